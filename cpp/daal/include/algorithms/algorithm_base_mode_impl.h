@@ -30,6 +30,7 @@
 #include "services/internal/daal_kernel_defines.h"
 
 #include "services/host_app.h"
+#include "services/threading_context.h"
 
 namespace daal
 {
@@ -103,7 +104,7 @@ public:
         }
 
         s = setupFinalizeCompute();
-        if (s) s |= this->_ac->finalizeCompute();
+        if (s) s |= runFinalizeCompute();
         if (resetFinalizeFlag) s |= resetFinalizeCompute();
         return s;
     }
@@ -210,7 +211,22 @@ public:
     */
     void setHostApp(const services::HostAppIfacePtr & pHost);
 
+    /**
+    * Returns threading context used by the class
+    * \return Threading context used by the class
+    */
+    services::ThreadingContextPtr threadingContext();
+
+    /**
+    * Sets threading context to be used by the class. The subsequent computations run in the task arena
+    * of the context using at most ThreadingContext::getMaxThreads() threads
+    * \param pContext Threading context to be used by the class
+    */
+    void setThreadingContext(const services::ThreadingContextPtr & pContext);
+
 private:
+    services::Status runFinalizeCompute();
+
     bool wasSetup;
     bool resetFlag;
     bool wasFinalizeSetup;
@@ -308,6 +324,19 @@ public:
     */
     void setHostApp(const services::HostAppIfacePtr & pHost);
 
+    /**
+    * Returns threading context used by the class
+    * \return Threading context used by the class
+    */
+    services::ThreadingContextPtr threadingContext();
+
+    /**
+    * Sets threading context to be used by the class. The subsequent computations run in the task arena
+    * of the context using at most ThreadingContext::getMaxThreads() threads
+    * \param pContext Threading context to be used by the class
+    */
+    void setThreadingContext(const services::ThreadingContextPtr & pContext);
+
 private:
     bool wasSetup;
     bool resetFlag;
@@ -50,6 +50,8 @@ namespace association_rules
 enum Method
 {
     apriori      = 0, /*!< Apriori method */
+    eclat        = 1, /*!< Eclat method: support of item sets is counted over vertical transaction bit sets,
+                           the item sets are mined in parallel over the prefix classes */
     defaultDense = 0  /*!< Apriori default method */
 };
 
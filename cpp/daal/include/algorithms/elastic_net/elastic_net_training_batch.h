@@ -39,7 +39,7 @@ namespace elastic_net
 {
 namespace training
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup elastic_net_batch Batch
@@ -180,10 +180,10 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface1
+} // namespace interface2
 
-using interface1::BatchContainer;
-using interface1::Batch;
+using interface2::BatchContainer;
+using interface2::Batch;
 
 } // namespace training
 } // namespace elastic_net
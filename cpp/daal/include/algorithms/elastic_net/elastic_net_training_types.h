@@ -117,7 +117,8 @@ enum ResultId
 enum OptionalResultNumericTableId
 {
     gramMatrixId             = lastResultId + 1, /*!< Numeric table of size: p x p, containing computed Gram matrix */
-    lastResultNumericTableId = gramMatrixId
+    betaPathId               = gramMatrixId + 1, /*!< Numeric table of size: nPenalties x (k * (p + 1)), containing the regularization path */
+    lastResultNumericTableId = betaPathId
 };
 
 /**
@@ -139,7 +140,7 @@ namespace interface1
  * \brief Parameters for the elastic net algorithm
  *
  */
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 struct DAAL_EXPORT Parameter : public linear_model::Parameter
 {
     typedef optimization_solver::iterative_solver::BatchPtr SolverPtr;
@@ -164,7 +165,7 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
     DataUseInComputation dataUseInComputation; /*!< The flag allows to corrupt input data */
     DAAL_UINT64 optResultToCompute;            /*!< 64 bit integer flag that indicates the optional results to compute */
 };
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__TRAINING__INPUTIFACE"></a>
@@ -339,9 +340,36 @@ typedef services::SharedPtr<Result> ResultPtr;
 typedef services::SharedPtr<const Result> ResultConstPtr;
 } // namespace interface1
 
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__ELASTIC_NET__TRAINPARAMETER"></a>
+ * \brief Parameters for the elastic net algorithm
+ *
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    Parameter(const SolverPtr & solver = SolverPtr());
+    Parameter(const Parameter & o) : interface1::Parameter(o), penaltyL1Path(o.penaltyL1Path) {}
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    data_management::NumericTablePtr penaltyL1Path; /*!< Numeric table of size nPenalties x 1 or nPenalties x k that contains
+                                                         the decreasing sequence of L1 parameters. If set, the model is trained
+                                                         for each row of the table starting from the solution for the previous row.
+                                                         penaltyL1 is not used then, the path is trained with the coordinate descent
+                                                         that takes only nIterations and accuracyThreshold of optimizationSolver */
+};
+/* [Parameter source code] */
+} // namespace interface2
+
 using interface1::InputIface;
 using interface1::Input;
-using interface1::Parameter;
+using interface2::Parameter;
 
 using interface1::Result;
 using interface1::ResultPtr;
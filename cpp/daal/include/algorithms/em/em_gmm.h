@@ -35,7 +35,7 @@ namespace algorithms
 {
 namespace em_gmm
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup em_gmm_batch Batch
@@ -152,9 +152,9 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface1
-using interface1::BatchContainer;
-using interface1::Batch;
+} // namespace interface2
+using interface2::BatchContainer;
+using interface2::Batch;
 
 } // namespace em_gmm
 } // namespace algorithms
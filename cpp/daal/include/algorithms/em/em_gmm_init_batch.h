@@ -37,7 +37,7 @@ namespace em_gmm
 {
 namespace init
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup em_gmm_init_batch Batch
@@ -154,9 +154,9 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface1
-using interface1::BatchContainer;
-using interface1::Batch;
+} // namespace interface2
+using interface2::BatchContainer;
+using interface2::Batch;
 
 } // namespace init
 } // namespace em_gmm
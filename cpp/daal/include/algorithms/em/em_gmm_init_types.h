@@ -252,7 +252,46 @@ typedef services::SharedPtr<daal::algorithms::em_gmm::init::interface1::Result>
 /** @} */
 /** @} */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__EM_GMM__INIT__PARAMETER"></a>
+ * \brief %Parameter for the computation of initial values for the EM for GMM algorithm
+ *
+ * \snippet em/em_gmm_init_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     * Constructs parameters of the EM for GMM algorithm
+     * \param[in] nComponents        Number of components in the Gaussian mixture model
+     * \param[in] nTrials            Number of trials of short EM runs
+     * \param[in] nIterations        Number of iterations in every short EM run
+     * \param[in] seed               Seed for randomly generating data points to start the initialization of short EM
+     * \param[in] accuracyThreshold  Threshold for the termination of the algorithm
+     * \param[in] covarianceStorage  Type of covariance in the Gaussian mixture model
+     */
+    Parameter(size_t nComponents, size_t nTrials = 20, size_t nIterations = 10, size_t seed = 777, double accuracyThreshold = 1.0e-04,
+              em_gmm::CovarianceStorageId covarianceStorage = em_gmm::full);
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual services::Status check() const;
+
+    size_t nWarmUpIterations; /*!< Number of iterations of short EM runs after which the losing trials are abandoned, zero means no abandoning */
+    double abandonTolerance;  /*!< Relative gap between the log-likelihood of a trial and the best log-likelihood to abandon the trial */
+};
+/* [Parameter source code] */
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
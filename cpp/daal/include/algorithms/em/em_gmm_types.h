@@ -299,7 +299,49 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__EM_GMM__PARAMETER"></a>
+ * \brief %Parameter for the EM for GMM algorithm
+ *
+ * \snippet em/em_gmm_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     * Constructs the parameter of EM for GMM algorithm
+     * \param[in] nComponents              Number of components in the Gaussian mixture model
+     * \param[in] covariance               Pointer to the algorithm that computes the covariance
+     * \param[in] maxIterations            Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold        Threshold for the termination of the algorithm
+     * \param[in] regularizationFactor     Factor for covariance regularization in case of ill-conditional data
+     * \param[in] covarianceStorage        Type of covariance in the Gaussian mixture model.
+     */
+    Parameter(const size_t nComponents, const services::SharedPtr<covariance::BatchImpl> & covariance, const size_t maxIterations = 10,
+              const double accuracyThreshold = 1.0e-04, const double regularizationFactor = 0.01, const CovarianceStorageId covarianceStorage = full);
+
+    Parameter(const Parameter & other);
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual services::Status check() const;
+
+    size_t miniBatchSize;      /*!< Number of rows sampled at each iteration of the stochastic EM, zero means full EM */
+    double stepSizeDecay;      /*!< Decay of the step size of the stochastic EM, a number in the (0.5, 1] interval */
+    engines::EnginePtr engine; /*!< Engine used to sample the blocks of rows in the stochastic EM */
+};
+/* [Parameter source code] */
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
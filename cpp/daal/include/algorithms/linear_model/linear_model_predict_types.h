@@ -26,6 +26,7 @@
 
 #include "data_management/data/numeric_table.h"
 #include "algorithms/algorithm_types.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/linear_model/linear_model_model.h"
 #include "algorithms/regression/regression_predict_types.h"
 
@@ -75,6 +76,17 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__MODELCOLLECTIONINPUTID"></a>
+ * \brief Available identifiers of input collections of models for making the regression model-based prediction
+ */
+enum ModelCollectionInputId
+{
+    models                     = lastModelInputId + 1, /*!< Collection of the linear, ridge or logistic regression models trained
+                                                            on the same features. If set, the model input is not used */
+    lastModelCollectionInputId = models
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making the regression model-based prediction
@@ -129,6 +141,28 @@ public:
      */
     void set(ModelInputId id, const linear_model::ModelPtr & value);
 
+    /**
+     * Returns the collection of models for making the regression model-based prediction
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ModelCollectionInputId id) const;
+
+    /**
+     * Sets the collection of models for making the regression model-based prediction.
+     * The prediction contains the responses of all the models in the order of the models in the collection,
+     * the responses of logistic regression models are the values of the linear functions of the classes
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   %Input object
+     */
+    void set(ModelCollectionInputId id, const data_management::DataCollectionPtr & value);
+
+    /**
+     * Returns the number of responses computed for each observation
+     * \return Number of responses
+     */
+    size_t getNumberOfResponses() const;
+
     /**
      * Checks an input object for making the regression model-based prediction
      *
@@ -0,0 +1,130 @@
+/* file: linear_regression_training_out_of_core.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for linear regression model-based training
+//  on the data read from a data source in chunks
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_TRAINING_OUT_OF_CORE_H__
+#define __LINEAR_REGRESSION_TRAINING_OUT_OF_CORE_H__
+
+#include "data_management/data_source/data_source.h"
+#include "algorithms/linear_regression/linear_regression_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup linear_regression_out_of_core OutOfCore
+ * @ingroup linear_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__LINEAR_REGRESSION__TRAINING__OUTOFCOREPARAMETER"></a>
+ * \brief Parameters of linear regression model-based training on the data read from a data source in chunks
+ */
+struct DAAL_EXPORT OutOfCoreParameter : public linear_regression::Parameter
+{
+    /**
+     * Constructs the parameters of linear regression model-based training on the data read from a data source in chunks
+     * \param[in] nDependentVariables   Number of the last columns of the data source that contain the dependent variables
+     * \param[in] nRowsInChunk          Number of rows read from the data source at once
+     * \param[in] nChunksInSegment      Number of chunks accumulated in one partial result
+     */
+    OutOfCoreParameter(size_t nDependentVariables = 1, size_t nRowsInChunk = 10000, size_t nChunksInSegment = 16);
+
+    /**
+     * Checks the correctness of the parameters
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t nDependentVariables; /*!< Number of the last columns of the data source that contain the dependent variables */
+    size_t nRowsInChunk;        /*!< Number of rows read from the data source at once */
+    size_t nChunksInSegment;    /*!< Number of chunks accumulated in one partial result before the partial results are merged */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__TRAINING__OUTOFCORE"></a>
+ * \brief Provides methods for linear regression model-based training with the normal equations method
+ *        on the data set that is read from a data source in chunks of rows.
+ *        The next chunk is read in the background while the partial result is updated with the current one.
+ *        The chunks are accumulated in segments of OutOfCoreParameter::nChunksInSegment chunks, the partial results
+ *        of the segments are merged with compensated summation, so the single precision partial sums do not lose accuracy
+ *        with the number of the segments.
+ * <!-- \n<a href="DAAL-REF-LINEARREGRESSION-ALGORITHM">Linear regression algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for
+ *                          linear regression model-based training, double or float
+ *
+ * \par References
+ *      - \ref linear_regression::interface1::ModelNormEq "linear_regression::ModelNormEq" class
+ *      - \ref training::interface1::Online "training::Online" class
+ *      - \ref training::interface1::Distributed "training::Distributed" class
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT OutOfCore
+{
+public:
+    typedef OutOfCoreParameter ParameterType;
+    typedef algorithms::linear_regression::training::Result ResultType;
+
+    ParameterType parameter; /*!< %Training \ref interface1::OutOfCoreParameter "parameters" */
+
+    /**
+     * Constructs the algorithm that reads the training data set from the data source.
+     * The data source must have a dictionary, the last parameter.nDependentVariables columns of the data source
+     * contain the dependent variables, the other ones contain the features.
+     * \param[in] dataSource    Data source to read the training data set from, it must stay alive until compute() returns
+     */
+    OutOfCore(data_management::DataSource & dataSource) : _dataSource(&dataSource) {}
+
+    /**
+     * Reads the whole data set from the data source and computes the result of linear regression model-based training
+     * \return Status of computations
+     */
+    services::Status compute();
+
+    /**
+     * Returns the structure that contains the result of linear regression model-based training
+     * \return Structure that contains the result of linear regression model-based training
+     */
+    ResultPtr getResult() { return _result; }
+
+private:
+    data_management::DataSource * _dataSource;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OutOfCoreParameter;
+using interface1::OutOfCore;
+
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -118,9 +118,9 @@ struct DAAL_EXPORT ParameterBase : public daal::algorithms::classifier::Paramete
  * <a name="DAAL-STRUCT-ALGORITHMS__MULTI_CLASS_CLASSIFIER__PARAMETER"></a>
  * \brief Optional multi-class classifier algorithm  parameters that are used with the MultiClassClassifierWu prediction method
  *
- * \snippet multi_class_classifier/multi_class_classifier_model.h Parameter source code
+ * \snippet multi_class_classifier/multi_class_classifier_model.h interface2::Parameter source code
  */
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 struct DAAL_EXPORT Parameter : public ParameterBase
 {
     Parameter(size_t nClasses, size_t maxIterations = 100, double accuracyThreshold = 1.0e-12)
@@ -132,10 +132,35 @@ struct DAAL_EXPORT Parameter : public ParameterBase
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 } // namespace interface2
+
+/**
+ * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__MULTI_CLASS_CLASSIFIER__PARAMETER"></a>
+ * \brief Optional multi-class classifier algorithm  parameters that are used with the MultiClassClassifierWu prediction method
+ *
+ * \snippet multi_class_classifier/multi_class_classifier_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    Parameter(size_t nClasses, size_t maxIterations = 100, double accuracyThreshold = 1.0e-12)
+        : interface2::Parameter(nClasses, maxIterations, accuracyThreshold), sharedCacheSize(0)
+    {}
+
+    size_t sharedCacheSize; /*!< Size of cache in bytes to store values of the kernel matrix shared by the two-class SVM classifiers.
+                                 A non-zero value enables training of the two-class SVM classifiers on the row indices
+                                 of the training data set instead of the copies of the data */
+};
+/* [Parameter source code] */
+} // namespace interface3
 using interface2::ParameterBase;
-using interface2::Parameter;
+using interface3::Parameter;
 
 namespace interface1
 {
@@ -257,7 +257,7 @@ public:
     typedef classifier::prediction::Batch super;
 
     typedef algorithms::multi_class_classifier::prediction::Input InputType;
-    typedef algorithms::multi_class_classifier::Parameter ParameterType;
+    typedef algorithms::multi_class_classifier::interface2::Parameter ParameterType;
     typedef typename super::ResultType ResultType;
 
     InputType input;         /*!< Input objects of the algorithm */
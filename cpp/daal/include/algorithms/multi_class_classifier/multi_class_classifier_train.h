@@ -205,6 +205,159 @@ private:
  */
 namespace interface2
 {
+/**
+ * @ingroup multi_class_classifier_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_CLASS_CLASSIFIER__TRAINING__BATCHCONTAINER"></a>
+ *  \brief Class containing methods to compute the results of multi-class classifier model-based training
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-class classifier, double or float
+ * \tparam method           Computation method of the algprithm, \ref daal::algorithms::multi_class_classifier::training::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for multi-class classifier model-based training with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of multi-class classifier model-based training in the batch processing mode
+     *
+     * \return Status of computation
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_CLASS_CLASSIFIER__TRAINING__BATCH"></a>
+ * \brief Algorithm for the multi-class classifier model training
+ * <!-- \n<a href="DAAL-REF-MULTICLASSCLASSIFIER-ALGORITHM">Multi-class classifier algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the multi-class classifier training algorithm, double or float
+ * \tparam method           Computation method for the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Multi-class classifier training methods
+ *      - \ref classifier::training::InputId  Identifiers of input objects for the multi-class classifier algprithm
+ *      - \ref classifier::training::ResultId Identifiers of multi-class classifier training results
+ *
+ * \par References
+ *      - \ref interface1::Model "Model" class
+ *      - \ref classifier::training::interface1::Input "classifier::training::Input" class
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = oneAgainstOne>
+class DAAL_EXPORT Batch : public classifier::training::Batch
+{
+public:
+    typedef classifier::training::Batch super;
+
+    typedef typename super::InputType InputType;
+    typedef algorithms::multi_class_classifier::interface2::Parameter ParameterType;
+    typedef algorithms::multi_class_classifier::training::Result ResultType;
+
+    ParameterType parameter; /*!< \ref interface2::Parameter "Parameters" of the algorithm */
+    InputType input;         /*!< %Input objects of the algorithm */
+
+    /**
+     * Default constructor
+     * \DAAL_DEPRECATED
+     */
+    DAAL_DEPRECATED Batch() : parameter(0) { initialize(); }
+
+    /**
+     * Default constructor
+     * \param[in] nClasses                         Number of classes
+     */
+    Batch(size_t nClasses) : parameter(nClasses) { initialize(); }
+
+    /**
+     * Constructs multi-class classifier training algorithm by copying input objects and parameters
+     * of another multi-class classifier training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> & other) : classifier::training::Batch(other), parameter(other.parameter), input(other.input)
+    {
+        initialize();
+    }
+
+    ~Batch() {}
+
+    /**
+     * Get input objects for the multi-class classifier training algorithm
+     * \return %Input objects for the multi-class classifier training algorithm
+     */
+    InputType * getInput() DAAL_C11_OVERRIDE { return &input; }
+
+    /**
+     * Returns method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the training results of the multi-class classifier algorithm
+     * \return Structure that contains the training results of the multi-class classifier algorithm
+     */
+    ResultPtr getResult() { return ResultType::cast(_result); }
+
+    /**
+     * Resets the training results of the classification algorithm
+     */
+    services::Status resetResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new ResultType());
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        _res = NULL;
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated multi-class classifier training algorithm
+     * with a copy of input objects and parameters of this multi-class classifier training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        ResultPtr res = getResult();
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        services::Status s = res->template allocate<algorithmFPType>(&input, _par, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+
+private:
+    Batch & operator=(const Batch &);
+};
+/** @} */
+} // namespace interface2
+
+/**
+ * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
 /**
  * @defgroup multi_class_classifier_training_batch Batch
  * @ingroup multi_class_classifier_training
@@ -264,7 +417,7 @@ public:
     typedef algorithms::multi_class_classifier::Parameter ParameterType;
     typedef algorithms::multi_class_classifier::training::Result ResultType;
 
-    ParameterType parameter; /*!< \ref interface1::Parameter "Parameters" of the algorithm */
+    ParameterType parameter; /*!< \ref interface3::Parameter "Parameters" of the algorithm */
     InputType input;         /*!< %Input objects of the algorithm */
 
     /**
@@ -352,9 +505,9 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface2
-using interface2::BatchContainer;
-using interface2::Batch;
+} // namespace interface3
+using interface3::BatchContainer;
+using interface3::Batch;
 
 } // namespace training
 } // namespace multi_class_classifier
@@ -75,9 +75,9 @@ namespace interface1
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__PARAMETER"></a>
  * \brief %Parameter base class for the Coordinate descent algorithm
  *
- * \snippet optimization_solver/coordinate_descent/coordinate_descent_types.h Parameter source code
+ * \snippet optimization_solver/coordinate_descent/coordinate_descent_types.h interface1::Parameter source code
  */
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Parameter
 {
     /**
@@ -107,7 +107,7 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
     bool positive;
     bool skipTheFirstComponents;
 };
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__INPUT"></a>
@@ -183,7 +183,54 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 /** @} */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * @ingroup coordinate_descent
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__PARAMETER"></a>
+ * \brief %Parameter base class for the Coordinate descent algorithm
+ *
+ * \snippet optimization_solver/coordinate_descent/coordinate_descent_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     * Constructs the parameter base class of the Coordinate descent algorithm
+     * \param[in] function                 Objective function represented as sum of functions
+     * \param[in] nIterations              Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold        Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] seed                     Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05, size_t seed = 777);
+
+    /**
+     * Constructs the parameter of the Coordinate descent algorithm from the parameter of the previous interface,
+     * the coordinates are updated sequentially
+     * \param[in] other    Parameter of the previous interface
+     */
+    Parameter(const interface1::Parameter & other);
+
+    virtual ~Parameter() {}
+
+    size_t nParallelCoordinates; /*!< Number of coordinates updated concurrently in one round of the parallel coordinate descent.
+                                      The features are split into this number of disjoint blocks, each block updates one coordinate
+                                      per round. Applied to the mean squared error objective function without weights and batch
+                                      indices. Values 0 and 1 select the sequential coordinate descent. Default is 1 */
+    bool safeParallelUpdates;    /*!< If true, the merged update of every round of the parallel coordinate descent is scaled
+                                      so that the objective function does not increase. Default is true */
+};
+/* [Parameter source code] */
+/** @} */
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
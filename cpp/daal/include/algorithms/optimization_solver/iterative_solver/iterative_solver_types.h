@@ -32,6 +32,19 @@
 
 namespace daal
 {
+namespace preview
+{
+namespace services
+{
+namespace interface1
+{
+/* Declared in services/communicator.h, the solvers hold it by pointer, so that their headers do not depend on the communication layer */
+class Communicator;
+} // namespace interface1
+using interface1::Communicator;
+} // namespace services
+} // namespace preview
+
 namespace algorithms
 {
 namespace optimization_solver
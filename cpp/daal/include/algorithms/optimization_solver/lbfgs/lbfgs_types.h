@@ -250,9 +250,9 @@ namespace interface2
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__LBFGS__PARAMETER"></a>
  * \brief %Parameter class for LBFGS algorithm
  *
- * \snippet optimization_solver/lbfgs/lbfgs_types.h Parameter source code
+ * \snippet optimization_solver/lbfgs/lbfgs_types.h interface2::Parameter source code
  */
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Parameter
 {
     /**
@@ -296,7 +296,7 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
     */
     virtual services::Status check() const DAAL_C11_OVERRIDE;
 };
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__LBFGS__INPUT"></a>
@@ -395,7 +395,56 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 /** @} */
 } // namespace interface2
-using interface2::Parameter;
+
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * @ingroup lbfgs
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__LBFGS__PARAMETER"></a>
+ * \brief %Parameter class for LBFGS algorithm
+ *
+ * \snippet optimization_solver/lbfgs/lbfgs_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /**
+     * Constructs the parameters of LBFGS algorithm
+     * \param[in] function                  Objective function that can be represented as sum
+     * \param[in] nIterations               Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold         Accuracy of the LBFGS algorithm
+     * \param[in] batchSize                 Number of observations to compute the stochastic gradient
+     * \param[in] correctionPairBatchSize_  The number of observations to compute the sub-sampled Hessian for correction pairs computation
+     * \param[in] m                         Memory parameter of LBFGS
+     * \param[in] L                         The number of iterations between the curvature estimates calculations
+     * \param[in] seed                      Seed for random choosing terms from objective function \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(sum_of_functions::BatchPtr function = sum_of_functions::BatchPtr(), size_t nIterations = 100, double accuracyThreshold = 1.0e-5,
+              size_t batchSize = 10, size_t correctionPairBatchSize_ = 100, size_t m = 10, size_t L = 10, size_t seed = 777);
+
+    /**
+     * Constructs the parameters of LBFGS algorithm from the parameters of the previous interface, a single rank runs
+     * \param[in] other    Parameters of the previous interface
+     */
+    Parameter(const interface2::Parameter & other);
+
+    virtual ~Parameter() {}
+
+    /** Communicator between the ranks that hold the parts of the data set, declared in services/communicator.h.
+        If it contains more than one rank, the values, the gradients and the Hessians computed by the ranks on their local terms
+        are averaged over all ranks. All ranks must use the same start point and the same parameters. If not set, a single rank runs */
+    services::SharedPtr<daal::preview::services::Communicator> communicator;
+};
+/* [Parameter source code] */
+/** @} */
+} // namespace interface3
+using interface3::Parameter;
 using interface2::Input;
 using interface2::Result;
 using interface2::ResultPtr;
@@ -0,0 +1,184 @@
+/* file: newton_cg_types.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Newton conjugate gradient algorithm types.
+//--
+*/
+
+#ifndef __NEWTON_CG_TYPES_H__
+#define __NEWTON_CG_TYPES_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+/**
+ * @defgroup newton_cg Newton Conjugate Gradient Algorithm
+ * \copydoc daal::algorithms::optimization_solver::newton_cg
+ * @ingroup optimization_solver
+ * @{
+ */
+/**
+ * \brief Contains classes for computing the Newton conjugate gradient (truncated Newton) algorithm
+ */
+namespace newton_cg
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__METHOD"></a>
+ * Available methods for computing the Newton conjugate gradient algorithm
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default: performance-oriented method */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__PARAMETER"></a>
+ * \brief %Parameter base class for the Newton conjugate gradient algorithm
+ *
+ * \snippet optimization_solver/newton_cg/newton_cg_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Parameter
+{
+    /**
+     * Constructs the parameter base class of the Newton conjugate gradient algorithm
+     * \param[in] function            Objective function represented as sum of functions. The function must compute
+     *                                the hessian-vector product, see objective_function::hessianVectorProduct
+     * \param[in] nIterations         Maximal number of the Newton iterations of the algorithm
+     * \param[in] accuracyThreshold   Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] nCGIterations       Maximal number of the conjugate gradient iterations in one Newton iteration
+     * \param[in] cgAccuracyThreshold Upper bound of the relative accuracy of the conjugate gradient iterations
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              size_t nCGIterations = 50, double cgAccuracyThreshold = 0.5);
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t nCGIterations;       /*!< Maximal number of the conjugate gradient iterations that solve the Newton system
+                                     in one Newton iteration. Default is 50 */
+    double cgAccuracyThreshold; /*!< The conjugate gradient iterations stop when the norm of the residual of the Newton system
+                                     is below min(cgAccuracyThreshold, sqrt(|gradient|)) * |gradient|. Must be in (0, 1).
+                                     Default is 0.5 */
+};
+/* [Parameter source code] */
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__INPUT"></a>
+* \brief %Input class for the Newton conjugate gradient algorithm
+*
+* \snippet optimization_solver/newton_cg/newton_cg_types.h Input source code
+*/
+/* [Input source code] */
+class DAAL_EXPORT Input : public optimization_solver::iterative_solver::Input
+{
+private:
+    typedef optimization_solver::iterative_solver::Input super;
+
+public:
+    Input();
+    Input(const Input & other);
+
+    using super::set;
+    using super::get;
+
+    /**
+    * Checks the correctness of the input
+    * \param[in] par       Pointer to the structure of the algorithm parameters
+    * \param[in] method    Computation method
+    *
+     * \return Status of computations
+    */
+    virtual services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+/* [Input source code] */
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__RESULT"></a>
+* \brief Results obtained with the compute() method of the Newton conjugate gradient algorithm in the batch processing mode
+*/
+class DAAL_EXPORT Result : public optimization_solver::iterative_solver::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    typedef optimization_solver::iterative_solver::Result super;
+
+    Result() {}
+    using super::set;
+    using super::get;
+
+    /**
+    * Allocates memory to store the results of the iterative solver algorithm
+    * \param[in] input  Pointer to the input structure
+    * \param[in] par    Pointer to the parameter structure
+    * \param[in] method Computation method of the algorithm
+    *
+     * \return Status of computations
+    */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method);
+
+    /**
+    * Checks the result of the iterative solver algorithm
+    * \param[in] input   %Input of algorithm
+    * \param[in] par     %Parameter of algorithm
+    * \param[in] method  Computation method of the algorithm
+    *
+     * \return Status of computations
+    */
+    virtual services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using daal::algorithms::interface1::Result::check;
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/* [Result source code] */
+
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+#endif
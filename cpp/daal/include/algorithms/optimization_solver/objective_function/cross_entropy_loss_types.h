@@ -170,10 +170,10 @@ namespace interface2
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__CROSS_ENTROPY__PARAMETER"></a>
  * \brief %Parameter for Cross-entropy loss objective function
  *
- * \snippet optimization_solver/objective_function/cross_entropy_loss_types.h Parameter source code
+ * \snippet optimization_solver/objective_function/cross_entropy_loss_types.h interface2::Parameter source code
  */
-/* [Parameter source code] */
-struct DAAL_EXPORT Parameter : public sum_of_functions::Parameter
+/* [interface2::Parameter source code] */
+struct DAAL_EXPORT Parameter : public sum_of_functions::interface2::Parameter
 {
     /**
      * Constructs the parameter of Cross-entropy loss objective function
@@ -247,9 +247,58 @@ public:
      */
     services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 };
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 } // namespace interface2
-using interface2::Parameter;
+
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__CROSS_ENTROPY__PARAMETER"></a>
+ * \brief %Parameter for Cross-entropy loss objective function
+ *
+ * \snippet optimization_solver/objective_function/cross_entropy_loss_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public sum_of_functions::Parameter
+{
+    /**
+     * Constructs the parameter of Cross-entropy loss objective function
+     * \param[in] nClasses         The number of different values of dependent variable
+     * \param[in] numberOfTerms    The number of terms in the function
+     * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                                   a batch of indices used to compute the function results, e.g.,
+                                   value of the sum of the functions. If no indices are provided,
+                                   all terms will be used in the computations.
+     * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+     */
+    Parameter(size_t nClasses, size_t numberOfTerms, data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+              const DAAL_UINT64 resultsToCompute = objective_function::gradient);
+
+    /**
+     * Constructs an Parameter by copying input objects and parameters of another Parameter
+     * \param[in] other An object to be used as the source to initialize object
+     */
+    Parameter(const Parameter & other);
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    bool interceptFlag; /*!< Whether the intercept needs to be computed. Default is true */
+    float penaltyL1;    /*!< L1 regularization coefficient. Default is 0 (not applied) */
+    float penaltyL2;    /*!< L2 regularization coefficient. Default is 0 (not applied) */
+    size_t nClasses;    /*!< Number of classes (different values of dependent variable) */
+};
+/* [Parameter source code] */
+} // namespace interface3
+using interface3::Parameter;
 using interface2::Input;
 
 } // namespace cross_entropy_loss
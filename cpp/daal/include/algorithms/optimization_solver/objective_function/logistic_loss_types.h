@@ -167,10 +167,10 @@ namespace interface2
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__MSE__PARAMETER"></a>
  * \brief %Parameter for Logistic loss objective function
  *
- * \snippet optimization_solver/objective_function/logistic_loss_types.h Parameter source code
+ * \snippet optimization_solver/objective_function/logistic_loss_types.h interface2::Parameter source code
  */
-/* [Parameter source code] */
-struct DAAL_EXPORT Parameter : public sum_of_functions::Parameter
+/* [interface2::Parameter source code] */
+struct DAAL_EXPORT Parameter : public sum_of_functions::interface2::Parameter
 {
     /**
      * Constructs the parameter of Logistic loss objective function
@@ -202,7 +202,7 @@ struct DAAL_EXPORT Parameter : public sum_of_functions::Parameter
     float penaltyL1;    /*!< L1 regularization coefficient. Default is 0 (not applied) */
     float penaltyL2;    /*!< L2 regularization coefficient. Default is 0 (not applied) */
 };
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__MSE__INPUT"></a>
@@ -245,7 +245,54 @@ public:
 };
 /** @} */
 } // namespace interface2
-using interface2::Parameter;
+
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__LOGISTIC_LOSS__PARAMETER"></a>
+ * \brief %Parameter for Logistic loss objective function
+ *
+ * \snippet optimization_solver/objective_function/logistic_loss_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public sum_of_functions::Parameter
+{
+    /**
+     * Constructs the parameter of Logistic loss objective function
+     * \param[in] numberOfTerms    The number of terms in the function
+     * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                                   a batch of indices used to compute the function results, e.g.,
+                                   value of the sum of the functions. If no indices are provided,
+                                   all terms will be used in the computations.
+     * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+     */
+    Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+              const DAAL_UINT64 resultsToCompute = objective_function::gradient);
+
+    /**
+     * Constructs an Parameter by copying input objects and parameters of another Parameter
+     * \param[in] other An object to be used as the source to initialize object
+     */
+    Parameter(const Parameter & other);
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    bool interceptFlag; /*!< Whether the intercept needs to be computed. Default is true */
+    float penaltyL1;    /*!< L1 regularization coefficient. Default is 0 (not applied) */
+    float penaltyL2;    /*!< L2 regularization coefficient. Default is 0 (not applied) */
+};
+/* [Parameter source code] */
+} // namespace interface3
+using interface3::Parameter;
 using interface2::Input;
 
 } // namespace logistic_loss
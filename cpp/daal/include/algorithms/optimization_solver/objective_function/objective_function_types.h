@@ -78,7 +78,9 @@ enum ResultToComputeId
     componentOfHessianDiagonal =
         0x00000080ULL, /*!< Numeric table of size 1 x nDependentVariable with the dioganal element of hession matrix over certain feature of the objective function in the given argument */
     componentOfProximalProjection =
-        0x00000100ULL /*!< Numeric table of size p x nDependentVariable with proximal projection of certain of the objective function in the given argument */
+        0x00000100ULL, /*!< Numeric table of size p x nDependentVariable with proximal projection of certain of the objective function in the given argument */
+    hessianVectorProduct =
+        0x00000200ULL /*!< Numeric table of size p x 1 with the product of the hessian in the given argument and the direction vector */
 };
 
 /**
@@ -96,7 +98,8 @@ enum ResultId
     componentOfGradientIdx,           /*!< Index of the componentOfGradient numeric table in the result collection */
     componentOfHessianDiagonalIdx,    /*!< Index of the componentOfHessianDiagonal numeric table in the result collection */
     componentOfProximalProjectionIdx, /*!< Index of the componentOfProximalProjection numeric table in the result collection */
-    lastResultId = componentOfProximalProjectionIdx
+    hessianVectorProductIdx,          /*!< Index of the hessianVectorProduct numeric table in the result collection */
+    lastResultId = hessianVectorProductIdx
 };
 
 /**
@@ -222,6 +225,12 @@ public:
                                    int method) const DAAL_C11_OVERRIDE;
 
 protected:
+    /**
+     * Constructs the result with the given number of the result objects
+     * \param[in] nElements    Number of the result objects
+     */
+    Result(const size_t nElements);
+
     using daal::algorithms::interface1::Result::check;
 
     template <typename Archive, bool onDeserialize>
@@ -233,10 +242,53 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__OBJECTIVE_FUNCTION__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the Objective function in the batch processing mode,
+ *        including the product of the hessian and the direction vector
+ */
+class DAAL_EXPORT Result : public interface1::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    /** Default constructor */
+    Result();
+
+    /** Destructor */
+    virtual ~Result() {};
+
+    /**
+    * Checks the result of the Objective function
+    * \param[in] input   %Input of the algorithm
+    * \param[in] par     %Parameter of algorithm
+    * \param[in] method  Computation method
+    *
+     * \return Status of computations
+    */
+    virtual services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using daal::algorithms::interface1::Result::check;
+
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+} // namespace interface2
 using interface1::Parameter;
 using interface1::Input;
-using interface1::Result;
-using interface1::ResultPtr;
+using interface2::Result;
+using interface2::ResultPtr;
 
 } // namespace objective_function
 } // namespace optimization_solver
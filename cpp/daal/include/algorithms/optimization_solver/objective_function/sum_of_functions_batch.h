@@ -144,7 +144,7 @@ public:
     typedef objective_function::Batch super;
 
     typedef algorithms::optimization_solver::sum_of_functions::Input InputType;
-    typedef algorithms::optimization_solver::sum_of_functions::Parameter ParameterType;
+    typedef algorithms::optimization_solver::sum_of_functions::interface2::Parameter ParameterType;
     typedef super::ResultType ResultType;
 
     /**
@@ -152,9 +152,9 @@ namespace interface2
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SUM_OF_FUNCTIONS__PARAMETER"></a>
  * \brief %Parameter for the Sum of functions
  *
- * \snippet optimization_solver/objective_function/sum_of_functions_types.h Parameter source code
+ * \snippet optimization_solver/objective_function/sum_of_functions_types.h interface2::Parameter source code
  */
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 struct DAAL_EXPORT Parameter : public objective_function::Parameter
 {
     /**
@@ -191,7 +191,7 @@ struct DAAL_EXPORT Parameter : public objective_function::Parameter
                                                                             all terms will be used in the computations.  */
     size_t featureId;                              /*!< The feature index to compute part of gradient/hessian/proximal projection */
 };
-/* [Parameter source code] */
+/* [interface2::Parameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__SUM_OF_FUNCTIONS__INPUT"></a>
@@ -235,7 +235,51 @@ public:
 
 } // namespace interface2
 
-using interface2::Parameter;
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SUM_OF_FUNCTIONS__PARAMETER"></a>
+ * \brief %Parameter for the Sum of functions
+ *
+ * \snippet optimization_solver/objective_function/sum_of_functions_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /**
+     * Constructs the parameter of Sum of functions
+     * \param[in] numberOfTerms    The number of terms in the function
+     * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                                   a batch of indices used to compute the function results, e.g.,
+                                   value of the sum of the functions. If no indices are provided,
+                                   all terms will be used in the computations.
+     * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+     */
+    Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+              const DAAL_UINT64 resultsToCompute = objective_function::gradient);
+
+    /**
+     * Constructs an Parameter by copying input objects and parameters of another Parameter
+     * \param[in] other An object to be used as the source to initialize object
+     */
+    Parameter(const Parameter & other);
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    data_management::NumericTablePtr hessianVectorDirection; /*!< Numeric table of size p x 1 with the vector the hessian is multiplied by
+                                                                  when objective_function::hessianVectorProduct is requested */
+};
+/* [Parameter source code] */
+} // namespace interface3
+
+using interface3::Parameter;
 using interface2::Input;
 
 } // namespace sum_of_functions
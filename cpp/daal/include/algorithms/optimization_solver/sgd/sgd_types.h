@@ -419,9 +419,9 @@ struct Parameter : public BaseParameter
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_DEFAULTDENSE"></a>
  * \brief %Parameter for the Stochastic gradient descent algorithm
  *
- * \snippet optimization_solver/sgd/sgd_types.h ParameterDefaultDense source code
+ * \snippet optimization_solver/sgd/sgd_types.h interface2::ParameterDefaultDense source code
  */
-/* [ParameterDefaultDense source code] */
+/* [interface2::ParameterDefaultDense source code] */
 template <>
 struct DAAL_EXPORT Parameter<defaultDense> : public BaseParameter
 {
@@ -449,15 +449,15 @@ struct DAAL_EXPORT Parameter<defaultDense> : public BaseParameter
 
     virtual ~Parameter() {}
 };
-/* [ParameterDefaultDense source code] */
+/* [interface2::ParameterDefaultDense source code] */
 
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_MINIBATCH"></a>
  * \brief %Parameter for the Stochastic gradient descent algorithm
  *
- * \snippet optimization_solver/sgd/sgd_types.h ParameterMiniBatch source code
+ * \snippet optimization_solver/sgd/sgd_types.h interface2::ParameterMiniBatch source code
  */
-/* [ParameterMiniBatch source code] */
+/* [interface2::ParameterMiniBatch source code] */
 template <>
 struct DAAL_EXPORT Parameter<miniBatch> : public BaseParameter
 {
@@ -497,16 +497,16 @@ struct DAAL_EXPORT Parameter<miniBatch> : public BaseParameter
     data_management::NumericTablePtr conservativeSequence; /*!< Numeric table of values of the conservative coefficient sequence */
     size_t innerNIterations;
 };
-/* [ParameterMiniBatch source code] */
+/* [interface2::ParameterMiniBatch source code] */
 /** @} */
 
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_MINIBATCH"></a>
  * \brief %Parameter for the Stochastic gradient descent algorithm
  *
- * \snippet optimization_solver/sgd/sgd_types.h ParameterMomentum source code
+ * \snippet optimization_solver/sgd/sgd_types.h interface2::ParameterMomentum source code
  */
-/* [ParameterMomentum source code] */
+/* [interface2::ParameterMomentum source code] */
 template <>
 struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 {
@@ -541,7 +541,7 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 
     double momentum; /*!< Momentum value */
 };
-/* [ParameterMomentum source code] */
+/* [interface2::ParameterMomentum source code] */
 /** @} */
 
 /**
@@ -645,8 +645,148 @@ typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 
 } // namespace interface2
+
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * @ingroup sgd
+ * @{
+ */
+template <Method method>
+struct Parameter : public interface2::Parameter<method>
+{};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_DEFAULTDENSE"></a>
+ * \brief %Parameter for the Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterDefaultDense source code
+ */
+/* [ParameterDefaultDense source code] */
+template <>
+struct DAAL_EXPORT Parameter<defaultDense> : public interface2::Parameter<defaultDense>
+{
+    /**
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices are
+                                       provided, the implementation will generate random indices.
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              data_management::NumericTablePtr batchIndices         = data_management::NumericTablePtr(),
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t seed = 777);
+
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm from the parameter of the previous interface
+     * \param[in] other    Parameter of the previous interface
+     */
+    Parameter(const interface2::Parameter<defaultDense> & other);
+
+    virtual ~Parameter() {}
+};
+/* [ParameterDefaultDense source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_MINIBATCH"></a>
+ * \brief %Parameter for the Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterMiniBatch source code
+ */
+/* [ParameterMiniBatch source code] */
+template <>
+struct DAAL_EXPORT Parameter<miniBatch> : public interface2::Parameter<miniBatch>
+{
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, the implementation will generate random indices.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient. If batchSize is equal to the number of terms
+                                       in objective function then no random sampling is performed, and all terms are used to calculate the gradient.
+                                       This parameter is ignored if batchIndices is provided.
+     * \param[in] conservativeSequence Numeric table of values of the conservative coefficient sequence
+     * \param[in] innerNIterations     Number of inner iterations
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), size_t batchSize = 128,
+              data_management::NumericTablePtr conservativeSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t innerNIterations                               = 5,
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t seed = 777);
+
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm from the parameter of the previous interface,
+     * a single rank runs
+     * \param[in] other    Parameter of the previous interface
+     */
+    Parameter(const interface2::Parameter<miniBatch> & other);
+
+    virtual ~Parameter() {}
+
+    /** Communicator between the ranks that hold the parts of the data set, declared in services/communicator.h.
+        If it contains more than one rank, the gradients computed by the ranks on their local batches are averaged over all ranks
+        at each iteration. All ranks must use the same start point and the same number of iterations. If not set, a single rank runs */
+    services::SharedPtr<daal::preview::services::Communicator> communicator;
+};
+/* [ParameterMiniBatch source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_MOMENTUM"></a>
+ * \brief %Parameter for the Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterMomentum source code
+ */
+/* [ParameterMomentum source code] */
+template <>
+struct DAAL_EXPORT Parameter<momentum> : public interface2::Parameter<momentum>
+{
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] momentum             The momentum value
+     * \param[in] nIterations          Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, the implementation will generate random indices.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient. If batchSize is equal to the number of terms
+                                       in objective function then no random sampling is performed, and all terms are used to calculate the gradient.
+                                       This parameter is ignored if batchIndices is provided.
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, double momentum = 0.9, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), size_t batchSize = 128,
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t seed = 777);
+
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm from the parameter of the previous interface
+     * \param[in] other    Parameter of the previous interface
+     */
+    Parameter(const interface2::Parameter<sgd::momentum> & other);
+
+    virtual ~Parameter() {}
+};
+/* [ParameterMomentum source code] */
+/** @} */
+} // namespace interface3
 using interface2::BaseParameter;
-using interface2::Parameter;
+using interface3::Parameter;
 using interface2::Input;
 using interface2::Result;
 using interface2::ResultPtr;
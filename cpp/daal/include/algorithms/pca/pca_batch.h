@@ -36,10 +36,10 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 /**
-    * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+    * \brief Contains version 4.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
     */
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHCONTAINER"></a>
@@ -183,9 +183,9 @@ private:
 };
 
 /** @} */
-} // namespace interface3
-using interface3::BatchContainer;
-using interface3::Batch;
+} // namespace interface4
+using interface4::BatchContainer;
+using interface4::Batch;
 
 } // namespace pca
 } // namespace algorithms
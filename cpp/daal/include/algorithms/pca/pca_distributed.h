@@ -38,7 +38,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup pca_distributed Distributed
@@ -149,7 +149,7 @@ public:
  *      - \ref Method  Computation methods for the algorithm
  *
  * \par References
- *      - \ref interface1::DistributedParameter class
+ *      - \ref interface2::DistributedParameter class
  */
 template <ComputeStep computeStep, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = correlationDense>
 class DAAL_EXPORT Distributed : public Analysis<distributed>
@@ -167,7 +167,7 @@ class DAAL_EXPORT Distributed : public Analysis<distributed>
  *      - \ref Method  Computation methods for the algorithm
  *
  * \par References
- *      - \ref interface1::DistributedParameter class
+ *      - \ref interface2::DistributedParameter class
  */
 template <typename algorithmFPType, Method method>
 class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Online<algorithmFPType, method>
@@ -460,9 +460,9 @@ private:
     Distributed & operator=(const Distributed &);
 };
 /** @} */
-} // namespace interface1
-using interface1::DistributedContainer;
-using interface1::Distributed;
+} // namespace interface2
+using interface2::DistributedContainer;
+using interface2::Distributed;
 
 } // namespace pca
 } // namespace algorithms
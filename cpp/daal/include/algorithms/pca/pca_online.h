@@ -36,7 +36,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup pca_online Online
@@ -365,9 +365,9 @@ private:
     Online & operator=(const Online &);
 };
 /** @} */
-} // namespace interface1
-using interface1::OnlineContainer;
-using interface1::Online;
+} // namespace interface2
+using interface2::OnlineContainer;
+using interface2::Online;
 
 } // namespace pca
 } // namespace algorithms
@@ -32,6 +32,7 @@
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/engines/engine.h"
 
 namespace daal
 {
@@ -59,6 +60,17 @@ enum Method
     svdDense         = 1  /*!< PCA SVD method */
 };
 
+/**
+    * <a name="DAAL-ENUM-ALGORITHMS__PCA__EIGENSOLVERMETHOD"></a>
+    * Available methods for solving the eigenproblem of the correlation matrix in the PCA Correlation method
+    */
+enum EigenSolverMethod
+{
+    fullEigenSolver       = 0, /*!< Full eigendecomposition of the correlation matrix */
+    randomizedEigenSolver = 1  /*!< Randomized range finder with power iterations (Halko, Martinsson, Tropp) that computes
+                                    only the leading eigenpairs */
+};
+
 /**
     * <a name="DAAL-ENUM-ALGORITHMS__PCA__INPUTDATASETID"></a>
     * Available identifiers of input dataset objects for the PCA algorithm
@@ -460,84 +472,6 @@ public:
     BaseParameter();
 };
 
-/**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER"></a>
-    * \brief Class that specifies the parameters of the PCA algorithm in the online computing mode
-    */
-template <typename algorithmFPType, Method method>
-class OnlineParameter : public BaseParameter<algorithmFPType, method>
-{};
-
-/**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
-    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the online computing mode
-    */
-template <typename algorithmFPType>
-class DAAL_EXPORT OnlineParameter<algorithmFPType, correlationDense> : public BaseParameter<algorithmFPType, correlationDense>
-{
-public:
-    /** Constructs PCA parameters */
-    OnlineParameter(const services::SharedPtr<covariance::OnlineImpl> & covarianceForOnlineParameter =
-                        services::SharedPtr<covariance::Online<algorithmFPType, covariance::defaultDense> >(
-                            new covariance::Online<algorithmFPType, covariance::defaultDense>()));
-
-    services::SharedPtr<covariance::OnlineImpl> covariance; /*!< Pointer to Online covariance */
-
-    /**
-    * Checks online parameter of the PCA correlation algorithm
-    * \return Errors detected while checking
-    */
-    services::Status check() const DAAL_C11_OVERRIDE;
-};
-
-/**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
-    * \brief Class that specifies the parameters of the PCA SVD algorithm in the online computing mode
-    */
-template <typename algorithmFPType>
-class DAAL_EXPORT OnlineParameter<algorithmFPType, svdDense> : public BaseParameter<algorithmFPType, svdDense>
-{
-public:
-    /** Constructs PCA parameters */
-    OnlineParameter();
-
-    /**
-    * Checks online parameter of the PCA SVD algorithm
-    * \return Errors detected while checking
-    */
-    services::Status check() const DAAL_C11_OVERRIDE;
-};
-
-/**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
-    * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
-    */
-template <ComputeStep step, typename algorithmFPType, Method method>
-class DistributedParameter : public BaseParameter<algorithmFPType, method>
-{};
-
-/**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP2MASTER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
-    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the distributed computing mode
-    */
-template <typename algorithmFPType>
-class DAAL_EXPORT DistributedParameter<step2Master, algorithmFPType, correlationDense> : public BaseParameter<algorithmFPType, correlationDense>
-{
-public:
-    /** Constructs PCA parameters */
-    DistributedParameter(const services::SharedPtr<covariance::DistributedIface<step2Master> > & covarianceForDistributedParameter =
-                             services::SharedPtr<covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense> >(
-                                 new covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense>()));
-
-    services::SharedPtr<covariance::DistributedIface<step2Master> > covariance; /*!< Pointer to Distributed covariance */
-
-    /**
-    * Checks distributed parameter of the PCA correlation algorithm
-    * \return Errors detected while checking
-    */
-    services::Status check() const DAAL_C11_OVERRIDE;
-};
-
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDINPUT"></a>
     * \brief Input objects for the PCA algorithm in the distributed processing mode
@@ -655,77 +589,142 @@ public:
 } // namespace interface1
 
 /**
-    * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+    * \brief Contains version 2.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
     */
-namespace interface3
+namespace interface2
 {
 /**
-* <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEBATCHPARAMETER"></a>
-* \brief Class that specifies the common parameters of the PCA Batch algorithms
-*/
-class DAAL_EXPORT BaseBatchParameter : public daal::algorithms::Parameter
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__EIGENSOLVERPARAMETER"></a>
+    * \brief Parameters of the solver of the correlation matrix eigenproblem used by the PCA Correlation method.
+    *        The randomized solver projects the p x p correlation matrix onto nComponents + nOversamples random directions,
+    *        refines the subspace with nPowerIterations passes and solves the small projected eigenproblem,
+    *        which replaces the O(p^3) eigendecomposition with a few p x p x (nComponents + nOversamples) matrix products
+    */
+class DAAL_EXPORT EigenSolverParameter
 {
 public:
-    /** Constructs PCA parameters */
-    BaseBatchParameter();
+    /** Constructs the parameters of the eigenproblem solver */
+    EigenSolverParameter();
 
-    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute */
-    size_t nComponents;           /*!< number of components for reduced implementation */
-    bool isDeterministic;         /*!< sign flip if required */
+    EigenSolverMethod method;  /*!< Method for solving the eigenproblem */
+    size_t nComponents;        /*!< Number of leading eigenpairs computed by the randomized solver in the online and distributed
+                                    processing modes. In the batch processing mode BaseBatchParameter::nComponents is used.
+                                    Zero means all the eigenpairs */
+    size_t nOversamples;       /*!< Number of additional random directions of the randomized range finder */
+    size_t nPowerIterations;   /*!< Number of power iterations of the randomized range finder */
+    engines::EnginePtr engine; /*!< Engine used to generate the random projection of the randomized solver.
+                                    If not set, the mt19937 engine with the default seed is created for each solve */
+
+    /**
+    * Checks the parameters of the eigenproblem solver
+    * \return Errors detected while checking
+    */
+    services::Status check() const;
 };
 
 /**
-* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER"></a>
-* \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
-*/
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER"></a>
+    * \brief Class that specifies the parameters of the PCA algorithm in the online computing mode
+    */
 template <typename algorithmFPType, Method method>
-class BatchParameter
+class OnlineParameter : public interface1::BaseParameter<algorithmFPType, method>
 {};
 
 /**
-    * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
-    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the batch computing mode
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the online computing mode
     */
 template <typename algorithmFPType>
-class DAAL_EXPORT BatchParameter<algorithmFPType, correlationDense> : public BaseBatchParameter
+class DAAL_EXPORT OnlineParameter<algorithmFPType, correlationDense> : public interface1::BaseParameter<algorithmFPType, correlationDense>
 {
 public:
     /** Constructs PCA parameters */
-    BatchParameter(const services::SharedPtr<covariance::BatchImpl> & covarianceForBatchParameter =
-                       services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >(
-                           new covariance::Batch<algorithmFPType, covariance::defaultDense>()));
+    OnlineParameter(const services::SharedPtr<covariance::OnlineImpl> & covarianceForOnlineParameter =
+                        services::SharedPtr<covariance::Online<algorithmFPType, covariance::defaultDense> >(
+                            new covariance::Online<algorithmFPType, covariance::defaultDense>()));
 
-    services::SharedPtr<covariance::BatchImpl> covariance; /*!< Pointer to batch covariance */
+    services::SharedPtr<covariance::OnlineImpl> covariance; /*!< Pointer to Online covariance */
+    EigenSolverParameter eigenSolver;                       /*!< Parameters of the correlation matrix eigenproblem solver */
 
     /**
-    * Checks batch parameter of the PCA correlation algorithm
+    * Checks online parameter of the PCA correlation algorithm
     * \return Errors detected while checking
     */
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
 /**
-* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
-* \brief Class that specifies the parameters of the PCA SVD algorithm in the batch computing mode
-*/
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA SVD algorithm in the online computing mode
+    */
 template <typename algorithmFPType>
-class DAAL_EXPORT BatchParameter<algorithmFPType, svdDense> : public BaseBatchParameter
+class DAAL_EXPORT OnlineParameter<algorithmFPType, svdDense> : public interface1::BaseParameter<algorithmFPType, svdDense>
 {
 public:
     /** Constructs PCA parameters */
-    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
-                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
-                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+    OnlineParameter();
 
-    services::SharedPtr<normalization::zscore::BatchImpl> normalization; /*!< Pointer to batch covariance */
+    /**
+    * Checks online parameter of the PCA SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
+    * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
+    */
+template <ComputeStep step, typename algorithmFPType, Method method>
+class DistributedParameter : public interface1::BaseParameter<algorithmFPType, method>
+{};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP2MASTER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the distributed computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT DistributedParameter<step2Master, algorithmFPType, correlationDense>
+    : public interface1::BaseParameter<algorithmFPType, correlationDense>
+{
+public:
+    /** Constructs PCA parameters */
+    DistributedParameter(const services::SharedPtr<covariance::DistributedIface<step2Master> > & covarianceForDistributedParameter =
+                             services::SharedPtr<covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense> >(
+                                 new covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense>()));
+
+    services::SharedPtr<covariance::DistributedIface<step2Master> > covariance; /*!< Pointer to Distributed covariance */
+    EigenSolverParameter eigenSolver; /*!< Parameters of the correlation matrix eigenproblem solver */
 
     /**
-                                                            * Checks batch parameter of the PCA svd algorithm
-                                                            * \return Errors detected while checking
-                                                            */
+    * Checks distributed parameter of the PCA correlation algorithm
+    * \return Errors detected while checking
+    */
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+} // namespace interface2
+
+/**
+    * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+    */
+namespace interface3
+{
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEBATCHPARAMETER"></a>
+* \brief Class that specifies the common parameters of the PCA Batch algorithms
+*/
+class DAAL_EXPORT BaseBatchParameter : public daal::algorithms::Parameter
+{
+public:
+    /** Constructs PCA parameters */
+    BaseBatchParameter();
+
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute */
+    size_t nComponents;           /*!< number of components for reduced implementation */
+    bool isDeterministic;         /*!< sign flip if required */
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -829,15 +828,76 @@ private:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface3
+
+/**
+    * \brief Contains version 4.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+    */
+namespace interface4
+{
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER"></a>
+* \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
+*/
+template <typename algorithmFPType, Method method>
+class BatchParameter
+{};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the batch computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, correlationDense> : public interface3::BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<covariance::BatchImpl> & covarianceForBatchParameter =
+                       services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >(
+                           new covariance::Batch<algorithmFPType, covariance::defaultDense>()));
+
+    services::SharedPtr<covariance::BatchImpl> covariance; /*!< Pointer to batch covariance */
+    interface2::EigenSolverParameter eigenSolver;         /*!< Parameters of the correlation matrix eigenproblem solver */
+
+    /**
+    * Checks batch parameter of the PCA correlation algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA SVD algorithm in the batch computing mode
+*/
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, svdDense> : public interface3::BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
+                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
+                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    services::SharedPtr<normalization::zscore::BatchImpl> normalization; /*!< Pointer to batch covariance */
+
+    /**
+                                                            * Checks batch parameter of the PCA svd algorithm
+                                                            * \return Errors detected while checking
+                                                            */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+} // namespace interface4
 using interface1::InputIface;
 using interface1::Input;
 using interface1::PartialResultBase;
 using interface1::PartialResult;
-using interface3::BatchParameter;
+using interface4::BatchParameter;
 using interface3::BaseBatchParameter;
-using interface1::OnlineParameter;
-using interface1::DistributedParameter;
+using interface2::OnlineParameter;
+using interface2::DistributedParameter;
 using interface1::DistributedInput;
+using interface2::EigenSolverParameter;
 using interface3::Result;
 using interface3::ResultPtr;
 
@@ -68,6 +68,15 @@ public:
     * Computes the result of the PCA transformation algorithm in the batch processing mode
     */
     virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+    * Prepares the projection matrix and the centering buffers of the PCA transformation algorithm from the eigenvectors, means,
+    * variances and eigenvalues
+    */
+    virtual services::Status setupCompute() DAAL_C11_OVERRIDE;
+    /**
+    * Releases the projection matrix and the centering buffers prepared by setupCompute()
+    */
+    virtual services::Status resetCompute() DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -80,6 +89,12 @@ public:
 *
 * \par Enumerations
 *      - \ref Method   Computation methods for the PCA transformation algorithm
+*
+* To project a stream of row batches with the same PCA results, call enableResetOnCompute(false) before the first compute():
+* the normalization and whitening are then folded into the projection matrix once, and the projection, the means and the per-thread
+* buffers used to center the rows are reused by the subsequent compute() calls that only replace the data input. Call resetCompute()
+* after changing the eigenvectors or dataForTransform inputs. Together with enableChecks(false) and a result set via setResult(),
+* a call only centers and projects the rows of the data table.
 */
 template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
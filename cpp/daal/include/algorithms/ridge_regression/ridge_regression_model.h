@@ -62,9 +62,9 @@ struct Parameter : public linear_model::Parameter
  * <a name="DAAL-STRUCT-ALGORITHMS__RIDGE_REGRESSION__TRAINPARAMETER"></a>
  * \brief Parameters for the ridge regression algorithm
  *
- * \snippet ridge_regression/ridge_regression_model.h TrainParameter source code
+ * \snippet ridge_regression/ridge_regression_model.h interface1::TrainParameter source code
  */
-/* [TrainParameter source code] */
+/* [interface1::TrainParameter source code] */
 struct DAAL_EXPORT TrainParameter : public Parameter
 {
     TrainParameter();
@@ -73,7 +73,7 @@ struct DAAL_EXPORT TrainParameter : public Parameter
 
     data_management::NumericTablePtr ridgeParameters; /*!< Numeric table that contains values of ridge parameters */
 };
-/* [TrainParameter source code] */
+/* [interface1::TrainParameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__RIDGE_REGRESSION__MODEL"></a>
@@ -97,8 +97,40 @@ typedef services::SharedPtr<const Model> ModelConstPtr;
 /** @} */
 } // namespace interface1
 
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * @ingroup ridge_regression
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__RIDGE_REGRESSION__TRAINPARAMETER"></a>
+ * \brief Parameters for the ridge regression algorithm with the selection of ridge parameters by the cross-validation
+ *
+ * \snippet ridge_regression/ridge_regression_model.h TrainParameter source code
+ */
+/* [TrainParameter source code] */
+struct DAAL_EXPORT TrainParameter : public interface1::TrainParameter
+{
+    TrainParameter();
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    data_management::NumericTablePtr ridgeParametersGrid; /*!< Numeric table of size nRidgeParameters x 1 or nRidgeParameters x k with
+                                                               the candidate values of ridge parameters. If set, the ridge parameter
+                                                               of every dependent variable is selected by the k-fold cross-validation
+                                                               and ridgeParameters is not used. Applicable in the batch processing mode */
+    size_t nFolds;                                        /*!< Number of the cross-validation folds, applicable if ridgeParametersGrid is set */
+};
+/* [TrainParameter source code] */
+/** @} */
+} // namespace interface2
+
 using interface1::Parameter;
-using interface1::TrainParameter;
+using interface2::TrainParameter;
 using interface1::Model;
 using interface1::ModelPtr;
 using interface1::ModelConstPtr;
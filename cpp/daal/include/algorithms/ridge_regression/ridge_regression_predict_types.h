@@ -78,6 +78,17 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__PREDICTION__MODELCOLLECTIONINPUTID"></a>
+ * \brief Available identifiers of input collections of models for making ridge regression model-based prediction
+ */
+enum ModelCollectionInputId
+{
+    models                     = linear_model::prediction::models, /*!< Collection of the linear, ridge or logistic regression models
+                                                                        trained on the same features. If set, the model input is not used */
+    lastModelCollectionInputId = models
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making ridge regression model-based prediction
@@ -133,6 +144,20 @@ public:
      * \param[in] value   %Input object
      */
     void set(ModelInputId id, const ridge_regression::ModelPtr & value);
+
+    /**
+     * Returns the collection of models for making ridge regression model-based prediction
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ModelCollectionInputId id) const;
+
+    /**
+     * Sets the collection of models for making ridge regression model-based prediction
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   %Input object
+     */
+    void set(ModelCollectionInputId id, const data_management::DataCollectionPtr & value);
 };
 
 /**
@@ -39,7 +39,7 @@ namespace ridge_regression
 {
 namespace training
 {
-namespace interface1
+namespace interface2
 {
 /**
  * @defgroup ridge_regression_batch Batch
@@ -165,10 +165,10 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface1
+} // namespace interface2
 
-using interface1::BatchContainer;
-using interface1::Batch;
+using interface2::BatchContainer;
+using interface2::Batch;
 
 } // namespace training
 } // namespace ridge_regression
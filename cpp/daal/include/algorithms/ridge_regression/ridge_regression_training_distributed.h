@@ -190,7 +190,7 @@ class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Tra
 {
 public:
     typedef algorithms::ridge_regression::training::DistributedInput<step2Master> InputType;
-    typedef algorithms::ridge_regression::TrainParameter ParameterType;
+    typedef algorithms::ridge_regression::interface1::TrainParameter ParameterType;
     typedef algorithms::ridge_regression::training::Result ResultType;
     typedef algorithms::ridge_regression::training::PartialResult PartialResultType;
 
@@ -98,7 +98,7 @@ class DAAL_EXPORT Online : public linear_model::training::Online
 {
 public:
     typedef algorithms::ridge_regression::training::Input InputType;
-    typedef algorithms::ridge_regression::TrainParameter ParameterType;
+    typedef algorithms::ridge_regression::interface1::TrainParameter ParameterType;
     typedef algorithms::ridge_regression::training::Result ResultType;
     typedef algorithms::ridge_regression::training::PartialResult PartialResultType;
 
@@ -100,6 +100,18 @@ enum ResultId
     lastResultId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__TRAINING__OPTIONALRESULTNUMERICTABLEID"></a>
+ * \brief Available identifiers of the optional results of ridge regression model-based training
+ */
+enum OptionalResultNumericTableId
+{
+    crossValidationErrors            = lastResultId + 1,          /*!< Numeric table of size nRidgeParameters x k, containing the mean squared
+                                                                       errors of the cross-validation for the values from ridgeParametersGrid */
+    bestRidgeParameters              = crossValidationErrors + 1, /*!< Numeric table of size 1 x k, containing the selected ridge parameters */
+    lastOptionalResultNumericTableId = bestRidgeParameters
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -351,6 +363,20 @@ public:
      */
     void set(ResultId id, const ridge_regression::ModelPtr & value);
 
+    /**
+     * Returns the optional result of ridge regression model-based training
+     * \param[in] id    Identifier of the optional result
+     * \return          Optional result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultNumericTableId id) const;
+
+    /**
+     * Sets the optional result of ridge regression model-based training
+     * \param[in] id      Identifier of the optional result
+     * \param[in] value   Optional result
+     */
+    void set(OptionalResultNumericTableId id, const data_management::NumericTablePtr & value);
+
     /**
      * Allocates memory to store the result of ridge regression model-based training
      * \param[in] input Pointer to an object containing the input data
@@ -31,6 +31,7 @@
 #include "algorithms/kernel_function/kernel_function_linear.h"
 #include "algorithms/kernel_function/kernel_function_types.h"
 #include "algorithms/classifier/classifier_model.h"
+#include "services/library_version_info.h"
 
 namespace daal
 {
@@ -198,7 +199,7 @@ public:
      * Empty constructor for deserialization
      * \DAAL_DEPRECATED_USE{ Model::create }
      */
-    Model() : _SV(), _SVCoeff(), _bias(0.0), _SVIndices() {}
+    Model() : _SV(), _SVCoeff(), _bias(0.0), _SVIndices(), _primalWeights() {}
 
     /**
      * Constructs empty SVM model for deserialization
@@ -247,6 +248,22 @@ public:
      */
     virtual void setBias(double bias) { _bias = bias; }
 
+    /**
+     * Returns the sum of the support vectors weighted by the classification coefficients, w = sum(coeff_i * sv_i),
+     * computed during the training of the SVM model with the linear kernel. The prediction with the linear kernel
+     * uses it to compute the distance function without evaluating the kernel on the support vectors.
+     * The weights are serialized with the model since the version 2021.2
+     * \return Numeric table of size 1 x p with the weights, empty if the weights are not computed
+     */
+    data_management::NumericTablePtr getPrimalWeights() { return _primalWeights; }
+
+    /**
+     * Sets the sum of the support vectors weighted by the classification coefficients
+     * \param primalWeights  Numeric table of size 1 x p with the weights, an empty pointer resets the weights.
+     *                       The weights must be reset if the support vectors or the classification coefficients are modified
+     */
+    void setPrimalWeights(const data_management::NumericTablePtr & primalWeights) { _primalWeights = primalWeights; }
+
     /**
      *  Retrieves the number of features in the dataset was used on the training stage
      *  \return Number of features in the dataset was used on the training stage
@@ -254,10 +271,11 @@ public:
     size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return (_SV ? _SV->getNumberOfColumns() : 0); }
 
 protected:
-    data_management::NumericTablePtr _SV;        /*!< \private Support vectors */
-    data_management::NumericTablePtr _SVCoeff;   /*!< \private Classification coefficients */
-    double _bias;                                /*!< \private Bias of the distance function D(x) = w*Phi(x) + bias */
-    data_management::NumericTablePtr _SVIndices; /*!< \private Indices of the support vectors in training data set */
+    data_management::NumericTablePtr _SV;            /*!< \private Support vectors */
+    data_management::NumericTablePtr _SVCoeff;       /*!< \private Classification coefficients */
+    double _bias;                                    /*!< \private Bias of the distance function D(x) = w*Phi(x) + bias */
+    data_management::NumericTablePtr _SVIndices;     /*!< \private Indices of the support vectors in training data set */
+    data_management::NumericTablePtr _primalWeights; /*!< \private Support vectors weighted by the classification coefficients */
 
     template <typename modelFPType>
     DAAL_EXPORT Model(modelFPType dummy, size_t nColumns, data_management::NumericTableIface::StorageLayout layout, services::Status & st);
@@ -273,8 +291,24 @@ protected:
 
         arch->setSharedPtrObj(_SVIndices);
 
+        if (hasPrimalWeights(arch))
+        {
+            arch->setSharedPtrObj(_primalWeights);
+        }
+
         return st;
     }
+
+private:
+    /* Version of the library that serializes the primal weights */
+    static const int primalWeightsVersion = 2021 * 10000 + 2 * 100 + 0;
+
+    static bool hasPrimalWeights(data_management::InputDataArchive *) { return INTEL_DAAL_VERSION >= primalWeightsVersion; }
+
+    static bool hasPrimalWeights(const data_management::OutputDataArchive * arch)
+    {
+        return arch->getMajorVersion() * 10000 + arch->getMinorVersion() * 100 + arch->getUpdateVersion() >= primalWeightsVersion;
+    }
 };
 typedef services::SharedPtr<Model> ModelPtr;
 /** @} */
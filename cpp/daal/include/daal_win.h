@@ -98,6 +98,7 @@
 #include "algorithms/linear_regression/linear_regression_training_distributed.h"
 #include "algorithms/linear_regression/linear_regression_training_batch.h"
 #include "algorithms/linear_regression/linear_regression_training_online.h"
+#include "algorithms/linear_regression/linear_regression_training_out_of_core.h"
 #include "algorithms/linear_regression/linear_regression_quality_metric_set_batch.h"
 #include "algorithms/linear_regression/linear_regression_quality_metric_set_types.h"
 #include "algorithms/linear_regression/linear_regression_single_beta_batch.h"
@@ -249,6 +250,8 @@
 #include "algorithms/optimization_solver/saga/saga_types.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_batch.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
 #include "algorithms/normalization/zscore.h"
 #include "algorithms/normalization/zscore_types.h"
 #include "algorithms/normalization/minmax.h"
@@ -335,6 +338,8 @@
 #include "algorithms/engines/engine_family.h"
 #include "algorithms/engines/mt2203/mt2203.h"
 #include "algorithms/engines/mt2203/mt2203_types.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10_types.h"
 #include "algorithms/dbscan/dbscan_types.h"
 #include "algorithms/dbscan/dbscan_batch.h"
 #include "algorithms/dbscan/dbscan_distributed.h"
@@ -43,6 +43,12 @@ namespace data_management
 typedef services::Collection<services::SharedPtr<DataBlock> > DataBlockCollection;
 typedef services::SharedPtr<DataBlockCollection> DataBlockCollectionPtr;
 
+namespace internal
+{
+struct FramedCompressionState;
+struct FramedDecompressionState;
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -196,9 +202,187 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELCOMPRESSIONSTREAM"></a>
+ * \brief %ParallelCompressionStream class splits input raw data into independent frames of a fixed size
+ *        and compresses the frames concurrently, each frame with its own compressor.
+ *        The compressed data starts with the index of the frames, so it can be decompressed in parallel
+ *        and read from any offset by \ref ParallelDecompressionStream.
+ *        The compressed data cannot be decompressed by \ref DecompressionStream.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref ParallelDecompressionStream class
+ */
+class DAAL_EXPORT ParallelCompressionStream : public Base
+{
+public:
+    /**
+     * %ParallelCompressionStream constructor
+     * \param method    Compression method
+     * \param level     Compression level, used by the zlib and bzip2 methods
+     * \param frameSize Optional parameter, size of the raw data frames compressed independently
+     */
+    ParallelCompressionStream(CompressionMethod method, CompressionLevel level = defaultLevel, size_t frameSize = 1024 * 1024 * 4);
+
+    virtual ~ParallelCompressionStream() DAAL_C11_OVERRIDE;
+
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream.
+     * The frames are compressed when the number of filled frames reaches the number of threads
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock * inBlock);
+
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+
+    /**
+     * Compresses the data written to %ParallelCompressionStream so far and returns the size of compressed data.
+     * The data written after the call is compressed into the next segment of frames with its own index
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+
+    /**
+     * Copies compressed data stored in %ParallelCompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte * outPtr, size_t outSize);
+
+    /**
+     * Copies compressed data stored in %ParallelCompressionStream to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where compressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock & outBlock) { return copyCompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    ParallelCompressionStream(const ParallelCompressionStream &);
+    ParallelCompressionStream & operator=(const ParallelCompressionStream &);
+
+    void compressFrames();
+    void seal();
+
+    internal::FramedCompressionState * _state;
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _frameSize;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELDECOMPRESSIONSTREAM"></a>
+ * \brief %ParallelDecompressionStream class decompresses the data compressed by \ref ParallelCompressionStream.
+ *        The frames needed to serve a read are decompressed concurrently, and the data can be read
+ *        from any offset without decompressing the preceding frames.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref ParallelCompressionStream class
+ */
+class DAAL_EXPORT ParallelDecompressionStream : public Base
+{
+public:
+    /**
+     * %ParallelDecompressionStream constructor
+     * \param method    Compression method the data was compressed with
+     */
+    ParallelDecompressionStream(CompressionMethod method);
+
+    virtual ~ParallelDecompressionStream() DAAL_C11_OVERRIDE;
+
+    /**
+     * Writes the next block of compressed data to %ParallelDecompressionStream.
+     * The blocks do not need to be aligned with the frames
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    virtual void push_back(DataBlock * inBlock);
+
+    /**
+     * Writes the next block of compressed data to %ParallelDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+
+    /**
+     * Writes the next block of compressed data to %ParallelDecompressionStream
+     * \param[in] inBlock  Next DataBlock to be decompressed
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+
+    /**
+     * Returns the size of decompressed data not yet read from %ParallelDecompressionStream.
+     * Only the frames that were written completely are taken into account
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+
+    /**
+     * Copies the next decompressed data stored in %ParallelDecompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte * outPtr, size_t outSize);
+
+    /**
+     * Copies the next decompressed data stored in %ParallelDecompressionStream to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock & outBlock) { return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    /**
+     * Copies decompressed data starting from the given offset to an external array.
+     * Only the frames that overlap the requested range are decompressed, the read position of the stream is not changed
+     * \param[in]  offset  Offset in bytes in the decompressed data
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedRange(size_t offset, byte * outPtr, size_t outSize);
+
+    /**
+     * Returns the number of frames written completely to %ParallelDecompressionStream
+     * \return Number of frames
+     */
+    virtual size_t getNumberOfFrames();
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    ParallelDecompressionStream(const ParallelDecompressionStream &);
+    ParallelDecompressionStream & operator=(const ParallelDecompressionStream &);
+
+    void parseFrames();
+    void decompressFrames(size_t first, size_t last, size_t offset, byte * outPtr, size_t outSize);
+
+    internal::FramedDecompressionState * _state;
+    CompressionMethod _method;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::ParallelCompressionStream;
+using interface1::ParallelDecompressionStream;
 /** @} */
 
 } //namespace data_management
@@ -387,14 +387,22 @@ protected:
         }
         arch->set((char *)_offsets, getNumberOfColumns() * sizeof(size_t));
 
+        size_t size = getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The table refers to the data in the archive memory if the archive provides it */
+            services::SharedPtr<byte> view = data_management::internal::getAlignedArrayView(arch, size * _structSize);
+            if (view)
+            {
+                _ptr       = view;
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfRows();
-
-        arch->set((char *)_ptr.get(), size * _structSize);
+        data_management::internal::setAlignedArray(arch, (char *)_ptr.get(), size * _structSize);
 
         return services::Status();
     }
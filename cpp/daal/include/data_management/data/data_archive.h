@@ -497,31 +497,27 @@ private:
 };
 
 /**
- *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDDATAARCHIVE"></a>
- *  \brief Abstract interface class that defines methods to access and modify a serialized object.
- *  This class declares the most generic access and modification methods.
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__STREAMDATAARCHIVEIMPL"></a>
+ *  \brief Data archive over a (de)compression stream. Implements the bookkeeping common to the compressed
+ *  and decompressed archives: the blocks written to the archive are pushed to the stream, and the output data
+ *  of the stream is returned as an array, a shared pointer or a string
+ *
+ *  \tparam StreamType   Type of the stream
+ *  \tparam getDataSize  Method of the stream that returns the size of its output data
+ *  \tparam copyData     Method of the stream that copies its output data to the array
  */
-class CompressedDataArchive : public DataArchiveImpl
+template <typename StreamType, size_t (StreamType::*getDataSize)(), size_t (StreamType::*copyData)(byte *, size_t)>
+class StreamDataArchiveImpl : public DataArchiveImpl
 {
 public:
-    /**
-     *  Constructor of a compressed data archive from compressor
-     *  \param[in]  compressor  Pointer to the compressor
-     */
-    CompressedDataArchive(daal::data_management::CompressorImpl * compressor) : minBlockSize(1024 * 64), _errors(new services::ErrorCollection())
-    {
-        compressionStream = new daal::data_management::CompressionStream(compressor, minBlockSize);
-        serializedBuffer  = 0;
-    }
-
     /** \private */
-    ~CompressedDataArchive() DAAL_C11_OVERRIDE
+    ~StreamDataArchiveImpl() DAAL_C11_OVERRIDE
     {
         if (serializedBuffer)
         {
             daal::services::daal_free(serializedBuffer);
         }
-        delete compressionStream;
+        delete stream;
     }
 
     void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
@@ -529,12 +525,10 @@ public:
         DataBlock wBlock;
         wBlock.setPtr(ptr);
         wBlock.setSize(size);
-        compressionStream->push_back(&wBlock);
+        stream->push_back(&wBlock);
     }
 
-    void read(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE {}
-
-    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return compressionStream->getCompressedDataSize(); }
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return (stream->*getDataSize)(); }
 
     byte * getArchiveAsArray() DAAL_C11_OVERRIDE
     {
@@ -556,7 +550,7 @@ public:
             return 0;
         }
 
-        compressionStream->copyCompressedArray(serializedBuffer, length);
+        (stream->*copyData)(serializedBuffer, length);
         return serializedBuffer;
     }
 
@@ -597,10 +591,44 @@ public:
             return length;
         }
 
-        compressionStream->copyCompressedArray(ptr, length);
+        (stream->*copyData)(ptr, length);
         return length;
     }
 
+protected:
+    /**
+     *  Constructor of the archive, the archive takes the ownership of the stream
+     *  \param[in]  stream  Pointer to the stream
+     */
+    StreamDataArchiveImpl(StreamType * stream) : serializedBuffer(0), stream(stream) {}
+
+    byte * serializedBuffer;
+    StreamType * stream;
+
+private:
+    StreamDataArchiveImpl(const StreamDataArchiveImpl &);
+    StreamDataArchiveImpl & operator=(const StreamDataArchiveImpl &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDDATAARCHIVE"></a>
+ *  \brief Abstract interface class that defines methods to access and modify a serialized object.
+ *  This class declares the most generic access and modification methods.
+ */
+class CompressedDataArchive
+    : public StreamDataArchiveImpl<CompressionStream, &CompressionStream::getCompressedDataSize, &CompressionStream::copyCompressedArray>
+{
+public:
+    /**
+     *  Constructor of a compressed data archive from compressor
+     *  \param[in]  compressor  Pointer to the compressor
+     */
+    CompressedDataArchive(daal::data_management::CompressorImpl * compressor)
+        : StreamDataArchiveImpl(new daal::data_management::CompressionStream(compressor, 1024 * 64)), _errors(new services::ErrorCollection())
+    {}
+
+    void read(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE {}
+
     /**
     * Returns errors during the computation
     * \return Errors during the computation
@@ -608,9 +636,6 @@ public:
     services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
 
 private:
-    size_t minBlockSize;
-    byte * serializedBuffer;
-    daal::data_management::CompressionStream * compressionStream;
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
@@ -619,7 +644,8 @@ private:
  *  \brief Abstract interface class that defines methods to access and modify a serialized object.
  *  This class declares the most generic access and modification methods.
  */
-class DecompressedDataArchive : public DataArchiveImpl
+class DecompressedDataArchive
+    : public StreamDataArchiveImpl<DecompressionStream, &DecompressionStream::getDecompressedDataSize, &DecompressionStream::copyDecompressedArray>
 {
 public:
     /**
@@ -627,110 +653,88 @@ public:
      *  \param[in]  decompressor  Pointer to the decompressor
      */
     DecompressedDataArchive(daal::data_management::DecompressorImpl * decompressor)
-        : minBlockSize(1024 * 64), _errors(new services::ErrorCollection())
-    {
-        decompressionStream = new daal::data_management::DecompressionStream(decompressor, minBlockSize);
-        serializedBuffer    = 0;
-    }
+        : StreamDataArchiveImpl(new daal::data_management::DecompressionStream(decompressor, 1024 * 64)), _errors(new services::ErrorCollection())
+    {}
 
-    /** \private */
-    ~DecompressedDataArchive() DAAL_C11_OVERRIDE
-    {
-        if (serializedBuffer)
-        {
-            daal::services::daal_free(serializedBuffer);
-        }
-        delete decompressionStream;
-    }
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { stream->copyDecompressedArray(ptr, size); }
 
-    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
-    {
-        DataBlock wBlock;
-        wBlock.setPtr(ptr);
-        wBlock.setSize(size);
-        decompressionStream->push_back(&wBlock);
-    }
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
 
-    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { decompressionStream->copyDecompressedArray(ptr, size); }
+private:
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 
-    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return decompressionStream->getDecompressedDataSize(); }
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELCOMPRESSEDDATAARCHIVE"></a>
+ *  \brief Data archive that compresses the serialized data by independent frames in parallel
+ *         with \ref ParallelCompressionStream. The compressed data is restored by \ref ParallelDecompressedDataArchive
+ */
+class ParallelCompressedDataArchive
+    : public StreamDataArchiveImpl<ParallelCompressionStream, &ParallelCompressionStream::getCompressedDataSize,
+                                   &ParallelCompressionStream::copyCompressedArray>
+{
+public:
+    /**
+     *  Constructor of a data archive compressed by frames
+     *  \param[in]  method     Compression method
+     *  \param[in]  level      Compression level, used by the zlib and bzip2 methods
+     *  \param[in]  frameSize  Size of the raw data frames compressed independently
+     */
+    ParallelCompressedDataArchive(CompressionMethod method, CompressionLevel level = defaultLevel, size_t frameSize = 1024 * 1024 * 4)
+        : StreamDataArchiveImpl(new daal::data_management::ParallelCompressionStream(method, level, frameSize))
+    {}
 
-    byte * getArchiveAsArray() DAAL_C11_OVERRIDE
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
     {
-        if (serializedBuffer)
-        {
-            return serializedBuffer;
-        }
-
-        size_t length = getSizeOfArchive();
-
-        if (length == 0)
-        {
-            return 0;
-        }
-
-        serializedBuffer = (byte *)daal::services::daal_malloc(length);
-        if (serializedBuffer == 0)
+        if (size == 0)
         {
-            return 0;
+            return;
         }
-
-        decompressionStream->copyDecompressedArray(serializedBuffer, length);
-        return serializedBuffer;
+        StreamDataArchiveImpl::write(ptr, size);
     }
 
-    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
-    {
-        size_t length = getSizeOfArchive();
-
-        if (length == 0)
-        {
-            return services::SharedPtr<byte>();
-        }
-
-        services::SharedPtr<byte> serializedBufferPtr((byte *)daal::services::daal_malloc(length), services::ServiceDeleter());
-        if (!serializedBufferPtr)
-        {
-            return services::SharedPtr<byte>();
-        }
-
-        copyArchiveToArray(serializedBufferPtr.get(), length);
+    void read(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE {}
 
-        return serializedBufferPtr;
-    }
+    /**
+    * Returns errors of the compression
+    * \return Errors of the compression
+    */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return stream->getErrors(); }
+};
 
-    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELDECOMPRESSEDDATAARCHIVE"></a>
+ *  \brief Data archive that decompresses the data written by \ref ParallelCompressedDataArchive.
+ *         The frames needed by a read are decompressed in parallel with \ref ParallelDecompressionStream
+ */
+class ParallelDecompressedDataArchive
+    : public StreamDataArchiveImpl<ParallelDecompressionStream, &ParallelDecompressionStream::getDecompressedDataSize,
+                                   &ParallelDecompressionStream::copyDecompressedArray>
+{
+public:
+    /**
+     *  Constructor of a data archive from a byte array of data compressed by frames
+     *  \param[in]  method  Compression method the data was compressed with
+     *  \param[in]  ptr     Pointer to the compressed data
+     *  \param[in]  size    Size of the compressed data in bytes
+     */
+    ParallelDecompressedDataArchive(CompressionMethod method, byte * ptr, size_t size)
+        : StreamDataArchiveImpl(new daal::data_management::ParallelDecompressionStream(method))
     {
-        size_t length = getSizeOfArchive();
-        char * buffer = (char *)getArchiveAsArray();
-
-        return std::string(buffer, length);
+        write(ptr, size);
     }
 
-    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
-    {
-        size_t length = getSizeOfArchive();
-
-        if (length == 0 || length > maxLength)
-        {
-            return length;
-        }
-
-        decompressionStream->copyDecompressedArray(ptr, length);
-        return length;
-    }
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { stream->copyDecompressedArray(ptr, size); }
 
     /**
-     * Returns errors during the computation
-     * \return Errors during the computation
+     * Returns errors of the decompression
+     * \return Errors of the decompression
      */
-    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
-
-private:
-    size_t minBlockSize;
-    byte * serializedBuffer;
-    daal::data_management::DecompressionStream * decompressionStream;
-    services::SharedPtr<services::ErrorCollection> _errors;
+    services::SharedPtr<services::ErrorCollection> getErrors() { return stream->getErrors(); }
 };
 
 /**
@@ -1240,12 +1244,484 @@ private:
 /** @} */
 
 } // namespace interface1
+
+namespace interface2
+{
+/**
+ * @ingroup serialization
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ALIGNEDDATAARCHIVEIFACE"></a>
+ *  \brief Abstract interface of the data archives that store arrays at the aligned positions. The archives that implement it
+ *         are used by AlignedInputDataArchive and AlignedOutputDataArchive, the numeric tables query it with dynamic_cast
+ */
+class AlignedDataArchiveIface
+{
+public:
+    virtual ~AlignedDataArchiveIface() {}
+
+    /**
+     *  Writes an array to the archive at the position aligned to the specified number of bytes from the beginning of the archive
+     *  \param[in]  ptr        Pointer to the array
+     *  \param[in]  size       Size of the array in bytes
+     *  \param[in]  alignment  Alignment of the position of the array in bytes
+     */
+    virtual void writeAligned(byte * ptr, size_t size, size_t alignment) = 0;
+
+    /**
+     *  Reads an array written to the archive by writeAligned()
+     *  \param[in]  ptr        Pointer to the array
+     *  \param[in]  size       Size of the array in bytes
+     *  \param[in]  alignment  Alignment of the position of the array in bytes
+     */
+    virtual void readAligned(byte * ptr, size_t size, size_t alignment) = 0;
+
+    /**
+     *  Returns the array written to the archive by writeAligned() without copying it, the returned pointer shares
+     *  the ownership of the archive memory. Returns an empty pointer and does not read the array
+     *  if the archive does not provide its memory to the deserialized objects
+     *  \param[in]  size       Size of the array in bytes
+     *  \param[in]  alignment  Alignment of the position of the array in bytes
+     *  \return Pointer to the array in the archive memory
+     */
+    virtual services::SharedPtr<byte> readAlignedView(size_t size, size_t alignment) = 0;
+
+protected:
+    static size_t alignmentPadding(size_t position, size_t alignment)
+    {
+        if (alignment <= 1) return 0;
+        const size_t remainder = position % alignment;
+        return (remainder ? alignment - remainder : 0);
+    }
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ALIGNEDDATAARCHIVE"></a>
+ *  \brief Data archive in memory that stores the arrays written by writeAligned() at the aligned positions.
+ *         The padding before an array is written and skipped as the regular data of the archive
+ */
+class AlignedDataArchive : public interface1::DataArchive, public AlignedDataArchiveIface
+{
+public:
+    /**
+     *  Constructor of an empty data archive
+     */
+    AlignedDataArchive() : _readPosition(0) {}
+
+    /**
+     *  Constructor of a data archive from the data of another archive
+     */
+    AlignedDataArchive(const interface1::DataArchive & arch) : interface1::DataArchive(arch), _readPosition(0) {}
+
+    /**
+     *  Constructor of a data archive from data in a byte array
+     *  \param[in]  ptr  Pointer to the array that represents the data
+     *  \param[in]  size Size of the data array
+     */
+    AlignedDataArchive(byte * ptr, size_t size) : interface1::DataArchive(ptr, size), _readPosition(0) {}
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        interface1::DataArchive::read(ptr, size);
+        _readPosition += alignValueUp(size);
+    }
+
+    void writeAligned(byte * ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE
+    {
+        byte zeros[paddingChunkSize] = { 0 };
+        for (size_t padding = alignmentPadding(getSizeOfArchive(), alignment); padding > 0;)
+        {
+            const size_t chunkSize = (padding < paddingChunkSize ? padding : paddingChunkSize);
+            write(zeros, chunkSize);
+            padding -= chunkSize;
+        }
+        write(ptr, size);
+    }
+
+    void readAligned(byte * ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE
+    {
+        byte skipped[paddingChunkSize];
+        for (size_t padding = alignmentPadding(_readPosition, alignment); padding > 0;)
+        {
+            const size_t chunkSize = (padding < paddingChunkSize ? padding : paddingChunkSize);
+            read(skipped, chunkSize);
+            padding -= chunkSize;
+        }
+        read(ptr, size);
+    }
+
+    services::SharedPtr<byte> readAlignedView(size_t /*size*/, size_t /*alignment*/) DAAL_C11_OVERRIDE { return services::SharedPtr<byte>(); }
+
+private:
+    /* The padding is written by chunks that are multiples of the alignment of the values in the archive */
+    static const size_t paddingChunkSize = DAAL_MALLOC_DEFAULT_ALIGNMENT * 16;
+
+    size_t _readPosition;
+
+    AlignedDataArchive & operator=(const AlignedDataArchive &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDDATAARCHIVE"></a>
+ *  \brief Read-only data archive over a file mapped to memory. The pages of the file are loaded on the first access.
+ *         The arrays written to the archive with alignment are provided to the deserialized objects as views of the mapped file,
+ *         the file stays mapped until the archive and all the views are destroyed
+ */
+class DAAL_EXPORT MappedDataArchive : public interface1::DataArchiveImpl, public AlignedDataArchiveIface
+{
+public:
+    /**
+     *  Constructor of a data archive that maps the file to memory
+     *  \param[in]  fileName  Name of the file with the serialized data
+     */
+    MappedDataArchive(const char * fileName);
+
+    ~MappedDataArchive() DAAL_C11_OVERRIDE {}
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE;
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE;
+
+    void writeAligned(byte * ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    void readAligned(byte * ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    services::SharedPtr<byte> readAlignedView(size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE { return _mapping; }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE { return _mapping.get(); }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE { return std::string((char *)_mapping.get(), _mapping ? _size : 0); }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    size_t alignValueUp(size_t value) const;
+    bool skipPadding(size_t alignment);
+
+    services::SharedPtr<byte> _mapping;
+    size_t _size;
+    size_t _readOffset;
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+    MappedDataArchive(const MappedDataArchive &);
+    MappedDataArchive & operator=(const MappedDataArchive &);
+};
+
+/**
+ *  \private
+ *  Version of the archive header layout. The archives of the version 1 store the alignment of the arrays
+ *  in the fifth value of the header, the archives of the version 0 do not align the arrays
+ */
+const int archiveHeaderVersion = 1;
+
+/**
+ *  \private
+ *  Maximal alignment of the arrays in an archive in bytes, the size of a large memory page
+ */
+const size_t maxArchiveArrayAlignment = 2 * 1024 * 1024;
+
+/**
+ *  \private
+ *  Checks that the alignment of the arrays in an archive is a power of two not less than
+ *  DAAL_MALLOC_DEFAULT_ALIGNMENT and not greater than maxArchiveArrayAlignment
+ */
+inline bool isValidArchiveArrayAlignment(size_t alignment)
+{
+    return alignment >= DAAL_MALLOC_DEFAULT_ALIGNMENT && alignment <= maxArchiveArrayAlignment && (alignment & (alignment - 1)) == 0;
+}
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ALIGNEDINPUTDATAARCHIVE"></a>
+ *  \brief Input data archive that stores the arrays of the numeric tables at the positions aligned to the specified number of bytes,
+ *         for example to the page size. The numeric tables restored from such archive by AlignedOutputDataArchive over a file
+ *         mapped to memory use the arrays in place without copying. The archive is read by AlignedOutputDataArchive only
+ */
+class AlignedInputDataArchive : public interface1::InputDataArchive
+{
+public:
+    /**
+     *  Constructor of an input data archive with the alignment of the arrays
+     *  \param[in]  arrayAlignment  Alignment of the arrays in bytes, a power of two not less than DAAL_MALLOC_DEFAULT_ALIGNMENT
+     *                              and not greater than 2 MB. The arrays are not aligned if the alignment is incorrect,
+     *                              and the error is reported by getErrors()
+     */
+    AlignedInputDataArchive(size_t arrayAlignment) : _arrayAlignment(arrayAlignment)
+    {
+        if (!isValidArchiveArrayAlignment(_arrayAlignment))
+        {
+            _errors->add(services::ErrorIncorrectArrayAlignment);
+            _arrayAlignment = 0;
+            return;
+        }
+
+        /* The base class writes the header without the alignment of the arrays, the archive is replaced with the aligned one */
+        delete _arch;
+        _arch = new AlignedDataArchive();
+        archiveHeader();
+    }
+
+    /**
+     *  Generates a header for a data archive, the header records the alignment of the arrays
+     */
+    void archiveHeader()
+    {
+        int headerValues[8] = {
+            0x4441414C, __INTEL_DAAL__, __INTEL_DAAL_MINOR__, __INTEL_DAAL_UPDATE__, (int)_arrayAlignment, archiveHeaderVersion, 0, 0
+        };
+
+        _arch->setMajorVersion(headerValues[1]);
+        _arch->setMinorVersion(headerValues[2]);
+        _arch->setUpdateVersion(headerValues[3]);
+        for (size_t i = 0; i < 8; i++)
+        {
+            _arch->write((byte *)&headerValues[i], sizeof(int));
+        }
+    }
+
+    /**
+     *  Performs data serialization of an array of values of the basic datatype at the aligned position in the archive
+     *  \tparam  T         Basic datatype
+     *  \param[in]   ptr   Pointer to the array of data to convert to the serialized format
+     *  \param[in]   size  Size of the array pointed to by ptr
+     */
+    template <typename T>
+    void setAlignedArray(T * ptr, size_t size)
+    {
+        if (_arrayAlignment)
+        {
+            static_cast<AlignedDataArchive *>(_arch)->writeAligned((byte *)ptr, size * sizeof(T), _arrayAlignment);
+        }
+        else
+        {
+            _arch->write((byte *)ptr, size * sizeof(T));
+        }
+    }
+
+    /**
+     *  Returns the alignment of the arrays in the archive
+     *  \return Alignment of the arrays in bytes, zero if the arrays are not aligned
+     */
+    size_t getArrayAlignment() const { return _arrayAlignment; }
+
+protected:
+    size_t _arrayAlignment;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ALIGNEDOUTPUTDATAARCHIVE"></a>
+ *  \brief Output data archive that restores the objects serialized by AlignedInputDataArchive. The archive also reads
+ *         the archives written by InputDataArchive
+ */
+class AlignedOutputDataArchive : public interface1::OutputDataArchive
+{
+public:
+    /**
+     *  Constructor of an output data archive from an input data archive
+     */
+    AlignedOutputDataArchive(interface1::InputDataArchive & arch)
+        : interface1::OutputDataArchive(new AlignedDataArchive(arch.getDataArchive())), _arrayAlignment(0)
+    {
+        _alignedArch                              = static_cast<AlignedDataArchive *>(_arch);
+        const AlignedInputDataArchive * alignedIn = dynamic_cast<const AlignedInputDataArchive *>(&arch);
+        _arrayAlignment                           = (alignedIn ? alignedIn->getArrayAlignment() : 0);
+    }
+
+    /**
+     *  Constructor of an output data archive from a byte array
+     */
+    AlignedOutputDataArchive(byte * ptr, size_t size) : interface1::OutputDataArchive(new AlignedDataArchive(ptr, size)), _arrayAlignment(0)
+    {
+        _alignedArch = static_cast<AlignedDataArchive *>(_arch);
+        readArrayAlignment(ptr, size);
+    }
+
+    /**
+     *  Constructor of an output data archive from a file mapped to memory.
+     *  The numeric tables of the objects restored from the archive that is written with the alignment of arrays
+     *  refer to the mapped file instead of copying the data
+     *  \param[in]  fileName  Name of the file with the serialized data
+     */
+    AlignedOutputDataArchive(const char * fileName) : interface1::OutputDataArchive(new MappedDataArchive(fileName)), _arrayAlignment(0)
+    {
+        MappedDataArchive * arch = static_cast<MappedDataArchive *>(_arch);
+        _alignedArch             = arch;
+        if (arch->getErrors()->size() != 0)
+        {
+            _errors->add(*arch->getErrors());
+            return;
+        }
+        readArrayAlignment(arch->getArchiveAsArray(), arch->getSizeOfArchive());
+    }
+
+    /**
+     *  Performs data deserialization of an array of values of the basic datatype written by AlignedInputDataArchive::setAlignedArray()
+     *  \tparam  T         Basic datatype
+     *  \param[in]   ptr   Pointer to the array of data to convert from the serialized format
+     *  \param[in]   size  Size of the array pointed to by ptr
+     */
+    template <typename T>
+    void setAlignedArray(T * ptr, size_t size) const
+    {
+        if (_arrayAlignment)
+        {
+            _alignedArch->readAligned((byte *)ptr, size * sizeof(T), _arrayAlignment);
+        }
+        else
+        {
+            _arch->read((byte *)ptr, size * sizeof(T));
+        }
+    }
+
+    /**
+     *  Returns the array written by AlignedInputDataArchive::setAlignedArray() as a view of the archive memory that shares
+     *  the ownership of the memory. Returns an empty pointer and does not read the array if the archive is written
+     *  without the alignment of arrays or does not provide its memory to the deserialized objects,
+     *  in that case the array is read by setAlignedArray()
+     *  \param[in]   size  Size of the array in bytes
+     *  \return Pointer to the array in the archive memory
+     */
+    services::SharedPtr<byte> getAlignedArrayView(size_t size) const
+    {
+        if (!_arrayAlignment)
+        {
+            return services::SharedPtr<byte>();
+        }
+        return _alignedArch->readAlignedView(size, _arrayAlignment);
+    }
+
+    /**
+     *  Returns the alignment of the arrays in the archive
+     *  \return Alignment of the arrays in bytes, zero if the arrays are not aligned
+     */
+    size_t getArrayAlignment() const { return _arrayAlignment; }
+
+protected:
+    AlignedDataArchiveIface * _alignedArch;
+    size_t _arrayAlignment;
+
+private:
+    /* Reads the alignment of the arrays from the header in the byte array, the header is already read by the base class */
+    void readArrayAlignment(const byte * ptr, size_t size)
+    {
+        /* The archives of the version 2016.0.0 do not align the values of the header */
+        const bool isUnaligned = (_arch->getMajorVersion() == 2016 && _arch->getMinorVersion() == 0 && _arch->getUpdateVersion() == 0);
+        const size_t stride    = (isUnaligned ? sizeof(int) : DAAL_MALLOC_DEFAULT_ALIGNMENT);
+        if (!ptr || size < 8 * stride)
+        {
+            return;
+        }
+
+        int headerValues[2];
+        for (size_t i = 0; i < 2; i++)
+        {
+            daal::services::internal::daal_memcpy_s(&headerValues[i], sizeof(int), ptr + (4 + i) * stride, sizeof(int));
+        }
+
+        /* The alignment of the arrays is stored starting from the version 1 of the header */
+        const int headerVersion = headerValues[1];
+        if (headerVersion > archiveHeaderVersion || headerVersion < 0)
+        {
+            _errors->add(services::ErrorUnsupportedArchiveVersion);
+        }
+        else if (headerVersion >= 1 && headerValues[0] != 0)
+        {
+            const size_t arrayAlignment = (headerValues[0] > 0 ? (size_t)headerValues[0] : 0);
+            if (isValidArchiveArrayAlignment(arrayAlignment))
+            {
+                _arrayAlignment = arrayAlignment;
+            }
+            else
+            {
+                _errors->add(services::ErrorIncorrectArrayAlignment);
+            }
+        }
+    }
+};
+/** @} */
+} // namespace interface2
+
+namespace internal
+{
+/**
+ *  \private
+ *  Serializes the array at the aligned position if the archive is AlignedInputDataArchive
+ */
+template <typename T>
+void setAlignedArray(interface1::InputDataArchive * arch, T * ptr, size_t size)
+{
+    interface2::AlignedInputDataArchive * alignedArch = dynamic_cast<interface2::AlignedInputDataArchive *>(arch);
+    if (alignedArch)
+    {
+        alignedArch->setAlignedArray(ptr, size);
+    }
+    else
+    {
+        arch->set(ptr, size);
+    }
+}
+
+/**
+ *  \private
+ *  Deserializes the array written by setAlignedArray()
+ */
+template <typename T>
+void setAlignedArray(const interface1::OutputDataArchive * arch, T * ptr, size_t size)
+{
+    const interface2::AlignedOutputDataArchive * alignedArch = dynamic_cast<const interface2::AlignedOutputDataArchive *>(arch);
+    if (alignedArch)
+    {
+        alignedArch->setAlignedArray(ptr, size);
+    }
+    else
+    {
+        arch->set(ptr, size);
+    }
+}
+
+/**
+ *  \private
+ *  The input data archive does not provide its memory to the serialized objects
+ */
+inline services::SharedPtr<byte> getAlignedArrayView(interface1::InputDataArchive * /*arch*/, size_t /*size*/)
+{
+    return services::SharedPtr<byte>();
+}
+
+/**
+ *  \private
+ *  Returns the array written by setAlignedArray() as a view of the archive memory if the archive provides it
+ */
+inline services::SharedPtr<byte> getAlignedArrayView(const interface1::OutputDataArchive * arch, size_t size)
+{
+    const interface2::AlignedOutputDataArchive * alignedArch = dynamic_cast<const interface2::AlignedOutputDataArchive *>(arch);
+    return (alignedArch ? alignedArch->getAlignedArrayView(size) : services::SharedPtr<byte>());
+}
+} // namespace internal
+
 using interface1::DataArchiveIface;
 using interface1::DataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
+using interface1::ParallelCompressedDataArchive;
+using interface1::ParallelDecompressedDataArchive;
 using interface1::InputDataArchive;
 using interface1::OutputDataArchive;
+using interface2::AlignedDataArchiveIface;
+using interface2::AlignedDataArchive;
+using interface2::MappedDataArchive;
+using interface2::AlignedInputDataArchive;
+using interface2::AlignedOutputDataArchive;
 
 } // namespace data_management
 } // namespace daal
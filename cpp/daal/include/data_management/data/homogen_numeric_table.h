@@ -810,14 +810,22 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(archive);
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The table refers to the data in the archive memory if the archive provides it */
+            services::SharedPtr<byte> view = data_management::internal::getAlignedArrayView(archive, size * sizeof(DataType));
+            if (view)
+            {
+                _ptr       = view;
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
-        archive->set((DataType *)_ptr.get(), size);
+        data_management::internal::setAlignedArray(archive, (DataType *)_ptr.get(), size);
 
         return services::Status();
     }
@@ -19,6 +19,7 @@
 #define __DAAL_SERVICES_COMMUNICATOR_H__
 
 #include "services/daal_shared_ptr.h"
+#include "services/collection.h"
 #include "services/internal/utilities.h"
 #include "sycl/internal/communicator.h"
 
@@ -71,9 +72,35 @@ public:
     EmptyCommunicator() : Communicator(new daal::preview::comm::internal::DummyCommunicator()) {}
 };
 
+/**
+ *  <a name="DAAL-CLASS-SERVICES__SHAREDMEMORYCOMMUNICATOR"></a>
+ *  \brief Communicator between the ranks that run in the threads of one process.
+ *   Lets the distributed algorithms be tested and benchmarked without an inter-process communication layer.
+ *   The buffers passed to the collective operations must be accessible on the host
+ */
+class DAAL_EXPORT SharedMemoryCommunicator : public Communicator
+{
+public:
+    /** Creates the communicator that does not belong to any group */
+    SharedMemoryCommunicator() {}
+
+    /**
+     * Creates the group of communicators, one per rank.
+     * Every collective operation must be called by all ranks of the group, each rank from its own thread
+     * \param[in]  nRanks  Number of ranks in the group
+     * \param[out] status  Status of the creation
+     * \return Collection of the communicators, where the i-th element is the communicator of the rank i
+     */
+    static daal::services::Collection<SharedMemoryCommunicator> createGroup(size_t nRanks, daal::services::Status * status = NULL);
+
+private:
+    explicit SharedMemoryCommunicator(daal::preview::comm::internal::CommunicatorIface * impl) : Communicator(impl) {}
+};
+
 /** @} */
 } // namespace interface1
 using interface1::Communicator;
+using interface1::SharedMemoryCommunicator;
 } // namespace services
 } // namespace preview
 } // namespace daal
@@ -340,13 +340,15 @@ const int SERIALIZATION_TANH_RESULT_ID     = 103400;
 const int SERIALIZATION_SMOOTHRELU_RESULT_ID = 103500;
 const int SERIALIZATION_ABS_RESULT_ID        = 103600;
 
-const int SERIALIZATION_OBJECTIVE_FUNCTION_RESULT_ID = 103700;
-const int SERIALIZATION_ITERATIVE_SOLVER_RESULT_ID   = 103810;
-const int SERIALIZATION_ADAGRAD_RESULT_ID            = 103820;
-const int SERIALIZATION_LBFGS_RESULT_ID              = 103830;
-const int SERIALIZATION_SGD_RESULT_ID                = 103840;
-const int SERIALIZATION_SAGA_RESULT_ID               = 103850;
-const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID = 103860;
+const int SERIALIZATION_OBJECTIVE_FUNCTION_RESULT_ID    = 103700;
+const int SERIALIZATION_OBJECTIVE_FUNCTION_RESULT_V2_ID = 103710;
+const int SERIALIZATION_ITERATIVE_SOLVER_RESULT_ID      = 103810;
+const int SERIALIZATION_ADAGRAD_RESULT_ID               = 103820;
+const int SERIALIZATION_LBFGS_RESULT_ID                 = 103830;
+const int SERIALIZATION_SGD_RESULT_ID                   = 103840;
+const int SERIALIZATION_SAGA_RESULT_ID                  = 103850;
+const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID    = 103860;
+const int SERIALIZATION_NEWTON_CG_RESULT_ID             = 103870;
 
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID = 103900;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID = 103910;
@@ -140,6 +140,8 @@ enum ErrorID
     ErrorCloneMethodFailed                            = -78, /*!< Cloning of algorithm failed */
     ErrorDataTypeNotSupported                         = -79, /*!< Data type not supported */
     ErrorBufferSizeIntegerOverflow                    = -80, /*!< Integer oveflow is occured during buffer size calculation */
+    ErrorIncorrectArrayAlignment                      = -81, /*!< Incorrect alignment of the arrays in the data archive */
+    ErrorUnsupportedArchiveVersion                    = -82, /*!< Data archive header version is not supported */
 
     // Environment errors: -2000..-2999
     ErrorCpuNotSupported          = -2000, /*!< CPU not supported */
@@ -327,6 +329,8 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+
+    ErrorCompressionFrameFormat = -9023, /*!< Input compressed stream is not in the frame format or corrupted */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -425,7 +429,9 @@ enum ErrorID
     ErrorInconsistenceModelAndBatchSizeInParameter = -1000008, /*!< Inconsistence of model and batch size parameter in optimization solver */
 
     ErrorCanNotLoadDynamicLibrary       = -1000009, /*!< Failure during loading of dynamic library */
-    ErrorCanNotLoadDynamicLibrarySymbol = -1000010  /*!< Failure during loading symbol from dynamic library */
+    ErrorCanNotLoadDynamicLibrarySymbol = -1000010, /*!< Failure during loading symbol from dynamic library */
+
+    ErrorCollectiveComputationFailed = -1000011 /*!< Computation failed on another rank of the communicator */
 };
 /** @} */
 } // namespace services
@@ -0,0 +1,131 @@
+/* file: threading_context.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface of the per-call threading context used by the library algorithms
+//--
+*/
+
+#ifndef __DAAL_THREADING_CONTEXT_H__
+#define __DAAL_THREADING_CONTEXT_H__
+
+#include "services/daal_defines.h"
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+class ScratchPool;
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+
+class ThreadingContext;
+typedef services::SharedPtr<ThreadingContext> ThreadingContextPtr;
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__THREADINGCONTEXT"></a>
+ *  \brief Threading context of an algorithm call. The computations of an algorithm that is given
+ *         a threading context run in the task arena of the context and use at most getMaxThreads() threads,
+ *         independently of the global number of threads set via Environment::setNumberOfThreads().
+ *         Several algorithms running concurrently with different threading contexts do not compete
+ *         for the same global threading setting.
+ */
+class DAAL_EXPORT ThreadingContext : public Base
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Constructs the threading context that owns its own task arena
+     * \param[in]  maxThreads  Maximal number of threads used by the computations in the context.
+     *                         Zero means the number of threads available to the library
+     * \param[out] stat        Status of the context construction
+     * \return Threading context
+     */
+    static ThreadingContextPtr create(size_t maxThreads = 0, services::Status * stat = NULL);
+
+    /**
+     * Constructs the threading context over the task arena provided by the caller.
+     * The arena is not owned by the context and must outlive it
+     * \param[in]  taskArena   Pointer to tbb::task_arena object owned by the caller
+     * \param[out] stat        Status of the context construction
+     * \return Threading context
+     */
+    static ThreadingContextPtr createFromTaskArena(void * taskArena, services::Status * stat = NULL);
+
+    virtual ~ThreadingContext();
+
+    /**
+     * Returns the maximal number of threads used by the computations in the context
+     * \return Maximal number of threads
+     */
+    size_t getMaxThreads() const { return _maxThreads; }
+
+    /**
+     * Returns the task arena the computations in the context run in
+     * \return Pointer to the task arena
+     */
+    void * getTaskArena() const { return _taskArena; }
+
+    /**
+     * Returns the peak size of the temporary scratch memory used by the computations in the context,
+     * summed over the threads of the context, since the context creation or the last call of resetPeakScratchSize()
+     * \return Peak size of the scratch memory in bytes
+     */
+    size_t getPeakScratchSize() const;
+
+    /**
+     * Resets the peak size of the scratch memory used by the computations in the context
+     */
+    void resetPeakScratchSize();
+
+    /** \private */
+    internal::ScratchPool * getScratchPool() const { return _scratchPool; }
+
+private:
+    ThreadingContext(size_t maxThreads, services::Status & stat);
+    ThreadingContext(void * taskArena, services::Status & stat);
+
+    ThreadingContext(const ThreadingContext &);
+    ThreadingContext & operator=(const ThreadingContext &);
+
+    void * _taskArena;
+    bool _ownsTaskArena;
+    size_t _maxThreads;
+    internal::ScratchPool * _scratchPool;
+};
+/** @} */
+} // namespace interface1
+
+using interface1::ThreadingContext;
+using interface1::ThreadingContextPtr;
+
+} // namespace services
+} // namespace daal
+#endif
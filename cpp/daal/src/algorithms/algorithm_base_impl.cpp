@@ -25,6 +25,7 @@
 #include "algorithms/algorithm_base_mode_impl.h"
 #include "src/algorithms/argument_storage.h"
 #include "src/services/service_algo_utils.h"
+#include "src/services/service_scratch_allocator.h"
 
 #include "src/threading/service_thread_pinner.h"
 #include "src/services/service_topo.h"
@@ -141,6 +142,28 @@ void setHostApp(const services::SharedPtr<services::HostAppIface> & pHostApp, da
     if (ptr) ptr->setExtension(algorithms::internal::ArgumentStorage::hostApp, pHostApp);
 }
 
+services::ThreadingContextPtr getThreadingContext(daal::algorithms::Input & inp)
+{
+    auto storage = StorageAccessor::get(inp);
+    if (!storage) return services::ThreadingContextPtr();
+    auto ext = storage->getExtension(algorithms::internal::ArgumentStorage::threadingContext);
+    DAAL_ASSERT(!ext.get() || dynamic_cast<services::ThreadingContext *>(ext.get()));
+    return services::dynamicPointerCast<services::ThreadingContext>(ext);
+}
+
+void setThreadingContext(const services::ThreadingContextPtr & pContext, daal::algorithms::Input & inp)
+{
+    auto ptr = StorageAccessor::get(inp);
+    if (ptr) ptr->setExtension(algorithms::internal::ArgumentStorage::threadingContext, pContext);
+}
+
+ScratchPool * scratchPool(daal::algorithms::Input & inp)
+{
+    services::ThreadingContextPtr pContext = getThreadingContext(inp);
+    ScratchPool * pool                     = pContext ? pContext->getScratchPool() : nullptr;
+    return pool ? pool : getDefaultScratchPool();
+}
+
 } //namespace internal
 } //namespace services
 
@@ -178,19 +201,28 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
     s = setupCompute();
     if (s)
     {
-#if !(defined DAAL_THREAD_PINNING_DISABLED)
-        daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
-
-        if (pinner != NULL)
+        services::ThreadingContextPtr pContext = threadingContext();
+        if (pContext)
         {
-            TaskWrapper<AlgorithmContainerImpl<mode> > task(this->_ac);
-            pinner->execute(task);
-            s |= task.getStatus();
+            services::internal::executeInThreadingContext(pContext, [&]() { s = this->_ac->compute(); });
         }
         else
-#endif
         {
-            s = this->_ac->compute();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+            daal::services::internal::thread_pinner_t * pinner =
+                daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+
+            if (pinner != NULL)
+            {
+                TaskWrapper<AlgorithmContainerImpl<mode> > task(this->_ac);
+                pinner->execute(task);
+                s |= task.getStatus();
+            }
+            else
+#endif
+            {
+                s = this->_ac->compute();
+            }
         }
     }
 
@@ -210,6 +242,26 @@ void AlgorithmImpl<mode>::setHostApp(const services::HostAppIfacePtr & pHost)
     if (this->_in) services::internal::setHostApp(pHost, *this->_in);
 }
 
+template <ComputeMode mode>
+services::ThreadingContextPtr AlgorithmImpl<mode>::threadingContext()
+{
+    return this->_in ? services::internal::getThreadingContext(*this->_in) : services::ThreadingContextPtr();
+}
+
+template <ComputeMode mode>
+void AlgorithmImpl<mode>::setThreadingContext(const services::ThreadingContextPtr & pContext)
+{
+    if (this->_in) services::internal::setThreadingContext(pContext, *this->_in);
+}
+
+template <ComputeMode mode>
+services::Status AlgorithmImpl<mode>::runFinalizeCompute()
+{
+    services::Status s;
+    services::internal::executeInThreadingContext(threadingContext(), [&]() { s = this->_ac->finalizeCompute(); });
+    return s;
+}
+
 /**
  * Computes final results of the algorithm in the %batch mode without possibility of throwing an exception.
  */
@@ -237,19 +289,28 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
 
     if (s)
     {
-#if !(defined DAAL_THREAD_PINNING_DISABLED)
-        daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
-
-        if (pinner != NULL)
+        services::ThreadingContextPtr pContext = threadingContext();
+        if (pContext)
         {
-            TaskWrapper<AlgorithmContainerImpl<batch> > task(_ac);
-            pinner->execute(task);
-            s |= task.getStatus();
+            services::internal::executeInThreadingContext(pContext, [&]() { s |= this->_ac->compute(); });
         }
         else
-#endif
         {
-            s |= this->_ac->compute();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+            daal::services::internal::thread_pinner_t * pinner =
+                daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+
+            if (pinner != NULL)
+            {
+                TaskWrapper<AlgorithmContainerImpl<batch> > task(_ac);
+                pinner->execute(task);
+                s |= task.getStatus();
+            }
+            else
+#endif
+            {
+                s |= this->_ac->compute();
+            }
         }
     }
 
@@ -268,6 +329,16 @@ void AlgorithmImpl<batch>::setHostApp(const services::HostAppIfacePtr & pHost)
     if (this->_in) services::internal::setHostApp(pHost, *this->_in);
 }
 
+services::ThreadingContextPtr AlgorithmImpl<batch>::threadingContext()
+{
+    return this->_in ? services::internal::getThreadingContext(*this->_in) : services::ThreadingContextPtr();
+}
+
+void AlgorithmImpl<batch>::setThreadingContext(const services::ThreadingContextPtr & pContext)
+{
+    if (this->_in) services::internal::setThreadingContext(pContext, *this->_in);
+}
+
 template class interface1::AlgorithmImpl<online>;
 template class interface1::AlgorithmImpl<distributed>;
 } // namespace algorithms
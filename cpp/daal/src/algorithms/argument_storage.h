@@ -36,7 +36,8 @@ class ArgumentStorage : public data_management::DataCollection
 public:
     enum Extension
     {
-        hostApp = 0
+        hostApp          = 0,
+        threadingContext = 1
     };
     DAAL_CAST_OPERATOR(ArgumentStorage);
     ArgumentStorage(const size_t n) : data_management::DataCollection(n) {}
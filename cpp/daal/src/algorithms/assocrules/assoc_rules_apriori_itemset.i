@@ -178,6 +178,29 @@ struct ItemSetList
         return true;
     }
 
+    /* Add Node detached from another list to the end of the list */
+    void append(Node * node)
+    {
+        node->setNext(NULL);
+        if (size > 0)
+            end->setNext(node);
+        else
+            start = node;
+        end = node;
+        size++;
+    }
+
+    /* Detaches all Nodes from the list and returns the first of them, the caller owns the Nodes */
+    Node * detach()
+    {
+        Node * first = start;
+        start        = NULL;
+        end          = NULL;
+        current      = NULL;
+        size         = 0;
+        return first;
+    }
+
     /* Removes current Node and its content */
     void removeNode(Node * node, Node * prev)
     {
@@ -49,6 +49,9 @@ public:
     services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
 
 protected:
+    /** Write "large" item sets into the resulting tables and build association rules from them */
+    services::Status writeResults(ItemSetList<cpu> * L, size_t L_size, const Parameter * parameter, NumericTable * r[]);
+
     services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
                                        size_t & L_size);
 
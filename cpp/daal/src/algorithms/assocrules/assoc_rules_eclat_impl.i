@@ -0,0 +1,376 @@
+/* file: assoc_rules_eclat_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of association rules Eclat method.
+//
+//  "Large" item sets are mined depth first over the vertical representation
+//  of the data set: the support of an item set is the number of bits set in
+//  the intersection of the transaction bit sets of its items. The classes of
+//  item sets that share a prefix of two items are mined in parallel.
+//--
+*/
+
+#ifndef __ASSOC_RULES_ECLAT_IMPL_I__
+#define __ASSOC_RULES_ECLAT_IMPL_I__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_impl.i"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+
+using namespace daal::algorithms::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/** Number of bits set in the 64-bit word */
+template <CpuType cpu>
+inline size_t bitCount(DAAL_UINT64 x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (size_t)((x * 0x0101010101010101ULL) >> 56);
+#else
+    return (size_t)__builtin_popcountll(x);
+#endif
+}
+
+/** Number of transactions in the intersection of two transaction bit sets */
+template <CpuType cpu>
+size_t intersectionSupport(const DAAL_UINT64 * a, const DAAL_UINT64 * b, size_t nWords)
+{
+    size_t support = 0;
+    for (size_t i = 0; i < nWords; ++i)
+    {
+        support += bitCount<cpu>(a[i] & b[i]);
+    }
+    return support;
+}
+
+/** Intersection of two transaction bit sets */
+template <CpuType cpu>
+void intersect(const DAAL_UINT64 * a, const DAAL_UINT64 * b, DAAL_UINT64 * c, size_t nWords)
+{
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nWords; ++i)
+    {
+        c[i] = a[i] & b[i];
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<eclat, algorithmFPType, cpu>::compute(const NumericTable * a, NumericTable * r[],
+                                                                    const daal::algorithms::Parameter * algParameter)
+{
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter * parameter =
+        static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    const double minSupport = parameter->minSupport;
+
+    /* Create association rules data set from input numeric table */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+    DAAL_CHECK_STATUS_OK(data.ok(), data.getLastStatus());
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, data.numOfUniqueItems, sizeof(ItemSetList<cpu>));
+
+    TArray<ItemSetList<cpu>, cpu> L(data.numOfUniqueItems);
+    DAAL_CHECK(L.get(), ErrorMemoryAllocationFailed);
+    for (size_t i = 0, n = L.size(); i < n; ++i) L[i].setDataOwner(true);
+
+    /* Find "large" itemsets */
+    size_t L_size         = 0;
+    size_t maxItemsetSize = ((parameter->maxItemsetSize == 0) ? (size_t)-1 : parameter->maxItemsetSize);
+    double ceil           = daal::internal::Math<double, cpu>::sCeil(minSupport * data.numOfTransactions);
+    DAAL_ASSERT(ceil >= 0)
+    services::Status statLargeItemset = findLargeItemsets((size_t)ceil, maxItemsetSize, data, L.get(), L_size);
+    DAAL_CHECK_STATUS_OK(statLargeItemset.ok(), statLargeItemset);
+    DAAL_ASSERT(L_size > 0);
+
+    return this->writeResults(L.get(), L_size, parameter, r);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<eclat, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                        assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                                                                        size_t & L_size)
+{
+    /* Form list of "large" item sets of size 1 from the unique items */
+    services::Status s = this->firstPass(minSupport, data, *L);
+    DAAL_CHECK_STATUS_VAR(s);
+    L_size = 1;
+
+    const size_t nItems                           = data.numOfUniqueItems;
+    const assocRulesUniqueItem<cpu> * uniqueItems = data.uniq_items;
+    if (nItems < 2 || data.numOfLargeTransactions == 0) return s;
+
+    assocrules_tid_bitsets<cpu> tids;
+    DAAL_CHECK_STATUS(s, buildTidBitsets(data, tids));
+
+    TArray<TArray<ItemExtension, cpu>, cpu> classes(nItems);
+    DAAL_CHECK_MALLOC(classes.get());
+    DAAL_CHECK_STATUS(s, findLargePairs(minSupport, tids, classes.get()));
+
+    /* Form list of "large" item sets of size 2 in the lexicographical order */
+    TArray<size_t, cpu> classOffsets(nItems + 1);
+    DAAL_CHECK_MALLOC(classOffsets.get());
+    classOffsets[0] = 0;
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        for (size_t k = 0; k < classes[i].size(); ++k)
+        {
+            assocrules_itemset<cpu> * iset = new assocrules_itemset<cpu>(2, &(uniqueItems[i].itemID), uniqueItems[classes[i][k].item].itemID,
+                                                                         classes[i][k].support);
+            DAAL_CHECK_MALLOC(iset);
+            if (!iset->ok() || !L[1].insert(iset))
+            {
+                s = (iset->ok() ? services::Status(services::ErrorMemoryAllocationFailed) : iset->getLastStatus());
+                delete iset;
+                return s;
+            }
+        }
+        classOffsets[i + 1] = classOffsets[i] + classes[i].size();
+    }
+
+    const size_t nPairs = classOffsets[nItems];
+    if (nPairs == 0) return s;
+    L_size = 2;
+
+    /* Apriori method always searches for the item sets of size 2, whatever the maximal item set size is */
+    if (maxItemsetSize <= 2 || nPairs < 3) return s;
+
+    /* Each "large" item set of size 2 is the prefix of a class of item sets.
+       The classes are mined in parallel, the item sets of each class are collected into a separate list */
+    TArray<size_t, cpu> pairClass(nPairs);
+    TArray<ItemSetList<cpu>, cpu> classLists(nPairs);
+    DAAL_CHECK_MALLOC(pairClass.get() && classLists.get());
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        for (size_t p = classOffsets[i]; p < classOffsets[i + 1]; ++p) pairClass[p] = i;
+    }
+    for (size_t p = 0; p < nPairs; ++p) classLists[p].setDataOwner(true);
+
+    const size_t maxPrefixSize = (maxItemsetSize < nItems ? maxItemsetSize : nItems);
+
+    SafeStatus safeStat;
+    daal::threader_for(nPairs, nPairs, [&](size_t p) {
+        const size_t i                            = pairClass[p];
+        const size_t jPos                         = p - classOffsets[i];
+        const TArray<ItemExtension, cpu> & iClass = classes[i];
+        const size_t j                            = iClass[jPos].item;
+        const TArray<ItemExtension, cpu> & jClass = classes[j];
+        const size_t nCandidatesMax               = iClass.size() - jPos - 1;
+        if (!nCandidatesMax || !jClass.size()) return;
+
+        /* Candidates to extend the prefix {i, j} are the items k > j such that both {i, k} and {j, k} are "large" */
+        TArrayScalable<ItemExtension, cpu> candidates(nCandidatesMax);
+        DAAL_CHECK_MALLOC_THR(candidates.get());
+        size_t nCandidates = 0;
+        for (size_t a = jPos + 1, b = 0; a < iClass.size() && b < jClass.size();)
+        {
+            if (iClass[a].item < jClass[b].item)
+            {
+                ++a;
+            }
+            else if (jClass[b].item < iClass[a].item)
+            {
+                ++b;
+            }
+            else
+            {
+                candidates[nCandidates++] = iClass[a++];
+                ++b;
+            }
+        }
+        if (!nCandidates) return;
+
+        TArrayScalable<DAAL_UINT64, cpu> pairTids(tids.nWords);
+        TArrayScalable<size_t, cpu> prefix(maxPrefixSize);
+        DAAL_CHECK_MALLOC_THR(pairTids.get() && prefix.get());
+        intersect<cpu>(tids.get(i), tids.get(j), pairTids.get(), tids.nWords);
+        prefix[0] = uniqueItems[i].itemID;
+        prefix[1] = uniqueItems[j].itemID;
+
+        services::Status localStatus =
+            mineClass(minSupport, maxItemsetSize, data, tids, prefix.get(), 2, pairTids.get(), candidates.get(), nCandidates, classLists[p]);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Concatenation of the class lists in the order of their prefixes keeps the lexicographical order of the item sets of each size */
+    for (size_t p = 0; p < nPairs; ++p)
+    {
+        for (auto * node = classLists[p].detach(); node;)
+        {
+            auto * next = node->next();
+            L[node->itemSet()->size - 1].append(node);
+            node = next;
+        }
+    }
+    while (L_size < nItems && L[L_size].size > 0) ++L_size;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<eclat, algorithmFPType, cpu>::buildTidBitsets(const assocrules_dataset<cpu> & data,
+                                                                                      assocrules_tid_bitsets<cpu> & tids)
+{
+    const size_t nItems                           = data.numOfUniqueItems;
+    const size_t nTransactions                    = data.numOfLargeTransactions;
+    const assocRulesUniqueItem<cpu> * uniqueItems = data.uniq_items;
+
+    /* Unique items are sorted by ID, map the item ID to the index of the unique item */
+    const size_t maxItemID = uniqueItems[nItems - 1].itemID;
+    TArray<size_t, cpu> itemIndex(maxItemID + 1);
+    DAAL_CHECK_MALLOC(itemIndex.get());
+    for (size_t i = 0; i < nItems; ++i) itemIndex[uniqueItems[i].itemID] = i;
+
+    tids.nItems = nItems;
+    tids.nWords = (nTransactions + 63) / 64;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems, tids.nWords);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems * tids.nWords, sizeof(DAAL_UINT64));
+    tids.bits.reset(nItems * tids.nWords);
+    DAAL_CHECK_MALLOC(tids.bits.get());
+
+    /* Each block of transactions sets its own range of words in the bit sets */
+    const size_t nWordsInBlock                              = 1024;
+    const size_t nTransactionsInBlock                       = nWordsInBlock * 64;
+    const size_t nBlocks                                    = (tids.nWords + nWordsInBlock - 1) / nWordsInBlock;
+    const size_t nWords                                     = tids.nWords;
+    const size_t * index                                    = itemIndex.get();
+    DAAL_UINT64 * bits                                      = tids.bits.get();
+    assocrules_transaction<cpu> * const * largeTransactions = data.large_tran;
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * nTransactionsInBlock;
+        const size_t last  = (nTransactions - first < nTransactionsInBlock ? nTransactions : first + nTransactionsInBlock);
+        for (size_t t = first; t < last; ++t)
+        {
+            const assocrules_transaction<cpu> * tran = largeTransactions[t];
+            const DAAL_UINT64 mask                   = (DAAL_UINT64)1 << (t & 63);
+            for (size_t k = 0; k < tran->size; ++k)
+            {
+                bits[index[tran->items[k]] * nWords + (t >> 6)] |= mask;
+            }
+        }
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<eclat, algorithmFPType, cpu>::findLargePairs(size_t minSupport, const assocrules_tid_bitsets<cpu> & tids,
+                                                                                     TArray<ItemExtension, cpu> * classes)
+{
+    const size_t nItems = tids.nItems;
+
+    SafeStatus safeStat;
+    daal::threader_for(nItems - 1, nItems - 1, [&](size_t i) {
+        TArrayScalable<ItemExtension, cpu> pairs(nItems - i - 1);
+        DAAL_CHECK_MALLOC_THR(pairs.get());
+
+        size_t nPairs = 0;
+        for (size_t j = i + 1; j < nItems; ++j)
+        {
+            const size_t support = intersectionSupport<cpu>(tids.get(i), tids.get(j), tids.nWords);
+            if (support >= minSupport)
+            {
+                pairs[nPairs].item    = j;
+                pairs[nPairs].support = support;
+                ++nPairs;
+            }
+        }
+        if (!nPairs) return;
+
+        classes[i].reset(nPairs);
+        DAAL_CHECK_MALLOC_THR(classes[i].get());
+        for (size_t k = 0; k < nPairs; ++k) classes[i][k] = pairs[k];
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<eclat, algorithmFPType, cpu>::mineClass(size_t minSupport, size_t maxItemsetSize,
+                                                                                const assocrules_dataset<cpu> & data,
+                                                                                const assocrules_tid_bitsets<cpu> & tids, size_t * prefix,
+                                                                                size_t prefixSize, const DAAL_UINT64 * prefixTids,
+                                                                                const ItemExtension * candidates, size_t nCandidates,
+                                                                                ItemSetList<cpu> & list)
+{
+    /* Items of the class that extend the prefix to a "large" item set */
+    TArrayScalable<ItemExtension, cpu> extensions(nCandidates);
+    DAAL_CHECK_MALLOC(extensions.get());
+    size_t nExtensions = 0;
+    for (size_t c = 0; c < nCandidates; ++c)
+    {
+        const size_t support = intersectionSupport<cpu>(prefixTids, tids.get(candidates[c].item), tids.nWords);
+        if (support >= minSupport)
+        {
+            extensions[nExtensions].item    = candidates[c].item;
+            extensions[nExtensions].support = support;
+            ++nExtensions;
+        }
+    }
+    if (!nExtensions) return services::Status();
+
+    const bool bNextSize = (prefixSize + 2 <= maxItemsetSize) && (nExtensions > 1);
+    TArrayScalable<DAAL_UINT64, cpu> extensionTids(bNextSize ? tids.nWords : 0);
+    DAAL_CHECK_MALLOC(!bNextSize || extensionTids.get());
+
+    services::Status s;
+    for (size_t e = 0; e < nExtensions; ++e)
+    {
+        const size_t itemID            = data.uniq_items[extensions[e].item].itemID;
+        assocrules_itemset<cpu> * iset = new assocrules_itemset<cpu>(prefixSize + 1, prefix, itemID, extensions[e].support);
+        DAAL_CHECK_MALLOC(iset);
+        if (!iset->ok() || !list.insert(iset))
+        {
+            s = (iset->ok() ? services::Status(services::ErrorMemoryAllocationFailed) : iset->getLastStatus());
+            delete iset;
+            return s;
+        }
+
+        /* Item sets with the prefix extended by the current item are listed right after it,
+           only the items that follow the current one in the class can extend them */
+        if (bNextSize && e + 1 < nExtensions)
+        {
+            intersect<cpu>(prefixTids, tids.get(extensions[e].item), extensionTids.get(), tids.nWords);
+            prefix[prefixSize] = itemID;
+            DAAL_CHECK_STATUS(s, mineClass(minSupport, maxItemsetSize, data, tids, prefix, prefixSize + 1, extensionTids.get(),
+                                           extensions.get() + e + 1, nExtensions - e - 1, list));
+        }
+    }
+    return s;
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
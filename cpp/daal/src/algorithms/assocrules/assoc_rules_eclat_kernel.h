@@ -0,0 +1,100 @@
+/* file: assoc_rules_eclat_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using Eclat method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_ECLAT_KERNEL_H__
+#define __ASSOC_RULES_ECLAT_KERNEL_H__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/** \brief Item that extends the prefix of an item set class */
+struct ItemExtension
+{
+    size_t item;    /*<! Index of the item in the array of unique items */
+    size_t support; /*<! Support of the prefix extended with the item */
+};
+
+/**
+ *  \brief Vertical representation of the data set: the bit set of the transactions that contain the item
+ *         is stored for each unique item. Only the transactions perspective for "large" itemsets search are indexed
+ */
+template <CpuType cpu>
+struct assocrules_tid_bitsets
+{
+    assocrules_tid_bitsets() : nItems(0), nWords(0) {}
+
+    const DAAL_UINT64 * get(size_t item) const { return bits.get() + item * nWords; }
+
+    TArrayScalableCalloc<DAAL_UINT64, cpu> bits; /*<! Bit sets of the items, nWords words per item */
+    size_t nItems;                               /*<! Number of unique items */
+    size_t nWords;                               /*<! Number of 64-bit words in the bit set of an item */
+};
+
+/**
+ *  Structure that contains kernels for Eclat association rules mining.
+ *  Produces the same "large" item sets in the same order as the Apriori method,
+ *  so the resulting tables and the association rules are built by the Apriori kernel
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<eclat, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+    typedef AssociationRulesKernel<apriori, algorithmFPType, cpu> super;
+
+public:
+    /** Find "large" item sets and build association rules */
+    services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
+
+protected:
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                       size_t & L_size);
+
+    /** Build the bit sets of transactions for the unique items */
+    services::Status buildTidBitsets(const assocrules_dataset<cpu> & data, assocrules_tid_bitsets<cpu> & tids);
+
+    /** Find "large" item sets of size 2, classes[i] contains the items that extend the i-th unique item */
+    services::Status findLargePairs(size_t minSupport, const assocrules_tid_bitsets<cpu> & tids, TArray<ItemExtension, cpu> * classes);
+
+    /** Find "large" item sets that extend the prefix with the given transactions, depth first.
+        Item sets are appended to the list in the lexicographical order within each size */
+    services::Status mineClass(size_t minSupport, size_t maxItemsetSize, const assocrules_dataset<cpu> & data,
+                               const assocrules_tid_bitsets<cpu> & tids, size_t * prefix, size_t prefixSize, const DAAL_UINT64 * prefixTids,
+                               const ItemExtension * candidates, size_t nCandidates, ItemSetList<cpu> & list);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -40,96 +40,73 @@ namespace internal
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status BernoulliKernel<algorithmFPType, method, cpu>::computeInt(int * resultArray, size_t n, algorithmFPType p, engines::BatchBase & engine)
 {
-    const int one              = 1;
-    const int zero             = 0;
-    const size_t nElemsInBlock = 1024;
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
 
-    size_t nBlocks = n / nElemsInBlock;
-    nBlocks += (nBlocks * nElemsInBlock != n);
+    /* The values are generated by blocks of the uniform numbers in the sequence of the engine,
+       so the result does not depend on the number of threads */
+    auto generate = [=](engines::internal::BatchBaseImpl & blockEngine, size_t nValues, int * values) -> Status {
+        const int one              = 1;
+        const int zero             = 0;
+        const size_t nElemsInBlock = 1024;
 
-    algorithmFPType buffer[nElemsInBlock];
+        algorithmFPType buffer[nElemsInBlock];
 
-    size_t nElemsToProcess = nElemsInBlock;
-    Status s;
-    for (size_t block = 0; block < nBlocks; block++)
-    {
-        size_t nProcessed = block * nElemsInBlock;
-        int * array       = resultArray + nProcessed;
-        if (block == nBlocks - 1)
+        Status s;
+        for (size_t nProcessed = 0; nProcessed < nValues; nProcessed += nElemsInBlock)
         {
-            nElemsToProcess = n - nProcessed;
-        }
-        DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, engine, nElemsToProcess, buffer)));
+            const size_t nElemsToProcess = (nValues - nProcessed < nElemsInBlock ? nValues - nProcessed : nElemsInBlock);
+            DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, blockEngine, nElemsToProcess, buffer)));
 
-        for (size_t j = 0; j < nElemsToProcess; j++)
-        {
-            array[j] = ((buffer[j] < p) ? one : zero);
+            int * array = values + nProcessed;
+            for (size_t j = 0; j < nElemsToProcess; j++)
+            {
+                array[j] = ((buffer[j] < p) ? one : zero);
+            }
         }
-    }
-    return s;
+        return s;
+    };
+    return engines::internal::generateInParallel<int, cpu>(*engineImpl, n, resultArray, generate);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status BernoulliKernel<algorithmFPType, method, cpu>::computeFPType(NumericTable * resultTable, algorithmFPType p, engines::BatchBase & engine)
 {
-    const algorithmFPType one  = 1;
-    const algorithmFPType zero = 0;
-    const size_t nElemsInBlock = 1024;
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
 
-    size_t nRows = resultTable->getNumberOfRows();
-    size_t nCols = resultTable->getNumberOfColumns();
-
-    Status s;
+    auto generate = [=](engines::internal::BatchBaseImpl & blockEngine, size_t nValues, algorithmFPType * values) -> Status {
+        const algorithmFPType one  = 1;
+        const algorithmFPType zero = 0;
 
-    if (nElemsInBlock > nCols)
-    {
-        size_t nRowsInBlock = nElemsInBlock / nCols;
-        size_t nRowBlocks   = nRows / nRowsInBlock;
-        nRowBlocks += (nRowBlocks * nRowsInBlock != nRows);
-
-        for (size_t block = 0; block < nRowBlocks; block++) /* blocking by rows */
+        Status s;
+        DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, blockEngine, nValues, values)));
+        for (size_t j = 0; j < nValues; j++)
         {
-            size_t nProcessedRows = block * nRowsInBlock;
-            size_t nRowsToProcess = (block == nRowBlocks - 1) ? (nRows - nProcessedRows) : nRowsInBlock;
-
-            daal::internal::WriteRows<algorithmFPType, cpu> resultBlock(resultTable, nProcessedRows, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS(resultBlock);
-            algorithmFPType * resultArray = resultBlock.get();
+            values[j] = ((values[j] < p) ? one : zero);
+        }
+        return s;
+    };
 
-            size_t nElemsToProcess = nRowsToProcess * nCols;
-            DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, engine, nElemsToProcess, resultArray)));
+    /* Blocks of rows are large enough to be generated in parallel and bound the memory of the tables that copy the rows */
+    const size_t nElemsInBlock = 1 << 22;
 
-            for (size_t j = 0; j < nElemsToProcess; j++)
-            {
-                resultArray[j] = ((resultArray[j] < p) ? one : zero);
-            }
-        }
-    }
-    else
-    {
-        size_t nColBlocks = nCols / nElemsInBlock;
-        nColBlocks += (nColBlocks * nElemsInBlock != nCols);
+    const size_t nRows = resultTable->getNumberOfRows();
+    const size_t nCols = resultTable->getNumberOfColumns();
 
-        for (size_t block = 0; block < nRows; block++) /* blocking by rows */
-        {
-            daal::internal::WriteRows<algorithmFPType, cpu> resultBlock(resultTable, block, 1);
-            DAAL_CHECK_BLOCK_STATUS(resultBlock);
-            algorithmFPType * resultArray = resultBlock.get();
+    size_t nRowsInBlock = nElemsInBlock / nCols;
+    if (nRowsInBlock == 0) nRowsInBlock = 1;
 
-            for (size_t colBlock = 0; colBlock < nColBlocks; colBlock++) /* blocking within one column */
-            {
-                size_t nProcessedElems = nElemsInBlock * colBlock;
-                size_t nElemsToProcess = (colBlock == nColBlocks - 1) ? (nCols - nProcessedElems) : nElemsInBlock;
+    Status s;
+    for (size_t nProcessedRows = 0; nProcessedRows < nRows; nProcessedRows += nRowsInBlock) /* blocking by rows */
+    {
+        const size_t nRowsToProcess = (nRows - nProcessedRows < nRowsInBlock ? nRows - nProcessedRows : nRowsInBlock);
 
-                algorithmFPType * array = resultArray + nProcessedElems;
-                DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, engine, nElemsToProcess, array)));
+        daal::internal::WriteRows<algorithmFPType, cpu> resultBlock(resultTable, nProcessedRows, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS(resultBlock);
 
-                for (size_t j = 0; j < nElemsToProcess; j++)
-                {
-                    array[j] = ((array[j] < p) ? one : zero);
-                }
-            }
-        }
+        DAAL_CHECK_STATUS(s, (engines::internal::generateInParallel<algorithmFPType, cpu>(*engineImpl, nRowsToProcess * nCols, resultBlock.get(),
+                                                                                           generate)));
     }
     return s;
 }
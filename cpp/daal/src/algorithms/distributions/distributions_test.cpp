@@ -0,0 +1,136 @@
+/* file: distributions_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "algorithms/distributions/bernoulli/bernoulli.h"
+#include "algorithms/distributions/normal/normal.h"
+#include "algorithms/distributions/uniform/uniform.h"
+#include "algorithms/engines/mcg59/mcg59.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/env_detect.h"
+#include "gtest/gtest.h"
+
+using daal::algorithms::engines::EnginePtr;
+using daal::data_management::BlockDescriptor;
+using daal::data_management::HomogenNumericTable;
+using daal::data_management::NumericTable;
+using daal::data_management::NumericTablePtr;
+
+namespace distributions = daal::algorithms::distributions;
+namespace engines       = daal::algorithms::engines;
+
+namespace
+{
+/* Several blocks of generateInParallel() per thread, and a tail that is not a multiple of the block size */
+const size_t nRows = 9;
+const size_t nCols = (1 << 17) + 3;
+
+enum EngineKind
+{
+    mcg59Engine,
+    philoxEngine
+};
+
+EnginePtr createEngine(EngineKind kind)
+{
+    const size_t seed = 7777;
+    if (kind == mcg59Engine) return engines::mcg59::Batch<>::create(seed);
+    return engines::philox4x32x10::Batch<>::create(seed);
+}
+
+std::vector<double> readTable(const NumericTablePtr & table)
+{
+    const size_t n = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, n, daal::data_management::readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + n * table->getNumberOfColumns());
+    table->releaseBlockOfRows(block);
+    return values;
+}
+
+/* Fills the table by the distribution and returns the table followed by the next values of the engine */
+template <typename Distribution>
+std::vector<double> generate(Distribution & distribution, const EnginePtr & engine)
+{
+    NumericTablePtr table(new HomogenNumericTable<double>(nCols, nRows, NumericTable::doAllocate));
+    distribution.input.set(distributions::tableToFill, table);
+    distribution.parameter.engine = engine;
+    EXPECT_TRUE(distribution.compute().ok());
+    std::vector<double> values = readTable(table);
+
+    /* The engine must be left at the same position of its sequence */
+    NumericTablePtr next(new HomogenNumericTable<double>(16, 1, NumericTable::doAllocate));
+    distributions::uniform::Batch<double> uniform;
+    uniform.input.set(distributions::tableToFill, next);
+    uniform.parameter.engine = engine;
+    EXPECT_TRUE(uniform.compute().ok());
+    const std::vector<double> nextValues = readTable(next);
+    values.insert(values.end(), nextValues.begin(), nextValues.end());
+    return values;
+}
+
+template <typename Distribution>
+std::vector<double> generateWithThreads(size_t nThreads, EngineKind kind, Distribution distribution)
+{
+    daal::services::Environment * env = daal::services::Environment::getInstance();
+    const size_t maxThreads           = env->getNumberOfThreads();
+    env->setNumberOfThreads(nThreads);
+    const std::vector<double> values = generate(distribution, createEngine(kind));
+    env->setNumberOfThreads(maxThreads);
+    return values;
+}
+
+/* Checks that the tables filled with one thread and with all the threads are bit-identical */
+template <typename Distribution>
+void checkDeterministic(const Distribution & distribution)
+{
+    const size_t maxThreads  = daal::services::Environment::getInstance()->getNumberOfThreads();
+    const EngineKind kinds[] = { mcg59Engine, philoxEngine };
+    for (EngineKind kind : kinds)
+    {
+        SCOPED_TRACE(testing::Message() << "engine " << kind << ", threads " << maxThreads);
+        const std::vector<double> sequential = generateWithThreads(1, kind, distribution);
+        const std::vector<double> parallel   = generateWithThreads(maxThreads, kind, distribution);
+        ASSERT_EQ(sequential.size(), parallel.size());
+        for (size_t i = 0; i < sequential.size(); i++)
+        {
+            ASSERT_EQ(std::memcmp(&sequential[i], &parallel[i], sizeof(double)), 0) << "value " << i;
+        }
+    }
+}
+} // namespace
+
+TEST(distributions_test, uniform_is_independent_of_number_of_threads)
+{
+    checkDeterministic(distributions::uniform::Batch<double>(-2.0, 3.0));
+    checkDeterministic(distributions::uniform::Batch<float>(0.0f, 1.0f));
+}
+
+TEST(distributions_test, normal_is_independent_of_number_of_threads)
+{
+    checkDeterministic(distributions::normal::Batch<double>(1.0, 2.0));
+    checkDeterministic(distributions::normal::Batch<float>(0.0f, 1.0f));
+}
+
+TEST(distributions_test, bernoulli_is_independent_of_number_of_threads)
+{
+    checkDeterministic(distributions::bernoulli::Batch<double>(0.3));
+    checkDeterministic(distributions::bernoulli::Batch<float>(0.5f));
+}
@@ -46,7 +46,14 @@ Status NormalKernel<algorithmFPType, method, cpu>::compute(const normal::Paramet
 
     size_t size = nRows * resultTable->getNumberOfColumns();
 
-    return compute(parameter, engine, size, result);
+    auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    /* The table of the distribution algorithm is filled in parallel, the kernels of other algorithms generate sequentially */
+    auto generate = [=](engines::internal::BatchBaseImpl & blockEngine, size_t nValues, algorithmFPType * values) -> Status {
+        return compute(parameter, blockEngine, nValues, values);
+    };
+    return engines::internal::generateInParallel<algorithmFPType, cpu>(*engineImpl, size, result, generate);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -46,7 +46,16 @@ Status UniformKernel<algorithmFPType, method, cpu>::compute(const uniform::Param
 
     size_t n = nRows * resultTable->getNumberOfColumns();
 
-    return compute(parameter, engine, n, resultArray);
+    auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    /* The table of the distribution algorithm is filled in parallel, the kernels of other algorithms generate sequentially */
+    const algorithmFPType a = parameter.a;
+    const algorithmFPType b = parameter.b;
+    auto generate           = [=](engines::internal::BatchBaseImpl & blockEngine, size_t nValues, algorithmFPType * values) -> Status {
+        return compute(a, b, blockEngine, nValues, values);
+    };
+    return engines::internal::generateInParallel<algorithmFPType, cpu>(*engineImpl, n, resultArray, generate);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -30,6 +30,7 @@
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
 #include "src/services/service_algo_utils.h"
+#include "src/services/service_scratch_allocator.h"
 
 using namespace daal::data_management;
 
@@ -61,9 +62,11 @@ public:
      *  \param m[in]    decision forest model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param par[in]  decision forest algorithm parameters
+     *  \param scratch[in] Pool of the scratch arenas for the temporary buffers of the call
      */
     services::Status compute(services::HostAppIface * const pHostApp, const NumericTable * a, const decision_forest::classification::Model * const m,
-                             NumericTable * const r, NumericTable * const prob, const size_t nClasses, const VotingMethod votingMethod);
+                             NumericTable * const r, NumericTable * const prob, const size_t nClasses, const VotingMethod votingMethod,
+                             services::internal::ScratchPool * const scratch = nullptr);
     PredictClassificationTask<algorithmFpType, cpu> * _task;
 
 private:
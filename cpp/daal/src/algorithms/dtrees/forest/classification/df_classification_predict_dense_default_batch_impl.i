@@ -122,6 +122,7 @@ public:
           _model(nullptr),
           _nClasses(0),
           _votingMethod(lastResultId),
+          _scratch(nullptr),
           _sumTreeSize(0),
           _cachedData(nullptr),
           _cachedModel(nullptr),
@@ -130,8 +131,9 @@ public:
     {}
 
     void setParams(const NumericTable * const x, NumericTable * const y, NumericTable * const prob, const dtrees::internal::ModelImpl * const m,
-                   const size_t nClasses, const VotingMethod votingMethod)
+                   const size_t nClasses, const VotingMethod votingMethod, services::internal::ScratchPool * const scratch)
     {
+        _scratch      = scratch;
         _data         = x;
         _res          = y;
         _prob         = prob;
@@ -211,6 +213,7 @@ protected:
     size_t _nClasses;
     size_t _cachedNClasses;
     VotingMethod _votingMethod;
+    services::internal::ScratchPool * _scratch;
     static const size_t s_cMaxClassesBufSize = 32;
     services::internal::TArray<featureIndexType, cpu> _tFI;
     services::internal::TArray<leftOrClassType, cpu> _tLC;
@@ -243,12 +246,13 @@ template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * const pHostApp, const NumericTable * const x,
                                                                       const decision_forest::classification::Model * const m, NumericTable * const r,
                                                                       NumericTable * const prob, const size_t nClasses,
-                                                                      const VotingMethod votingMethod)
+                                                                      const VotingMethod votingMethod,
+                                                                      services::internal::ScratchPool * const scratch)
 {
     const daal::algorithms::decision_forest::classification::internal::ModelImpl * const pModel =
         static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl * const>(m);
     if (_task == nullptr) _task = new PredictClassificationTask<algorithmFPType, cpu>();
-    _task->setParams(x, r, prob, pModel, nClasses, votingMethod);
+    _task->setParams(x, r, prob, pModel, nClasses, votingMethod, scratch);
     return _task->run(pHostApp);
 }
 
@@ -333,9 +337,9 @@ void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algo
                                                                       const size_t blockSize, const size_t residualSize, algorithmFPType * const prob,
                                                                       const size_t iTree)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu> tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu> tFV(treeSize);
+    services::internal::TScratchArray<featureIndexType, cpu> tFI(_scratch, treeSize);
+    services::internal::TScratchArray<leftOrClassType, cpu> tLC(_scratch, treeSize);
+    services::internal::TScratchArray<algorithmFPType, cpu> tFV(_scratch, treeSize);
 
     featureIndexType * const fi = tFI.get();
     leftOrClassType * const lc  = tLC.get();
@@ -379,8 +383,8 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const
     }
     else
     {
-        services::internal::TArray<uint32_t, cpu> currentNodesT(sizeOfBlock);
-        services::internal::TArray<bool, cpu> isSplitsT(sizeOfBlock);
+        services::internal::TScratchArray<uint32_t, cpu> currentNodesT(_scratch, sizeOfBlock);
+        services::internal::TScratchArray<bool, cpu> isSplitsT(_scratch, sizeOfBlock);
         uint32_t * const currentNodes = currentNodesT.get();
         bool * isSplits               = isSplitsT.get();
         if (isSplits && currentNodes)
@@ -71,7 +71,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                                nullptr);
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations,
+                       daal::services::internal::scratchPool(*input));
 }
 
 } // namespace interface2
@@ -64,7 +64,9 @@ class PredictBinaryClassificationTask : public gbt::regression::prediction::inte
 {
 public:
     typedef gbt::regression::prediction::internal::PredictRegressionTask<algorithmFPType, cpu> super;
-    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : super(x, y), _prob(prob) {}
+    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, services::internal::ScratchPool * scratch)
+        : super(x, y, scratch), _prob(prob)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp)
     {
         DAAL_ASSERT(!nIterations || nIterations <= m->size());
@@ -86,7 +88,7 @@ public:
             WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
             DAAL_CHECK_BLOCK_STATUS(probBD);
             algorithmFPType * prob_pred = probBD.get();
-            TArray<algorithmFPType, cpu> expValPtr(nRows);
+            TScratchArray<algorithmFPType, cpu> expValPtr(this->_scratch, nRows);
             algorithmFPType * expVal = expValPtr.get();
             DAAL_CHECK_MALLOC(expVal);
             s = super::runInternal(pHostApp, this->_res);
@@ -117,7 +119,7 @@ public:
             WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
             DAAL_CHECK_BLOCK_STATUS(probBD);
             algorithmFPType * prob_pred = probBD.get();
-            TArray<algorithmFPType, cpu> expValPtr(nRows);
+            TScratchArray<algorithmFPType, cpu> expValPtr(this->_scratch, nRows);
             algorithmFPType * expVal = expValPtr.get();
             NumericTablePtr expNT    = HomogenNumericTableCPU<algorithmFPType, cpu>::create(expVal, 1, nRows, &s);
             DAAL_CHECK_MALLOC(expVal);
@@ -169,10 +171,10 @@ class PredictMulticlassTask
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
     typedef gbt::prediction::internal::TileDimensions<algorithmFPType> DimType;
-    typedef daal::tls<algorithmFPType *> ClassesRawBoostedTlsBase;
-    typedef daal::TlsMem<algorithmFPType, cpu> ClassesRawBoostedTls;
 
-    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : _data(x), _res(y), _prob(prob) {}
+    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, services::internal::ScratchPool * scratch)
+        : _data(x), _res(y), _prob(prob), _scratch(scratch)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nClasses, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
@@ -191,6 +193,7 @@ protected:
     const NumericTable * _data;
     NumericTable * _res;
     NumericTable * _prob;
+    services::internal::ScratchPool * _scratch;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
 };
@@ -201,16 +204,17 @@ protected:
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      size_t nClasses, size_t nIterations,
+                                                                      services::internal::ScratchPool * scratch)
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
     if (nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob, scratch);
         return task.run(pModel, nIterations, pHostApp);
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob, scratch);
     return task.run(pModel, nClasses, nIterations, pHostApp);
 }
 
@@ -271,8 +275,9 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
         DAAL_CHECK_BLOCK_STATUS(probBD);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nClasses);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * nClasses, sizeof(algorithmFPType));
-        TArray<algorithmFPType, cpu> valPtr(nRows * nClasses);
+        TScratchArray<algorithmFPType, cpu> valPtr(_scratch, nRows * nClasses);
         algorithmFPType * valFull = valPtr.get();
+        DAAL_CHECK_MALLOC(valFull);
         services::internal::service_memset<algorithmFPType, cpu>(valFull, algorithmFPType(0), nRows * nClasses);
 
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
@@ -314,9 +319,10 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
     }
     else if (!_prob && this->_res)
     {
-        ClassesRawBoostedTls lsData(nClasses * VECTOR_BLOCK_SIZE);
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
-            algorithmFPType * const val = lsData.local();
+            TScratchArray<algorithmFPType, cpu> valT(_scratch, nClasses * VECTOR_BLOCK_SIZE);
+            algorithmFPType * const val = valT.get();
+            DAAL_CHECK_MALLOC_THR(val);
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
@@ -62,7 +62,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations, daal::services::internal::scratchPool(*input));
 }
 
 } // namespace prediction
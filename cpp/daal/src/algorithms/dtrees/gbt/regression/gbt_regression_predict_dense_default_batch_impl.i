@@ -61,7 +61,9 @@ class PredictRegressionTask
 {
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
-    PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
+    PredictRegressionTask(const NumericTable * x, NumericTable * y, services::internal::ScratchPool * scratch = nullptr)
+        : _data(x), _res(y), _scratch(scratch)
+    {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
@@ -74,6 +76,7 @@ protected:
     TArray<const TreeType *, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
+    services::internal::ScratchPool * _scratch;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -81,11 +84,12 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::Model * m, NumericTable * r, size_t nIterations,
+                                                                      services::internal::ScratchPool * scratch)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
-    PredictRegressionTask<algorithmFPType, cpu> task(x, r);
+    PredictRegressionTask<algorithmFPType, cpu> task(x, r, scratch);
     return task.run(pModel, nIterations, pHostApp);
 }
 
@@ -29,6 +29,7 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
+#include "src/services/service_scratch_allocator.h"
 
 using namespace daal::data_management;
 
@@ -55,9 +56,10 @@ public:
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param scratch[in]      Pool of the scratch arenas for the temporary buffers of the call
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
-                             size_t nIterations);
+                             size_t nIterations, services::internal::ScratchPool * scratch = nullptr);
 };
 
 } // namespace internal
@@ -35,7 +35,7 @@ namespace elastic_net
 {
 namespace training
 {
-namespace interface1
+namespace interface2
 {
 template <>
 Batch<DAAL_FPTYPE, elastic_net::training::defaultDense>::Batch(const optimization_solver::iterative_solver::BatchPtr & solver)
@@ -52,7 +52,7 @@ Batch<DAAL_FPTYPE, elastic_net::training::defaultDense>::Batch(const BatchType &
     initialize();
 }
 
-} // namespace interface1
+} // namespace interface2
 } // namespace training
 } // namespace elastic_net
 } // namespace algorithms
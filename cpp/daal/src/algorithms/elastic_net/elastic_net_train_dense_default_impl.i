@@ -27,6 +27,7 @@
 
 #include "src/algorithms/elastic_net/elastic_net_train_kernel.h"
 #include "src/algorithms/elastic_net/elastic_net_model_impl.h"
+#include "src/algorithms/elastic_net/elastic_net_train_path_impl.i"
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_algo_utils.h"
 #include "algorithms/optimization_solver/objective_function/mse_batch.h"
@@ -235,6 +236,13 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             });
         }
     }
+    if (par.penaltyL1Path)
+    {
+        return trainPath<algorithmFPType, cpu>(*xTrain, *yTrain, *par.penaltyL1Path, par.penaltyL2.get(), par.optimizationSolver,
+                                               par.interceptFlag ? xMeansPtr : nullptr, par.interceptFlag ? yMeansPtr : nullptr,
+                                               *res.get(betaPathId), *m.getBeta());
+    }
+
     services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver); //par.optimizationSolver->clone();
     if (!pSolver.get())
     {
@@ -0,0 +1,501 @@
+/* file: elastic_net_train_path_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the elastic net training along the regularization path.
+//  The problem 1/(2n) ||y - X b||^2 + l1 ||b||_1 + l2/2 ||b||^2 is solved for the
+//  sequence of L1 parameters, each solution starts from the previous one.
+//  The coordinate descent visits only the working set of features chosen by the
+//  sequential strong rule and checks the optimality conditions for the rest of
+//  the features once the working set converges. The features that are proved to
+//  have zero coefficients by the gap safe rule are excluded from the checks.
+//  The gap is computed for the equivalent lasso problem on [X; sqrt(n * l2) * I].
+//  Lasso regression uses the same solver with l2 = 0.
+//--
+*/
+
+#ifndef __ELASTIC_NET_TRAIN_PATH_IMPL_I__
+#define __ELASTIC_NET_TRAIN_PATH_IMPL_I__
+
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_batch.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "src/algorithms/service_column_major.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/**
+ *  Solver of the elastic net problem for one dependent variable along the regularization path
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PathSolver
+{
+public:
+    PathSolver(size_t nRows, size_t nFeatures, const algorithmFPType * xt, size_t maxIterations, algorithmFPType accuracyThreshold)
+        : _nRows(nRows),
+          _nFeatures(nFeatures),
+          _xt(xt),
+          _maxIterations(maxIterations),
+          _accuracyThreshold(accuracyThreshold),
+          _y(nullptr),
+          _l2(0),
+          _lambdaPrev(0),
+          _drift(0),
+          _nWorking(0)
+    {}
+
+    services::Status init();
+
+    /* Starts the path for the new dependent variable from the zero coefficients */
+    void setResponse(const algorithmFPType * y, algorithmFPType l2);
+
+    /* Trains the model for the next L1 parameter of the path, l1 is expected to not exceed the previous one */
+    void solve(algorithmFPType l1, algorithmFPType * beta);
+
+private:
+    /* Upper bound of |x_j^T r| for the current residual given the residual drift since x_j^T r was computed */
+    algorithmFPType correlationBound(size_t j, algorithmFPType drift) const
+    {
+        return Math<algorithmFPType, cpu>::sFabs(_corr[j]) + _xNorms[j] * (drift - _driftRef[j]);
+    }
+
+    algorithmFPType residualShift() const;
+    void computeCorrelations();
+    void screen(algorithmFPType l1);
+    void sweep(const size_t * features, size_t nFeatures, algorithmFPType l1, algorithmFPType & maxDiff, algorithmFPType & maxValue);
+    void coordinateDescent(algorithmFPType l1);
+
+    const size_t _nRows;
+    const size_t _nFeatures;
+    const algorithmFPType * const _xt;
+    const size_t _maxIterations;
+    const algorithmFPType _accuracyThreshold;
+
+    const algorithmFPType * _y;
+    algorithmFPType _l2;
+    algorithmFPType _lambdaPrev; /* L1 parameter of the previous step of the path */
+    algorithmFPType _drift;      /* Sum of the norms of the residual changes made by the previous steps */
+    size_t _nWorking;
+
+    TArray<algorithmFPType, cpu> _xNorms;    /* Euclidean norms of the features */
+    TArray<algorithmFPType, cpu> _hessian;   /* Diagonal of the Hessian, ||x_j||^2 / n */
+    TArray<algorithmFPType, cpu> _beta;      /* Coefficients */
+    TArray<algorithmFPType, cpu> _corr;      /* x_j^T r computed at the residual with the drift _driftRef[j] */
+    TArray<algorithmFPType, cpu> _driftRef;  /* Residual drift at the moment _corr[j] was computed */
+    TArray<algorithmFPType, cpu> _r;         /* Residual y - X b */
+    TArray<algorithmFPType, cpu> _rPrev;     /* Residual at the beginning of the step */
+    TArray<int, cpu> _screened;              /* Flags of the features with zero coefficients proved by the gap safe rule */
+    TArray<int, cpu> _inWorkingSet;          /* Flags of the features in the working set */
+    TArray<size_t, cpu> _working;            /* Indices of the features in the working set */
+    TArray<size_t, cpu> _active;             /* Indices of the features in the working set with non-zero coefficients */
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PathSolver<algorithmFPType, cpu>::init()
+{
+    _xNorms.reset(_nFeatures);
+    _hessian.reset(_nFeatures);
+    _beta.reset(_nFeatures);
+    _corr.reset(_nFeatures);
+    _driftRef.reset(_nFeatures);
+    _r.reset(_nRows);
+    _rPrev.reset(_nRows);
+    _screened.reset(_nFeatures);
+    _inWorkingSet.reset(_nFeatures);
+    _working.reset(_nFeatures);
+    _active.reset(_nFeatures);
+    DAAL_CHECK_MALLOC(_xNorms.get() && _hessian.get() && _beta.get() && _corr.get() && _driftRef.get() && _r.get() && _rPrev.get());
+    DAAL_CHECK_MALLOC(_screened.get() && _inWorkingSet.get() && _working.get() && _active.get());
+
+    const DAAL_INT n                    = (DAAL_INT)_nRows;
+    const DAAL_INT one                  = 1;
+    const algorithmFPType inversedNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+    daal::threader_for(_nFeatures, _nFeatures, [&](const size_t j) {
+        const algorithmFPType * const xj = _xt + j * _nRows;
+        const algorithmFPType norm2      = Blas<algorithmFPType, cpu>::xxdot(&n, xj, &one, xj, &one);
+        _xNorms[j]                       = Math<algorithmFPType, cpu>::sSqrt(norm2);
+        _hessian[j]                      = norm2 * inversedNRows;
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::setResponse(const algorithmFPType * y, algorithmFPType l2)
+{
+    _y     = y;
+    _l2    = l2;
+    _drift = 0;
+    for (size_t i = 0; i < _nRows; ++i) _r[i] = y[i];
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        _beta[j]         = 0;
+        _driftRef[j]     = 0;
+        _screened[j]     = 0;
+        _inWorkingSet[j] = 0;
+    }
+    computeCorrelations();
+
+    /* The coefficients are zero for all L1 parameters greater than max |x_j^T y| / n */
+    algorithmFPType maxCorr = 0;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        const algorithmFPType c = Math<algorithmFPType, cpu>::sFabs(_corr[j]);
+        maxCorr                 = c > maxCorr ? c : maxCorr;
+    }
+    _lambdaPrev = maxCorr / algorithmFPType(_nRows);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType PathSolver<algorithmFPType, cpu>::residualShift() const
+{
+    double shift = 0;
+    for (size_t i = 0; i < _nRows; ++i)
+    {
+        const double d = double(_r[i]) - double(_rPrev[i]);
+        shift += d * d;
+    }
+    return Math<algorithmFPType, cpu>::sSqrt(algorithmFPType(shift));
+}
+
+/**
+ *  Computes x_j^T r for the features not excluded by the gap safe rule
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::computeCorrelations()
+{
+    const DAAL_INT n       = (DAAL_INT)_nRows;
+    const DAAL_INT one     = 1;
+    const size_t blockSize = 64;
+    size_t nBlocks         = _nFeatures / blockSize;
+    nBlocks += (nBlocks * blockSize != _nFeatures);
+
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t start  = iBlock * blockSize;
+        const size_t finish = (iBlock + 1 == nBlocks ? _nFeatures : start + blockSize);
+        for (size_t j = start; j < finish; ++j)
+        {
+            if (!_screened[j]) _corr[j] = Blas<algorithmFPType, cpu>::xxdot(&n, _xt + j * _nRows, &one, _r.get(), &one);
+        }
+    });
+}
+
+/**
+ *  Gap safe rule: the feature has zero coefficient at the optimum if |x_j^T theta| + radius * ||x_j|| < 1
+ *  for the dual point theta = r / max(n * l1, ||X^T r||_inf) of the augmented lasso problem
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::screen(algorithmFPType l1)
+{
+    if (!(l1 > 0)) return;
+
+    const double n      = double(_nRows);
+    const double lambda = n * double(l1);
+    const double nL2    = n * double(_l2);
+    const double drift  = double(_drift) + double(residualShift());
+
+    double rNorm2 = 0;
+    double ry     = 0;
+    for (size_t i = 0; i < _nRows; ++i)
+    {
+        rNorm2 += double(_r[i]) * double(_r[i]);
+        ry += double(_r[i]) * double(_y[i]);
+    }
+
+    double bNorm1  = 0;
+    double bNorm2  = 0;
+    double scaling = lambda;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        const double b    = double(_beta[j]);
+        const double absB = b < 0 ? -b : b;
+        bNorm1 += absB;
+        bNorm2 += b * b;
+        const double bound = double(correlationBound(j, algorithmFPType(drift))) + nL2 * absB;
+        scaling            = bound > scaling ? bound : scaling;
+    }
+
+    const double augmentedRNorm2 = rNorm2 + nL2 * bNorm2;
+    const double primal          = 0.5 * augmentedRNorm2 + lambda * bNorm1;
+    const double ratio           = lambda / scaling;
+    const double dual            = ratio * ry - 0.5 * ratio * ratio * augmentedRNorm2;
+    const double gap             = primal > dual ? primal - dual : 0.0;
+    const double radius          = Math<double, cpu>::sSqrt(2.0 * gap) / lambda;
+
+    /* Guards the test against the rounding errors in x_j^T r */
+    const double threshold = 1.0 - double(Math<algorithmFPType, cpu>::sSqrt(services::internal::EpsilonVal<algorithmFPType>::get()));
+
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        if (_screened[j] || _beta[j] != 0) continue;
+        const double xNorm = Math<double, cpu>::sSqrt(double(_xNorms[j]) * double(_xNorms[j]) + nL2);
+        if (double(correlationBound(j, algorithmFPType(drift))) / scaling + radius * xNorm < threshold) _screened[j] = 1;
+    }
+
+    size_t nWorking = 0;
+    for (size_t i = 0; i < _nWorking; ++i)
+    {
+        const size_t j = _working[i];
+        if (_screened[j])
+            _inWorkingSet[j] = 0;
+        else
+            _working[nWorking++] = j;
+    }
+    _nWorking = nWorking;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::sweep(const size_t * features, size_t nFeatures, algorithmFPType l1, algorithmFPType & maxDiff,
+                                             algorithmFPType & maxValue)
+{
+    const DAAL_INT n                    = (DAAL_INT)_nRows;
+    const DAAL_INT one                  = 1;
+    const algorithmFPType inversedNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+    algorithmFPType * const r           = _r.get();
+
+    maxDiff  = 0;
+    maxValue = 0;
+    for (size_t i = 0; i < nFeatures; ++i)
+    {
+        const size_t j          = features[i];
+        const algorithmFPType h = _hessian[j];
+        if (h == 0) continue;
+
+        const algorithmFPType * const xj = _xt + j * _nRows;
+        const algorithmFPType prev       = _beta[j];
+        const algorithmFPType z          = Blas<algorithmFPType, cpu>::xxdot(&n, xj, &one, r, &one) * inversedNRows + h * prev;
+
+        algorithmFPType next = 0;
+        if (z > l1) next = (z - l1) / (h + _l2);
+        if (z < -l1) next = (z + l1) / (h + _l2);
+
+        if (next != prev)
+        {
+            algorithmFPType delta = prev - next;
+            Blas<algorithmFPType, cpu>::xxaxpy(&n, &delta, xj, &one, r, &one);
+            _beta[j] = next;
+        }
+
+        const algorithmFPType diff  = Math<algorithmFPType, cpu>::sFabs(next - prev);
+        const algorithmFPType value = Math<algorithmFPType, cpu>::sFabs(next);
+        maxDiff                     = diff > maxDiff ? diff : maxDiff;
+        maxValue                    = value > maxValue ? value : maxValue;
+    }
+}
+
+/**
+ *  Coordinate descent over the working set. After each full sweep the iterations
+ *  continue over the features with non-zero coefficients until they converge
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::coordinateDescent(algorithmFPType l1)
+{
+    algorithmFPType maxDiff  = 0;
+    algorithmFPType maxValue = 0;
+    size_t iter              = 0;
+    while (iter < _maxIterations)
+    {
+        sweep(_working.get(), _nWorking, l1, maxDiff, maxValue);
+        ++iter;
+        if (maxDiff <= _accuracyThreshold * maxValue) break;
+
+        size_t nActive = 0;
+        for (size_t i = 0; i < _nWorking; ++i)
+        {
+            if (_beta[_working[i]] != 0) _active[nActive++] = _working[i];
+        }
+        while (iter < _maxIterations)
+        {
+            sweep(_active.get(), nActive, l1, maxDiff, maxValue);
+            ++iter;
+            if (maxDiff <= _accuracyThreshold * maxValue) break;
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PathSolver<algorithmFPType, cpu>::solve(algorithmFPType l1, algorithmFPType * beta)
+{
+    const algorithmFPType nRows = algorithmFPType(_nRows);
+    for (size_t i = 0; i < _nRows; ++i) _rPrev[i] = _r[i];
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        _screened[j]     = 0;
+        _inWorkingSet[j] = 0;
+    }
+    _nWorking = 0;
+    screen(l1);
+
+    /* Sequential strong rule: the feature is likely to stay zero if |x_j^T r| / n < 2 * l1 - l1_prev */
+    const algorithmFPType strongThreshold = (algorithmFPType(2) * l1 - _lambdaPrev) * nRows;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        if (_screened[j]) continue;
+        if (_beta[j] != 0 || correlationBound(j, _drift) >= strongThreshold)
+        {
+            _inWorkingSet[j]      = 1;
+            _working[_nWorking++] = j;
+        }
+    }
+
+    algorithmFPType shift = 0;
+    for (;;)
+    {
+        coordinateDescent(l1);
+        screen(l1);
+
+        /* Optimality check for the features outside the working set */
+        computeCorrelations();
+        shift = residualShift();
+
+        size_t nViolations = 0;
+        for (size_t j = 0; j < _nFeatures; ++j)
+        {
+            if (_screened[j]) continue;
+            _driftRef[j] = _drift - shift;
+            if (!_inWorkingSet[j] && Math<algorithmFPType, cpu>::sFabs(_corr[j]) > l1 * nRows)
+            {
+                _inWorkingSet[j]      = 1;
+                _working[_nWorking++] = j;
+                ++nViolations;
+            }
+        }
+        if (!nViolations) break;
+    }
+
+    _drift += shift;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        if (!_screened[j]) _driftRef[j] = _drift;
+        beta[j] = _beta[j];
+    }
+    _lambdaPrev = l1;
+}
+
+/**
+ *  Trains the models for all rows of the L1 parameters table and writes them into the rows of betaPath,
+ *  the model for the last row is written into beta
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status trainPath(NumericTable & x, NumericTable & y, NumericTable & penaltyL1Path, NumericTable * penaltyL2,
+                           const optimization_solver::iterative_solver::BatchPtr & solver, const algorithmFPType * xMeans,
+                           const algorithmFPType * yMeans, NumericTable & betaPath, NumericTable & beta)
+{
+    const size_t nRows      = x.getNumberOfRows();
+    const size_t nFeatures  = x.getNumberOfColumns();
+    const size_t nResponses = y.getNumberOfColumns();
+    const size_t nPenalties = penaltyL1Path.getNumberOfRows();
+    const size_t p          = nFeatures + 1;
+    const size_t nBetas     = nResponses * p;
+
+    /* Same defaults as the ones of the coordinate descent solver created by the training */
+    size_t maxIterations              = 10000;
+    algorithmFPType accuracyThreshold = 0.00001;
+    if (solver.get())
+    {
+        maxIterations     = solver->getParameter()->nIterations;
+        accuracyThreshold = solver->getParameter()->accuracyThreshold;
+    }
+
+    services::Status s;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * nFeatures, sizeof(algorithmFPType));
+    TArrayScalable<algorithmFPType, cpu> xtArray(nRows * nFeatures);
+    DAAL_CHECK_MALLOC(xtArray.get());
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::copyToColumnMajor<algorithmFPType, cpu>(x, xtArray.get())));
+
+    PathSolver<algorithmFPType, cpu> pathSolver(nRows, nFeatures, xtArray.get(), maxIterations, accuracyThreshold);
+    DAAL_CHECK_STATUS(s, pathSolver.init());
+
+    ReadRows<algorithmFPType, cpu> pathBD(penaltyL1Path, 0, nPenalties);
+    DAAL_CHECK_BLOCK_STATUS(pathBD);
+    const algorithmFPType * const path = pathBD.get();
+    const size_t nPathColumns          = penaltyL1Path.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> penaltyL2BD;
+    const algorithmFPType * l2 = nullptr;
+    if (penaltyL2)
+    {
+        penaltyL2BD.set(*penaltyL2, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(penaltyL2BD);
+        l2 = penaltyL2BD.get();
+    }
+
+    ReadRows<algorithmFPType, cpu> yBD(y, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBD);
+    const algorithmFPType * const yPtr = yBD.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> betaPathBD(betaPath, 0, nPenalties);
+    DAAL_CHECK_BLOCK_STATUS(betaPathBD);
+    algorithmFPType * const betaPathPtr = betaPathBD.get();
+
+    TArray<algorithmFPType, cpu> yColumn(nRows);
+    DAAL_CHECK_MALLOC(yColumn.get());
+
+    for (size_t k = 0; k < nResponses; ++k)
+    {
+        for (size_t i = 0; i < nRows; ++i) yColumn[i] = yPtr[i * nResponses + k];
+        pathSolver.setResponse(yColumn.get(), l2 ? l2[penaltyL2->getNumberOfColumns() == 1 ? 0 : k] : algorithmFPType(0));
+
+        for (size_t l = 0; l < nPenalties; ++l)
+        {
+            algorithmFPType * const b = betaPathPtr + l * nBetas + k * p;
+            pathSolver.solve(path[l * nPathColumns + (nPathColumns == 1 ? 0 : k)], b + 1);
+
+            algorithmFPType intercept = 0;
+            if (xMeans)
+            {
+                intercept = yMeans[k];
+                for (size_t j = 0; j < nFeatures; ++j) intercept -= xMeans[j] * b[j + 1];
+            }
+            b[0] = intercept;
+        }
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> betaBD(beta, 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(betaBD);
+    const int result = daal::services::internal::daal_memcpy_s(betaBD.get(), nBetas * sizeof(algorithmFPType),
+                                                               betaPathPtr + (nPenalties - 1) * nBetas, nBetas * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -104,6 +104,10 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     if (p->optResultToCompute & computeGramMatrix)
         s |= data_management::checkNumericTable(get(gramMatrixId).get(), gramMatrixStr(), 0, 0, in->getNumberOfFeatures(), in->getNumberOfFeatures());
 
+    const interface2::Parameter * const p2 = dynamic_cast<const interface2::Parameter *>(p);
+    if (p2 && p2->penaltyL1Path)
+        s |= data_management::checkNumericTable(get(betaPathId).get(), betaPathStr(), 0, 0, nBeta * nResponses, p2->penaltyL1Path->getNumberOfRows());
+
     s |= elastic_net::checkModel(model.get(), *par, nBeta, nResponses, method);
     return s;
 }
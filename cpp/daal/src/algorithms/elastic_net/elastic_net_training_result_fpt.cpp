@@ -40,7 +40,7 @@ using namespace daal::services;
  * \param[in] method Computation method for the algorithm
  */
 template <typename algorithmFPType>
-DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const Parameter * parameter, const int method)
+DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const interface1::Parameter * parameter, const int method)
 {
     const Input * const in = static_cast<const Input *>(input);
 
@@ -54,10 +54,18 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
     if (parameter->optResultToCompute & computeGramMatrix)
         set(gramMatrixId, data_management::HomogenNumericTable<algorithmFPType>::create(in->getNumberOfFeatures(), in->getNumberOfFeatures(),
                                                                                         data_management::NumericTableIface::doAllocate, &s));
+
+    const interface2::Parameter * const parameter2 = dynamic_cast<const interface2::Parameter *>(parameter);
+    if (parameter2 && parameter2->penaltyL1Path)
+    {
+        const size_t nBetas = in->getNumberOfDependentVariables() * (in->getNumberOfFeatures() + 1);
+        set(betaPathId, data_management::HomogenNumericTable<algorithmFPType>::create(nBetas, parameter2->penaltyL1Path->getNumberOfRows(),
+                                                                                      data_management::NumericTableIface::doAllocate, &s));
+    }
     return s;
 }
 
-template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const Parameter * parameter,
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const interface1::Parameter * parameter,
                                                                     const int method);
 
 } // namespace training
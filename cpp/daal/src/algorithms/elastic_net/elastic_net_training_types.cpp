@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/elastic_net/elastic_net_training_types.h"
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
 #include "src/services/daal_strings.h"
 
 using namespace daal::data_management;
@@ -154,6 +155,12 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     DAAL_CHECK((penaltyL1NumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL1NumberOfColumns), ErrorIncorrectNumberOfColumns);
     const size_t penaltyL2NumberOfColumns = parameter->penaltyL2->getNumberOfColumns();
     DAAL_CHECK((penaltyL2NumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL2NumberOfColumns), ErrorIncorrectNumberOfColumns);
+    const interface2::Parameter * const parameter2 = dynamic_cast<const interface2::Parameter *>(parameter);
+    if (parameter2 && parameter2->penaltyL1Path)
+    {
+        const size_t pathNumberOfColumns = parameter2->penaltyL1Path->getNumberOfColumns();
+        DAAL_CHECK((pathNumberOfColumns == 1) || (nColumnsInDepVariable == pathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
     return services::Status();
 }
 
@@ -174,6 +181,29 @@ services::Status Parameter::check() const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(const SolverPtr & solver) : interface1::Parameter(solver) {}
+
+services::Status Parameter::check() const
+{
+    services::Status status = interface1::Parameter::check();
+    if (status == services::Status() && penaltyL1Path)
+    {
+        status = checkNumericTable(penaltyL1Path.get(), penaltyL1PathStr(), packed_mask);
+        DAAL_CHECK_STATUS_VAR(status);
+        /* The path is trained with the coordinate descent, the other solvers and the positive constraint are not supported */
+        const optimization_solver::coordinate_descent::Parameter * const solverPar =
+            optimizationSolver.get() ? dynamic_cast<const optimization_solver::coordinate_descent::Parameter *>(optimizationSolver->getParameter())
+                                     : NULL;
+        DAAL_CHECK_EX(!optimizationSolver.get() || (solverPar && !solverPar->positive), ErrorIncorrectParameter, ParameterName,
+                      optimizationSolverStr());
+    }
+    return status;
+}
+
+} // namespace interface2
 } // namespace training
 } // namespace elastic_net
 } // namespace algorithms
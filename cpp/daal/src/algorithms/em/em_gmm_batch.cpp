@@ -301,6 +301,38 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+/**
+ * Constructs the parameter of EMM for GMM algorithm
+ * \param[in] nComponents              Number of components in the Gaussian mixture model
+ * \param[in] maxIterations            Maximal number of iterations of the algorithm
+ * \param[in] accuracyThreshold        Threshold for the termination of the algorithm
+ * \param[in] covariance               Pointer to the algorithm that computes the covariance
+ */
+Parameter::Parameter(const size_t _nComponents, const SharedPtr<covariance::BatchImpl> & _covariance, const size_t _maxIterations,
+                     const double _accuracyThreshold, const double _regularizationFactor, const CovarianceStorageId _covarianceStorage)
+    : interface1::Parameter(_nComponents, _covariance, _maxIterations, _accuracyThreshold, _regularizationFactor, _covarianceStorage),
+      miniBatchSize(0),
+      stepSizeDecay(0.6),
+      engine(engines::mt19937::Batch<>::create())
+{}
+
+Parameter::Parameter(const Parameter & other)
+    : interface1::Parameter(other), miniBatchSize(other.miniBatchSize), stepSizeDecay(other.stepSizeDecay), engine(other.engine)
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s = interface1::Parameter::check();
+    if (!s) return s;
+    DAAL_CHECK(!miniBatchSize || (stepSizeDecay > 0.5 && stepSizeDecay <= 1.0), ErrorIncorrectParameter);
+    DAAL_CHECK(!miniBatchSize || engine, ErrorIncorrectEngineParameter);
+    return s;
+}
+
+} // namespace interface2
 } // namespace em_gmm
 } // namespace algorithms
 } // namespace daal
@@ -29,7 +29,7 @@ namespace algorithms
 {
 namespace em_gmm
 {
-namespace interface1
+namespace interface2
 {
 template <typename algorithmFPType, Method method>
 Batch<algorithmFPType, method>::Batch(const size_t nComponents)
@@ -50,7 +50,7 @@ void Batch<algorithmFPType, method>::initialize()
 
 template class Batch<DAAL_FPTYPE, defaultDense>;
 
-} // namespace interface1
+} // namespace interface2
 } // namespace em_gmm
 } // namespace algorithms
 } // namespace daal
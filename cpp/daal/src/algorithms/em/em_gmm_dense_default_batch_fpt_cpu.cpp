@@ -31,7 +31,7 @@ namespace algorithms
 {
 namespace em_gmm
 {
-namespace interface1
+namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 
@@ -30,6 +30,8 @@
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_utils.h"
+#include "src/algorithms/distributions/uniform/uniform_kernel.h"
+#include "src/algorithms/distributions/uniform/uniform_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -68,6 +70,16 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
     double diff             = 2 * threshold + 1;
     double oldLogLikelyhood = 0;
 
+    /* Stochastic EM: all iterations except the last one process a random subset of the blocks */
+    const bool miniBatch        = par.miniBatchSize > 0 && par.miniBatchSize < (size_t)nVectors && nBlocks > 1;
+    const size_t nSampledBlocks = miniBatch ? (par.miniBatchSize + blockSizeDefault - 1) / blockSizeDefault : 0;
+    TArray<int, cpu> sampledBlocks(nSampledBlocks);
+    if (miniBatch)
+    {
+        DAAL_CHECK_MALLOC(sampledBlocks.get());
+        DAAL_CHECK_STATUS(s, initializeRunningStatistics())
+    }
+
     daal::tls<Task<algorithmFPType, cpu> *> threadBuffer([=]() -> Task<algorithmFPType, cpu> * {
         return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get());
     });
@@ -75,6 +87,18 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
     algorithmFPType & logLikelyhood = logLikelyhoodArray[0];
     while (diff > threshold && iterCounter < maxIterations)
     {
+        const bool sampled = miniBatch && iterCounter < maxIterations - 1;
+
+        size_t nProcessedBlocks  = nBlocks;
+        size_t nProcessedVectors = nVectors;
+        const int * blocks       = nullptr;
+        if (sampled)
+        {
+            DAAL_CHECK_STATUS(s, sampleBlocks(sampledBlocks.get(), nSampledBlocks, nProcessedVectors))
+            nProcessedBlocks = nSampledBlocks;
+            blocks           = sampledBlocks.get();
+        }
+
         DAAL_CHECK_STATUS(s, covs->computeSigmaInverse(iterCounter))
         algorithmFPType * sqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
         Math<algorithmFPType, cpu>::vLog(nComponents, sqrtInvDetSigma, covs->getLogSqrtInvDetSigma());
@@ -84,7 +108,8 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
         logLikelyhood = 0;
 
         SafeStatus safeStat;
-        daal::threader_for(nBlocks, nBlocks, [=, &threadBuffer, &safeStat](size_t iBlock) {
+        daal::threader_for(nProcessedBlocks, nProcessedBlocks, [=, &threadBuffer, &safeStat](size_t iProcessedBlock) {
+            const size_t iBlock           = blocks ? blocks[iProcessedBlock] : iProcessedBlock;
             size_t j0                     = iBlock * blockSizeDefault;
             size_t nVectorsInCurrentBlock = blockSizeDefault;
             if (iBlock == nBlocks - 1)
@@ -123,11 +148,22 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
             }
             e->setMergedToZero();
         });
-        logLikelyhood -= logLikelyhoodCorrection;
+
+        if (sampled)
+        {
+            /* Estimate of the log-likelihood of the whole data set from the processed blocks */
+            logLikelyhood = logLikelyhood * nVectors / nProcessedVectors - logLikelyhoodCorrection;
+            updateRunningStatistics(iterCounter, nProcessedVectors);
+        }
+        else
+        {
+            logLikelyhood -= logLikelyhoodCorrection;
+        }
 
         DAAL_CHECK_STATUS(s, stepM_merge(iterCounter))
 
-        if (iterCounter > 0)
+        /* The estimates of the log-likelihood are too noisy to check the convergence */
+        if (iterCounter > 0 && !sampled)
         {
             diff = logLikelyhood - oldLogLikelyhood;
         }
@@ -404,6 +440,77 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_merge(size_t iteration)
     return Status();
 }
 
+/**
+ * Function samples the blocks of rows processed at an iteration of stochastic EM with replacement
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMKernelTask<algorithmFPType, method, cpu>::sampleBlocks(int * blocks, size_t nSampledBlocks, size_t & nSampledVectors)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, (distributions::uniform::internal::UniformKernelDefault<int, cpu>::compute(0, (int)nBlocks, *par.engine, nSampledBlocks,
+                                                                                                     blocks)));
+    nSampledVectors = 0;
+    for (size_t i = 0; i < nSampledBlocks; i++)
+    {
+        const size_t iBlock = blocks[i];
+        nSampledVectors += (iBlock == nBlocks - 1) ? nVectors - iBlock * blockSizeDefault : blockSizeDefault;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMKernelTask<algorithmFPType, method, cpu>::initializeRunningStatistics()
+{
+    runningWeights.reset(nComponents);
+    runningMeans.reset(nComponents * nFeatures);
+    runningCP.reset(nComponents * covs->getOneCovSize());
+    DAAL_CHECK_MALLOC(runningWeights.get() && runningMeans.get() && runningCP.get());
+    return Status();
+}
+
+/**
+ * Function blends the sufficient statistics of the processed blocks into the running ones with the step size (iteration + 1)^(-stepSizeDecay)
+ * and writes the running statistics to the results, so they are finalized as in the full EM iteration
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::updateRunningStatistics(size_t iteration, size_t nSampledVectors)
+{
+    const size_t oneCovSize = covs->getOneCovSize();
+
+    const algorithmFPType step        = Math<algorithmFPType, cpu>::sPowx((algorithmFPType)(iteration + 1), -par.stepSizeDecay);
+    const algorithmFPType oldFactor   = 1.0 - step;
+    const algorithmFPType batchFactor = step * (algorithmFPType)nVectors / (algorithmFPType)nSampledVectors;
+
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        algorithmFPType * cp      = covs->getSigma(k);
+        algorithmFPType * runCP   = &runningCP[k * oneCovSize];
+        algorithmFPType * runMean = &runningMeans[k * nFeatures];
+
+        runningWeights[k] *= oldFactor;
+        alpha[k] *= batchFactor;
+        for (size_t i = 0; i < oneCovSize; i++)
+        {
+            runCP[i] *= oldFactor;
+            cp[i] *= batchFactor;
+        }
+        if (alpha[k] > MinVal<algorithmFPType>::get())
+        {
+            stepM_mergePartialSums(runCP, cp, runMean, &means[k * nFeatures], runningWeights[k], alpha[k], nFeatures, covs.get());
+        }
+
+        alpha[k] = runningWeights[k];
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            means[k * nFeatures + j] = runMean[j];
+        }
+        for (size_t i = 0; i < oneCovSize; i++)
+        {
+            cp[i] = runCP[i];
+        }
+    }
+}
+
 /**
  * Sets constants and values
  */
@@ -77,6 +77,11 @@ public:
     void setResultToZero();
     Status stepM_merge(size_t iteration);
 
+    /* Stochastic EM: blocks of rows processed at an iteration and the sufficient statistics accumulated over the iterations */
+    Status sampleBlocks(int * blocks, size_t nSampledBlocks, size_t & nSampledVectors);
+    Status initializeRunningStatistics();
+    void updateRunningStatistics(size_t iteration, size_t nSampledVectors);
+
     static void stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
     static algorithmFPType computePartialLogLikelyhood(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t);
     static Status stepM_partial(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
@@ -101,6 +106,10 @@ public:
     TArray<WriteRows<algorithmFPType, cpu, NumericTable>, cpu> covsPtr;
     GmmModelPtr covs;
 
+    TArrayCalloc<algorithmFPType, cpu> runningWeights;
+    TArrayCalloc<algorithmFPType, cpu> runningMeans;
+    TArrayCalloc<algorithmFPType, cpu> runningCP;
+
     WriteRows<algorithmFPType, cpu, NumericTable> weightsBD;
     WriteRows<algorithmFPType, cpu, NumericTable> meansBD;
     WriteRows<int, cpu, NumericTable> nIterationsBD;
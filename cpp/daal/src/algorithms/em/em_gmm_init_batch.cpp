@@ -203,6 +203,28 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(size_t nComponents, size_t nTrials, size_t nIterations, size_t seed, double accuracyThreshold,
+                     em_gmm::CovarianceStorageId covarianceStorage)
+    : interface1::Parameter(nComponents, nTrials, nIterations, seed, accuracyThreshold, covarianceStorage),
+      nWarmUpIterations(0),
+      abandonTolerance(0.05)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter::check() const
+{
+    services::Status s = interface1::Parameter::check();
+    if (!s) return s;
+    DAAL_CHECK(abandonTolerance >= 0, ErrorIncorrectParameter);
+    return s;
+}
+
+} // namespace interface2
 } // namespace init
 } // namespace em_gmm
 } // namespace algorithms
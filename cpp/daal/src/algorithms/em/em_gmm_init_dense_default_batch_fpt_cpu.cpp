@@ -33,7 +33,7 @@ namespace em_gmm
 {
 namespace init
 {
-namespace interface1
+namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 
@@ -25,6 +25,7 @@
 #include "src/algorithms/em/em_gmm_dense_default_batch_kernel.h"
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_stat.h"
+#include "src/threading/threading.h"
 #include "src/algorithms/distributions/uniform/uniform_impl.i"
 
 using namespace daal::data_management;
@@ -47,44 +48,50 @@ services::Status EMInitKernel<algorithmFPType, method, cpu>::compute(NumericTabl
                                                                      DataCollectionPtr & covariancesToInit, const Parameter & parameter,
                                                                      engines::BatchBase & engine)
 {
-    Status s;
-    EMInitKernelTask<algorithmFPType, method, cpu> kernelTask(data, weightsToInit, meansToInit, covariancesToInit, parameter, engine, s); //?
-    if (!s) return s;
-    DAAL_CHECK_STATUS(s, kernelTask.compute())
-    return Status();
+    EMInitKernelTask<algorithmFPType, method, cpu> kernelTask(data, weightsToInit, meansToInit, covariancesToInit, parameter, engine);
+    return kernelTask.compute();
 }
 
+/**
+ *  The trials run concurrently. If the number of warm-up iterations is set, the trials that are far behind the best one
+ *  after the warm-up iterations are abandoned and the remaining ones continue up to the number of iterations
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status EMInitKernelTask<algorithmFPType, method, cpu>::compute()
 {
     Status s;
     DAAL_CHECK_STATUS(s, initialize())
 
-    bool isInitialized = false;
-    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
-    {
-        DAAL_CHECK_STATUS(s, generateSelectedSet())
-
-        DAAL_CHECK_STATUS(s, setSelectedSetAsInitialValues())
+    const size_t nWarmUpIterations =
+        (parameter.nWarmUpIterations > 0 && parameter.nWarmUpIterations < nIterations) ? parameter.nWarmUpIterations : nIterations;
 
-        ErrorID errorId = runEM();
+    runTrials(nWarmUpIterations);
+    if (nWarmUpIterations < nIterations)
+    {
+        abandonTrials(nWarmUpIterations);
+        runTrials(nIterations - nWarmUpIterations);
+    }
 
-        if (!errorId && (loglikelyhood > maxLoglikelyhood))
+    Trial * bestTrial                = nullptr;
+    algorithmFPType maxLoglikelyhood = -MaxVal<algorithmFPType>::get();
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        Trial * trial = trials[idxTry].get();
+        if (!trial->errorId && (trial->loglikelyhood > maxLoglikelyhood))
         {
-            isInitialized    = true;
-            maxLoglikelyhood = loglikelyhood;
-            DAAL_CHECK_STATUS(s, writeValuesToTables())
+            maxLoglikelyhood = trial->loglikelyhood;
+            bestTrial        = trial;
         }
     }
 
-    DAAL_CHECK(isInitialized, ErrorEMInitNoTrialConverges)
-    return Status();
+    DAAL_CHECK(bestTrial, ErrorEMInitNoTrialConverges)
+    return writeValuesToTables(*bestTrial);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 EMInitKernelTask<algorithmFPType, method, cpu>::EMInitKernelTask(NumericTable & data, NumericTable & weightsToInit, NumericTable & meansToInit,
                                                                  DataCollectionPtr & covariancesToInit, const Parameter & parameter,
-                                                                 engines::BatchBase & engine, Status & status)
+                                                                 engines::BatchBase & engine)
     : data(data),
       weightsToInit(weightsToInit),
       meansToInit(meansToInit),
@@ -94,29 +101,36 @@ EMInitKernelTask<algorithmFPType, method, cpu>::EMInitKernelTask(NumericTable &
       nTrials(parameter.nTrials),
       nIterations(parameter.nIterations),
       accuracyThreshold(parameter.accuracyThreshold),
-      maxLoglikelyhood(-MaxVal<algorithmFPType>::get()),
       nFeatures(data.getNumberOfColumns()),
       nVectors(data.getNumberOfRows()),
-      covs(parameter.covarianceStorage, parameter.nComponents, data.getNumberOfColumns(), status),
       varianceArrayPtr(data.getNumberOfColumns()),
-      selectedSetPtr(parameter.nComponents),
+      selectedSetPtr(parameter.nTrials * parameter.nComponents),
+      trials(parameter.nTrials),
       engine(engine)
 {}
 
+/**
+ *  The start points of all the trials are drawn before the trials run, so the result does not depend on the number of threads
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status EMInitKernelTask<algorithmFPType, method, cpu>::initialize()
 {
     Status st;
-    alpha = HomogenNT::create(nComponents, 1, &st);
-    DAAL_CHECK_STATUS_VAR(st);
-    means = HomogenNT::create(nFeatures, nComponents, &st);
-    DAAL_CHECK_STATUS_VAR(st);
     varianceArray = varianceArrayPtr.get();
-    selectedSet   = selectedSetPtr.get();
+    DAAL_CHECK(varianceArray && selectedSetPtr.get() && trials.get(), ErrorMemoryAllocationFailed);
+    DAAL_CHECK_STATUS(st, computeVariance())
 
-    DAAL_CHECK(alpha && means && varianceArray && selectedSet, ErrorMemoryAllocationFailed);
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        trials[idxTry] = TrialPtr(new Trial(parameter.covarianceStorage, nComponents, nFeatures, st));
+        DAAL_CHECK_MALLOC(trials[idxTry].get())
+        DAAL_CHECK_STATUS_VAR(st)
 
-    return computeVariance();
+        int * selectedSet = selectedSetPtr.get() + idxTry * nComponents;
+        DAAL_CHECK_STATUS(st, generateSelectedSet(selectedSet))
+        DAAL_CHECK_STATUS(st, setSelectedSetAsInitialValues(*trials[idxTry], selectedSet))
+    }
+    return st;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -132,7 +146,7 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::computeVariance()
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables(Trial & trial)
 {
     {
         WriteOnlyRows<algorithmFPType, cpu, NumericTable> weightsBlock(weightsToInit, 0, 1);
@@ -140,7 +154,7 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
         algorithmFPType * weightsArray = weightsBlock.get();
         for (size_t i = 0; i < nComponents; i++)
         {
-            weightsArray[i] = alpha->getArray()[i];
+            weightsArray[i] = trial.alpha->getArray()[i];
         }
     }
 
@@ -150,24 +164,23 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
         algorithmFPType * meansArray = meansBlock.get();
         for (size_t i = 0; i < nFeatures * nComponents; i++)
         {
-            meansArray[i] = means->getArray()[i];
+            meansArray[i] = trial.means->getArray()[i];
         }
     }
 
-    covs.writeToTables(covariancesToInit);
-    return Status();
+    return trial.covs.writeToTables(covariancesToInit);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues(Trial & trial, const int * selectedSet)
 {
-    algorithmFPType * alphaArray = alpha->getArray();
+    algorithmFPType * alphaArray = trial.alpha->getArray();
     for (size_t k = 0; k < nComponents; k++)
     {
         alphaArray[k] = 1.0 / nComponents;
     }
 
-    algorithmFPType * meansArray = means->getArray();
+    algorithmFPType * meansArray = trial.means->getArray();
     ReadRows<algorithmFPType, cpu, NumericTable> block;
     for (size_t k = 0; k < nComponents; k++)
     {
@@ -179,26 +192,67 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialVa
         }
     }
 
-    covs.setVariance(varianceArray);
+    trial.covs.setVariance(varianceArray);
     return Status();
 }
 
+/**
+ *  Runs the given number of EM iterations for each trial that is continued, the trials are independent
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
-ErrorID EMInitKernelTask<algorithmFPType, method, cpu>::runEM()
+void EMInitKernelTask<algorithmFPType, method, cpu>::runTrials(size_t nTrialIterations)
+{
+    daal::threader_for(nTrials, nTrials, [&](size_t idxTry) {
+        Trial & trial = *trials[idxTry];
+        if (trial.isContinued && !trial.errorId)
+        {
+            runEM(trial, nTrialIterations);
+        }
+    });
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMInitKernelTask<algorithmFPType, method, cpu>::runEM(Trial & trial, size_t nTrialIterations)
 {
     EMforKernel<algorithmFPType> em(nComponents);
-    em.parameter.maxIterations     = nIterations;
+    em.parameter.maxIterations     = nTrialIterations;
     em.parameter.accuracyThreshold = accuracyThreshold;
-    ErrorID returnErrorId          = em.run(data, *alpha, *means, covs.getSigma(), parameter.covarianceStorage, loglikelyhood);
-    if (returnErrorId != 0)
+    trial.errorId = em.run(data, *trial.alpha, *trial.means, trial.covs.getSigma(), parameter.covarianceStorage, trial.loglikelyhood,
+                           trial.nIterationsDone);
+    if (trial.errorId != 0)
+    {
+        trial.loglikelyhood = -MaxVal<algorithmFPType>::get();
+    }
+}
+
+/**
+ *  Stops the trials that converged within the warm-up iterations or whose log-likelihood is behind the best one
+ *  by more than abandonTolerance of its absolute value. The stopped trials remain candidates for the result
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMInitKernelTask<algorithmFPType, method, cpu>::abandonTrials(size_t nWarmUpIterations)
+{
+    algorithmFPType maxLoglikelyhood = -MaxVal<algorithmFPType>::get();
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        const Trial & trial = *trials[idxTry];
+        if (!trial.errorId && trial.loglikelyhood > maxLoglikelyhood)
+        {
+            maxLoglikelyhood = trial.loglikelyhood;
+        }
+    }
+
+    const algorithmFPType absMaxLoglikelyhood = (maxLoglikelyhood < 0) ? -maxLoglikelyhood : maxLoglikelyhood;
+    const algorithmFPType minLoglikelyhood    = maxLoglikelyhood - parameter.abandonTolerance * absMaxLoglikelyhood;
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
     {
-        loglikelyhood = -MaxVal<algorithmFPType>::get();
+        Trial & trial     = *trials[idxTry];
+        trial.isContinued = trial.nIterationsDone >= nWarmUpIterations && trial.loglikelyhood >= minLoglikelyhood;
     }
-    return returnErrorId;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet(int * selectedSet)
 {
     int number;
     Status s;
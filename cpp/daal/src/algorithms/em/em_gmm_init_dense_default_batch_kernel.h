@@ -29,6 +29,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
 #include "algorithms/em/em_gmm_init_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm.h"
@@ -130,22 +131,55 @@ public:
                              const Parameter & par, engines::BatchBase & engine);
 };
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-class EMInitKernelTask
+/** \brief State of the EM algorithm started from one of the trial start points */
+template <typename algorithmFPType, CpuType cpu>
+struct EMInitTrial
 {
     typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
     typedef SharedPtr<HomogenNT> HomogenNTPtr;
 
+    DAAL_NEW_DELETE();
+
+    EMInitTrial(em_gmm::CovarianceStorageId covType, size_t nComponents, size_t nFeatures, Status & st)
+        : covs(covType, nComponents, nFeatures, st),
+          loglikelyhood(-services::internal::MaxVal<algorithmFPType>::get()),
+          errorId(ErrorID(0)),
+          nIterationsDone(0),
+          isContinued(true)
+    {
+        if (!st) return;
+        alpha = HomogenNT::create(nComponents, 1, &st);
+        if (!st) return;
+        means = HomogenNT::create(nFeatures, nComponents, &st);
+    }
+
+    HomogenNTPtr alpha;
+    HomogenNTPtr means;
+    GmmSigma<algorithmFPType, cpu> covs;
+    algorithmFPType loglikelyhood;
+    ErrorID errorId;        /*<! Error of the last EM run, the trial is not a candidate for the result if it is set */
+    size_t nIterationsDone; /*<! Number of iterations done by the last EM run */
+    bool isContinued;       /*<! Flag that the trial is neither converged nor abandoned after the warm-up iterations */
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class EMInitKernelTask
+{
+    typedef EMInitTrial<algorithmFPType, cpu> Trial;
+    typedef SharedPtr<Trial> TrialPtr;
+
 public:
     EMInitKernelTask(NumericTable & data, NumericTable & weightsToInit, NumericTable & meansToInit, DataCollectionPtr & covariancesToInit,
-                     const Parameter & parameter, engines::BatchBase & engine, Status & status);
+                     const Parameter & parameter, engines::BatchBase & engine);
     Status compute();
 
 private:
-    Status writeValuesToTables();
-    Status setSelectedSetAsInitialValues();
-    ErrorID runEM();
-    Status generateSelectedSet();
+    Status writeValuesToTables(Trial & trial);
+    Status setSelectedSetAsInitialValues(Trial & trial, const int * selectedSet);
+    void runTrials(size_t nTrialIterations);
+    void runEM(Trial & trial, size_t nTrialIterations);
+    void abandonTrials(size_t nWarmUpIterations);
+    Status generateSelectedSet(int * selectedSet);
     Status initialize();
     Status computeVariance();
 
@@ -160,15 +194,10 @@ private:
     const size_t nTrials;
     const size_t nIterations;
     double accuracyThreshold;
-    HomogenNTPtr alpha;
-    HomogenNTPtr means;
-    algorithmFPType loglikelyhood;
-    algorithmFPType maxLoglikelyhood;
     algorithmFPType * varianceArray;
     TArray<algorithmFPType, cpu> varianceArrayPtr;
     TArray<int, cpu> selectedSetPtr;
-    int * selectedSet;
-    GmmSigma<algorithmFPType, cpu> covs;
+    TArray<TrialPtr, cpu> trials;
     engines::BatchBase & engine;
 };
 
@@ -180,7 +209,8 @@ public:
     virtual ~EMforKernel() {}
 
     ErrorID run(data_management::NumericTable & inputData, data_management::NumericTable & inputWeights, data_management::NumericTable & inputMeans,
-                data_management::DataCollectionPtr & inputCov, const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood);
+                data_management::DataCollectionPtr & inputCov, const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood,
+                size_t & nIterationsDone);
 };
 
 } // namespace internal
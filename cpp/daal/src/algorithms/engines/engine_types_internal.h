@@ -25,6 +25,8 @@
 #include "src/algorithms/engines/engine_batch_impl.h"
 #include "algorithms/engines/engine_family.h"
 #include "src/services/service_arrays.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -137,6 +139,121 @@ public:
     }
 };
 
+/* Minimal number of values generated by one task of generateInParallel() */
+const size_t parallelGenerationBlockSize = 1 << 16;
+
+/* Maximal number of tasks of generateInParallel() per thread */
+const size_t parallelGenerationBlocksPerThread = 4;
+
+/* Number of values generated to detect the number of elements of the engine sequence consumed by one value */
+const size_t skipPerValueProbeSize = 16;
+
+/* Maximal number of elements of the engine sequence consumed by one value that generateInParallel() supports */
+const size_t maxSkipPerValue = 2;
+
+/**
+ *  Returns the number of elements of the engine sequence consumed by one value of the generator.
+ *  The engine state after the generation of several values is compared with the engine state
+ *  skipped ahead by the multiple of the number of values. Returns zero if the state differs for all
+ *  the supported numbers of elements, the values cannot be generated in parallel in that case
+ */
+template <typename T, CpuType cpu, typename Generator>
+size_t getSkipPerValue(engines::BatchBase & engine, const Generator & generate)
+{
+    engines::EnginePtr generated = engine.clone();
+    auto generatedImpl           = dynamic_cast<engines::internal::BatchBaseImpl *>(generated.get());
+    if (!generatedImpl) return 0;
+
+    T probe[skipPerValueProbeSize];
+    if (!generate(*generatedImpl, skipPerValueProbeSize, probe)) return 0;
+
+    const int stateSize = generatedImpl->getStateSize();
+    if (stateSize <= 0) return 0;
+
+    services::internal::TArray<byte, cpu> generatedState(stateSize);
+    services::internal::TArray<byte, cpu> skippedState(stateSize);
+    if (!generatedState.get() || !skippedState.get() || !generated->saveState(generatedState.get())) return 0;
+
+    for (size_t nSkip = 1; nSkip <= maxSkipPerValue; nSkip++)
+    {
+        engines::EnginePtr skipped = engine.clone();
+        if (!skipped->skipAhead(skipPerValueProbeSize * nSkip) || !skipped->saveState(skippedState.get())) return 0;
+
+        bool equal = true;
+        for (int i = 0; i < stateSize && equal; i++)
+        {
+            equal = (generatedState[i] == skippedState[i]);
+        }
+        if (equal) return nSkip;
+    }
+    return 0;
+}
+
+/**
+ *  Generates n values to the array r in parallel. The array is split into blocks, each block is generated
+ *  by a copy of the engine skipped ahead to the position of the block in the sequence of the engine,
+ *  so the values are the same as the values generated by the engine sequentially.
+ *  The engine is skipped ahead past the generated values.
+ *  The generation is sequential if the engine does not support skip-ahead or the array is small.
+ *  Only the batch algorithms of the distributions call it, the kernels of other algorithms generate sequentially
+ *  on the engine they were given.
+ *
+ *  \param[in] engineImpl      Engine
+ *  \param[in] n               Number of values to generate
+ *  \param[in] r               Array to store the values
+ *  \param[in] nSkipPerValue   Number of elements of the engine sequence consumed by one generated value,
+ *                             zero to detect it with getSkipPerValue()
+ *  \param[in] generate        Functor with the signature
+ *                             services::Status (engines::internal::BatchBaseImpl & engine, size_t nValues, T * values)
+ *                             that generates the values sequentially
+ */
+template <typename T, CpuType cpu, typename Generator>
+services::Status generateInParallel(engines::internal::BatchBaseImpl & engineImpl, size_t n, T * r, size_t nSkipPerValue, const Generator & generate)
+{
+    const size_t nThreads = daal::threader_get_threads_number();
+    auto engine           = dynamic_cast<engines::BatchBase *>(&engineImpl);
+    if (!engine || nThreads < 2 || n < 2 * parallelGenerationBlockSize || !engineImpl.hasSupport(skipahead))
+    {
+        return generate(engineImpl, n, r);
+    }
+
+    if (!nSkipPerValue) nSkipPerValue = getSkipPerValue<T, cpu>(*engine, generate);
+    if (!nSkipPerValue)
+    {
+        return generate(engineImpl, n, r);
+    }
+
+    /* Blocks are the multiples of the probe size, so the generators that produce values by pairs start at the same phase */
+    const size_t maxBlocks = nThreads * parallelGenerationBlocksPerThread;
+    size_t blockSize       = (n + maxBlocks - 1) / maxBlocks;
+    if (blockSize < parallelGenerationBlockSize) blockSize = parallelGenerationBlockSize;
+    blockSize            = (blockSize + skipPerValueProbeSize - 1) / skipPerValueProbeSize * skipPerValueProbeSize;
+    const size_t nBlocks = (n + blockSize - 1) / blockSize;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t start = iBlock * blockSize;
+        const size_t count = (n - start < blockSize ? n - start : blockSize);
+
+        engines::EnginePtr blockEngine = engine->clone();
+        auto blockEngineImpl           = dynamic_cast<engines::internal::BatchBaseImpl *>(blockEngine.get());
+        DAAL_CHECK_THR(blockEngineImpl, ErrorIncorrectEngineParameter);
+        services::Status s = blockEngine->skipAhead(start * nSkipPerValue);
+        DAAL_CHECK_STATUS_THR(s);
+        s = generate(*blockEngineImpl, count, r + start);
+        DAAL_CHECK_STATUS_THR(s);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    return engine->skipAhead(n * nSkipPerValue);
+}
+
+template <typename T, CpuType cpu, typename Generator>
+services::Status generateInParallel(engines::internal::BatchBaseImpl & engineImpl, size_t n, T * r, const Generator & generate)
+{
+    return generateInParallel<T, cpu>(engineImpl, n, r, 0, generate);
+}
+
 } // namespace internal
 } // namespace engines
 } // namespace algorithms
@@ -0,0 +1,210 @@
+/* file: philox4x32x10_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "src/externals/service_rng.h"
+#include "src/algorithms/engines/engine_types_internal.h"
+#include "gtest/gtest.h"
+
+using daal::algorithms::engines::EnginePtr;
+using daal::algorithms::engines::internal::BatchBaseImpl;
+
+namespace
+{
+typedef daal::algorithms::engines::philox4x32x10::Batch<> Philox;
+
+const daal::CpuType cpu = daal::sse2;
+
+/* Reference Philox4x32-10 of the Random123 library, the counter is incremented after each block of four values */
+class ReferencePhilox
+{
+public:
+    explicit ReferencePhilox(unsigned long long seed) : _index(4)
+    {
+        _key[0] = (unsigned int)(seed & 0xFFFFFFFFu);
+        _key[1] = (unsigned int)(seed >> 32);
+        for (size_t i = 0; i < 4; i++) _counter[i] = 0;
+    }
+
+    unsigned int next()
+    {
+        if (_index == 4)
+        {
+            generateBlock();
+            increment();
+            _index = 0;
+        }
+        return _block[_index++];
+    }
+
+private:
+    void generateBlock()
+    {
+        unsigned int c[4] = { _counter[0], _counter[1], _counter[2], _counter[3] };
+        unsigned int k[2] = { _key[0], _key[1] };
+        for (size_t round = 0; round < 10; round++)
+        {
+            if (round > 0)
+            {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+            const unsigned long long p0 = (unsigned long long)0xD2511F53u * c[0];
+            const unsigned long long p1 = (unsigned long long)0xCD9E8D57u * c[2];
+            const unsigned int out[4]   = { (unsigned int)(p1 >> 32) ^ c[1] ^ k[0], (unsigned int)p1, (unsigned int)(p0 >> 32) ^ c[3] ^ k[1],
+                                          (unsigned int)p0 };
+            for (size_t i = 0; i < 4; i++) c[i] = out[i];
+        }
+        for (size_t i = 0; i < 4; i++) _block[i] = c[i];
+    }
+
+    void increment()
+    {
+        for (size_t i = 0; i < 4 && ++_counter[i] == 0; i++)
+        {
+        }
+    }
+
+    unsigned int _key[2];
+    unsigned int _counter[4];
+    unsigned int _block[4];
+    size_t _index;
+};
+
+BatchBaseImpl * getImpl(const EnginePtr & engine)
+{
+    return dynamic_cast<BatchBaseImpl *>(engine.get());
+}
+
+std::vector<unsigned int> generateBits(const EnginePtr & engine, size_t n)
+{
+    std::vector<unsigned int> values(n);
+    daal::internal::RNGs<unsigned int, cpu> rng;
+    EXPECT_EQ(rng.uniformBits32(n, values.data(), getImpl(engine)->getState()), 0);
+    return values;
+}
+
+struct BitsGenerator
+{
+    daal::services::Status operator()(BatchBaseImpl & engine, size_t n, unsigned int * values) const
+    {
+        daal::internal::RNGs<unsigned int, cpu> rng;
+        if (rng.uniformBits32(n, values, engine.getState())) return daal::services::Status(daal::services::ErrorIncorrectErrorcodeFromGenerator);
+        return daal::services::Status();
+    }
+};
+
+struct UniformGenerator
+{
+    daal::services::Status operator()(BatchBaseImpl & engine, size_t n, double * values) const
+    {
+        daal::internal::RNGs<double, cpu> rng;
+        if (rng.uniform(n, values, engine.getState(), 0.0, 1.0)) return daal::services::Status(daal::services::ErrorIncorrectErrorcodeFromGenerator);
+        return daal::services::Status();
+    }
+};
+
+/* Generates the values by generateInParallel() and by one sequential call, and checks that the values and the engine states are equal */
+template <typename T, typename Generator>
+void checkParallelEqualsSequential(size_t n, const Generator & generate)
+{
+    EnginePtr parallelEngine   = Philox::create(12345);
+    EnginePtr sequentialEngine = Philox::create(12345);
+
+    std::vector<T> parallelValues(n), sequentialValues(n);
+    ASSERT_TRUE((daal::algorithms::engines::internal::generateInParallel<T, cpu>(*getImpl(parallelEngine), n, parallelValues.data(), generate)));
+    ASSERT_TRUE(generate(*getImpl(sequentialEngine), n, sequentialValues.data()));
+
+    for (size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(parallelValues[i], sequentialValues[i]) << "value " << i << " of " << n;
+    }
+
+    /* The source engine is advanced past all the generated values */
+    const std::vector<unsigned int> parallelNext   = generateBits(parallelEngine, 16);
+    const std::vector<unsigned int> sequentialNext = generateBits(sequentialEngine, 16);
+    EXPECT_EQ(parallelNext, sequentialNext);
+}
+} // namespace
+
+TEST(philox4x32x10_test, known_answer_for_zero_key)
+{
+    /* Philox4x32-10 known-answer vector of the Random123 library: zero key, zero counter */
+    const unsigned int expected[4] = { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u };
+
+    const std::vector<unsigned int> values = generateBits(Philox::create(0), 4);
+    for (size_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(values[i], expected[i]) << "value " << i;
+    }
+}
+
+TEST(philox4x32x10_test, stream_matches_reference_implementation)
+{
+    const unsigned long long seed = 0x299f31d0a4093822ull;
+    const size_t n                = 1003;
+
+    ReferencePhilox reference(seed);
+    const std::vector<unsigned int> values = generateBits(Philox::create((size_t)seed), n);
+    for (size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(values[i], reference.next()) << "value " << i;
+    }
+}
+
+TEST(philox4x32x10_test, skip_ahead_matches_reference_implementation)
+{
+    const size_t seed  = 777;
+    const size_t nSkip = 4 * 1000 + 2;
+
+    ReferencePhilox reference(seed);
+    for (size_t i = 0; i < nSkip; i++) reference.next();
+
+    EnginePtr engine = Philox::create(seed);
+    ASSERT_TRUE(engine->skipAhead(nSkip));
+    const std::vector<unsigned int> values = generateBits(engine, 10);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], reference.next()) << "value " << i;
+    }
+}
+
+TEST(philox4x32x10_test, clone_continues_the_stream)
+{
+    EnginePtr engine = Philox::create(42);
+    generateBits(engine, 5);
+    EnginePtr clone = engine->clone();
+    EXPECT_EQ(generateBits(engine, 20), generateBits(clone, 20));
+}
+
+TEST(philox4x32x10_test, parallel_bits_equal_sequential_stream)
+{
+    EnginePtr engine = Philox::create(12345);
+    EXPECT_EQ((daal::algorithms::engines::internal::getSkipPerValue<unsigned int, cpu>(*engine, BitsGenerator())), size_t(1));
+
+    const size_t blockSize = daal::algorithms::engines::internal::parallelGenerationBlockSize;
+    checkParallelEqualsSequential<unsigned int>(5 * blockSize + 7, BitsGenerator());
+}
+
+TEST(philox4x32x10_test, parallel_uniform_equals_sequential_stream)
+{
+    const size_t blockSize = daal::algorithms::engines::internal::parallelGenerationBlockSize;
+    checkParallelEqualsSequential<double>(3 * blockSize + 1, UniformGenerator());
+    checkParallelEqualsSequential<double>(blockSize / 2, UniformGenerator());
+}
@@ -31,6 +31,7 @@
 #include "data_management/data/numeric_table.h"
 #include "src/externals/service_blas.h"
 #include "src/services/service_arrays.h"
+#include "src/services/service_scratch_allocator.h"
 
 namespace daal
 {
@@ -65,7 +66,8 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par,
+                             services::internal::ScratchPool * scratch = nullptr);
 
 protected:
     void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
@@ -74,7 +76,7 @@ protected:
                               services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
 
     services::Status predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-                             const NumericTable & labels, size_t k);
+                             const NumericTable & labels, size_t k, services::internal::ScratchPool * scratch);
 };
 
 } // namespace internal
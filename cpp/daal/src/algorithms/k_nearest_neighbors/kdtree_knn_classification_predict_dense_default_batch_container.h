@@ -24,6 +24,7 @@
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict.h"
 #include "src/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -61,7 +62,7 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     daal::services::Environment::env & env        = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), compute, a.get(), m.get(),
-                       r.get(), par);
+                       r.get(), par, daal::services::internal::scratchPool(*const_cast<classifier::prediction::Input *>(input)));
 }
 
 } // namespace interface2
@@ -270,7 +270,8 @@ DAAL_FORCEINLINE void releaseNtData(const bool isHomogenSOA, const NumericTable
 
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
-                                                                                   NumericTable * y, const daal::algorithms::Parameter * par)
+                                                                                   NumericTable * y, const daal::algorithms::Parameter * par,
+                                                                                   services::internal::ScratchPool * scratch)
 {
     Status status;
 
@@ -369,7 +370,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
             {
                 findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data, isHomogenSOA,
                                      soa_arrays);
-                auto s = predict(dy[i * yColumnCount], local->heap, labels, k);
+                auto s = predict(dy[i * yColumnCount], local->heap, labels, k, scratch);
                 DAAL_CHECK_STATUS_THR(s)
             }
             y->releaseBlockOfRows(yBD);
@@ -533,7 +534,8 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
 
 template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
-    algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
+    algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k,
+    services::internal::ScratchPool * scratch)
 {
     const size_t heapSize = heap.size();
     if (heapSize < 1) return services::Status();
@@ -545,7 +547,8 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
     };
 
     data_management::BlockDescriptor<algorithmFpType> labelBD;
-    algorithmFpType * classes = static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(heapSize));
+    services::internal::TScratchArray<algorithmFpType, cpu> classesArr(scratch, heapSize);
+    algorithmFpType * const classes = classesArr.get();
     DAAL_CHECK_MALLOC(classes);
     for (size_t i = 0; i < heapSize; ++i)
     {
@@ -575,8 +578,6 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
         }
     }
     predictedClass = winnerClass;
-    daal_free(classes);
-    classes = nullptr;
     return services::Status();
 }
 
@@ -142,6 +142,8 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
 
     size_t kIter;
+    /* Keeps the blocks of the data on the same threads across the iterations */
+    daal::affinity_partitioner affinity;
 
     for (kIter = 0; kIter < nIter; kIter++)
     {
@@ -151,7 +153,7 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
             s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr, &affinity);
         }
 
         if (!s)
@@ -103,14 +103,14 @@ struct TaskKMeansLloyd
     }
 
     Status addNTToTaskThreadedDense(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
-                                    NumericTable * ntAssign = nullptr);
+                                    NumericTable * ntAssign = nullptr, daal::affinity_partitioner * affinity = nullptr);
 
     Status addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
-                                  NumericTable * ntAssign = nullptr);
+                                  NumericTable * ntAssign = nullptr, daal::affinity_partitioner * affinity = nullptr);
 
     template <Method method>
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
-                               NumericTable * ntAssign = nullptr);
+                               NumericTable * ntAssign = nullptr, daal::affinity_partitioner * affinity = nullptr);
 
     template <typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType * s1);
@@ -136,7 +136,8 @@ struct TaskKMeansLloyd
 
 template <typename algorithmFPType, CpuType cpu>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const NumericTable * const ntData, const algorithmFPType * const catCoef,
-                                                                       const size_t blockSizeDefault, NumericTable * ntAssign)
+                                                                       const size_t blockSizeDefault, NumericTable * ntAssign,
+                                                                       daal::affinity_partitioner * affinity)
 {
     const size_t n = ntData->getNumberOfRows();
 
@@ -144,7 +145,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
+    auto processBlock = [=, &safeStat](const int k) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local();
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
@@ -243,13 +244,24 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
         } /* for (size_t i = 0; i < blockSize; i++) */
 
         *trg += goal;
-    }); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+    };
+
+    /* The same blocks go to the same threads on every iteration when the partitioner is reused */
+    if (affinity)
+    {
+        daal::threader_for_affinity(nBlocks, 1, *affinity, processBlock);
+    }
+    else
+    {
+        daal::threader_for(nBlocks, nBlocks, processBlock);
+    }
     return safeStat.detach();
 }
 
 template <typename algorithmFPType, CpuType cpu>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef,
-                                                                     const size_t blockSizeDefault, NumericTable * ntAssign)
+                                                                     const size_t blockSizeDefault, NumericTable * ntAssign,
+                                                                     daal::affinity_partitioner * affinity)
 {
     CSRNumericTableIface * ntDataCsr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntData));
 
@@ -259,7 +271,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
+    auto processBlock = [=, &safeStat](const int k) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local();
         DAAL_CHECK_MALLOC_THR(tt);
 
@@ -339,22 +351,33 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
                 assignments[i] = (int)minIdx;
             }
         }
-    });
+    };
+
+    /* The same blocks go to the same threads on every iteration when the partitioner is reused */
+    if (affinity)
+    {
+        daal::threader_for_affinity(nBlocks, 1, *affinity, processBlock);
+    }
+    else
+    {
+        daal::threader_for(nBlocks, nBlocks, processBlock);
+    }
     return safeStat.detach();
 }
 
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
-                                                                  const size_t blockSizeDefault, NumericTable * ntAssign)
+                                                                  const size_t blockSizeDefault, NumericTable * ntAssign,
+                                                                  daal::affinity_partitioner * affinity)
 {
     if (method == lloydDense)
     {
-        return addNTToTaskThreadedDense(ntData, catCoef, blockSizeDefault, ntAssign);
+        return addNTToTaskThreadedDense(ntData, catCoef, blockSizeDefault, ntAssign, affinity);
     }
     else if (method == lloydCSR)
     {
-        return addNTToTaskThreadedCSR(ntData, catCoef, blockSizeDefault, ntAssign);
+        return addNTToTaskThreadedCSR(ntData, catCoef, blockSizeDefault, ntAssign, affinity);
     }
     DAAL_ASSERT(false);
     return Status();
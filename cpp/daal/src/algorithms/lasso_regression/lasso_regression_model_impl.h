@@ -50,7 +50,7 @@ public:
      * \param[in] dummy   Dummy variable for the templated constructor
      */
     template <typename modelFPType>
-    ModelImpl(size_t featnum, size_t nrhs, const lasso_regression::training::Parameter & par, modelFPType dummy, services::Status & s)
+    ModelImpl(size_t featnum, size_t nrhs, const lasso_regression::training::interface1::Parameter & par, modelFPType dummy, services::Status & s)
         : ImplType(featnum, nrhs, par, dummy)
     {}
 
@@ -42,7 +42,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LASSO_REGRESSION_PREDICTION_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : linear_model::prediction::Input(lastModelInputId + 1) {}
+Input::Input() : linear_model::prediction::Input(lastModelCollectionInputId + 1) {}
 Input::Input(const Input & other) : linear_model::prediction::Input(other) {}
 
 /**
@@ -85,6 +85,26 @@ void Input::set(ModelInputId id, const lasso_regression::ModelPtr & value)
     linear_model::prediction::Input::set(linear_model::prediction::ModelInputId(id), value);
 }
 
+/**
+ * Returns the collection of models for making lasso regression model-based prediction
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr Input::get(ModelCollectionInputId id) const
+{
+    return linear_model::prediction::Input::get(linear_model::prediction::ModelCollectionInputId(id));
+}
+
+/**
+ * Sets the collection of models for making lasso regression model-based prediction
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   %Input object
+ */
+void Input::set(ModelCollectionInputId id, const DataCollectionPtr & value)
+{
+    linear_model::prediction::Input::set(linear_model::prediction::ModelCollectionInputId(id), value);
+}
+
 Result::Result() : linear_model::prediction::Result(lastResultId + 1) {}
 
 /**
@@ -35,7 +35,7 @@ namespace lasso_regression
 {
 namespace training
 {
-namespace interface1
+namespace interface2
 {
 template <>
 Batch<DAAL_FPTYPE, lasso_regression::training::defaultDense>::Batch(const optimization_solver::iterative_solver::BatchPtr & solver)
@@ -52,7 +52,7 @@ Batch<DAAL_FPTYPE, lasso_regression::training::defaultDense>::Batch(const BatchT
     initialize();
 }
 
-} // namespace interface1
+} // namespace interface2
 } // namespace training
 } // namespace lasso_regression
 } // namespace algorithms
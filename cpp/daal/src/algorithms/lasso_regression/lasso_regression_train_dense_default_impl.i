@@ -27,6 +27,7 @@
 
 #include "src/algorithms/lasso_regression/lasso_regression_train_kernel.h"
 #include "src/algorithms/lasso_regression/lasso_regression_model_impl.h"
+#include "src/algorithms/elastic_net/elastic_net_train_path_impl.i"
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_algo_utils.h"
 #include "algorithms/optimization_solver/objective_function/mse_batch.h"
@@ -233,6 +234,14 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             });
         }
     }
+    if (par.lassoParametersPath)
+    {
+        return elastic_net::training::internal::trainPath<algorithmFPType, cpu>(*xTrain, *yTrain, *par.lassoParametersPath, nullptr,
+                                                                                par.optimizationSolver, par.interceptFlag ? xMeansPtr : nullptr,
+                                                                                par.interceptFlag ? yMeansPtr : nullptr, *res.get(betaPathId),
+                                                                                *m.getBeta());
+    }
+
     services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver); //par.optimizationSolver->clone();
     if (!pSolver.get())
     {
@@ -104,6 +104,11 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     if (p->optResultToCompute & computeGramMatrix)
         s |= data_management::checkNumericTable(get(gramMatrixId).get(), gramMatrixStr(), 0, 0, in->getNumberOfFeatures(), in->getNumberOfFeatures());
 
+    const interface2::Parameter * const p2 = dynamic_cast<const interface2::Parameter *>(p);
+    if (p2 && p2->lassoParametersPath)
+        s |= data_management::checkNumericTable(get(betaPathId).get(), betaPathStr(), 0, 0, nBeta * nResponses,
+                                                p2->lassoParametersPath->getNumberOfRows());
+
     s |= lasso_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
     return s;
 }
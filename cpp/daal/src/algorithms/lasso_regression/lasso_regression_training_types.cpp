@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/lasso_regression/lasso_regression_training_types.h"
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
 #include "src/services/daal_strings.h"
 using namespace daal::data_management;
 using namespace daal::services;
@@ -151,6 +152,12 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 
     const size_t lassoParamsNumberOfColumns = parameter->lassoParameters->getNumberOfColumns();
     DAAL_CHECK((lassoParamsNumberOfColumns == 1) || (nColumnsInDepVariable == lassoParamsNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    const interface2::Parameter * const parameter2 = dynamic_cast<const interface2::Parameter *>(parameter);
+    if (parameter2 && parameter2->lassoParametersPath)
+    {
+        const size_t pathNumberOfColumns = parameter2->lassoParametersPath->getNumberOfColumns();
+        DAAL_CHECK((pathNumberOfColumns == 1) || (nColumnsInDepVariable == pathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
     return services::Status();
 }
 
@@ -168,6 +175,29 @@ services::Status Parameter::check() const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(const SolverPtr & solver) : interface1::Parameter(solver) {}
+
+services::Status Parameter::check() const
+{
+    services::Status status = interface1::Parameter::check();
+    if (status == services::Status() && lassoParametersPath)
+    {
+        status = checkNumericTable(lassoParametersPath.get(), lassoParametersPathStr(), packed_mask);
+        DAAL_CHECK_STATUS_VAR(status);
+        /* The path is trained with the coordinate descent, the other solvers and the positive constraint are not supported */
+        const optimization_solver::coordinate_descent::Parameter * const solverPar =
+            optimizationSolver.get() ? dynamic_cast<const optimization_solver::coordinate_descent::Parameter *>(optimizationSolver->getParameter())
+                                     : NULL;
+        DAAL_CHECK_EX(!optimizationSolver.get() || (solverPar && !solverPar->positive), ErrorIncorrectParameter, ParameterName,
+                      optimizationSolverStr());
+    }
+    return status;
+}
+
+} // namespace interface2
 } // namespace training
 } // namespace lasso_regression
 } // namespace algorithms
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/linear_model/linear_model_predict_types.h"
+#include "src/algorithms/linear_model/linear_model_predict_models.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 
@@ -63,9 +64,52 @@ void Input::set(ModelInputId id, const linear_model::ModelPtr & value)
     regression::prediction::Input::set(regression::prediction::ModelInputId(id), value);
 }
 
+DataCollectionPtr Input::get(ModelCollectionInputId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+void Input::set(ModelCollectionInputId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
+size_t Input::getNumberOfResponses() const
+{
+    const DataCollectionPtr modelCollection = get(models);
+    if (!modelCollection) return get(model)->getNumberOfResponses();
+
+    size_t nResponses  = 0;
+    bool interceptFlag = false;
+    for (size_t i = 0; i < modelCollection->size(); ++i)
+    {
+        const NumericTable * const beta = internal::getModelBeta((*modelCollection)[i], interceptFlag);
+        if (beta) nResponses += beta->getNumberOfRows();
+    }
+    return nResponses;
+}
+
 Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
 {
     Status s;
+    const DataCollectionPtr modelCollection = get(models);
+    if (modelCollection)
+    {
+        const NumericTablePtr dataTable = get(data);
+        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+        DAAL_CHECK_EX(modelCollection->size() > 0, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, modelsStr());
+
+        const size_t nBeta = dataTable->getNumberOfColumns() + 1;
+        bool interceptFlag = false;
+        for (size_t i = 0; i < modelCollection->size(); ++i)
+        {
+            NumericTable * const beta = internal::getModelBeta((*modelCollection)[i], interceptFlag);
+            DAAL_CHECK_EX(beta, ErrorNullModel, ArgumentName, modelsStr());
+            DAAL_CHECK_STATUS(s, checkNumericTable(beta, betaStr(), 0, 0, nBeta));
+        }
+        return s;
+    }
+
     DAAL_CHECK_STATUS(s, regression::prediction::Input::check(parameter, method));
 
     size_t nBeta      = get(data)->getNumberOfColumns() + 1;
@@ -90,7 +134,7 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     Status s;
     DAAL_CHECK_STATUS(s, regression::prediction::Result::check(input, par, method));
     const Input * in  = static_cast<const Input *>(input);
-    size_t nResponses = in->get(model)->getNumberOfResponses();
+    size_t nResponses = in->getNumberOfResponses();
 
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == nResponses, ErrorIncorrectNumberOfFeatures, ArgumentName, predictionStr());
     return s;
@@ -41,7 +41,7 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
 {
     const Input * in           = static_cast<const Input *>(input);
     size_t nVectors            = in->get(data)->getNumberOfRows();
-    size_t nDependentVariables = in->get(model)->getNumberOfResponses();
+    size_t nDependentVariables = in->getNumberOfResponses();
     Status st;
 
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
@@ -76,6 +76,13 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
     auto & deviceInfo = context.getInfoDevice();
 
+    DataCollection * modelCollection = input->get(models).get();
+    if (modelCollection)
+    {
+        DAAL_CHECK(deviceInfo.isCpu, services::ErrorMethodNotImplemented);
+        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, modelCollection, r);
+    }
+
     if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r);
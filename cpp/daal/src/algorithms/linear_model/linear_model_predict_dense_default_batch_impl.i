@@ -31,6 +31,8 @@
 #include "src/externals/service_blas.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/linear_model/linear_model_predict_models.h"
+#include "src/externals/service_memory.h"
 
 namespace daal
 {
@@ -93,12 +95,6 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
 {
     linear_model::Model * model = const_cast<linear_model::Model *>(m);
 
-    /* Get numeric tables with input data */
-    NumericTable * dataTable = const_cast<NumericTable *>(a);
-
-    /* Get numeric table to store results */
-    DAAL_INT numVectors = dataTable->getNumberOfRows();
-
     /* Get linear regression coefficients */
     NumericTable * betaTable = model->getBeta().get();
     DAAL_INT numResponses    = betaTable->getNumberOfRows();
@@ -108,6 +104,66 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
     DAAL_CHECK_BLOCK_STATUS(betaRows)
     const algorithmFPType * beta = betaRows.get();
 
+    return computeResponses(a, beta, betaTable->getNumberOfColumns(), numResponses, model->getInterceptFlag(), r);
+} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::compute */
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * a, const DataCollection * models, NumericTable * r)
+{
+    const size_t nModels = models->size();
+    const size_t nBetas  = a->getNumberOfColumns() + 1;
+
+    size_t numResponses = 0;
+    bool interceptFlag  = false;
+    for (size_t i = 0; i < nModels; i++)
+    {
+        const NumericTable * betaTable = getModelBeta((*models)[i], interceptFlag);
+        DAAL_CHECK(betaTable, ErrorNullModel);
+        numResponses += betaTable->getNumberOfRows();
+    }
+
+    /* Stack the coefficients of all the models to compute all the responses with one GEMM per block of input data rows */
+    TArray<algorithmFPType, cpu> betaArray(numResponses * nBetas);
+    algorithmFPType * beta = betaArray.get();
+    DAAL_CHECK_MALLOC(beta);
+
+    size_t startResponse = 0;
+    for (size_t i = 0; i < nModels; i++)
+    {
+        NumericTable * betaTable     = getModelBeta((*models)[i], interceptFlag);
+        const size_t nModelResponses = betaTable->getNumberOfRows();
+
+        ReadRows<algorithmFPType, cpu> betaRows(betaTable, 0, nModelResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRows)
+        algorithmFPType * modelBeta = beta + startResponse * nBetas;
+        const size_t betaSize       = nModelResponses * nBetas * sizeof(algorithmFPType);
+        int result                  = daal::services::internal::daal_memcpy_s(modelBeta, betaSize, betaRows.get(), betaSize);
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        if (!interceptFlag)
+        {
+            for (size_t j = 0; j < nModelResponses; j++)
+            {
+                modelBeta[j * nBetas] = 0;
+            }
+        }
+        startResponse += nModelResponses;
+    }
+
+    return computeResponses(a, beta, nBetas, numResponses, true, r);
+} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::compute */
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::computeResponses(const NumericTable * a, const algorithmFPType * beta,
+                                                                                     DAAL_INT nAllBetas, DAAL_INT numResponses, bool findBeta0,
+                                                                                     NumericTable * r)
+{
+    /* Get numeric tables with input data */
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+
+    /* Get numeric table to store results */
+    DAAL_INT numVectors = dataTable->getNumberOfRows();
+
     size_t numRowsInBlock = _numRowsInBlock;
 
     if (numRowsInBlock < 1)
@@ -135,7 +191,7 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
         DAAL_INT numRows = endRow - startRow;
 
         DAAL_INT numFeatures = dataTable->getNumberOfColumns();
-        DAAL_INT nAllBetas   = betaTable->getNumberOfColumns();
+        DAAL_INT numBetas    = nAllBetas;
 
         Status s;
         /* Retrieve data blocks associated with input and resulting tables */
@@ -159,11 +215,11 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
         DAAL_INT * pnumResponses        = (DAAL_INT *)&numResponses;
 
         /* Calculate predictions */
-        computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas, beta, pnumResponses, responseBlock, model->getInterceptFlag());
+        computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &numBetas, beta, pnumResponses, responseBlock, findBeta0);
     }); /* daal::threader_for */
 
     return safeStat.detach();
-} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::compute */
+} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeResponses */
 
 } /* namespace internal */
 } /* namespace prediction */
@@ -55,6 +55,15 @@ public:
      *  \param r[out]   Prediction results
      */
     services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r);
+
+    /**
+     *  \brief Compute the prediction results of several models in one pass over the input data.
+     *
+     *  \param a[in]        Matrix of input variables X
+     *  \param models[in]   Collection of linear and logistic regression models
+     *  \param r[out]       Prediction results of all the models
+     */
+    services::Status compute(const NumericTable * a, const DataCollection * models, NumericTable * r);
 };
 
 template <typename algorithmFpType, CpuType cpu>
@@ -63,7 +72,12 @@ class PredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithm
 public:
     services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r);
 
+    services::Status compute(const NumericTable * a, const DataCollection * models, NumericTable * r);
+
 protected:
+    services::Status computeResponses(const NumericTable * a, const algorithmFpType * beta, DAAL_INT nAllBetas, DAAL_INT numResponses,
+                                      bool findBeta0, NumericTable * r);
+
     void computeBlockOfResponses(DAAL_INT * numFeatures, DAAL_INT * numRows, const algorithmFpType * dataBlock, DAAL_INT * numBetas,
                                  const algorithmFpType * beta, DAAL_INT * numResponses, algorithmFpType * responseBlock, bool findBeta0);
 
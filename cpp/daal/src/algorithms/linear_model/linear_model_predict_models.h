@@ -0,0 +1,72 @@
+/* file: linear_model_predict_models.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Access to the coefficients of the models from the collection of models
+//  used in the regression model-based prediction.
+//--
+*/
+
+#ifndef __LINEAR_MODEL_PREDICT_MODELS_H__
+#define __LINEAR_MODEL_PREDICT_MODELS_H__
+
+#include "algorithms/linear_model/linear_model_model.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace prediction
+{
+namespace internal
+{
+/**
+ *  Returns the coefficients of the linear model or the logistic regression model,
+ *  null if the object is not a model of these types
+ *
+ *  \param model[in]            Object from the collection of models
+ *  \param interceptFlag[out]   Flag. True if the model contains the intercept term
+ */
+inline data_management::NumericTable * getModelBeta(const data_management::SerializationIfacePtr & model, bool & interceptFlag)
+{
+    linear_model::Model * const linearModel = dynamic_cast<linear_model::Model *>(model.get());
+    if (linearModel)
+    {
+        interceptFlag = linearModel->getInterceptFlag();
+        return linearModel->getBeta().get();
+    }
+
+    logistic_regression::Model * const logisticModel = dynamic_cast<logistic_regression::Model *>(model.get());
+    if (logisticModel)
+    {
+        interceptFlag = logisticModel->getInterceptFlag();
+        return logisticModel->getBeta().get();
+    }
+    return nullptr;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -195,6 +195,20 @@ public:
      */
     static Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, bool initializeResult,
                           bool interceptFlag);
+
+    /**
+     * Adds the contribution of the range of rows of the data set to the partial sums
+     * \param[in]     x        Input data set of size N x P
+     * \param[in]     y        Input responses of size N x Ny
+     * \param[in]     startRow Index of the first row in the range
+     * \param[in]     nRows    Number of rows in the range
+     * \param[in,out] xtx      Array of size P' x P' with the partial sums of \f$X'^T \times X'\f$
+     * \param[in,out] xty      Array of size Ny x P' with the partial sums of \f$X'^T \times Y\f$
+     * \param[in]     nBetasIntercept  P' - number of columns in the partial sums
+     * \return Status of the computations
+     */
+    static Status updateRows(const NumericTable & x, const NumericTable & y, size_t startRow, size_t nRows, algorithmFPType * xtx,
+                             algorithmFPType * xty, size_t nBetasIntercept);
 };
 
 /**
@@ -220,13 +234,15 @@ public:
 
 protected:
     /**
-     * Adds input numeric table to the partial result
+     * Adds input numeric table to the partial result using compensated (Kahan) summation
      * \param[in]  partialTable       Numeric table with partial sums
-     * \param[out] result             Resulting array with full sums
+     * \param[in,out] result          Resulting array with full sums
+     * \param[in,out] compensation    Array of the size of result with the running compensation of the rounding errors,
+     *                                if null, the partial sums are added without compensation
      * \param[in]  threadingCondition Flag. If true, then the operation is performed in parallel
      * \return Status of the computations
      */
-    static Status merge(const NumericTable & partialTable, algorithmFPType * result, bool threadingCondition);
+    static Status merge(const NumericTable & partialTable, algorithmFPType * result, algorithmFPType * compensation, bool threadingCondition);
 };
 
 } // namespace internal
@@ -23,6 +23,8 @@
 
 #include "src/algorithms/linear_model/linear_model_train_normeq_kernel.h"
 #include "src/threading/threading.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
 
 namespace daal
 {
@@ -57,8 +59,13 @@ void conditional_threader_for(bool condition, size_t n, size_t threadsRequest, c
     }
 }
 
+/* The compensation of the Kahan summation is algebraically zero, so the compiler must not reassociate the operations,
+   otherwise the compensation is optimized away. The pragma covers the Intel(R) C++ Compiler with its default -fp-model fast,
+   each intermediate of the summation is volatile for the other compilers, for which the pragma is empty, and for -ffast-math */
+PRAGMA_FLOAT_PRECISE_PUSH
 template <typename algorithmFPType, CpuType cpu>
-Status MergeKernel<algorithmFPType, cpu>::merge(const NumericTable & partialTable, algorithmFPType * result, bool threadingCondition)
+Status MergeKernel<algorithmFPType, cpu>::merge(const NumericTable & partialTable, algorithmFPType * result, algorithmFPType * compensation,
+                                                bool threadingCondition)
 {
     const size_t nRows = partialTable.getNumberOfRows();
 
@@ -67,9 +74,23 @@ Status MergeKernel<algorithmFPType, cpu>::merge(const NumericTable & partialTabl
     algorithmFPType * partialResult = const_cast<algorithmFPType *>(block.get());
 
     size_t resultSize = nRows * partialTable.getNumberOfColumns();
-    conditional_threader_for<cpu>(threadingCondition, resultSize, resultSize, [=](size_t i) { result[i] += partialResult[i]; });
+    if (!compensation)
+    {
+        conditional_threader_for<cpu>(threadingCondition, resultSize, resultSize, [=](size_t i) { result[i] += partialResult[i]; });
+        return Status();
+    }
+
+    /* Kahan summation: compensation keeps the low-order bits lost in the previous additions to result */
+    conditional_threader_for<cpu>(threadingCondition, resultSize, resultSize, [=](size_t i) {
+        volatile const algorithmFPType term  = partialResult[i] - compensation[i];
+        volatile const algorithmFPType sum   = result[i] + term;
+        volatile const algorithmFPType added = sum - result[i];
+        compensation[i]                      = added - term;
+        result[i]                            = sum;
+    });
     return Status();
 }
+PRAGMA_FLOAT_PRECISE_POP
 
 template <typename algorithmFPType, CpuType cpu>
 Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** partialxtx, NumericTable ** partialxty, NumericTable & xtxTable,
@@ -89,13 +110,22 @@ Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** part
     service_memset<algorithmFPType, cpu>(xtx, 0, nBetas * nBetas);
     service_memset<algorithmFPType, cpu>(xty, 0, nBetas * nResponses);
 
+    /* The partial results are summed with compensation, so that many of them can be merged without the loss
+       of accuracy growing with their number */
+    TArrayScalableCalloc<algorithmFPType, cpu> compensationArray(nBetas * (nBetas + nResponses));
+    DAAL_CHECK_MALLOC(compensationArray.get());
+    algorithmFPType * xtxCompensation = compensationArray.get();
+    algorithmFPType * xtyCompensation = xtxCompensation + nBetas * nBetas;
+
     const size_t minThreadingSize = 512 * 1024;
     Status st;
     for (size_t i = 0; i < n; i++)
     {
-        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxtx[i], xtx, nBetas * nBetas * sizeof(algorithmFPType) > minThreadingSize);
+        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxtx[i], xtx, xtxCompensation,
+                                                       nBetas * nBetas * sizeof(algorithmFPType) > minThreadingSize);
         DAAL_CHECK_STATUS_VAR(st);
-        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxty[i], xty, nBetas * nResponses * sizeof(algorithmFPType) > minThreadingSize);
+        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxty[i], xty, xtyCompensation,
+                                                       nBetas * nResponses * sizeof(algorithmFPType) > minThreadingSize);
         DAAL_CHECK_STATUS_VAR(st);
     }
     return st;
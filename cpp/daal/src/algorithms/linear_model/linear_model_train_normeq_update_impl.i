@@ -190,6 +190,15 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
         service_memset<algorithmFPType, cpu>(xty, 0, nResponses * nBetasIntercept);
     }
 
+    return updateRows(xTable, yTable, 0, nRows, xtx, xty, nBetasIntercept);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status UpdateKernel<algorithmFPType, cpu>::updateRows(const NumericTable & xTable, const NumericTable & yTable, size_t startRow, size_t nRows,
+                                                      algorithmFPType * xtx, algorithmFPType * xty, size_t nBetasIntercept)
+{
+    const size_t nResponses(yTable.getNumberOfColumns());
+
     /* Split rows by blocks */
     size_t nRowsInBlock = 128;
 
@@ -212,14 +221,14 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
             return;
         }
 
-        size_t startRow = iBlock * nRowsInBlock;
-        size_t endRow   = startRow + nRowsInBlock;
-        if (endRow > nRows)
+        size_t startBlockRow = iBlock * nRowsInBlock;
+        size_t endBlockRow   = startBlockRow + nRowsInBlock;
+        if (endBlockRow > nRows)
         {
-            endRow = nRows;
+            endBlockRow = nRows;
         }
 
-        Status localSt = tlsLocal->update(startRow, endRow - startRow, xTable, yTable);
+        Status localSt = tlsLocal->update(startRow + startBlockRow, endBlockRow - startBlockRow, xTable, yTable);
         DAAL_CHECK_STATUS_THR(localSt);
     });
 
@@ -0,0 +1,56 @@
+/* file: linear_regression_training_out_of_core.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parameters of linear regression model-based training
+//  on the data read from a data source in chunks
+//--
+*/
+
+#include "algorithms/linear_regression/linear_regression_training_out_of_core.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+OutOfCoreParameter::OutOfCoreParameter(size_t nDependentVariables, size_t nRowsInChunk, size_t nChunksInSegment)
+    : linear_regression::Parameter(), nDependentVariables(nDependentVariables), nRowsInChunk(nRowsInChunk), nChunksInSegment(nChunksInSegment)
+{}
+
+Status OutOfCoreParameter::check() const
+{
+    DAAL_CHECK_EX(nDependentVariables > 0, ErrorIncorrectParameter, ParameterName, nDependentVariablesStr());
+    DAAL_CHECK_EX(nRowsInChunk > 0, ErrorIncorrectParameter, ParameterName, nRowsInChunkStr());
+    DAAL_CHECK_EX(nChunksInSegment > 0, ErrorIncorrectParameter, ParameterName, nChunksInSegmentStr());
+    return Status();
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,43 @@
+/* file: linear_regression_training_out_of_core_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of linear regression model-based training
+//  on the data read from a data source in chunks
+//--
+*/
+
+#include "src/algorithms/linear_regression/linear_regression_training_out_of_core_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+template class DAAL_EXPORT OutOfCore<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
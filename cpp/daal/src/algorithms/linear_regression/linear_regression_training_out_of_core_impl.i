@@ -0,0 +1,152 @@
+/* file: linear_regression_training_out_of_core_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of linear regression model-based training
+//  on the data read from a data source in chunks
+//--
+*/
+
+#include "algorithms/linear_regression/linear_regression_training_out_of_core.h"
+#include "algorithms/linear_regression/linear_regression_training_online.h"
+#include "algorithms/linear_regression/linear_regression_training_distributed.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/merged_numeric_table.h"
+#include "src/algorithms/service_threading.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Buffer for one chunk of the training data set
+ */
+template <typename algorithmFPType>
+struct OutOfCoreChunk
+{
+    Status initialize(size_t nFeatures, size_t nDependentVariables)
+    {
+        Status st;
+        data = HomogenNumericTable<algorithmFPType>::create(nFeatures, 0, NumericTable::doNotAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        dependentVariables = HomogenNumericTable<algorithmFPType>::create(nDependentVariables, 0, NumericTable::doNotAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        merged = MergedNumericTable::create(data, dependentVariables, &st);
+        nRows  = 0;
+        return st;
+    }
+
+    NumericTablePtr data;               /*!< Features of the chunk */
+    NumericTablePtr dependentVariables; /*!< Dependent variables of the chunk */
+    NumericTablePtr merged;             /*!< Table the chunk is read into, it joins the features and the dependent variables */
+    size_t nRows;                       /*!< Number of rows read into the chunk */
+};
+
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * Reads the data set from the data source into two chunks by turns: the next chunk is read in the background
+ * while the partial result of the current segment is updated with the other one.
+ * The partial results of the segments are merged on the master step of the distributed processing mode,
+ * which sums them with compensation
+ */
+template <typename algorithmFPType>
+services::Status OutOfCore<algorithmFPType>::compute()
+{
+    Status st = parameter.check();
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const size_t nColumns = _dataSource->getNumberOfColumns();
+    DAAL_CHECK_EX(parameter.nDependentVariables < nColumns, ErrorIncorrectParameter, ParameterName, nDependentVariablesStr());
+    const size_t nFeatures = nColumns - parameter.nDependentVariables;
+
+    internal::OutOfCoreChunk<algorithmFPType> chunks[2];
+    DAAL_CHECK_STATUS(st, chunks[0].initialize(nFeatures, parameter.nDependentVariables));
+    DAAL_CHECK_STATUS(st, chunks[1].initialize(nFeatures, parameter.nDependentVariables));
+
+    data_management::DataSource * dataSource = _dataSource;
+    const size_t nRowsInChunk                = parameter.nRowsInChunk;
+    chunks[0].nRows                          = dataSource->loadDataBlock(nRowsInChunk, chunks[0].merged.get());
+    DAAL_CHECK_STATUS(st, dataSource->status());
+    DAAL_CHECK(chunks[0].nRows > 0, ErrorEmptyDataSource);
+
+    Distributed<step2Master, algorithmFPType> masterAlgorithm;
+    masterAlgorithm.parameter.interceptFlag = parameter.interceptFlag;
+
+    SharedPtr<Online<algorithmFPType> > segmentAlgorithm;
+    size_t nChunksInCurrentSegment = 0;
+
+    daal::task_group reader;
+    for (size_t iChunk = 0; chunks[iChunk % 2].nRows > 0; iChunk++)
+    {
+        internal::OutOfCoreChunk<algorithmFPType> & current = chunks[iChunk % 2];
+        internal::OutOfCoreChunk<algorithmFPType> * next    = &chunks[(iChunk + 1) % 2];
+
+        auto readNext = [=]() { next->nRows = dataSource->loadDataBlock(nRowsInChunk, next->merged.get()); };
+        reader.run(readNext);
+
+        if (!segmentAlgorithm)
+        {
+            segmentAlgorithm.reset(new Online<algorithmFPType>());
+            segmentAlgorithm->parameter.interceptFlag = parameter.interceptFlag;
+        }
+        segmentAlgorithm->input.set(data, current.data);
+        segmentAlgorithm->input.set(dependentVariables, current.dependentVariables);
+        st |= segmentAlgorithm->compute();
+
+        /* The partial sums of the segment are passed to the master step and the next segment starts from zero */
+        if (st && ++nChunksInCurrentSegment == parameter.nChunksInSegment)
+        {
+            masterAlgorithm.input.add(partialModels, segmentAlgorithm->getPartialResult());
+            segmentAlgorithm.reset();
+            nChunksInCurrentSegment = 0;
+        }
+
+        /* The next chunk is in use by the reader until it finishes, even if the update failed */
+        reader.wait();
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, dataSource->status());
+    }
+    if (segmentAlgorithm)
+    {
+        masterAlgorithm.input.add(partialModels, segmentAlgorithm->getPartialResult());
+    }
+
+    DAAL_CHECK_STATUS(st, masterAlgorithm.compute());
+    DAAL_CHECK_STATUS(st, masterAlgorithm.finalizeCompute());
+    _result = masterAlgorithm.getResult();
+    return st;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
@@ -150,9 +150,13 @@ services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictR
     const size_t nYPerRow            = 1;
     const size_t nRowsInBlockDefault = 500;
 
-    const size_t nRowsInBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
-                                                                              (nCols + nYPerRow) * sizeof(algorithmFPType), nRowsInBlockDefault);
-    const size_t nDataBlocks  = nRowsTotal / nRowsInBlock + !!(nRowsTotal % nRowsInBlock);
+    const size_t nRowsInDenseBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
+                                                                                   (nCols + nYPerRow) * sizeof(algorithmFPType), nRowsInBlockDefault);
+
+    /* The rows of the data set in CSR format are not converted to the dense ones, so the block size does not depend on nCols */
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(_data));
+    const size_t nRowsInBlock            = csrData ? nRowsInBlockDefault : nRowsInDenseBlock;
+    const size_t nDataBlocks             = nRowsTotal / nRowsInBlock + !!(nRowsTotal % nRowsInBlock);
 
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable &>(beta), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(betaBD);
@@ -168,9 +172,17 @@ services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictR
         }
         const size_t iStartRow      = iBlock * nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? nRowsTotal - iBlock * nRowsInBlock : nRowsInBlock;
+        algorithmFPType * res       = pRes + iStartRow;
+        if (csrData)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> xBD(csrData, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::applyBetaCSR(xBD.values(), xBD.cols(), xBD.rows(), betaBD.get(), res,
+                                                                                              nRowsToProcess, nCols, true);
+            return;
+        }
         ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-        algorithmFPType * res = pRes + iStartRow;
         ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::applyBeta(xBD.get(), betaBD.get(), res, nRowsToProcess, nCols, true);
     });
     return safeStat.detach();
@@ -190,6 +202,8 @@ public:
 
 protected:
     void predictRaw(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * rawRes, size_t nRows, size_t nClasses, size_t nCols);
+    void predictRawCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets, const algorithmFPType * beta,
+                       algorithmFPType * rawRes, algorithmFPType * rawResByClass, size_t nRows, size_t nClasses, size_t nCols);
 
 protected:
     const NumericTable * _data;
@@ -233,15 +247,21 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         resBD.set(_res, 0, nRowsTotal);
         DAAL_CHECK_BLOCK_STATUS(resBD);
     }
-    const size_t nRowsInBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
-                                                                              (nCols + nYPerRow) * sizeof(algorithmFPType), nRowsInBlockDefault);
-    const size_t nDataBlocks  = nRowsTotal / nRowsInBlock + !!(nRowsTotal % nRowsInBlock);
+    const size_t nRowsInDenseBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
+                                                                                   (nCols + nYPerRow) * sizeof(algorithmFPType), nRowsInBlockDefault);
+
+    /* The rows of the data set in CSR format are not converted to the dense ones, so the block size does not depend on nCols */
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(_data));
+    const size_t nRowsInBlock            = csrData ? nRowsInBlockDefault : nRowsInDenseBlock;
+    const size_t nDataBlocks             = nRowsTotal / nRowsInBlock + !!(nRowsTotal % nRowsInBlock);
 
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable &>(beta), 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(betaBD);
 
-    using TlsDataCpu = TlsData<algorithmFPType, cpu>;
-    daal::tls<TlsDataCpu *> tlsData([=]() -> TlsDataCpu * { return new TlsDataCpu(nRowsInBlock * nClasses, _data); });
+    /* The raw values of the block of CSR rows are computed class by class in the second half of the buffer */
+    const size_t nRawValues = nRowsInBlock * nClasses * (csrData ? 2 : 1);
+    using TlsDataCpu        = TlsData<algorithmFPType, cpu>;
+    daal::tls<TlsDataCpu *> tlsData([=]() -> TlsDataCpu * { return new TlsDataCpu(nRawValues, _data); });
 
     SafeStatus safeStat;
     HostAppHelper host(pHostApp, 1000);
@@ -256,10 +276,20 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? nRowsTotal - iBlock * nRowsInBlock : nRowsInBlock;
         TlsDataCpu * pLocal         = tlsData.local();
         DAAL_CHECK_MALLOC_THR(pLocal);
-        const algorithmFPType * pXBlock = pLocal->x.next(iStartRow, nRowsToProcess);
-        DAAL_CHECK_BLOCK_STATUS_THR(pLocal->x);
         algorithmFPType * pRawValues = pLocal->raw;
-        predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        if (csrData)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> xBD(csrData, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            predictRawCSR(xBD.values(), xBD.cols(), xBD.rows(), betaBD.get(), pRawValues, pRawValues + nRowsInBlock * nClasses, nRowsToProcess,
+                          nClasses, nCols);
+        }
+        else
+        {
+            const algorithmFPType * pXBlock = pLocal->x.next(iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(pLocal->x);
+            predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        }
         if (_res)
         {
             algorithmFPType * res = resBD.get() + iStartRow;
@@ -306,6 +336,16 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictRaw(const algorithmFPTy
     cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::applyBeta(x, beta, rawRes, nRows, nClasses, nCols, true);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictMulticlassTask<algorithmFPType, cpu>::predictRawCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets,
+                                                                const algorithmFPType * beta, algorithmFPType * rawRes,
+                                                                algorithmFPType * rawResByClass, size_t nRows, size_t nClasses, size_t nCols)
+{
+    namespace cel = daal::algorithms::optimization_solver::cross_entropy_loss;
+    cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::applyBetaCSR(values, cols, rowOffsets, beta, rawRes,
+                                                                                                 rawResByClass, nRows, nClasses, nCols, true);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictKernel
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -90,7 +90,7 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
         auto par1 = dynamic_cast<const multi_class_classifier::interface1::Parameter *>(parameter);
         if (par1) DAAL_CHECK_EX(par1->prediction.get(), services::ErrorNullAuxiliaryAlgorithm, services::ParameterName, predictionStr());
 
-        auto par2 = dynamic_cast<const multi_class_classifier::Parameter *>(parameter);
+        auto par2 = dynamic_cast<const multi_class_classifier::interface2::Parameter *>(parameter);
         if (par2) DAAL_CHECK_EX(par2->prediction.get(), services::ErrorNullAuxiliaryAlgorithm, services::ParameterName, predictionStr());
 
         if (par1 == nullptr && par2 == nullptr) return services::Status(services::ErrorNullParameterNotSupported);
@@ -42,7 +42,7 @@ template class BatchContainer<DAAL_FPTYPE, multiClassClassifierWu, training::one
 namespace internal
 {
 template class MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, DAAL_FPTYPE, classifier::prediction::Batch,
-                                                 multi_class_classifier::Parameter, DAAL_CPU>;
+                                                 multi_class_classifier::interface2::Parameter, DAAL_CPU>;
 } // namespace internal
 } // namespace prediction
 } // namespace multi_class_classifier
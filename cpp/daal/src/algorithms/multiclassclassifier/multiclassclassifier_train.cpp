@@ -68,7 +68,7 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
             DAAL_CHECK_EX(par1->training.get(), services::ErrorNullAuxiliaryAlgorithm, services::ParameterName, trainingStr());
         }
 
-        auto par2 = dynamic_cast<const multi_class_classifier::Parameter *>(parameter);
+        auto par2 = dynamic_cast<const multi_class_classifier::interface2::Parameter *>(parameter);
         if (par2)
         {
             nClasses = par2->nClasses;
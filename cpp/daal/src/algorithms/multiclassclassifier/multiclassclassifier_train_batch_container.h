@@ -37,7 +37,7 @@ namespace multi_class_classifier
 {
 namespace training
 {
-namespace interface2
+namespace interface3
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -72,7 +72,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                        a[0], a[1], a[2], r, par);
 }
 
-} // namespace interface2
+} // namespace interface3
 
 } // namespace training
 
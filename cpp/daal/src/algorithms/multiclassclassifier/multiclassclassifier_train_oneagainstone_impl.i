@@ -31,6 +31,7 @@
 #include "src/algorithms/service_sort.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/externals/service_blas.h"
+#include "src/algorithms/svm/svm_primal_weights.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -47,6 +48,22 @@ namespace training
 {
 namespace internal
 {
+/* Size of the cache shared by the two-class sub-problems, the parameters of the previous interfaces do not provide it */
+inline size_t getSharedCacheSize(const multi_class_classifier::interface1::Parameter * par)
+{
+    return 0;
+}
+
+inline size_t getSharedCacheSize(const multi_class_classifier::interface2::Parameter * par)
+{
+    return 0;
+}
+
+inline size_t getSharedCacheSize(const multi_class_classifier::interface3::Parameter * par)
+{
+    return par->sharedCacheSize;
+}
+
 template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
 services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::compute(
     const NumericTable * xTable, const NumericTable * yTable, const NumericTable * wTable, daal::algorithms::Model * r,
@@ -76,9 +93,29 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
     }
 
+    /* Two-class SVMs are trained on the row indices of the input data with the kernel function values shared by the sub-problems.
+       The indices are stored in the floating-point tables, so the number of observations is limited by the exactly representable integers */
+    svm::Parameter * const svmPar = dynamic_cast<svm::Parameter *>(simpleTrainingInit->getBaseParameter());
+    const size_t maxExactIndex    = (size_t)1 << (sizeof(algorithmFPType) == sizeof(float) ? 24 : 53);
+    const bool shareKernel        = getSharedCacheSize(mccPar) && svmPar && svmPar->kernel.get() && nVectors <= maxExactIndex;
+    bool computePrimalWeights     = false;
+    if (shareKernel)
+    {
+        Status s;
+        services::SharedPtr<SharedKernelCache<algorithmFPType, cpu> > cache =
+            SharedKernelCache<algorithmFPType, cpu>::create(*xTable, y, nClasses, svmPar->kernel, getSharedCacheSize(mccPar), s);
+        DAAL_CHECK_STATUS_VAR(s);
+        computePrimalWeights = svm::internal::getLinearKernelParameter(svmPar->kernel) != nullptr;
+        svmPar->kernel       = kernel_function::KernelIfacePtr(new SharedKernel<algorithmFPType, cpu>(cache));
+        DAAL_CHECK_MALLOC(svmPar->kernel.get());
+    }
+
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]() {
+        if (shareKernel)
+            return (TSubTask *)SubTaskSharedKernel<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, xTable, weights,
+                                                                                          simpleTrainingInit, computePrimalWeights);
         if (xTable->getDataLayout() == NumericTableIface::csrArray)
             return (TSubTask *)SubTaskCSR<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, weights,
                                                                                  simpleTrainingInit);
@@ -121,7 +158,8 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
                 safeStat.add(services::ErrorMultiClassFailedToTrainTwoClassClassifier);
                 return;
             }
-            pModel = local->getModel();
+            s = local->getModel(pModel);
+            DAAL_CHECK_STATUS_THR(s);
         }
         model->setTwoClassClassifierModel(imodel, pModel);
     });
@@ -235,6 +273,80 @@ Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nF
     return Status();
 }
 
+template <typename algorithmFPType, typename ClsType, CpuType cpu>
+Status SubTaskSharedKernel<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx,
+                                                                                algorithmFPType label, const algorithmFPType * y, size_t & nRows)
+{
+    for (size_t ix = 0; ix < nVectors; ix++)
+    {
+        if (size_t(y[ix]) != classIdx) continue;
+        this->_subsetX[nRows] = algorithmFPType(ix);
+        this->_subsetY[nRows] = label;
+        if (this->_weights)
+        {
+            this->_subsetW[nRows] = this->_weights[ix];
+        }
+        ++nRows;
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, typename ClsType, CpuType cpu>
+Status SubTaskSharedKernel<algorithmFPType, ClsType, cpu>::getModel(classifier::ModelPtr & model)
+{
+    Status s;
+    classifier::ModelPtr indexModel;
+    DAAL_CHECK_STATUS(s, super::getModel(indexModel));
+    svm::Model * const svmModel = dynamic_cast<svm::Model *>(indexModel.get());
+    DAAL_CHECK(svmModel, services::ErrorNullModel);
+
+    /* Support vectors of the trained model are the row indices of the input data */
+    NumericTablePtr svIndexTable = svmModel->getSupportVectors();
+    const size_t nSV             = svIndexTable->getNumberOfRows();
+    TArray<size_t, cpu> aRows;
+
+    svm::ModelPtr result = svm::Model::create<algorithmFPType>(_nFeatures, _xTable->getDataLayout(), &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr svCoeffTable   = result->getClassificationCoefficients();
+    NumericTablePtr svIndicesTable = result->getSupportIndices();
+    DAAL_CHECK_STATUS(s, svCoeffTable->resize(nSV));
+    DAAL_CHECK_STATUS(s, svIndicesTable->resize(nSV));
+    if (nSV)
+    {
+        aRows.reset(nSV);
+        DAAL_CHECK_MALLOC(aRows.get());
+        ReadColumns<algorithmFPType, cpu> mtRows(*svIndexTable, 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtRows);
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            aRows[i] = size_t(mtRows.get()[i]);
+        }
+
+        ReadColumns<algorithmFPType, cpu> mtCoeff(*svmModel->getClassificationCoefficients(), 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtCoeff);
+        WriteOnlyColumns<algorithmFPType, cpu> mtResultCoeff(*svCoeffTable, 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtResultCoeff);
+        ReadColumns<int, cpu> mtIndices(*svmModel->getSupportIndices(), 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtIndices);
+        WriteOnlyColumns<int, cpu> mtResultIndices(*svIndicesTable, 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtResultIndices);
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            mtResultCoeff.get()[i]   = mtCoeff.get()[i];
+            mtResultIndices.get()[i] = mtIndices.get()[i];
+        }
+    }
+    DAAL_CHECK_STATUS(s, (copyRowsByIndices<algorithmFPType, cpu>(*_xTable, aRows.get(), nSV, *result->getSupportVectors())));
+    result->setBias(svmModel->getBias());
+    result->setNFeatures(_nFeatures);
+    if (_computePrimalWeights)
+    {
+        DAAL_CHECK_STATUS(s, (svm::internal::setPrimalWeights<algorithmFPType, cpu>(*result)));
+    }
+    model = result;
+    return s;
+}
+
 } // namespace internal
 } // namespace training
 } // namespace multi_class_classifier
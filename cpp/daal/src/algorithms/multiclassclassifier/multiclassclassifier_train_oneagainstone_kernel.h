@@ -26,6 +26,8 @@
 #define __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTONE_KERNEL_H__
 
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
+#include "algorithms/svm/svm_model.h"
+#include "src/algorithms/multiclassclassifier/multiclassclassifier_train_shared_kernel.h"
 #include "src/algorithms/service_sort.h"
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
@@ -82,7 +84,11 @@ public:
         return _simpleTraining->computeNoThrow();
     }
 
-    classifier::ModelPtr getModel() { return _simpleTraining->getResult()->get(classifier::training::model); }
+    virtual services::Status getModel(classifier::ModelPtr & model)
+    {
+        model = _simpleTraining->getResult()->get(classifier::training::model);
+        return services::Status();
+    }
 
 protected:
     typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
@@ -201,6 +207,52 @@ private:
     ReadRows<algorithmFPType, cpu> _mtX;
 };
 
+/**
+ *  Subtask that trains the two-class SVM on the row indices of the training data set.
+ *  The kernel function values are provided by the cache shared by all the subtasks
+ */
+template <typename algorithmFPType, typename ClsType, CpuType cpu>
+class SubTaskSharedKernel : public SubTask<algorithmFPType, ClsType, cpu>
+{
+public:
+    virtual ~SubTaskSharedKernel() DAAL_C11_OVERRIDE {}
+
+    typedef SubTask<algorithmFPType, ClsType, cpu> super;
+    static SubTaskSharedKernel * create(size_t nFeatures, size_t nSubsetVectors, const NumericTable * xTable, const algorithmFPType * weights,
+                                        const services::SharedPtr<ClsType> & st, bool computePrimalWeights)
+    {
+        auto val = new SubTaskSharedKernel(nFeatures, nSubsetVectors, xTable, weights, st, computePrimalWeights);
+        if (val && val->isValid()) return val;
+        delete val;
+        val = nullptr;
+        return nullptr;
+    }
+
+    /** Returns the model with the support vectors taken from the training data set */
+    virtual services::Status getModel(classifier::ModelPtr & model) DAAL_C11_OVERRIDE;
+
+private:
+    typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
+    bool isValid() const { return super::isValid() && this->_subsetXTable.get(); }
+
+    SubTaskSharedKernel(size_t nFeatures, size_t nSubsetVectors, const NumericTable * xTable, const algorithmFPType * weights,
+                        const services::SharedPtr<ClsType> & st, bool computePrimalWeights)
+        : super(nSubsetVectors, nSubsetVectors, weights, st), _xTable(xTable), _nFeatures(nFeatures), _computePrimalWeights(computePrimalWeights)
+    {
+        services::Status status;
+        if (this->_subsetX.get()) this->_subsetXTable = HomogenNT::create(this->_subsetX.get(), 1, nSubsetVectors, &status);
+        if (!status) return;
+    }
+
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+                                                  size_t & nRows) DAAL_C11_OVERRIDE;
+
+private:
+    const NumericTable * _xTable;
+    size_t _nFeatures;
+    bool _computePrimalWeights;
+};
+
 template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
 class MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu> : public Kernel
 {
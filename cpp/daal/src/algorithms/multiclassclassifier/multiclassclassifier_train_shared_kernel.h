@@ -0,0 +1,583 @@
+/* file: multiclassclassifier_train_shared_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Kernel function values shared by the two-class SVM sub-problems of the
+//  One-Against-One method for Multi-class classifier training algorithm.
+//
+//  The sub-problems are trained on the tables of the row indices of the
+//  training data set instead of the copies of the data. The kernel function
+//  of a sub-problem maps the indices to the observations ordered by class.
+//  The values of the kernel function for the observations of the same class
+//  are used by all the sub-problems of the class, so they are cached once
+//  for the whole training; the values for the observations of different
+//  classes are used by the only sub-problem and are computed on request.
+//--
+*/
+
+#ifndef __MULTICLASSCLASSIFIER_TRAIN_SHARED_KERNEL_H__
+#define __MULTICLASSCLASSIFIER_TRAIN_SHARED_KERNEL_H__
+
+#include "algorithms/kernel_function/kernel_function.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/threading/threading.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+/**
+ *  Copies the rows of the input table with the given indices into the table dst of the same layout
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status copyRowsByIndices(const NumericTable & xTable, const size_t * indices, size_t nRows, NumericTable & dst)
+{
+    services::Status s;
+    const size_t p = xTable.getNumberOfColumns();
+    if (xTable.getDataLayout() != NumericTableIface::csrArray)
+    {
+        DAAL_CHECK_STATUS(s, dst.resize(nRows));
+        if (nRows == 0) return s;
+
+        WriteOnlyRows<algorithmFPType, cpu> mtDst(dst, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(mtDst);
+        algorithmFPType * const dstData = mtDst.get();
+
+        SafeStatus safeStat;
+        daal::threader_for(nRows, nRows, [&](size_t i) {
+            ReadRows<algorithmFPType, cpu> mtX(const_cast<NumericTable *>(&xTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+            DAAL_CHECK_THR(!services::internal::daal_memcpy_s(dstData + i * p, p * sizeof(algorithmFPType), mtX.get(), p * sizeof(algorithmFPType)),
+                           services::ErrorMemoryCopyFailedInternal);
+        });
+        return safeStat.detach();
+    }
+
+    CSRNumericTableIface * const csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
+    CSRNumericTable * const dstCSR        = dynamic_cast<CSRNumericTable *>(&dst);
+    DAAL_CHECK(csrIface && dstCSR, services::ErrorEmptyCSRNumericTable);
+
+    TArray<size_t, cpu> aRowOffsets(nRows + 1);
+    DAAL_CHECK_MALLOC(aRowOffsets.get());
+    size_t * const rowOffsetsBuffer = aRowOffsets.get();
+
+    ReadRowsCSR<algorithmFPType, cpu> mtX;
+    rowOffsetsBuffer[0] = 1;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        mtX.set(csrIface, indices[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        rowOffsetsBuffer[i + 1] = rowOffsetsBuffer[i] + (mtX.rows()[1] - mtX.rows()[0]);
+    }
+
+    DAAL_CHECK_STATUS(s, dstCSR->resize(nRows));
+    if (nRows == 0) return s;
+    DAAL_CHECK_STATUS(s, dstCSR->allocateDataMemory(rowOffsetsBuffer[nRows] - rowOffsetsBuffer[0]));
+
+    size_t * rowOffsets = nullptr;
+    dstCSR->getArrays<algorithmFPType>(NULL, NULL, &rowOffsets);
+    for (size_t i = 0; i < nRows + 1; ++i)
+    {
+        rowOffsets[i] = rowOffsetsBuffer[i];
+    }
+
+    WriteOnlyRowsCSR<algorithmFPType, cpu> mtDst(*dstCSR, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(mtDst);
+    algorithmFPType * const values = mtDst.values();
+    size_t * const colIndices      = mtDst.cols();
+    for (size_t i = 0, offset = 0; i < nRows; ++i)
+    {
+        mtX.set(csrIface, indices[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const size_t nNonZeroValuesInRow = mtX.rows()[1] - mtX.rows()[0];
+        for (size_t j = 0; j < nNonZeroValuesInRow; ++j, ++offset)
+        {
+            values[offset]     = mtX.values()[j];
+            colIndices[offset] = mtX.cols()[j];
+        }
+    }
+    return s;
+}
+
+/**
+ *  Creates the empty table with p columns and the same layout as the input table
+ */
+template <typename algorithmFPType>
+NumericTablePtr createEmptyTable(const NumericTable & xTable, services::Status & s)
+{
+    const size_t p = xTable.getNumberOfColumns();
+    if (xTable.getDataLayout() == NumericTableIface::csrArray)
+    {
+        algorithmFPType * const dummyPtr = NULL;
+        return CSRNumericTable::create(dummyPtr, NULL, NULL, p, 0, CSRNumericTableIface::oneBased, &s);
+    }
+    return HomogenNumericTable<algorithmFPType>::create(p, 0, NumericTable::notAllocate, &s);
+}
+
+/**
+ *  Computes the values of the kernel function for the observations of one class
+ *  and the observation of the same or another class. Owned by one thread
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SharedKernelTask
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static SharedKernelTask * create(const kernel_function::KernelIfacePtr & kernel, size_t nVectors, size_t nClasses)
+    {
+        SharedKernelTask * task = new SharedKernelTask(kernel, nVectors, nClasses);
+        if (task && task->isValid()) return task;
+        delete task;
+        return nullptr;
+    }
+
+    /** Computes K(x_k, y_row) for all the observations x_k of the table xTable */
+    services::Status computeRow(const NumericTablePtr & xTable, const NumericTablePtr & yTable, size_t row, algorithmFPType * values)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, _values->setArray(values, xTable->getNumberOfRows()));
+        kernel_function::ParameterBase * const par = _kernel->getParameter();
+        par->computationMode                       = kernel_function::matrixVector;
+        par->rowIndexY                             = row;
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, yTable);
+        return _kernel->computeNoThrow();
+    }
+
+    /** Computes K(x_rowX, y_rowY) */
+    services::Status computeValue(const NumericTablePtr & xTable, size_t rowX, const NumericTablePtr & yTable, size_t rowY, algorithmFPType & value)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, _values->setArray(_buffer.get(), xTable->getNumberOfRows()));
+        kernel_function::ParameterBase * const par = _kernel->getParameter();
+        par->computationMode                       = kernel_function::vectorVector;
+        par->rowIndexX                             = rowX;
+        par->rowIndexY                             = rowY;
+        par->rowIndexResult                        = 0;
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, yTable);
+        DAAL_CHECK_STATUS(s, _kernel->computeNoThrow());
+        value = _buffer[0];
+        return s;
+    }
+
+    /** Buffer of nVectors values, the values for the class c start at the offset of the class */
+    algorithmFPType * buffer() { return _buffer.get(); }
+
+    /** Pointers to the values of the kernel function for the classes, one per class */
+    const algorithmFPType ** blocks() { return _blocks.get(); }
+
+private:
+    SharedKernelTask(const kernel_function::KernelIfacePtr & kernel, size_t nVectors, size_t nClasses)
+        : _kernel(kernel->clone()), _buffer(nVectors), _blocks(nClasses)
+    {
+        services::Status s;
+        _values = HomogenNumericTableCPU<algorithmFPType, cpu>::create(NULL, 1, nVectors, &s);
+        if (!s || !_kernel) return;
+        kernel_function::ResultPtr res(new kernel_function::Result());
+        if (!res) return;
+        res->set(kernel_function::values, _values);
+        _kernel->setResult(res);
+    }
+
+    bool isValid() const { return _kernel.get() && _values.get() && _buffer.get() && _blocks.get(); }
+
+private:
+    kernel_function::KernelIfacePtr _kernel;
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _values;
+    TArray<algorithmFPType, cpu> _buffer;
+    TArray<const algorithmFPType *, cpu> _blocks;
+};
+
+/**
+ *  Observations of the training data set ordered by class and the cache of the kernel function values
+ *  for the observations of the same class. Shared by all the two-class sub-problems, thread-safe
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SharedKernelCache
+{
+public:
+    DAAL_NEW_DELETE();
+    typedef SharedKernelTask<algorithmFPType, cpu> TTask;
+
+    /**
+     * Constructs the cache
+     * \param[in] xTable    Training data set
+     * \param[in] y         Class labels of the observations
+     * \param[in] nClasses  Number of classes
+     * \param[in] kernel    Kernel function of the two-class classifier
+     * \param[in] cacheSize Size of the cache in bytes
+     * \param[out] s        Status of the cache construction
+     */
+    static services::SharedPtr<SharedKernelCache> create(const NumericTable & xTable, const algorithmFPType * y, size_t nClasses,
+                                                         const kernel_function::KernelIfacePtr & kernel, size_t cacheSize, services::Status & s)
+    {
+        services::SharedPtr<SharedKernelCache> res(new SharedKernelCache(xTable.getNumberOfRows(), nClasses, kernel));
+        if (!res)
+        {
+            s.add(services::ErrorMemoryAllocationFailed);
+            return res;
+        }
+        s = res->init(xTable, y, cacheSize);
+        if (!s) res.reset();
+        return res;
+    }
+
+    size_t getNumberOfVectors() const { return _nVectors; }
+    size_t getNumberOfClasses() const { return _nClasses; }
+
+    TTask * createTask() const { return TTask::create(_kernel, _nVectors, _nClasses); }
+
+    size_t getClass(size_t row) const { return _rowClass[row]; }
+    size_t getPosition(size_t row) const { return _rowPosition[row]; }
+
+    /**
+     * Returns the values of the kernel function K(x_k, x_row) for the observations x_k of the class c
+     * ordered by the position in the class. The values for the class of the observation x_row are cached,
+     * the others are computed into the buffer of the task
+     */
+    services::Status getBlock(TTask & task, size_t row, size_t c, const algorithmFPType *& block)
+    {
+        const size_t rowClass = _rowClass[row];
+        const size_t nInClass = _classOffset[c + 1] - _classOffset[c];
+        algorithmFPType * out = task.buffer() + _classOffset[c];
+        if (c != rowClass)
+        {
+            block = out;
+            return task.computeRow(_classData[c], _classData[rowClass], _rowPosition[row], out);
+        }
+
+        {
+            AUTOLOCK(_mutex);
+            if (_rowState[row] == ready)
+            {
+                block = _rows[row];
+                return services::Status();
+            }
+            if (_rowState[row] == absent && _used + nInClass <= _capacity)
+            {
+                /* Reserve the space for the row, the other threads compute it on their own meanwhile */
+                out = _data.get() + _used;
+                _used += nInClass;
+                _rowState[row] = pending;
+            }
+        }
+
+        services::Status s = task.computeRow(_classData[c], _classData[c], _rowPosition[row], out);
+        if (out != task.buffer() + _classOffset[c])
+        {
+            AUTOLOCK(_mutex);
+            _rows[row]     = out;
+            _rowState[row] = s ? ready : failed;
+        }
+        block = out;
+        return s;
+    }
+
+    /** Returns the value of the kernel function K(x_row1, x_row2) */
+    services::Status getValue(TTask & task, size_t row1, size_t row2, algorithmFPType & value)
+    {
+        services::Status s;
+        const size_t c1 = _rowClass[row1];
+        const size_t c2 = _rowClass[row2];
+        /* The whole row is computed only if it is kept in the cache, otherwise the single value is cheaper */
+        if (c1 == c2 && isCachedOrFits(row2, c1))
+        {
+            const algorithmFPType * block = nullptr;
+            DAAL_CHECK_STATUS(s, getBlock(task, row2, c1, block));
+            value = block[_rowPosition[row1]];
+            return s;
+        }
+        return task.computeValue(_classData[c1], _rowPosition[row1], _classData[c2], _rowPosition[row2], value);
+    }
+
+private:
+    enum RowState
+    {
+        absent,
+        pending,
+        ready,
+        failed
+    };
+
+    /** Returns true if the values for the observation x_row are in the cache or the cache has space for them */
+    bool isCachedOrFits(size_t row, size_t c)
+    {
+        const size_t nInClass = _classOffset[c + 1] - _classOffset[c];
+        AUTOLOCK(_mutex);
+        return _rowState[row] == ready || (_rowState[row] == absent && _used + nInClass <= _capacity);
+    }
+
+    SharedKernelCache(size_t nVectors, size_t nClasses, const kernel_function::KernelIfacePtr & kernel)
+        : _nVectors(nVectors), _nClasses(nClasses), _kernel(kernel), _capacity(0), _used(0)
+    {}
+
+    services::Status init(const NumericTable & xTable, const algorithmFPType * y, size_t cacheSize)
+    {
+        _rowClass.reset(_nVectors);
+        _rowPosition.reset(_nVectors);
+        _rows.reset(_nVectors);
+        _rowState.reset(_nVectors);
+        _classOffset.reset(_nClasses + 1);
+        DAAL_CHECK_MALLOC(_rowClass.get() && _rowPosition.get() && _rows.get() && _rowState.get() && _classOffset.get());
+        service_memset_seq<char, cpu>(_rowState.get(), char(absent), _nVectors);
+        service_memset_seq<size_t, cpu>(_classOffset.get(), 0, _nClasses + 1);
+
+        for (size_t i = 0; i < _nVectors; ++i)
+        {
+            _rowClass[i]    = size_t(y[i]);
+            _rowPosition[i] = _classOffset[_rowClass[i] + 1]++;
+        }
+        size_t nCachedValues = 0;
+        for (size_t c = 0; c < _nClasses; ++c)
+        {
+            nCachedValues += _classOffset[c + 1] * _classOffset[c + 1];
+            _classOffset[c + 1] += _classOffset[c];
+        }
+
+        /* Observations ordered by class */
+        TArray<size_t, cpu> aIndices(_nVectors);
+        DAAL_CHECK_MALLOC(aIndices.get());
+        size_t * const indices = aIndices.get();
+        for (size_t i = 0; i < _nVectors; ++i)
+        {
+            indices[_classOffset[_rowClass[i]] + _rowPosition[i]] = i;
+        }
+
+        services::Status s;
+        for (size_t c = 0; c < _nClasses; ++c)
+        {
+            NumericTablePtr classData = createEmptyTable<algorithmFPType>(xTable, s);
+            DAAL_CHECK_STATUS_VAR(s);
+            DAAL_CHECK_STATUS(s, (copyRowsByIndices<algorithmFPType, cpu>(xTable, indices + _classOffset[c], _classOffset[c + 1] - _classOffset[c],
+                                                                           *classData)));
+            _classData.push_back(classData);
+        }
+
+        _capacity = services::internal::min<cpu, size_t>(cacheSize / sizeof(algorithmFPType), nCachedValues);
+        if (_capacity)
+        {
+            _data.reset(_capacity);
+            DAAL_CHECK_MALLOC(_data.get());
+        }
+        return s;
+    }
+
+private:
+    const size_t _nVectors;
+    const size_t _nClasses;
+    const kernel_function::KernelIfacePtr _kernel;   /*!< Kernel function of the two-class classifier */
+    services::Collection<NumericTablePtr> _classData; /*!< Observations of each class */
+    TArray<size_t, cpu> _rowClass;                    /*!< Class of each observation */
+    TArray<size_t, cpu> _rowPosition;                 /*!< Position of each observation in its class */
+    TArray<size_t, cpu> _classOffset;                 /*!< Offsets of the classes in the observations ordered by class */
+    TArrayScalable<algorithmFPType, cpu> _data;       /*!< Cached values of the kernel function */
+    TArray<const algorithmFPType *, cpu> _rows;       /*!< Cached values for each observation */
+    TArray<char, cpu> _rowState;                      /*!< State of the cached values for each observation */
+    size_t _capacity;                                 /*!< Number of values that fit into the cache */
+    size_t _used;                                     /*!< Number of values in the cache */
+    daal::Mutex _mutex;
+};
+
+/**
+ *  Container of the kernel function on the tables of row indices of the training data set
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SharedKernelContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    typedef SharedKernelCache<algorithmFPType, cpu> TCache;
+    typedef SharedKernelTask<algorithmFPType, cpu> TTask;
+
+    SharedKernelContainer(const services::SharedPtr<TCache> & cache, daal::services::Environment::env * daalEnv)
+        : daal::algorithms::AnalysisContainerIface<batch>(daalEnv), _cache(cache), _task(nullptr), _tlsTask(nullptr)
+    {}
+
+    ~SharedKernelContainer()
+    {
+        delete _task;
+        if (_tlsTask)
+        {
+            _tlsTask->reduce([](TTask * local) { delete local; });
+            delete _tlsTask;
+        }
+    }
+
+    virtual services::Status compute() DAAL_C11_OVERRIDE
+    {
+        const kernel_function::Input * input      = static_cast<const kernel_function::Input *>(_in);
+        const kernel_function::ParameterBase * par = static_cast<const kernel_function::ParameterBase *>(_par);
+        kernel_function::Result * result           = static_cast<kernel_function::Result *>(_res);
+
+        NumericTable * xTable = input->get(kernel_function::X).get();
+        NumericTable * yTable = input->get(kernel_function::Y).get();
+        NumericTable * rTable = result->get(kernel_function::values).get();
+
+        switch (par->computationMode)
+        {
+        case kernel_function::vectorVector: return computeValue(*xTable, *yTable, *rTable, par);
+        case kernel_function::matrixVector: return computeBlock(*xTable, *yTable, par->rowIndexY, 1, *rTable);
+        case kernel_function::matrixMatrix: return computeBlock(*xTable, *yTable, 0, yTable->getNumberOfRows(), *rTable);
+        default: return services::Status(services::ErrorIncorrectParameter);
+        }
+    }
+
+protected:
+    services::Status computeValue(NumericTable & xTable, NumericTable & yTable, NumericTable & rTable, const kernel_function::ParameterBase * par)
+    {
+        if (!_task)
+        {
+            _task = _cache->createTask();
+            DAAL_CHECK_MALLOC(_task);
+        }
+
+        ReadColumns<algorithmFPType, cpu> mtX(xTable, 0, par->rowIndexX, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        ReadColumns<algorithmFPType, cpu> mtY(yTable, 0, par->rowIndexY, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtY);
+        WriteOnlyRows<algorithmFPType, cpu> mtR(rTable, par->rowIndexResult, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtR);
+
+        return _cache->getValue(*_task, size_t(mtX.get()[0]), size_t(mtY.get()[0]), mtR.get()[0]);
+    }
+
+    /* Computes K(x_i, y_j) for all the rows x_i of xTable and the nY rows y_j of yTable starting from startY */
+    services::Status computeBlock(NumericTable & xTable, NumericTable & yTable, size_t startY, size_t nY, NumericTable & rTable)
+    {
+        if (!_tlsTask)
+        {
+            const services::SharedPtr<TCache> cache = _cache;
+            _tlsTask                                = new daal::tls<TTask *>([=]() { return cache->createTask(); });
+            DAAL_CHECK_MALLOC(_tlsTask);
+        }
+
+        const size_t nX = xTable.getNumberOfRows();
+        ReadColumns<algorithmFPType, cpu> mtX(xTable, 0, 0, nX);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType * const idxX = mtX.get();
+        ReadColumns<algorithmFPType, cpu> mtY(yTable, 0, startY, nY);
+        DAAL_CHECK_BLOCK_STATUS(mtY);
+        const algorithmFPType * const idxY = mtY.get();
+        WriteOnlyRows<algorithmFPType, cpu> mtR(rTable, 0, nX);
+        DAAL_CHECK_BLOCK_STATUS(mtR);
+        algorithmFPType * const r = mtR.get();
+
+        const size_t nClasses = _cache->getNumberOfClasses();
+        TCache & cache        = *_cache;
+
+        SafeStatus safeStat;
+        daal::threader_for(nY, nY, [&](size_t j) {
+            TTask * const task = _tlsTask->local();
+            DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+
+            const size_t rowY                     = size_t(idxY[j]);
+            const algorithmFPType ** const blocks = task->blocks();
+            for (size_t c = 0; c < nClasses; ++c) blocks[c] = nullptr;
+
+            for (size_t i = 0; i < nX; ++i)
+            {
+                const size_t rowX = size_t(idxX[i]);
+                const size_t c    = cache.getClass(rowX);
+                if (!blocks[c])
+                {
+                    services::Status s = cache.getBlock(*task, rowY, c, blocks[c]);
+                    DAAL_CHECK_STATUS_THR(s);
+                }
+                r[i * nY + j] = blocks[c][cache.getPosition(rowX)];
+            }
+        });
+        return safeStat.detach();
+    }
+
+private:
+    services::SharedPtr<TCache> _cache;
+    TTask * _task;                  /*!< Task of the calls of the vector-vector mode */
+    daal::tls<TTask *> * _tlsTask; /*!< Tasks of the threads that compute the matrix modes */
+};
+
+/**
+ *  Kernel function on the tables of row indices of the training data set,
+ *  the values are taken from the shared cache or computed by the kernel function of the two-class classifier
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SharedKernel : public kernel_function::KernelIface
+{
+public:
+    typedef SharedKernelCache<algorithmFPType, cpu> TCache;
+
+    SharedKernel(const services::SharedPtr<TCache> & cache) : _cache(cache) { initialize(); }
+
+    SharedKernel(const SharedKernel & other) : kernel_function::KernelIface(other), parameter(other.parameter), input(other.input), _cache(other._cache)
+    {
+        initialize();
+    }
+
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return 0; }
+
+    virtual kernel_function::Input * getInput() DAAL_C11_OVERRIDE { return &input; }
+
+    virtual kernel_function::ParameterBase * getParameter() DAAL_C11_OVERRIDE { return &parameter; }
+
+    kernel_function::ParameterBase parameter; /*!< Parameter of the kernel function */
+    kernel_function::Input input;             /*!< %Input data structure */
+
+protected:
+    void initialize()
+    {
+        Analysis<batch>::_ac = new SharedKernelContainer<algorithmFPType, cpu>(_cache, &_env);
+        _in                  = &input;
+        _par                 = &parameter;
+    }
+
+    virtual SharedKernel * cloneImpl() const DAAL_C11_OVERRIDE { return new SharedKernel(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, 0);
+        _res               = _result.get();
+        return s;
+    }
+
+private:
+    services::SharedPtr<TCache> _cache;
+
+    SharedKernel & operator=(const SharedKernel &);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -21,6 +21,10 @@
 //--
 */
 #include "src/externals/service_math.h"
+#include "src/externals/service_spblas.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_utils.h"
 
 namespace daal
 {
@@ -54,6 +58,175 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/*
+ * Rows of a block of the batch of the data set in CSR format with one-based indices as one CSR matrix.
+ * The rows that follow each other in the data set are referenced in place, the rows given by the batch indices are copied.
+ * The row i takes the elements rowBegin(i) to rowEnd(i) - 1 of values() and cols(), the row offsets may start from any value
+ */
+template <typename algorithmFPType, CpuType cpu>
+class CSRBlock
+{
+public:
+    CSRBlock() : _values(nullptr), _cols(nullptr), _rowOffsets(nullptr) {}
+
+    services::Status set(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets, const int * ind, size_t iStartRow,
+                         size_t nRows)
+    {
+        if (!ind)
+        {
+            const size_t iStart = rowOffsets[iStartRow] - 1;
+            _values             = values + iStart;
+            _cols               = cols + iStart;
+            _rowOffsets         = rowOffsets + iStartRow;
+            return services::Status();
+        }
+
+        size_t * const rowOffsetsCopy = _rowOffsetsCopy.reset(nRows + 1);
+        DAAL_CHECK_MALLOC(rowOffsetsCopy);
+        rowOffsetsCopy[0] = 1;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const size_t iRow     = size_t(ind[iStartRow + i]);
+            rowOffsetsCopy[i + 1] = rowOffsetsCopy[i] + rowOffsets[iRow + 1] - rowOffsets[iRow];
+        }
+
+        const size_t nNonZeros             = rowOffsetsCopy[nRows] - 1;
+        algorithmFPType * const valuesCopy = _valuesCopy.reset(nNonZeros + 1);
+        size_t * const colsCopy            = _colsCopy.reset(nNonZeros + 1);
+        DAAL_CHECK_MALLOC(valuesCopy && colsCopy);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const size_t iRow         = size_t(ind[iStartRow + i]);
+            const size_t iStart       = rowOffsets[iRow] - 1;
+            const size_t nRowNonZeros = rowOffsets[iRow + 1] - rowOffsets[iRow];
+            services::internal::tmemcpy<algorithmFPType, cpu>(valuesCopy + rowOffsetsCopy[i] - 1, values + iStart, nRowNonZeros);
+            services::internal::tmemcpy<size_t, cpu>(colsCopy + rowOffsetsCopy[i] - 1, cols + iStart, nRowNonZeros);
+        }
+        _values     = valuesCopy;
+        _cols       = colsCopy;
+        _rowOffsets = rowOffsetsCopy;
+        return services::Status();
+    }
+
+    const algorithmFPType * values() const { return _values; }
+    const size_t * cols() const { return _cols; }
+    const size_t * rowOffsets() const { return _rowOffsets; }
+    size_t rowBegin(size_t i) const { return _rowOffsets[i] - _rowOffsets[0]; }
+    size_t rowEnd(size_t i) const { return _rowOffsets[i + 1] - _rowOffsets[0]; }
+
+private:
+    const algorithmFPType * _values;
+    const size_t * _cols;
+    const size_t * _rowOffsets;
+    TArray<algorithmFPType, cpu> _valuesCopy;
+    TArray<size_t, cpu> _colsCopy;
+    TArray<size_t, cpu> _rowOffsetsCopy;
+};
+
+/*
+ * Computes xb(i, k) = x(i)*b(k) + b(k, 0) for the block of nRows rows of the data set in CSR format with one-based indices
+ * as one product of the sparse block and the dense coefficients, where b(k) is the k-th block of nBetaPerClass coefficients
+ * and b(k, 0) is its intercept. The row i takes the elements rowOffsets[i] - rowOffsets[0] to rowOffsets[i + 1] - rowOffsets[0] - 1
+ * of values and cols. The results are stored class by class: xb(i, k) = xb[k * nRows + i]
+ */
+template <typename algorithmFPType, CpuType cpu>
+void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets, size_t nRows, const algorithmFPType * beta,
+                  size_t nBetaPerClass, size_t nClasses, bool bIntercept, algorithmFPType * xb)
+{
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        const algorithmFPType b0 = bIntercept ? beta[iClass * nBetaPerClass] : algorithmFPType(0);
+        services::internal::service_memset_seq<algorithmFPType, cpu>(xb + iClass * nRows, b0, nRows);
+    }
+    if (!nRows || nBetaPerClass < 2) return;
+
+    /* The one-based indexing makes the dense matrices column-major: the coefficients b(k) without the intercept are the columns */
+    const char trans            = 'N';
+    const DAAL_INT m            = nRows;
+    const DAAL_INT n            = nClasses;
+    const DAAL_INT k            = nBetaPerClass - 1;
+    const DAAL_INT ldb          = nBetaPerClass;
+    const algorithmFPType alpha = 1.0;
+    const algorithmFPType one   = 1.0;
+    const char matdescra[6]     = { 'G', 0, 0, 'F', 0, 0 };
+    SpBlas<algorithmFPType, cpu>::xxcsrmm(&trans, &m, &n, &k, &alpha, matdescra, values, (const DAAL_INT *)cols, (const DAAL_INT *)rowOffsets,
+                                          beta + 1, &ldb, &one, xb, &m);
+}
+
+/*
+ * Numbers the features that are non-zero in the n rows of the batch of the data set in CSR format with one-based indices.
+ * position[j] of the one-based feature j is its one-based number among these features or 0, features[k - 1] is the feature
+ * with the number k. Returns the number of these features
+ */
+template <CpuType cpu>
+size_t numberNonZeroFeatures(const size_t * cols, const size_t * rowOffsets, const int * ind, size_t n, size_t p, size_t * position,
+                             size_t * features)
+{
+    services::internal::service_memset_seq<size_t, cpu>(position, size_t(0), p + 1);
+    size_t nFeatures = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const size_t iRow = ind ? size_t(ind[i]) : i;
+        for (size_t jj = rowOffsets[iRow] - 1; jj < rowOffsets[iRow + 1] - 1; ++jj)
+        {
+            const size_t j = cols[jj];
+            if (position[j]) continue;
+            features[nFeatures] = j;
+            position[j]         = ++nFeatures;
+        }
+    }
+    return nFeatures;
+}
+
+/*
+ * Adds the products of the row i of the block and the multipliers m of size nOut to the sums stored feature by feature:
+ * acc(position[j], o) += x(j)*m(o), where position numbers the features that are non-zero in the batch from 1,
+ * and acc(0, o) += m(o) is the sum for the intercept. Only the sums of the non-zero features of the row are touched
+ */
+template <typename algorithmFPType, CpuType cpu>
+void addRowProductsCSR(const CSRBlock<algorithmFPType, cpu> & block, size_t i, const size_t * position, const algorithmFPType * m, size_t nOut,
+                       algorithmFPType * acc)
+{
+    const algorithmFPType * const values = block.values();
+    const size_t * const cols            = block.cols();
+    for (size_t o = 0; o < nOut; ++o) acc[o] += m[o];
+    for (size_t jj = block.rowBegin(i); jj < block.rowEnd(i); ++jj)
+    {
+        const algorithmFPType xj   = values[jj];
+        algorithmFPType * const aj = acc + position[cols[jj]] * nOut;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t o = 0; o < nOut; ++o) aj[o] += xj * m[o];
+    }
+}
+
+/* Returns the maximal squared norm of the rows of the data set in CSR format with one-based indices */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType getMaxRowNorm2CSR(const algorithmFPType * values, const size_t * rowOffsets, const int * ind, size_t n)
+{
+    const size_t blockSize = 256;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        algorithmFPType & maxNorm = *tlsData.local();
+        const size_t finishRow    = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+        for (size_t i = iBlock * blockSize; i < finishRow; i++)
+        {
+            const size_t iRow    = ind ? size_t(ind[i]) : i;
+            algorithmFPType norm = 0;
+            for (size_t jj = rowOffsets[iRow] - 1; jj < rowOffsets[iRow + 1] - 1; ++jj) norm += values[jj] * values[jj];
+            if (norm > maxNorm) maxNorm = norm;
+        }
+    });
+
+    algorithmFPType globalMaxNorm = 0;
+    tlsData.reduce([&](algorithmFPType * maxNorm) {
+        if (globalMaxNorm < *maxNorm) globalMaxNorm = *maxNorm;
+    });
+    return globalMaxNorm;
+}
+
 } // namespace internal
 
 } // namespace objective_function
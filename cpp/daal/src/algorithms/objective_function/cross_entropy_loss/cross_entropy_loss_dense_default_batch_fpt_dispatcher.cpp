@@ -25,14 +25,14 @@ namespace daal
 {
 namespace algorithms
 {
-__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(optimization_solver::cross_entropy_loss::interface2::BatchContainer, batch, DAAL_FPTYPE,
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(optimization_solver::cross_entropy_loss::interface3::BatchContainer, batch, DAAL_FPTYPE,
                                            optimization_solver::cross_entropy_loss::defaultDense)
 
 namespace optimization_solver
 {
 namespace cross_entropy_loss
 {
-namespace interface2
+namespace interface3
 {
 using BatchType = Batch<DAAL_FPTYPE, optimization_solver::cross_entropy_loss::defaultDense>;
 
@@ -57,7 +57,7 @@ services::SharedPtr<BatchType> BatchType::create(size_t nClasses, size_t numberO
     return services::SharedPtr<BatchType>(new BatchType(nClasses, numberOfTerms));
 }
 
-} // namespace interface2
+} // namespace interface3
 
 } // namespace cross_entropy_loss
 } // namespace optimization_solver
@@ -24,6 +24,7 @@
 #include "src/services/service_utils.h"
 #include "src/services/service_environment.h"
 #include "src/externals/service_ittnotify.h"
+#include "src/algorithms/service_error_handling.h"
 
 DAAL_ITTNOTIFY_DOMAIN(cross_entropy_loss.dense.default.batch);
 
@@ -87,6 +88,24 @@ void CrossEntropyLossKernel<algorithmFPType, method, cpu>::applyBetaThreaded(con
     applyBetaImpl<algorithmFPType, cpu>(x, beta, xb, nRows, nClasses, nCols, bIntercept, true);
 }
 
+/*
+ * Computes xb = X*B + B0 for the block of nRows rows of the data set in CSR format with one-based row offsets as one sparse-dense product.
+ * The product is stored class by class in xbByClass of nRows*nClasses values and then copied to xb row by row
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void CrossEntropyLossKernel<algorithmFPType, method, cpu>::applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets,
+                                                                        const algorithmFPType * beta, algorithmFPType * xb,
+                                                                        algorithmFPType * xbByClass, size_t nRows, size_t nClasses, size_t nCols,
+                                                                        bool bIntercept)
+{
+    objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(values, cols, rowOffsets, nRows, beta, nCols + 1, nClasses, bIntercept,
+                                                                     xbByClass);
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        for (size_t k = 0; k < nClasses; ++k) xb[i * nClasses + k] = xbByClass[k * nRows + i];
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 void CrossEntropyLossKernel<algorithmFPType, method, cpu>::softmax(const algorithmFPType * arg, algorithmFPType * res, size_t nRows, size_t nCols)
 {
@@ -178,27 +197,12 @@ void addHessInPt(algorithmFPType * h, const algorithmFPType * xi, const algorith
     }
 }
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t nRows,
-                                                                                 size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
-                                                                                 NumericTable * hessianNT, NumericTable * gradientNT,
-                                                                                 NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                                 NumericTable * lipschitzConstant, Parameter * parameter)
+/* Computes the proximal projection of the argument b and the value of the non-smooth L1 term */
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerms(const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass, const algorithmFPType penaltyL1,
+                                              NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, algorithmFPType & notSmoothTerm)
 {
-    const size_t nClasses = parameter->nClasses;
-
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
-
-    TArrayScalable<algorithmFPType, cpu> f(n * nClasses);
-    const size_t nBetaPerClass = p + 1;
-    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
-    DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses * nBetaPerClass);
-    const size_t nBeta = betaNT->getNumberOfColumns() * betaNT->getNumberOfRows();
-    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
-    DAAL_CHECK_BLOCK_STATUS(betar);
-    const algorithmFPType * b = betar.get();
-
+    const size_t nBeta = nClasses * nBetaPerClass;
     if (proximalProjection)
     {
         WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
@@ -210,15 +214,15 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         {
             for (size_t j = 1; j < nBetaPerClass; j++)
             {
-                if (b[i * nBetaPerClass + j] > parameter->penaltyL1)
+                if (b[i * nBetaPerClass + j] > penaltyL1)
                 {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
+                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - penaltyL1;
                 }
-                if (b[i * nBetaPerClass + j] < -parameter->penaltyL1)
+                if (b[i * nBetaPerClass + j] < -penaltyL1)
                 {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
+                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + penaltyL1;
                 }
-                if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
+                if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= penaltyL1)
                 {
                     prox[i * nBetaPerClass + j] = 0;
                 }
@@ -226,7 +230,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         }
     }
 
-    algorithmFPType notSmoothTerm = 0;
+    notSmoothTerm = 0;
     if (nonSmoothTermValue)
     {
         WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
@@ -235,11 +239,41 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         for (size_t i = 0; i < nClasses; i++)
         {
             for (size_t j = 1; j < nBetaPerClass; j++)
-                notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+                notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * penaltyL1;
         }
         value = notSmoothTerm;
     }
 
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t nRows,
+                                                                                 size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
+                                                                                 NumericTable * hessianNT, NumericTable * gradientNT,
+                                                                                 NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+                                                                                 NumericTable * lipschitzConstant, NumericTable * hessianVectorProductNT,
+                                                                                 Parameter * parameter)
+{
+    const size_t nClasses = parameter->nClasses;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
+
+    TArrayScalable<algorithmFPType, cpu> f(n * nClasses);
+    const size_t nBetaPerClass = p + 1;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses * nBetaPerClass);
+    const size_t nBeta = betaNT->getNumberOfColumns() * betaNT->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * b = betar.get();
+
+    algorithmFPType notSmoothTerm = 0;
+    services::Status s            = computeNonSmoothTerms<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, algorithmFPType(parameter->penaltyL1),
+                                                                                nonSmoothTermValue, proximalProjection, notSmoothTerm);
+    DAAL_CHECK_STATUS_VAR(s);
+
     if (lipschitzConstant)
     {
         DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
@@ -286,6 +320,14 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         c                            = 2 * lipschitz + displacement;
     }
 
+    if (hessianVectorProductNT)
+    {
+        s = doComputeFused(x, y, n, p, b, valueNT, gradientNT, hessianVectorProductNT, parameter);
+        DAAL_CHECK_STATUS_VAR(s);
+        valueNT    = nullptr;
+        gradientNT = nullptr;
+    }
+
     if (valueNT || gradientNT || hessianNT)
     {
         //f = X*b + b0
@@ -418,18 +460,409 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     return services::Status();
 }
 
+/**
+ *  \brief Computes the value, the gradient and the hessian-vector product in one pass over the row blocks of the data set.
+ *  X*B and X*V of a block are computed while the block is in cache, then the gradient and the hessian-vector product
+ *  contributions of the block are accumulated with a single gemm: the gradient is X^T*(P - Y) and the product of the hessian
+ *  and V is X^T*W, where P are the softmax probabilities, Y are the class indicators and W(i,k) = P(i,k)*(U(i,k) - sum_m P(i,m)*U(i,m))
+ *  for U = X*V
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doComputeFused(const algorithmFPType * x, const algorithmFPType * y, size_t n,
+                                                                                      size_t p, const algorithmFPType * b, NumericTable * valueNT,
+                                                                                      NumericTable * gradientNT, NumericTable * hessianVectorProductNT,
+                                                                                      Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeFused);
+
+    const size_t nClasses      = parameter->nClasses;
+    const size_t nBetaPerClass = p + 1;
+    const size_t nBeta         = nClasses * nBetaPerClass;
+    DAAL_CHECK(parameter->hessianVectorDirection.get(), services::ErrorNullNumericTable);
+    ReadRows<algorithmFPType, cpu> directionRows(parameter->hessianVectorDirection.get(), 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(directionRows);
+    const algorithmFPType * const v = directionRows.get();
+
+    const bool bIntercept = parameter->interceptFlag;
+    const bool bValue     = (valueNT != nullptr);
+
+    /* Multipliers of the rows of X are stored row by row: P - Y if the gradient is requested, then W */
+    const size_t iGrad = 0;
+    const size_t iHv   = gradientNT ? nClasses : 0;
+    const size_t nOut  = iHv + nClasses;
+
+    /* Accumulated sums: the log-likelihood, the sums of the multipliers and the products X^T*multipliers of size p x nOut */
+    const size_t iSum = 1;
+    const size_t iXtM = iSum + nOut;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOut, p);
+    const size_t nAcc = iXtM + nOut * p;
+
+    const size_t nRowsInBlock = 256;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsInBlock, 1 + 2 * nClasses + nOut);
+
+    TlsSum<algorithmFPType, cpu> tlsAcc(nAcc);
+    TlsMem<algorithmFPType, cpu> tlsScratch(nRowsInBlock * (1 + 2 * nClasses + nOut));
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        algorithmFPType * const acc     = tlsAcc.local();
+        algorithmFPType * const scratch = tlsScratch.local();
+        DAAL_CHECK_MALLOC_THR(acc && scratch);
+
+        const size_t iStartRow           = iBlock * nRowsInBlock;
+        const size_t nRows               = (iBlock == nDataBlocks - 1) ? n - iStartRow : nRowsInBlock;
+        const algorithmFPType * const px = x + iStartRow * p;
+        const algorithmFPType * const py = y + iStartRow;
+
+        algorithmFPType * const prob = scratch;
+        algorithmFPType * const u    = prob + nRows * nClasses;
+        algorithmFPType * const m    = u + nRows * nClasses;
+        algorithmFPType * const lp   = m + nRows * nOut;
+
+        //P = softmax(X*B + B0), U = X*V + V0
+        applyBetaImpl<algorithmFPType, cpu>(px, b, prob, nRows, nClasses, p, bIntercept, false);
+        softmax(prob, prob, nRows, nClasses);
+        applyBetaImpl<algorithmFPType, cpu>(px, v, u, nRows, nClasses, p, bIntercept, false);
+
+        if (bValue)
+        {
+            for (size_t i = 0; i < nRows; ++i) lp[i] = prob[i * nClasses + size_t(py[i])];
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRows, lp, lp);
+            algorithmFPType logLikelihood = 0;
+            for (size_t i = 0; i < nRows; ++i) logLikelihood += lp[i];
+            acc[0] += logLikelihood;
+        }
+
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const algorithmFPType * const pi = prob + i * nClasses;
+            const algorithmFPType * const ui = u + i * nClasses;
+            algorithmFPType * const mi       = m + i * nOut;
+            algorithmFPType pu               = 0;
+            for (size_t k = 0; k < nClasses; ++k) pu += pi[k] * ui[k];
+            for (size_t k = 0; k < nClasses; ++k) mi[iHv + k] = pi[k] * (ui[k] - pu);
+            if (gradientNT)
+            {
+                for (size_t k = 0; k < nClasses; ++k) mi[iGrad + k] = pi[k];
+                mi[iGrad + size_t(py[i])] -= algorithmFPType(1);
+            }
+            for (size_t j = 0; j < nOut; ++j) acc[iSum + j] += mi[j];
+        }
+
+        char trans          = 'T';
+        char notrans        = 'N';
+        algorithmFPType one = 1.0;
+        DAAL_INT mDim       = (DAAL_INT)nOut;
+        DAAL_INT dim        = (DAAL_INT)p;
+        DAAL_INT nN         = (DAAL_INT)nRows;
+        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &mDim, &dim, &nN, &one, m, &mDim, px, &dim, &one, acc + iXtM, &mDim);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(nAcc);
+    algorithmFPType * const sums = sumsArray.get();
+    DAAL_CHECK_MALLOC(sums);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, algorithmFPType(0), nAcc);
+    tlsAcc.reduceTo(sums, nAcc);
+
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    const algorithmFPType l2  = algorithmFPType(2) * algorithmFPType(parameter->penaltyL2);
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = -sums[0] * div;
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            for (size_t j = 1; j < nBetaPerClass; ++j)
+            {
+                const algorithmFPType bkj = b[k * nBetaPerClass + j];
+                value += bkj * bkj * parameter->penaltyL2;
+                if (parameter->penaltyL1 > 0) value += (bkj < 0 ? -bkj : bkj) * parameter->penaltyL1;
+            }
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            g[k * nBetaPerClass] = bIntercept ? sums[iSum + iGrad + k] * div : algorithmFPType(0);
+            for (size_t j = 0; j < p; ++j)
+            {
+                g[k * nBetaPerClass + j + 1] = sums[iXtM + j * nOut + iGrad + k] * div + l2 * b[k * nBetaPerClass + j + 1];
+            }
+        }
+    }
+
+    DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+    WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(hvr);
+    algorithmFPType * const hv = hvr.get();
+    for (size_t k = 0; k < nClasses; ++k)
+    {
+        hv[k * nBetaPerClass] = bIntercept ? sums[iSum + iHv + k] * div : algorithmFPType(0);
+        for (size_t j = 0; j < p; ++j)
+        {
+            hv[k * nBetaPerClass + j + 1] = sums[iXtM + j * nOut + iHv + k] * div + l2 * v[k * nBetaPerClass + j + 1];
+        }
+    }
+
+    return services::Status();
+}
+
+/**
+ *  \brief Computes the results on the data set in CSR format without converting it to the dense one.
+ *  The logits X*B and X*V of a block of rows are sparse-dense products, the rows of the batch given by the indices are copied block by block.
+ *  The contributions of a row to the gradient X^T*(P - Y) and to the hessian-vector product X^T*W are accumulated in the per-thread
+ *  buffers only for the features that are non-zero in the row. The buffers keep the sums only for the nFeatures features that are
+ *  non-zero in the batch, so the memory and the reduction time grow as nThreads*nOut*(nFeatures + 1), where nOut is nClasses for the
+ *  gradient plus nClasses for the hessian-vector product. X^T*multipliers is not a sparse-dense product, as it would write all
+ *  nOut*p sums of every block.
+ *  The hessian is not supported for the data in CSR format
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doComputeCSR(
+    CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT, size_t nRows, size_t p, NumericTable * betaNT,
+    NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+    NumericTable * lipschitzConstant, NumericTable * hessianVectorProductNT, Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCSR);
+    DAAL_CHECK(!hessianNT, services::ErrorMethodNotSupported);
+
+    const size_t nClasses      = parameter->nClasses;
+    const size_t nBetaPerClass = p + 1;
+    const size_t nBeta         = nClasses * nBetaPerClass;
+    const size_t n             = indNT ? indNT->getNumberOfColumns() : nRows;
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * const b = betar.get();
+
+    algorithmFPType notSmoothTerm = 0;
+    services::Status s            = computeNonSmoothTerms<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, algorithmFPType(parameter->penaltyL1),
+                                                                                nonSmoothTermValue, proximalProjection, notSmoothTerm);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    const algorithmFPType * const values = xr.values();
+    const size_t * const cols            = xr.cols();
+    const size_t * const rowOffsets      = xr.rows();
+
+    ReadRows<int, cpu> indr;
+    const int * ind = nullptr;
+    if (indNT)
+    {
+        indr.set(const_cast<NumericTable *>(indNT), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(indr);
+        ind = indr.get();
+    }
+
+    if (lipschitzConstant)
+    {
+        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+        algorithmFPType & c = *lipschitzConstantPtr.get();
+
+        const algorithmFPType globalMaxNorm = objective_function::internal::getMaxRowNorm2CSR<algorithmFPType, cpu>(values, rowOffsets, ind, n);
+        algorithmFPType alpha_scaled        = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+        algorithmFPType lipschitz           = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+        algorithmFPType displacement        = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+        c                                   = 2 * lipschitz + displacement;
+    }
+
+    if (!valueNT && !gradientNT && !hessianVectorProductNT) return s;
+
+    ReadRows<algorithmFPType, cpu> directionRows;
+    const algorithmFPType * v = nullptr;
+    if (hessianVectorProductNT)
+    {
+        DAAL_CHECK(parameter->hessianVectorDirection.get(), services::ErrorNullNumericTable);
+        directionRows.set(parameter->hessianVectorDirection.get(), 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(directionRows);
+        v = directionRows.get();
+    }
+
+    ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+    const algorithmFPType * const y = yr.get();
+
+    const bool bIntercept = parameter->interceptFlag;
+    const bool bValue     = (valueNT != nullptr);
+
+    /* Multipliers of the row: P - Y if the gradient is requested, then W if the hessian-vector product is requested */
+    const size_t iGrad = 0;
+    const size_t iHv   = gradientNT ? nClasses : 0;
+    const size_t nOut  = iHv + (v ? nClasses : 0);
+
+    /* Numbers of the features that are non-zero in the batch */
+    TArray<size_t, cpu> positionArray(nOut ? nBetaPerClass : 0);
+    TArray<size_t, cpu> featuresArray(nOut ? p : 0);
+    DAAL_CHECK_MALLOC(!nOut || (positionArray.get() && featuresArray.get()));
+    size_t * const position = positionArray.get();
+    size_t * const features = featuresArray.get();
+    const size_t nFeatures  = nOut ? objective_function::internal::numberNonZeroFeatures<cpu>(cols, rowOffsets, ind, n, p, position, features) : 0;
+
+    /* Accumulated sums: the log-likelihood and the products X^T*multipliers stored by the numbers of the features, the intercept first */
+    const size_t iXtM = 1;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOut, nFeatures + 1);
+    const size_t nAcc = iXtM + nOut * (nFeatures + 1);
+
+    const size_t nRowsInBlock = 256;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsInBlock, 1 + 2 * nClasses);
+    TlsSum<algorithmFPType, cpu> tlsAcc(nAcc);
+    TlsMem<algorithmFPType, cpu> tlsScratch(nRowsInBlock * (1 + 2 * nClasses) + nOut);
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        algorithmFPType * const acc     = tlsAcc.local();
+        algorithmFPType * const scratch = tlsScratch.local();
+        DAAL_CHECK_MALLOC_THR(acc && scratch);
+
+        const size_t iStartRow  = iBlock * nRowsInBlock;
+        const size_t nBlockRows = (iBlock == nDataBlocks - 1) ? n - iStartRow : nRowsInBlock;
+        const int * const pInd  = ind ? ind + iStartRow : nullptr;
+
+        algorithmFPType * const prob      = scratch;
+        algorithmFPType * const xbByClass = prob + nBlockRows * nClasses;
+        algorithmFPType * const lp        = xbByClass + nBlockRows * nClasses;
+        algorithmFPType * const m         = lp + nBlockRows;
+
+        objective_function::internal::CSRBlock<algorithmFPType, cpu> xBlock;
+        DAAL_CHECK_STATUS_THR(xBlock.set(values, cols, rowOffsets, ind, iStartRow, nBlockRows));
+
+        //P = softmax(X*B + B0)
+        applyBetaCSR(xBlock.values(), xBlock.cols(), xBlock.rowOffsets(), b, prob, xbByClass, nBlockRows, nClasses, p, bIntercept);
+        softmax(prob, prob, nBlockRows, nClasses);
+
+        if (bValue)
+        {
+            for (size_t i = 0; i < nBlockRows; ++i) lp[i] = prob[i * nClasses + size_t(y[pInd ? size_t(pInd[i]) : iStartRow + i])];
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nBlockRows, lp, lp);
+            algorithmFPType logLikelihood = 0;
+            for (size_t i = 0; i < nBlockRows; ++i) logLikelihood += lp[i];
+            acc[0] += logLikelihood;
+        }
+        if (!nOut) return;
+
+        //U = X*V + V0 stored class by class, X*B + B0 is not needed anymore
+        algorithmFPType * const u = xbByClass;
+        if (v)
+        {
+            objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xBlock.values(), xBlock.cols(), xBlock.rowOffsets(), nBlockRows, v,
+                                                                             nBetaPerClass, nClasses, bIntercept, u);
+        }
+
+        for (size_t i = 0; i < nBlockRows; ++i)
+        {
+            const size_t iRow                = pInd ? size_t(pInd[i]) : iStartRow + i;
+            const algorithmFPType * const pi = prob + i * nClasses;
+            if (gradientNT)
+            {
+                for (size_t k = 0; k < nClasses; ++k) m[iGrad + k] = pi[k];
+                m[iGrad + size_t(y[iRow])] -= algorithmFPType(1);
+            }
+            if (v)
+            {
+                //W(k) = P(k)*(U(k) - sum_m P(m)*U(m))
+                algorithmFPType pu = 0;
+                for (size_t k = 0; k < nClasses; ++k) pu += pi[k] * u[k * nBlockRows + i];
+                for (size_t k = 0; k < nClasses; ++k) m[iHv + k] = pi[k] * (u[k * nBlockRows + i] - pu);
+            }
+            objective_function::internal::addRowProductsCSR<algorithmFPType, cpu>(xBlock, i, position, m, nOut, acc + iXtM);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(nAcc);
+    algorithmFPType * const sums = sumsArray.get();
+    DAAL_CHECK_MALLOC(sums);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, algorithmFPType(0), nAcc);
+    tlsAcc.reduceTo(sums, nAcc);
+
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    const algorithmFPType l2  = algorithmFPType(2) * algorithmFPType(parameter->penaltyL2);
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = -sums[0] * div;
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            for (size_t j = 1; j < nBetaPerClass; ++j)
+            {
+                const algorithmFPType bkj = b[k * nBetaPerClass + j];
+                value += bkj * bkj * parameter->penaltyL2;
+                if (parameter->penaltyL1 > 0) value += (bkj < 0 ? -bkj : bkj) * parameter->penaltyL1;
+            }
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            algorithmFPType * const gk = g + k * nBetaPerClass;
+            gk[0]                      = bIntercept ? sums[iXtM + iGrad + k] * div : algorithmFPType(0);
+            for (size_t j = 1; j < nBetaPerClass; ++j) gk[j] = l2 * b[k * nBetaPerClass + j];
+            for (size_t f = 1; f <= nFeatures; ++f) gk[features[f - 1]] += sums[iXtM + f * nOut + iGrad + k] * div;
+        }
+    }
+
+    if (hessianVectorProductNT)
+    {
+        DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hvr);
+        algorithmFPType * const hv = hvr.get();
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            algorithmFPType * const hvk = hv + k * nBetaPerClass;
+            hvk[0]                      = bIntercept ? sums[iXtM + iHv + k] * div : algorithmFPType(0);
+            for (size_t j = 1; j < nBetaPerClass; ++j) hvk[j] = l2 * v[k * nBetaPerClass + j];
+            for (size_t f = 1; f <= nFeatures; ++f) hvk[features[f - 1]] += sums[iXtM + f * nOut + iHv + k] * div;
+        }
+    }
+
+    return s;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
                                                                                NumericTable * betaNT, NumericTable * valueNT,
                                                                                NumericTable * hessianNT, NumericTable * gradientNT,
                                                                                NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                               NumericTable * lipschitzConstant, Parameter * parameter)
+                                                                               NumericTable * lipschitzConstant, NumericTable * hessianVectorProduct,
+                                                                               Parameter * parameter)
 {
     const size_t nRows                                = dataNT->getNumberOfRows();
     const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (csrData)
+    {
+        return doComputeCSR(csrData, dependentVariablesNT, ntInd, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                            proximalProjection, lipschitzConstant, hessianVectorProduct, parameter);
+    }
+
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
@@ -440,7 +873,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
         TArrayScalable<algorithmFPType, cpu> aY(n);
         s |= objective_function::internal::getXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, aX.get(), aY.get(), nRows, n, p);
         s |= doCompute(aX.get(), aY.get(), nRows, n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                       lipschitzConstant, parameter);
+                       lipschitzConstant, hessianVectorProduct, parameter);
         return s;
     }
     ReadRows<algorithmFPType, cpu> xr(dataNT, 0, nRows);
@@ -449,7 +882,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
     DAAL_CHECK_BLOCK_STATUS(yr);
 
     return doCompute(xr.get(), yr.get(), nRows, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                     lipschitzConstant, parameter);
+                     lipschitzConstant, hessianVectorProduct, parameter);
 }
 
 } // namespace internal
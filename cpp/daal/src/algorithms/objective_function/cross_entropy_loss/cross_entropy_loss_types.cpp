@@ -47,7 +47,7 @@ namespace interface2
  * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
  */
 Parameter::Parameter(size_t numClasses, size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
-    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute),
+    : sum_of_functions::interface2::Parameter(numberOfTerms, batchIndices, resultsToCompute),
       interceptFlag(true),
       penaltyL1(0),
       penaltyL2(0),
@@ -59,7 +59,7 @@ Parameter::Parameter(size_t numClasses, size_t numberOfTerms, data_management::N
  * \param[in] other An object to be used as the source to initialize object
  */
 Parameter::Parameter(const Parameter & other)
-    : sum_of_functions::Parameter(other),
+    : sum_of_functions::interface2::Parameter(other),
       interceptFlag(other.interceptFlag),
       penaltyL1(other.penaltyL1),
       penaltyL2(other.penaltyL2),
@@ -74,7 +74,7 @@ services::Status Parameter::check() const
     DAAL_CHECK_EX(penaltyL1 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL1Str());
     DAAL_CHECK_EX(penaltyL2 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL2Str());
     DAAL_CHECK_EX(nClasses > 2, services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
-    return sum_of_functions::Parameter::check();
+    return sum_of_functions::interface2::Parameter::check();
 }
 
 /** Default constructor */
@@ -117,13 +117,60 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 
     const size_t nColsInData = get(data)->getNumberOfColumns();
     const size_t nRowsInData = get(data)->getNumberOfRows();
-    const Parameter * pPar   = static_cast<const Parameter *>(par);
-    s                        = checkNumericTable(get(dependentVariables).get(), dependentVariablesStr(), 0, 0, 1, nRowsInData);
-    s |= checkNumericTable(get(argument).get(), argumentStr(), 0, 0, 1, pPar->nClasses * (nColsInData + 1));
+    /* The input is shared by the batches of the second and the third interfaces */
+    const interface3::Parameter * pPar = dynamic_cast<const interface3::Parameter *>(par);
+    const size_t nClasses              = pPar ? pPar->nClasses : static_cast<const Parameter *>(par)->nClasses;
+    s                                  = checkNumericTable(get(dependentVariables).get(), dependentVariablesStr(), 0, 0, 1, nRowsInData);
+    s |= checkNumericTable(get(argument).get(), argumentStr(), 0, 0, 1, nClasses * (nColsInData + 1));
     return s;
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+/**
+ * Constructs the parameter of Cross-entropy loss objective function
+ * \param[in] numClasses       The number of different values of dependent variable
+ * \param[in] numberOfTerms    The number of terms in the function
+ * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                               a batch of indices used to compute the function results, e.g.,
+                               value of the sum of the functions. If no indices are provided,
+                               all terms will be used in the computations.
+ * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+ */
+Parameter::Parameter(size_t numClasses, size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
+    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute),
+      interceptFlag(true),
+      penaltyL1(0),
+      penaltyL2(0),
+      nClasses(numClasses)
+{}
+
+/**
+ * Constructs an Parameter by copying input objects and parameters of another Parameter
+ * \param[in] other An object to be used as the source to initialize object
+ */
+Parameter::Parameter(const Parameter & other)
+    : sum_of_functions::Parameter(other),
+      interceptFlag(other.interceptFlag),
+      penaltyL1(other.penaltyL1),
+      penaltyL2(other.penaltyL2),
+      nClasses(other.nClasses)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(penaltyL1 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL1Str());
+    DAAL_CHECK_EX(penaltyL2 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL2Str());
+    DAAL_CHECK_EX(nClasses > 2, services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
+    return sum_of_functions::Parameter::check();
+}
+
+} // namespace interface3
 } // namespace cross_entropy_loss
 } // namespace optimization_solver
 } // namespace algorithms
@@ -36,7 +36,7 @@ namespace optimization_solver
 {
 namespace logistic_loss
 {
-namespace interface2
+namespace interface3
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -73,6 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * nonSmoothTermValue      = nullptr;
     NumericTable * proximalProjection      = nullptr;
     NumericTable * lipschitzConstant       = nullptr;
+    NumericTable * hessianVectorProduct    = nullptr;
 
     if (parameter->resultsToCompute & objective_function::value)
     {
@@ -104,15 +105,22 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
         lipschitzConstant = result->get(objective_function::lipschitzConstantIdx).get();
     }
 
+    if (parameter->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        hessianVectorProduct = result->get(objective_function::hessianVectorProductIdx).get();
+    }
+
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu || nonSmoothTermValue || proximalProjection || lipschitzConstant)
+    /* The data in CSR format is processed on CPU */
+    const bool isCSR = dynamic_cast<CSRNumericTableIface *>(input->get(logistic_loss::data).get()) != nullptr;
+    if (deviceInfo.isCpu || nonSmoothTermValue || proximalProjection || lipschitzConstant || hessianVectorProduct || isCSR)
     {
         __DAAL_CALL_KERNEL(env, internal::LogLossKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            input->get(logistic_loss::data).get(), input->get(logistic_loss::dependentVariables).get(),
                            input->get(logistic_loss::argument).get(), value, hessian, gradient, nonSmoothTermValue, proximalProjection,
-                           lipschitzConstant, parameter);
+                           lipschitzConstant, hessianVectorProduct, parameter);
     }
     else
     {
@@ -123,7 +131,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     }
 }
 
-} // namespace interface2
+} // namespace interface3
 } // namespace logistic_loss
 } // namespace optimization_solver
 } // namespace algorithms
@@ -24,6 +24,7 @@
 #include "src/externals/service_math.h"
 #include "src/services/service_utils.h"
 #include "src/externals/service_ittnotify.h"
+#include "src/algorithms/service_error_handling.h"
 
 DAAL_ITTNOTIFY_DOMAIN(logistic_loss.dense.default.batch);
 
@@ -84,6 +85,15 @@ void LogLossKernel<algorithmFPType, method, cpu>::applyBetaThreaded(const algori
     applyBetaImpl<algorithmFPType, cpu>(x, beta, xb, nRows, nCols, bIntercept, true);
 }
 
+/* Computes xb = X*b + b0 for the block of nRows rows of the data set in CSR format with one-based row offsets as one sparse-dense product */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void LogLossKernel<algorithmFPType, method, cpu>::applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets,
+                                                               const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nCols,
+                                                               bool bIntercept)
+{
+    objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(values, cols, rowOffsets, nRows, beta, nCols + 1, 1, bIntercept, xb);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 static void vexp(const algorithmFPType * f, algorithmFPType * exp, size_t n)
 {
@@ -124,32 +134,11 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
     for (size_t i = 0; i < n; ++i) s[i] = algorithmFPType(1.0) / (algorithmFPType(1.0) + s[i]);
 }
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
-                                                                        NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
-                                                                        NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
-                                                                        NumericTable * proximalProjection, NumericTable * lipschitzConstant,
-                                                                        Parameter * parameter)
+/* Computes the proximal projection of the argument b and the value of the non-smooth L1 term */
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerms(const algorithmFPType * b, size_t nBeta, const algorithmFPType penaltyL1,
+                                              NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, algorithmFPType & nonSmoothTerm)
 {
-    const size_t nBeta = p + 1;
-    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
-    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
-
-    const algorithmFPType * b;
-    HomogenNumericTable<algorithmFPType> * hmgBeta = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(betaNT);
-    ReadRows<algorithmFPType, cpu> betar;
-
-    if (hmgBeta)
-    {
-        b = (*hmgBeta).getArray();
-    }
-    else
-    {
-        betar.set(betaNT, 0, nBeta);
-        DAAL_CHECK_BLOCK_STATUS(betar);
-        b = betar.get();
-    }
-
     if (proximalProjection)
     {
         DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
@@ -171,21 +160,72 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         prox[0] = b[0];
         for (size_t i = 1; i < nBeta; i++)
         {
-            if (b[i] > parameter->penaltyL1)
+            if (b[i] > penaltyL1)
             {
-                prox[i] = b[i] - parameter->penaltyL1;
+                prox[i] = b[i] - penaltyL1;
             }
-            if (b[i] < -parameter->penaltyL1)
+            if (b[i] < -penaltyL1)
             {
-                prox[i] = b[i] + parameter->penaltyL1;
+                prox[i] = b[i] + penaltyL1;
             }
-            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= parameter->penaltyL1)
+            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= penaltyL1)
             {
                 prox[i] = 0;
             }
         }
     }
 
+    nonSmoothTerm = 0;
+    if (nonSmoothTermValue)
+    {
+        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & v = *vr.get();
+
+        if ((penaltyL1 > 0))
+        {
+            for (size_t i = 1; i < nBeta; ++i)
+            {
+                nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * penaltyL1;
+            }
+        }
+        v = nonSmoothTerm;
+    }
+
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
+                                                                        NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
+                                                                        NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                        NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                        NumericTable * hessianVectorProductNT, Parameter * parameter)
+{
+    const size_t nBeta = p + 1;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
+
+    const algorithmFPType * b;
+    HomogenNumericTable<algorithmFPType> * hmgBeta = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(betaNT);
+    ReadRows<algorithmFPType, cpu> betar;
+
+    if (hmgBeta)
+    {
+        b = (*hmgBeta).getArray();
+    }
+    else
+    {
+        betar.set(betaNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(betar);
+        b = betar.get();
+    }
+
+    algorithmFPType nonSmoothTerm = 0;
+    services::Status status       = computeNonSmoothTerms<algorithmFPType, cpu>(b, nBeta, algorithmFPType(parameter->penaltyL1), nonSmoothTermValue,
+                                                                                proximalProjection, nonSmoothTerm);
+    DAAL_CHECK_STATUS_VAR(status);
+
     if (lipschitzConstant)
     {
         DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
@@ -230,21 +270,12 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         c                            = 2 * lipschitz + displacement;
     }
 
-    algorithmFPType nonSmoothTerm = 0;
-    if (nonSmoothTermValue)
+    if (hessianVectorProductNT)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType & v = *vr.get();
-
-        if ((parameter->penaltyL1 > 0))
-        {
-            for (size_t i = 1; i < nBeta; ++i)
-            {
-                nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
-            }
-        }
-        v = nonSmoothTerm;
+        status = doComputeFused(x, y, n, p, b, valueNT, gradientNT, hessianVectorProductNT, parameter);
+        DAAL_CHECK_STATUS_VAR(status);
+        valueNT    = nullptr;
+        gradientNT = nullptr;
     }
 
     if (valueNT || gradientNT || hessianNT)
@@ -464,12 +495,358 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
     return services::Status();
 }
 
+/**
+ *  \brief Computes the value, the gradient and the hessian-vector product in one pass over the row blocks of the data set.
+ *  X*b and X*v of a block are computed while the block is in cache, then the gradient and the hessian-vector product
+ *  contributions of the block are accumulated with a single gemm: the gradient is X^T*(s - y) and the product of the hessian
+ *  and v is X^T*(s*(1 - s)*(X*v)), where s is the vector of sigmoids of X*b
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doComputeFused(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
+                                                                             const algorithmFPType * b, NumericTable * valueNT,
+                                                                             NumericTable * gradientNT, NumericTable * hessianVectorProductNT,
+                                                                             Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeFused);
+
+    const size_t nBeta = p + 1;
+    DAAL_CHECK(parameter->hessianVectorDirection.get(), services::ErrorNullNumericTable);
+    ReadRows<algorithmFPType, cpu> directionRows(parameter->hessianVectorDirection.get(), 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(directionRows);
+    const algorithmFPType * const v = directionRows.get();
+
+    const bool bIntercept = parameter->interceptFlag;
+    const bool bValue     = (valueNT != nullptr);
+
+    /* Multipliers of the rows of X are stored row by row: s - y if the gradient is requested, then s*(1 - s)*(X*v) */
+    const size_t iGrad = 0;
+    const size_t iHv   = gradientNT ? 1 : 0;
+    const size_t nOut  = iHv + 1;
+
+    /* Accumulated sums: the log-likelihood, the sums of the multipliers and the products X^T*multipliers of size p x nOut */
+    const size_t iSum = 1;
+    const size_t iXtM = iSum + nOut;
+    const size_t nAcc = iXtM + nOut * p;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOut, p);
+
+    const size_t nRowsInBlock = 512;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    TlsSum<algorithmFPType, cpu> tlsAcc(nAcc);
+    TlsMem<algorithmFPType, cpu> tlsScratch(nRowsInBlock * (5 + nOut));
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        algorithmFPType * const acc     = tlsAcc.local();
+        algorithmFPType * const scratch = tlsScratch.local();
+        DAAL_CHECK_MALLOC_THR(acc && scratch);
+
+        const size_t iStartRow           = iBlock * nRowsInBlock;
+        const size_t nRows               = (iBlock == nDataBlocks - 1) ? n - iStartRow : nRowsInBlock;
+        const algorithmFPType * const px = x + iStartRow * p;
+        const algorithmFPType * const py = y + iStartRow;
+
+        algorithmFPType * const f  = scratch;
+        algorithmFPType * const sg = f + nRows;
+        algorithmFPType * const ls = sg + 2 * nRows;
+        algorithmFPType * const m  = ls + 2 * nRows;
+
+        //f = X*b + b0, s = sigm(f), s1 = 1 - s
+        applyBetaImpl<algorithmFPType, cpu>(px, b, f, nRows, p, bIntercept, false);
+        vexp<algorithmFPType, cpu>(f, sg, nRows);
+        sigmoids<algorithmFPType, cpu>(sg, nRows);
+        const algorithmFPType * const s  = sg;
+        const algorithmFPType * const s1 = sg + nRows;
+
+        if (bValue)
+        {
+            daal::internal::Math<algorithmFPType, cpu>::vLog(2 * nRows, sg, ls);
+            algorithmFPType logLikelihood = 0;
+            for (size_t i = 0; i < nRows; ++i) logLikelihood += py[i] * ls[i] + (algorithmFPType(1) - py[i]) * ls[i + nRows];
+            acc[0] += logLikelihood;
+        }
+
+        //u = X*v + v0, f is not needed anymore
+        algorithmFPType * const u = f;
+        applyBetaImpl<algorithmFPType, cpu>(px, v, u, nRows, p, bIntercept, false);
+
+        if (gradientNT)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i) m[i * nOut + iGrad] = s[i] - py[i];
+        }
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i) m[i * nOut + iHv] = s[i] * s1[i] * u[i];
+
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t j = 0; j < nOut; ++j) acc[iSum + j] += m[i * nOut + j];
+        }
+
+        char trans          = 'T';
+        char notrans        = 'N';
+        algorithmFPType one = 1.0;
+        DAAL_INT mDim       = (DAAL_INT)nOut;
+        DAAL_INT dim        = (DAAL_INT)p;
+        DAAL_INT nN         = (DAAL_INT)nRows;
+        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &mDim, &dim, &nN, &one, m, &mDim, px, &dim, &one, acc + iXtM, &mDim);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(nAcc);
+    algorithmFPType * const sums = sumsArray.get();
+    DAAL_CHECK_MALLOC(sums);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, algorithmFPType(0), nAcc);
+    tlsAcc.reduceTo(sums, nAcc);
+
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    const algorithmFPType l2  = algorithmFPType(2) * algorithmFPType(parameter->penaltyL2);
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = -sums[0] * div;
+        for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
+        if (parameter->penaltyL1 > 0)
+        {
+            for (size_t i = 1; i < nBeta; ++i) value += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        g[0]                      = bIntercept ? sums[iSum + iGrad] * div : algorithmFPType(0);
+        for (size_t j = 0; j < p; ++j) g[j + 1] = sums[iXtM + j * nOut + iGrad] * div + l2 * b[j + 1];
+    }
+
+    DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+    WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(hvr);
+    algorithmFPType * const hv = hvr.get();
+    hv[0]                      = bIntercept ? sums[iSum + iHv] * div : algorithmFPType(0);
+    for (size_t j = 0; j < p; ++j) hv[j + 1] = sums[iXtM + j * nOut + iHv] * div + l2 * v[j + 1];
+
+    return services::Status();
+}
+
+/**
+ *  \brief Computes the results on the data set in CSR format without converting it to the dense one.
+ *  X*b and X*v of a block of rows are sparse-dense products, the rows of the batch given by the indices are copied block by block.
+ *  The contributions of a row to the gradient X^T*(s - y) and to the hessian-vector product X^T*(s*(1 - s)*(X*v)) are accumulated in
+ *  the per-thread buffers only for the features that are non-zero in the row. The buffers keep the sums only for the nFeatures features
+ *  that are non-zero in the batch, so the memory and the reduction time grow as nThreads*nOut*(nFeatures + 1), where nOut is the number
+ *  of the requested products. X^T*multipliers is not a sparse-dense product, as it would write all p sums of every block.
+ *  The hessian is not supported for the data in CSR format
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doComputeCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT,
+                                                                           const NumericTable * indNT, size_t nRows, size_t p, NumericTable * betaNT,
+                                                                           NumericTable * valueNT, NumericTable * hessianNT,
+                                                                           NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                           NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                           NumericTable * hessianVectorProductNT, Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCSR);
+    DAAL_CHECK(!hessianNT, services::ErrorMethodNotSupported);
+
+    const size_t nBeta = p + 1;
+    const size_t n     = indNT ? indNT->getNumberOfColumns() : nRows;
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * const b = betar.get();
+
+    algorithmFPType nonSmoothTerm = 0;
+    services::Status status       = computeNonSmoothTerms<algorithmFPType, cpu>(b, nBeta, algorithmFPType(parameter->penaltyL1), nonSmoothTermValue,
+                                                                                proximalProjection, nonSmoothTerm);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    const algorithmFPType * const values = xr.values();
+    const size_t * const cols            = xr.cols();
+    const size_t * const rowOffsets      = xr.rows();
+
+    ReadRows<int, cpu> indr;
+    const int * ind = nullptr;
+    if (indNT)
+    {
+        indr.set(const_cast<NumericTable *>(indNT), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(indr);
+        ind = indr.get();
+    }
+
+    if (lipschitzConstant)
+    {
+        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+        algorithmFPType & c = *lipschitzConstantPtr.get();
+
+        const algorithmFPType globalMaxNorm = objective_function::internal::getMaxRowNorm2CSR<algorithmFPType, cpu>(values, rowOffsets, ind, n);
+        algorithmFPType alpha_scaled        = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+        algorithmFPType lipschitz           = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+        algorithmFPType displacement        = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+        c                                   = 2 * lipschitz + displacement;
+    }
+
+    if (!valueNT && !gradientNT && !hessianVectorProductNT) return status;
+
+    ReadRows<algorithmFPType, cpu> directionRows;
+    const algorithmFPType * v = nullptr;
+    if (hessianVectorProductNT)
+    {
+        DAAL_CHECK(parameter->hessianVectorDirection.get(), services::ErrorNullNumericTable);
+        directionRows.set(parameter->hessianVectorDirection.get(), 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(directionRows);
+        v = directionRows.get();
+    }
+
+    ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+    const algorithmFPType * const y = yr.get();
+
+    const bool bIntercept = parameter->interceptFlag;
+    const bool bValue     = (valueNT != nullptr);
+
+    /* Multipliers of the row: s - y if the gradient is requested, then s*(1 - s)*(x*v) if the hessian-vector product is requested */
+    const size_t iGrad = 0;
+    const size_t iHv   = gradientNT ? 1 : 0;
+    const size_t nOut  = iHv + (v ? 1 : 0);
+
+    /* Numbers of the features that are non-zero in the batch */
+    TArray<size_t, cpu> positionArray(nOut ? nBeta : 0);
+    TArray<size_t, cpu> featuresArray(nOut ? p : 0);
+    DAAL_CHECK_MALLOC(!nOut || (positionArray.get() && featuresArray.get()));
+    size_t * const position = positionArray.get();
+    size_t * const features = featuresArray.get();
+    const size_t nFeatures  = nOut ? objective_function::internal::numberNonZeroFeatures<cpu>(cols, rowOffsets, ind, n, p, position, features) : 0;
+
+    /* Accumulated sums: the log-likelihood and the products X^T*multipliers stored by the numbers of the features, the intercept first */
+    const size_t iXtM = 1;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOut, nFeatures + 1);
+    const size_t nAcc = iXtM + nOut * (nFeatures + 1);
+
+    const size_t nRowsInBlock = 512;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    TlsSum<algorithmFPType, cpu> tlsAcc(nAcc);
+    TlsMem<algorithmFPType, cpu> tlsScratch(nRowsInBlock * 6);
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        algorithmFPType * const acc     = tlsAcc.local();
+        algorithmFPType * const scratch = tlsScratch.local();
+        DAAL_CHECK_MALLOC_THR(acc && scratch);
+
+        const size_t iStartRow  = iBlock * nRowsInBlock;
+        const size_t nBlockRows = (iBlock == nDataBlocks - 1) ? n - iStartRow : nRowsInBlock;
+        const int * const pInd  = ind ? ind + iStartRow : nullptr;
+
+        algorithmFPType * const f  = scratch;
+        algorithmFPType * const sg = f + nBlockRows;
+        algorithmFPType * const ls = sg + 2 * nBlockRows;
+        algorithmFPType * const yb = ls + 2 * nBlockRows;
+
+        objective_function::internal::CSRBlock<algorithmFPType, cpu> xBlock;
+        DAAL_CHECK_STATUS_THR(xBlock.set(values, cols, rowOffsets, ind, iStartRow, nBlockRows));
+        for (size_t i = 0; i < nBlockRows; ++i) yb[i] = y[pInd ? size_t(pInd[i]) : iStartRow + i];
+
+        //f = X*b + b0, s = sigm(f), s1 = 1 - s
+        objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xBlock.values(), xBlock.cols(), xBlock.rowOffsets(), nBlockRows, b, nBeta,
+                                                                         1, bIntercept, f);
+        vexp<algorithmFPType, cpu>(f, sg, nBlockRows);
+        sigmoids<algorithmFPType, cpu>(sg, nBlockRows);
+        const algorithmFPType * const s  = sg;
+        const algorithmFPType * const s1 = sg + nBlockRows;
+
+        if (bValue)
+        {
+            daal::internal::Math<algorithmFPType, cpu>::vLog(2 * nBlockRows, sg, ls);
+            algorithmFPType logLikelihood = 0;
+            for (size_t i = 0; i < nBlockRows; ++i) logLikelihood += yb[i] * ls[i] + (algorithmFPType(1) - yb[i]) * ls[i + nBlockRows];
+            acc[0] += logLikelihood;
+        }
+        if (!nOut) return;
+
+        //u = X*v + v0, ls is not needed anymore
+        algorithmFPType * const u = ls;
+        if (v)
+        {
+            objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xBlock.values(), xBlock.cols(), xBlock.rowOffsets(), nBlockRows, v,
+                                                                             nBeta, 1, bIntercept, u);
+        }
+
+        algorithmFPType m[2];
+        for (size_t i = 0; i < nBlockRows; ++i)
+        {
+            if (gradientNT) m[iGrad] = s[i] - yb[i];
+            if (v) m[iHv] = s[i] * s1[i] * u[i];
+            objective_function::internal::addRowProductsCSR<algorithmFPType, cpu>(xBlock, i, position, m, nOut, acc + iXtM);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(nAcc);
+    algorithmFPType * const sums = sumsArray.get();
+    DAAL_CHECK_MALLOC(sums);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, algorithmFPType(0), nAcc);
+    tlsAcc.reduceTo(sums, nAcc);
+
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    const algorithmFPType l2  = algorithmFPType(2) * algorithmFPType(parameter->penaltyL2);
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = -sums[0] * div;
+        for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
+        if (parameter->penaltyL1 > 0)
+        {
+            for (size_t i = 1; i < nBeta; ++i) value += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        g[0]                      = bIntercept ? sums[iXtM + iGrad] * div : algorithmFPType(0);
+        for (size_t j = 1; j < nBeta; ++j) g[j] = l2 * b[j];
+        for (size_t k = 1; k <= nFeatures; ++k) g[features[k - 1]] += sums[iXtM + k * nOut + iGrad] * div;
+    }
+
+    if (hessianVectorProductNT)
+    {
+        DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hvr);
+        algorithmFPType * const hv = hvr.get();
+        hv[0]                      = bIntercept ? sums[iXtM + iHv] * div : algorithmFPType(0);
+        for (size_t j = 1; j < nBeta; ++j) hv[j] = l2 * v[j];
+        for (size_t k = 1; k <= nFeatures; ++k) hv[features[k - 1]] += sums[iXtM + k * nOut + iHv] * div;
+    }
+
+    return status;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
                                                                       NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
                                                                       NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
                                                                       NumericTable * proximalProjection, NumericTable * lipschitzConstant,
-                                                                      Parameter * parameter)
+                                                                      NumericTable * hessianVectorProduct, Parameter * parameter)
 {
     const size_t nRows                                = dataNT->getNumberOfRows();
     const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
@@ -477,6 +854,14 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (csrData)
+    {
+        return doComputeCSR(csrData, dependentVariablesNT, ntInd, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                            proximalProjection, lipschitzConstant, hessianVectorProduct, parameter);
+    }
+
     if (ntInd)
     {
         const size_t n                                               = ntInd->getNumberOfColumns();
@@ -488,8 +873,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
             int ind                    = ntInd->getValue<int>(0, 0);
             const algorithmFPType * aX = (*hmgData)[ind];
             const algorithmFPType * aY = (*hmgDependentVariables)[ind];
-            s |=
-                doCompute(aX, aY, n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+            s |= doCompute(aX, aY, n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant,
+                           hessianVectorProduct, parameter);
             return s;
         }
         else
@@ -505,7 +890,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
                 s |= objective_function::internal::getXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, aX.get(), aY.get(), nRows, n, p);
             }
             s |= doCompute(aX.get(), aY.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                           lipschitzConstant, parameter);
+                           lipschitzConstant, hessianVectorProduct, parameter);
         }
         return s;
     }
@@ -516,7 +901,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     DAAL_CHECK_BLOCK_STATUS(yr);
 
     s |= doCompute(xr.get(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant,
-                   parameter);
+                   hessianVectorProduct, parameter);
     return s;
 }
 
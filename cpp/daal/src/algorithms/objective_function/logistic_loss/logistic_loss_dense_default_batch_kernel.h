@@ -27,6 +27,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_blas.h"
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -48,16 +49,27 @@ class LogLossKernel : public Kernel
 public:
     services::Status compute(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
                              NumericTable * hessian, NumericTable * gradient, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                             NumericTable * lipschitzConstant, Parameter * parameter);
+                             NumericTable * lipschitzConstant, NumericTable * hessianVectorProduct, Parameter * parameter);
     static void applyBeta(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nCols, bool bIntercept);
     static void applyBetaThreaded(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nCols,
                                   bool bIntercept);
+    static void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets, const algorithmFPType * beta,
+                             algorithmFPType * xb, size_t nRows, size_t nCols, bool bIntercept);
     static void sigmoid(const algorithmFPType * f, algorithmFPType * s, size_t n);
 
 protected:
     services::Status doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p, NumericTable * betaNT,
                                NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
-                               NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter);
+                               NumericTable * proximalProjection, NumericTable * lipschitzConstant, NumericTable * hessianVectorProductNT,
+                               Parameter * parameter);
+
+    services::Status doComputeFused(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p, const algorithmFPType * b,
+                                    NumericTable * valueNT, NumericTable * gradientNT, NumericTable * hessianVectorProductNT, Parameter * parameter);
+
+    services::Status doComputeCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT, size_t nRows,
+                                  size_t p, NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT,
+                                  NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                  NumericTable * hessianVectorProductNT, Parameter * parameter);
 };
 
 } // namespace internal
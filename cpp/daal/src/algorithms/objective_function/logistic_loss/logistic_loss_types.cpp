@@ -47,7 +47,7 @@ namespace interface2
  * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
  */
 Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
-    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute), penaltyL1(0), penaltyL2(0), interceptFlag(true)
+    : sum_of_functions::interface2::Parameter(numberOfTerms, batchIndices, resultsToCompute), penaltyL1(0), penaltyL2(0), interceptFlag(true)
 {}
 
 /**
@@ -55,7 +55,7 @@ Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batc
  * \param[in] other An object to be used as the source to initialize object
  */
 Parameter::Parameter(const Parameter & other)
-    : sum_of_functions::Parameter(other), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2), interceptFlag(other.interceptFlag)
+    : sum_of_functions::interface2::Parameter(other), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2), interceptFlag(other.interceptFlag)
 {}
 
 /**
@@ -65,7 +65,7 @@ services::Status Parameter::check() const
 {
     DAAL_CHECK_EX(penaltyL1 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL1Str());
     DAAL_CHECK_EX(penaltyL2 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL2Str());
-    return sum_of_functions::Parameter::check();
+    return sum_of_functions::interface2::Parameter::check();
 }
 
 /** Default constructor */
@@ -115,6 +115,41 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+/**
+ * Constructs the parameter of Logistic loss objective function
+ * \param[in] numberOfTerms    The number of terms in the function
+ * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                               a batch of indices used to compute the function results, e.g.,
+                               value of the sum of the functions. If no indices are provided,
+                               all terms will be used in the computations.
+ * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+ */
+Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
+    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute), penaltyL1(0), penaltyL2(0), interceptFlag(true)
+{}
+
+/**
+ * Constructs an Parameter by copying input objects and parameters of another Parameter
+ * \param[in] other An object to be used as the source to initialize object
+ */
+Parameter::Parameter(const Parameter & other)
+    : sum_of_functions::Parameter(other), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2), interceptFlag(other.interceptFlag)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(penaltyL1 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL1Str());
+    DAAL_CHECK_EX(penaltyL2 >= 0, services::ErrorIncorrectParameter, services::ParameterName, penaltyL2Str());
+    return sum_of_functions::Parameter::check();
+}
+
+} // namespace interface3
 } // namespace logistic_loss
 } // namespace optimization_solver
 } // namespace algorithms
@@ -35,7 +35,7 @@ namespace optimization_solver
 {
 namespace mse
 {
-namespace interface2
+namespace interface3
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -73,6 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * componentOfGradient           = nullptr;
     NumericTable * componentOfHessianDiagonal    = nullptr;
     NumericTable * componentOfProximalProjection = nullptr;
+    NumericTable * hessianVectorProduct          = nullptr;
 
     bool valueFlag = ((parameter->resultsToCompute & objective_function::value) != 0) ? true : false;
     if (valueFlag)
@@ -118,13 +119,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
         componentOfProximalProjection = result->get(objective_function::componentOfProximalProjectionIdx).get();
         componentOfHessianDiagonal    = result->get(objective_function::componentOfHessianDiagonalIdx).get();
     }
+    if (parameter->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        hessianVectorProduct = result->get(objective_function::hessianVectorProductIdx).get();
+    }
 
     __DAAL_CALL_KERNEL(env, internal::MSEKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, data, dependentVariables, argument, value,
                        hessian, gradient, nonSmoothTermValue, proximalProjection, lipschitzConstant, componentOfGradient, componentOfHessianDiagonal,
-                       componentOfProximalProjection, parameter);
+                       componentOfProximalProjection, hessianVectorProduct, parameter);
 }
 
-} // namespace interface2
+} // namespace interface3
 
 } // namespace mse
 
@@ -32,7 +32,7 @@ namespace optimization_solver
 {
 namespace mse
 {
-namespace interface2
+namespace interface3
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 }
@@ -25,14 +25,14 @@ namespace daal
 {
 namespace algorithms
 {
-__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(optimization_solver::mse::interface2::BatchContainer, batch, DAAL_FPTYPE,
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(optimization_solver::mse::interface3::BatchContainer, batch, DAAL_FPTYPE,
                                            optimization_solver::mse::defaultDense)
 
 namespace optimization_solver
 {
 namespace mse
 {
-namespace interface2
+namespace interface3
 {
 using BatchType = Batch<DAAL_FPTYPE, optimization_solver::mse::defaultDense>;
 
@@ -51,7 +51,7 @@ BatchType::Batch(const BatchType & other)
     _par = sumOfFunctionsParameter;
 }
 
-} // namespace interface2
+} // namespace interface3
 } // namespace mse
 } // namespace optimization_solver
 } // namespace algorithms
@@ -42,7 +42,8 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                                                                          NumericTable * proximalProjection, NumericTable * lipschitzConstant,
                                                                          NumericTable * componentOfGradient,
                                                                          NumericTable * componentOfHessianDiagonal,
-                                                                         NumericTable * componentOfProximalProjection, Parameter * parameter)
+                                                                         NumericTable * componentOfProximalProjection,
+                                                                         NumericTable * hessianVectorProduct, Parameter * parameter)
 {
     SafeStatus safeStat;
     const size_t nDataRows           = dataNT->getNumberOfRows();
@@ -752,11 +753,12 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
 
     if (parameter->batchIndices.get() != NULL && parameter->batchIndices->getNumberOfColumns() != nDataRows)
     {
-        MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter,
-                                                 blockSizeDefault);
+        MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, hessianVectorProduct,
+                                                 parameter, blockSizeDefault);
         return run(task);
     }
-    MSETaskAll<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter, blockSizeDefault);
+    MSETaskAll<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, hessianVectorProduct, parameter,
+                                          blockSizeDefault);
     return (!result) ? run(task) : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
@@ -767,9 +769,9 @@ services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmF
     Status s                        = task.init(argumentArray);
     if (!s) return s;
     algorithmFPType *dataBlock = nullptr, *dependentVariablesBlock = nullptr;
-    algorithmFPType *value = nullptr, *gradient = NULL, *hessian = nullptr;
-    DAAL_CHECK_STATUS(s, task.getResultValues(value, gradient, hessian));
-    task.setResultValuesToZero(value, gradient, hessian);
+    algorithmFPType *value = nullptr, *gradient = NULL, *hessian = nullptr, *hessianVectorProduct = nullptr;
+    DAAL_CHECK_STATUS(s, task.getResultValues(value, gradient, hessian, hessianVectorProduct));
+    task.setResultValuesToZero(value, gradient, hessian, hessianVectorProduct);
 
     size_t blockSize = blockSizeDefault;
     size_t nBlocks   = task.batchSize / blockSizeDefault;
@@ -784,11 +786,11 @@ services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmF
         if (block == nBlocks - 1) blockSize = task.batchSize - block * blockSizeDefault;
 
         s = task.getCurrentBlock(block * blockSizeDefault, blockSize, dataBlock, dependentVariablesBlock);
-        if (s) computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, value, gradient, hessian);
+        if (s) computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, value, gradient, hessian, hessianVectorProduct);
         task.releaseCurrentBlock();
     }
 
-    if (s) normalizeResults(task, value, gradient, hessian);
+    if (s) normalizeResults(task, value, gradient, hessian, hessianVectorProduct);
     task.releaseResultValues();
     return s;
 }
@@ -796,7 +798,8 @@ services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmF
 template <typename algorithmFPType, Method method, CpuType cpu>
 inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(size_t blockSize, MSETask<algorithmFPType, cpu> & task, algorithmFPType * data,
                                                                 algorithmFPType * argumentArray, algorithmFPType * dependentVariablesArray,
-                                                                algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian)
+                                                                algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian,
+                                                                algorithmFPType * hessianVectorProduct)
 {
     char trans                   = 'T';
     algorithmFPType one          = 1.0;
@@ -864,11 +867,30 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(size_t blockSize
             hessian[i * argumentSize] = hessian[i];
         }
     }
+
+    if (task.hessianVectorProductFlag)
+    {
+        /* H v = sum_i (1, x_i) * ((1, x_i) . v), the hessian itself is never formed */
+        algorithmFPType * direction      = task.directionArray;
+        algorithmFPType * xMultDirection = task.xMultDirection.get();
+        Blas<algorithmFPType, cpu>::xgemv(&trans, &dim, &n, &one, data, &dim, direction + 1, &ione, &zero, xMultDirection, &ione);
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType u = xMultDirection[i] + direction[0];
+            hessianVectorProduct[0] += u;
+            for (size_t j = 0; j < nTheta; j++)
+            {
+                hessianVectorProduct[j + 1] += u * data[i * nTheta + j];
+            }
+        }
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 void MSEKernel<algorithmFPType, method, cpu>::normalizeResults(MSETask<algorithmFPType, cpu> & task, algorithmFPType * value,
-                                                               algorithmFPType * gradient, algorithmFPType * hessian)
+                                                               algorithmFPType * gradient, algorithmFPType * hessian,
+                                                               algorithmFPType * hessianVectorProduct)
 {
     size_t argumentSize          = task.argumentSize;
     const algorithmFPType one    = 1.0;
@@ -894,6 +916,14 @@ void MSEKernel<algorithmFPType, method, cpu>::normalizeResults(MSETask<algorithm
             hessian[j] *= batchSizeInv;
         }
     }
+
+    if (task.hessianVectorProductFlag)
+    {
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            hessianVectorProduct[j] *= batchSizeInv;
+        }
+    }
 }
 
 } // namespace internal
@@ -48,15 +48,17 @@ struct MSETask
 {
     DAAL_NEW_DELETE();
     MSETask(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value, NumericTable * hessian,
-            NumericTable * gradient, Parameter * parameter);
+            NumericTable * gradient, NumericTable * hessianVectorProduct, Parameter * parameter);
     virtual ~MSETask();
 
     virtual Status init(algorithmFPType *& pArgumentArray);
     virtual Status getCurrentBlock(size_t startIdx, size_t blockSize, algorithmFPType *& pBlockData, algorithmFPType *& pBlockDependentVariables) = 0;
     virtual void releaseCurrentBlock()                                                                                                            = 0;
 
-    void setResultValuesToZero(algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian);
-    Status getResultValues(algorithmFPType *& value, algorithmFPType *& gradient, algorithmFPType *& hessian);
+    void setResultValuesToZero(algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian,
+                               algorithmFPType * hessianVectorProduct);
+    Status getResultValues(algorithmFPType *& value, algorithmFPType *& gradient, algorithmFPType *& hessian,
+                           algorithmFPType *& hessianVectorProduct);
     void releaseResultValues();
 
     BlockDescriptor<algorithmFPType> dataBlock;
@@ -65,6 +67,8 @@ struct MSETask
     BlockDescriptor<algorithmFPType> gradientBlock;
     BlockDescriptor<algorithmFPType> valueBlock;
     BlockDescriptor<algorithmFPType> hessianBlock;
+    BlockDescriptor<algorithmFPType> hessianVectorProductBlock;
+    BlockDescriptor<algorithmFPType> directionBlock;
 
     NumericTable * ntData;
     NumericTable * ntDependentVariables;
@@ -72,14 +76,19 @@ struct MSETask
     NumericTable * ntGradient;
     NumericTable * ntValue;
     NumericTable * ntHessian;
+    NumericTable * ntHessianVectorProduct;
+    NumericTable * ntDirection;
 
     bool valueFlag;
     bool hessianFlag;
     bool gradientFlag;
+    bool hessianVectorProductFlag;
     size_t argumentSize;
     size_t nTheta;
     size_t batchSize;
     TArray<algorithmFPType, cpu> xMultTheta;
+    TArray<algorithmFPType, cpu> xMultDirection;
+    algorithmFPType * directionArray;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -107,13 +116,16 @@ struct MSETaskAll : public MSETask<algorithmFPType, cpu>
     using super::hessianBlock;
     using super::hessianFlag;
 
+    using super::hessianVectorProductFlag;
+
     using super::argumentSize;
     using super::nTheta;
     using super::batchSize;
     using super::xMultTheta;
+    using super::xMultDirection;
 
     MSETaskAll(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value, NumericTable * hessian,
-               NumericTable * gradient, Parameter * parameter, size_t blockSizeDefault);
+               NumericTable * gradient, NumericTable * hessianVectorProduct, Parameter * parameter, size_t blockSizeDefault);
     virtual ~MSETaskAll();
 
     virtual Status init(algorithmFPType *& pArgumentArray) DAAL_C11_OVERRIDE;
@@ -149,13 +161,16 @@ struct MSETaskSample : public MSETask<algorithmFPType, cpu>
     using super::hessianBlock;
     using super::hessianFlag;
 
+    using super::hessianVectorProductFlag;
+
     using super::argumentSize;
     using super::nTheta;
     using super::batchSize;
     using super::xMultTheta;
+    using super::xMultDirection;
 
     MSETaskSample(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value, NumericTable * hessian,
-                  NumericTable * gradient, Parameter * parameter, size_t blockSizeDefault);
+                  NumericTable * gradient, NumericTable * hessianVectorProduct, Parameter * parameter, size_t blockSizeDefault);
     virtual ~MSETaskSample();
 
     virtual Status init(algorithmFPType *& pArgumentArray) DAAL_C11_OVERRIDE;
@@ -178,7 +193,7 @@ public:
     services::Status compute(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
                              NumericTable * hessian, NumericTable * gradient, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
                              NumericTable * lipschitzConstant, NumericTable * componentOfGradient, NumericTable * componentOfHessianDiagonal,
-                             NumericTable * componentOfProximalProjection, Parameter * parameter);
+                             NumericTable * componentOfProximalProjection, NumericTable * hessianVectorProduct, Parameter * parameter);
     MSEKernel()
         : hessianDiagonal(0),
           hessianDiagonalPtr(nullptr),
@@ -216,9 +231,11 @@ public:
 
 private:
     void computeMSE(size_t blockSize, MSETask<algorithmFPType, cpu> & task, algorithmFPType * data, algorithmFPType * argumentArray,
-                    algorithmFPType * dependentVariablesArray, algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian);
+                    algorithmFPType * dependentVariablesArray, algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian,
+                    algorithmFPType * hessianVectorProduct);
 
-    void normalizeResults(MSETask<algorithmFPType, cpu> & task, algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian);
+    void normalizeResults(MSETask<algorithmFPType, cpu> & task, algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian,
+                          algorithmFPType * hessianVectorProduct);
 
     Status run(MSETask<algorithmFPType, cpu> & task);
 
@@ -41,12 +41,21 @@ static const size_t blockSizeDefault = 512;
 
 template <typename algorithmFPType, CpuType cpu>
 MSETask<algorithmFPType, cpu>::MSETask(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
-                                       NumericTable * hessian, NumericTable * gradient, Parameter * parameter)
-    : ntData(data), ntDependentVariables(dependentVariables), ntArgument(argument), ntValue(value), ntHessian(hessian), ntGradient(gradient)
+                                       NumericTable * hessian, NumericTable * gradient, NumericTable * hessianVectorProduct, Parameter * parameter)
+    : ntData(data),
+      ntDependentVariables(dependentVariables),
+      ntArgument(argument),
+      ntValue(value),
+      ntHessian(hessian),
+      ntGradient(gradient),
+      ntHessianVectorProduct(hessianVectorProduct),
+      ntDirection(parameter->hessianVectorDirection.get()),
+      directionArray(nullptr)
 {
-    valueFlag    = ((parameter->resultsToCompute & objective_function::value) != 0) ? true : false;
-    hessianFlag  = ((parameter->resultsToCompute & objective_function::hessian) != 0) ? true : false;
-    gradientFlag = ((parameter->resultsToCompute & objective_function::gradient) != 0) ? true : false;
+    valueFlag                = ((parameter->resultsToCompute & objective_function::value) != 0) ? true : false;
+    hessianFlag              = ((parameter->resultsToCompute & objective_function::hessian) != 0) ? true : false;
+    gradientFlag             = ((parameter->resultsToCompute & objective_function::gradient) != 0) ? true : false;
+    hessianVectorProductFlag = ((parameter->resultsToCompute & objective_function::hessianVectorProduct) != 0) ? true : false;
 
     argumentSize = ntArgument->getNumberOfRows();
     nTheta       = argumentSize - 1;
@@ -57,6 +66,12 @@ Status MSETask<algorithmFPType, cpu>::init(algorithmFPType *& pArgumentArray)
 {
     Status s       = ntArgument->getBlockOfRows(0, argumentSize, readOnly, argumentBlock);
     pArgumentArray = argumentBlock.getBlockPtr();
+    if (s && hessianVectorProductFlag)
+    {
+        DAAL_CHECK(ntDirection, ErrorNullNumericTable);
+        DAAL_CHECK_STATUS(s, ntDirection->getBlockOfRows(0, argumentSize, readOnly, directionBlock));
+        directionArray = directionBlock.getBlockPtr();
+    }
     return s;
 }
 
@@ -64,10 +79,15 @@ template <typename algorithmFPType, CpuType cpu>
 MSETask<algorithmFPType, cpu>::~MSETask()
 {
     ntArgument->releaseBlockOfRows(argumentBlock);
+    if (directionArray)
+    {
+        ntDirection->releaseBlockOfRows(directionBlock);
+    }
 }
 
 template <typename algorithmFPType, CpuType cpu>
-Status MSETask<algorithmFPType, cpu>::getResultValues(algorithmFPType *& value, algorithmFPType *& gradient, algorithmFPType *& hessian)
+Status MSETask<algorithmFPType, cpu>::getResultValues(algorithmFPType *& value, algorithmFPType *& gradient, algorithmFPType *& hessian,
+                                                      algorithmFPType *& hessianVectorProduct)
 {
     Status s;
     if (valueFlag)
@@ -85,11 +105,17 @@ Status MSETask<algorithmFPType, cpu>::getResultValues(algorithmFPType *& value,
         DAAL_CHECK_STATUS(s, ntGradient->getBlockOfRows(0, argumentSize, writeOnly, gradientBlock));
         gradient = gradientBlock.getBlockPtr();
     }
+    if (hessianVectorProductFlag)
+    {
+        DAAL_CHECK_STATUS(s, ntHessianVectorProduct->getBlockOfRows(0, argumentSize, writeOnly, hessianVectorProductBlock));
+        hessianVectorProduct = hessianVectorProductBlock.getBlockPtr();
+    }
     return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void MSETask<algorithmFPType, cpu>::setResultValuesToZero(algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian)
+void MSETask<algorithmFPType, cpu>::setResultValuesToZero(algorithmFPType * value, algorithmFPType * gradient, algorithmFPType * hessian,
+                                                          algorithmFPType * hessianVectorProduct)
 {
     algorithmFPType zero = (algorithmFPType)0.0;
     if (valueFlag)
@@ -110,6 +136,13 @@ void MSETask<algorithmFPType, cpu>::setResultValuesToZero(algorithmFPType * valu
             gradient[j] = zero;
         }
     }
+    if (hessianVectorProductFlag)
+    {
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            hessianVectorProduct[j] = zero;
+        }
+    }
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -127,15 +160,24 @@ void MSETask<algorithmFPType, cpu>::releaseResultValues()
     {
         ntGradient->releaseBlockOfRows(gradientBlock);
     }
+    if (hessianVectorProductFlag)
+    {
+        ntHessianVectorProduct->releaseBlockOfRows(hessianVectorProductBlock);
+    }
 }
 
 template <typename algorithmFPType, CpuType cpu>
 MSETaskAll<algorithmFPType, cpu>::MSETaskAll(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
-                                             NumericTable * hessian, NumericTable * gradient, Parameter * parameter, size_t blockSizeDefault)
-    : super(data, dependentVariables, argument, value, hessian, gradient, parameter)
+                                             NumericTable * hessian, NumericTable * gradient, NumericTable * hessianVectorProduct,
+                                             Parameter * parameter, size_t blockSizeDefault)
+    : super(data, dependentVariables, argument, value, hessian, gradient, hessianVectorProduct, parameter)
 {
     batchSize = ntData->getNumberOfRows();
     xMultTheta.reset(batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
+    if (hessianVectorProductFlag)
+    {
+        xMultDirection.reset(xMultTheta.size());
+    }
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -144,6 +186,7 @@ Status MSETaskAll<algorithmFPType, cpu>::init(algorithmFPType *& pArgumentArray)
     Status s = super::init(pArgumentArray);
     if (!s) return s;
     DAAL_CHECK_MALLOC(xMultTheta.get());
+    DAAL_CHECK_MALLOC(!hessianVectorProductFlag || xMultDirection.get());
     return s;
 }
 
@@ -172,9 +215,10 @@ void MSETaskAll<algorithmFPType, cpu>::releaseCurrentBlock()
 
 template <typename algorithmFPType, CpuType cpu>
 MSETaskSample<algorithmFPType, cpu>::MSETaskSample(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument,
-                                                   NumericTable * value, NumericTable * hessian, NumericTable * gradient, Parameter * parameter,
-                                                   size_t blockSizeDefault)
-    : MSETask<algorithmFPType, cpu>(data, dependentVariables, argument, value, hessian, gradient, parameter), ntIndices(parameter->batchIndices.get())
+                                                   NumericTable * value, NumericTable * hessian, NumericTable * gradient,
+                                                   NumericTable * hessianVectorProduct, Parameter * parameter, size_t blockSizeDefault)
+    : MSETask<algorithmFPType, cpu>(data, dependentVariables, argument, value, hessian, gradient, hessianVectorProduct, parameter),
+      ntIndices(parameter->batchIndices.get())
 {
     batchSize = parameter->batchIndices->getNumberOfColumns();
 }
@@ -196,6 +240,11 @@ Status MSETaskSample<algorithmFPType, cpu>::init(algorithmFPType *& pArgumentArr
     dependentVariablesBlockMemory.reset(allocationSize);
     xMultTheta.reset(allocationSize);
     DAAL_CHECK_MALLOC(dependentVariablesBlockMemory.get() && xMultTheta.get());
+    if (hessianVectorProductFlag)
+    {
+        xMultDirection.reset(allocationSize);
+        DAAL_CHECK_MALLOC(xMultDirection.get());
+    }
     return s;
 }
 
@@ -47,7 +47,7 @@ namespace interface2
  * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
  */
 Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
-    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute),
+    : sum_of_functions::interface2::Parameter(numberOfTerms, batchIndices, resultsToCompute),
       interceptFlag(true),
       penaltyL1(new HomogenNumericTable<float>(1, 1, NumericTableIface::doAllocate, 0)),
       penaltyL2(new HomogenNumericTable<float>(1, 1, NumericTableIface::doAllocate, 0))
@@ -58,7 +58,7 @@ Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batc
  * \param[in] other An object to be used as the source to initialize object
  */
 Parameter::Parameter(const Parameter & other)
-    : sum_of_functions::Parameter(other), interceptFlag(other.interceptFlag), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2)
+    : sum_of_functions::interface2::Parameter(other), interceptFlag(other.interceptFlag), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2)
 {}
 
 /**
@@ -66,7 +66,7 @@ Parameter::Parameter(const Parameter & other)
  */
 services::Status Parameter::check() const
 {
-    return sum_of_functions::Parameter::check();
+    return sum_of_functions::interface2::Parameter::check();
 }
 
 /** Default constructor */
@@ -170,6 +170,42 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 
 } // namespace interface2
 
+namespace interface3
+{
+/**
+ * Constructs the parameter of Mean squared error objective function
+ * \param[in] numberOfTerms    The number of terms in the function
+ * \param[in] batchIndices     Numeric table of size 1 x m where m is batch size that represent
+                               a batch of indices used to compute the function results, e.g.,
+                               value of the sum of the functions. If no indices are provided,
+                               all terms will be used in the computations.
+ * \param[in] resultsToCompute 64 bit integer flag that indicates the results to compute
+ */
+Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
+    : sum_of_functions::Parameter(numberOfTerms, batchIndices, resultsToCompute),
+      interceptFlag(true),
+      penaltyL1(new HomogenNumericTable<float>(1, 1, NumericTableIface::doAllocate, 0)),
+      penaltyL2(new HomogenNumericTable<float>(1, 1, NumericTableIface::doAllocate, 0))
+{}
+
+/**
+ * Constructs an Parameter by copying input objects and parameters of another Parameter
+ * \param[in] other An object to be used as the source to initialize object
+ */
+Parameter::Parameter(const Parameter & other)
+    : sum_of_functions::Parameter(other), interceptFlag(other.interceptFlag), penaltyL1(other.penaltyL1), penaltyL2(other.penaltyL2)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter::check() const
+{
+    return sum_of_functions::Parameter::check();
+}
+
+} // namespace interface3
+
 } // namespace mse
 } // namespace optimization_solver
 } // namespace algorithms
@@ -78,7 +78,9 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 }
 
 /** Default constructor */
-Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+Result::Result() : daal::algorithms::Result(componentOfProximalProjectionIdx + 1) {}
+
+Result::Result(const size_t nElements) : daal::algorithms::Result(nElements) {}
 
 /**
  * Sets the result of the Objective function
@@ -101,17 +103,12 @@ NumericTablePtr Result::get(ResultId id) const
 }
 
 /**
-* Checks the result of the Objective function
-* \param[in] input   %Input of the algorithm
-* \param[in] par     %Parameter of algorithm
-* \param[in] method  Computation method
-*/
-services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+ * Checks the results of the Objective function available in all the interfaces
+ */
+static services::Status checkResult(const Result & result, const daal::algorithms::Input * input, const daal::algorithms::Parameter * par)
 {
     using namespace services;
 
-    DAAL_CHECK(Argument::size() == 9, ErrorIncorrectNumberOfArguments);
-
     const Input * algInput         = static_cast<const Input *>(input);
     const Parameter * algParameter = static_cast<const Parameter *>(par);
     DAAL_CHECK(algParameter != 0, ErrorNullParameterNotSupported);
@@ -120,20 +117,65 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     services::Status s;
     if (algParameter->resultsToCompute & value)
     {
-        s = checkNumericTable(get(valueIdx).get(), valueIdxStr(), 0, 0, 1, 1);
+        s = checkNumericTable(result.get(valueIdx).get(), valueIdxStr(), 0, 0, 1, 1);
     }
     if (algParameter->resultsToCompute & gradient)
     {
-        s |= checkNumericTable(get(gradientIdx).get(), gradientIdxStr(), 0, 0, 1, nRows);
+        s |= checkNumericTable(result.get(gradientIdx).get(), gradientIdxStr(), 0, 0, 1, nRows);
     }
     if (algParameter->resultsToCompute & hessian)
     {
-        s |= checkNumericTable(get(hessianIdx).get(), hessianIdxStr(), 0, 0, nRows, nRows);
+        s |= checkNumericTable(result.get(hessianIdx).get(), hessianIdxStr(), 0, 0, nRows, nRows);
     }
     return s;
 }
 
+/**
+* Checks the result of the Objective function
+* \param[in] input   %Input of the algorithm
+* \param[in] par     %Parameter of algorithm
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    DAAL_CHECK(Argument::size() == 9, services::ErrorIncorrectNumberOfArguments);
+    return checkResult(*this, input, par);
+}
+
 } // namespace interface1
+
+namespace interface2
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OBJECTIVE_FUNCTION_RESULT_V2_ID);
+
+/** Default constructor */
+Result::Result() : interface1::Result(lastResultId + 1) {}
+
+/**
+* Checks the result of the Objective function
+* \param[in] input   %Input of the algorithm
+* \param[in] par     %Parameter of algorithm
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    using namespace services;
+
+    DAAL_CHECK(Argument::size() == 10, ErrorIncorrectNumberOfArguments);
+
+    services::Status s = interface1::checkResult(*this, input, par);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    if (algParameter->resultsToCompute & hessianVectorProduct)
+    {
+        const size_t nRows = static_cast<const Input *>(input)->get(argument)->getNumberOfRows();
+        s |= checkNumericTable(get(hessianVectorProductIdx).get(), hessianVectorProductIdxStr(), 0, 0, 1, nRows);
+    }
+    return s;
+}
+
+} // namespace interface2
 } // namespace objective_function
 } // namespace optimization_solver
 } // namespace algorithms
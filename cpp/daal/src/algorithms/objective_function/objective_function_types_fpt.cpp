@@ -120,6 +120,14 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
         DAAL_CHECK_STATUS_VAR(status);
         Argument::set(componentOfProximalProjectionIdx, staticPointerCast<NumericTable, SerializationIface>(nt));
     }
+    /* The product of the hessian and the direction vector is stored in the results of the second interface only */
+    if (algParameter->resultsToCompute & hessianVectorProduct && Argument::size() > hessianVectorProductIdx
+        && !Argument::get(hessianVectorProductIdx))
+    {
+        NumericTablePtr nt = NumericTablePtr(HomogenNumericTable<algorithmFPType>::create(1, nRows, NumericTable::doAllocate, zero, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        Argument::set(hessianVectorProductIdx, staticPointerCast<NumericTable, SerializationIface>(nt));
+    }
     return status;
 }
 
@@ -96,11 +96,44 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     DAAL_CHECK(algParameter != 0, ErrorNullParameterNotSupported);
 
     services::Status s = checkNumericTable(get(argument).get(), argumentStr(), 0, 0, 1);
+    DAAL_CHECK_STATUS_VAR(s);
 
+    /* The direction of the Hessian-vector product is available in the parameters of the latest interface only */
+    const interface3::Parameter * hvParameter = dynamic_cast<const interface3::Parameter *>(par);
+    if (hvParameter && (hvParameter->resultsToCompute & objective_function::hessianVectorProduct))
+    {
+        const size_t nRows = get(argument)->getNumberOfRows();
+        s |= checkNumericTable(hvParameter->hessianVectorDirection.get(), hessianVectorDirectionStr(), 0, 0, 1, nRows);
+    }
     return s;
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+Parameter::Parameter(size_t numberOfTerms, data_management::NumericTablePtr batchIndices, const DAAL_UINT64 resultsToCompute)
+    : interface2::Parameter(numberOfTerms, batchIndices, resultsToCompute), hessianVectorDirection()
+{}
+
+Parameter::Parameter(const Parameter & other) : interface2::Parameter(other), hessianVectorDirection(other.hessianVectorDirection) {}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter::check() const
+{
+    services::Status s = interface2::Parameter::check();
+    DAAL_CHECK_STATUS_VAR(s);
+    if (resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        DAAL_CHECK_EX(hessianVectorDirection.get() != NULL, ErrorNullNumericTable, ArgumentName, hessianVectorDirectionStr());
+        DAAL_CHECK_EX(hessianVectorDirection->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, hessianVectorDirectionStr());
+    }
+    return s;
+}
+
+} // namespace interface3
 } // namespace sum_of_functions
 } // namespace optimization_solver
 } // namespace algorithms
@@ -36,7 +36,7 @@ namespace optimization_solver
 {
 namespace coordinate_descent
 {
-namespace interface1
+namespace interface2
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -74,7 +74,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                        proxResultPtr);
 }
 
-} // namespace interface1
+} // namespace interface2
 } // namespace coordinate_descent
 } // namespace optimization_solver
 } // namespace algorithms
@@ -22,6 +22,7 @@
 #include "src/algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch_container.h"
 #include "src/algorithms/optimization_solver/coordinate_descent/coordinate_descent_dense_default_kernel.h"
 #include "src/algorithms/optimization_solver/coordinate_descent/coordinate_descent_dense_default_impl.i"
+#include "src/algorithms/optimization_solver/coordinate_descent/coordinate_descent_dense_parallel_impl.i"
 
 namespace daal
 {
@@ -31,7 +32,7 @@ namespace optimization_solver
 {
 namespace coordinate_descent
 {
-namespace interface1
+namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 }
@@ -32,7 +32,7 @@ namespace optimization_solver
 {
 namespace coordinate_descent
 {
-namespace interface1
+namespace interface2
 {
 using BatchType = Batch<DAAL_FPTYPE, optimization_solver::coordinate_descent::defaultDense>;
 
@@ -55,7 +55,7 @@ services::SharedPtr<BatchType> BatchType::create()
 {
     return services::SharedPtr<BatchType>(new BatchType());
 }
-} // namespace interface1
+} // namespace interface2
 } // namespace coordinate_descent
 } // namespace optimization_solver
 } // namespace algorithms
@@ -47,6 +47,22 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
 
+/**
+ *  Reads the parameters of the mean squared error objective function if the parameter of the function has the given interface
+ */
+template <typename MSEParameterType>
+bool getMSEParameters(const sum_of_functions::Batch & function, MSEParameters & mseParameters)
+{
+    const MSEParameterType * const mseParameter = dynamic_cast<const MSEParameterType *>(function.sumOfFunctionsParameter);
+    if (!mseParameter) return false;
+
+    mseParameters.interceptFlag = mseParameter->interceptFlag;
+    mseParameters.penaltyL1     = mseParameter->penaltyL1;
+    mseParameters.penaltyL2     = mseParameter->penaltyL2;
+    mseParameters.batchIndices  = mseParameter->batchIndices;
+    return true;
+}
+
 /**
  *  \Kernel for CoordinateDescent calculation
  */
@@ -78,6 +94,22 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
                                                          nRowsArgument * nColsArgument * sizeof(algorithmFPType));
     DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
 
+    if (parameter->nParallelCoordinates > 1)
+    {
+        const mse::Input * const mseInput = dynamic_cast<const mse::Input *>(parameter->function->sumOfFunctionsInput);
+
+        MSEParameters mseParameter;
+        const bool isMSE = getMSEParameters<mse::interface3::Parameter>(*parameter->function, mseParameter)
+                           || getMSEParameters<mse::interface2::Parameter>(*parameter->function, mseParameter);
+        if (mseInput && isMSE && !mseInput->get(mse::weights) && !mseParameter.batchIndices)
+        {
+            size_t itr = 0;
+            DAAL_CHECK_STATUS(s, computeParallel(*mseInput, mseParameter, workValue, nRowsArgument, nColsArgument, *parameter, engine, itr));
+            *nIter = itr + 1;
+            return s;
+        }
+    }
+
     sum_of_functions::BatchPtr gradientHessianFunction = parameter->function->clone();
     const size_t maxIterations                         = parameter->nIterations;
 
@@ -23,6 +23,7 @@
 #define __COORDINATE_DESCENT_DENSE_DEFAULT_KERNEL_H__
 
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
+#include "algorithms/optimization_solver/objective_function/mse_types.h"
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
 #include "src/externals/service_math.h"
@@ -42,6 +43,18 @@ namespace coordinate_descent
 {
 namespace internal
 {
+/**
+ *  Parameters of the mean squared error objective function used by the parallel coordinate descent,
+ *  common to all interfaces of the mean squared error parameter
+ */
+struct MSEParameters
+{
+    bool interceptFlag;
+    NumericTablePtr penaltyL1;
+    NumericTablePtr penaltyL2;
+    NumericTablePtr batchIndices;
+};
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 class CoordinateDescentKernel : public Kernel
 {
@@ -49,6 +62,11 @@ public:
     services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
                              Parameter * parameter, engines::BatchBase & engine, optimization_solver::objective_function::ResultPtr & hesGr,
                              optimization_solver::objective_function::ResultPtr & prox);
+
+protected:
+    services::Status computeParallel(const mse::Input & mseInput, const MSEParameters & mseParameter, algorithmFPType * workValue,
+                                     size_t nRowsArgument, size_t nColsArgument, const Parameter & parameter, engines::BatchBase & engine,
+                                     size_t & nIterations);
 };
 
 } // namespace internal
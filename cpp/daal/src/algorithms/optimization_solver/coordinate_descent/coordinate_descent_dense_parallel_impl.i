@@ -0,0 +1,424 @@
+/* file: coordinate_descent_dense_parallel_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parallel coordinate descent for the mean squared error
+//  objective function 1/(2n) ||y - X b - b0||^2 + l1 ||b||_1 + l2/2 ||b||^2.
+//  The features are split into disjoint blocks. In every round each block computes
+//  the update of one of its coordinates for the residual of the previous round,
+//  the updates of all blocks are computed concurrently and merged into the residual
+//  at the end of the round.
+//  Concurrent updates of correlated features can overshoot. The safe mode scales
+//  the merged update u = X d by the step t from (0, 1] that minimizes the upper bound
+//      F(b + t d) <= F(b) - t a + t^2 ||u||^2 / (2n),
+//      a = r^T u / n - (G(b + d) - G(b)),
+//  where G is the regularization term. Every coordinate update minimizes the objective
+//  along its coordinate, so a > 0 and every round decreases the objective function.
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_DENSE_PARALLEL_IMPL_I__
+#define __COORDINATE_DESCENT_DENSE_PARALLEL_IMPL_I__
+
+#include "src/algorithms/service_column_major.h"
+#include "src/algorithms/service_threading.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace internal
+{
+/**
+ *  Returns the value of the coordinate that minimizes the objective function along the coordinate,
+ *  the same update as the sequential coordinate descent computes from the gradient and the hessian diagonal
+ *  \param[in] value        Current value of the coordinate
+ *  \param[in] correlation  x_j^T r / n for the current residual r
+ *  \param[in] hessian      x_j^T x_j / n
+ */
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType updateCoordinate(algorithmFPType value, algorithmFPType correlation, algorithmFPType hessian, algorithmFPType l1,
+                                        algorithmFPType l2, bool positive)
+{
+    algorithmFPType prox = value + correlation / hessian;
+    if (positive && prox < 0) prox = 0;
+
+    const algorithmFPType argument = hessian * prox;
+    algorithmFPType result         = 0;
+    if (argument > l1) result = argument - l1;
+    if (argument < -l1) result = argument + l1;
+    if (l2) result *= algorithmFPType(1) / (algorithmFPType(1) + l2 / hessian);
+    return result / hessian;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType penaltyValue(algorithmFPType value, algorithmFPType l1, algorithmFPType l2)
+{
+    return l1 * Math<algorithmFPType, cpu>::sFabs(value) + algorithmFPType(0.5) * l2 * value * value;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status readPenalty(const NumericTablePtr & penaltyTable, algorithmFPType & penalty)
+{
+    penalty = 0;
+    if (!penaltyTable) return services::Status();
+    ReadRows<algorithmFPType, cpu> penaltyBD(*penaltyTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(penaltyBD);
+    penalty = penaltyBD.get()[0];
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::computeParallel(const mse::Input & mseInput,
+                                                                                        const MSEParameters & mseParameter,
+                                                                                        algorithmFPType * workValue, size_t nRowsArgument,
+                                                                                        size_t nColsArgument, const Parameter & parameter,
+                                                                                        engines::BatchBase & engine, size_t & nIterations)
+{
+    services::Status s;
+    NumericTablePtr xTable = mseInput.get(mse::data);
+    NumericTablePtr yTable = mseInput.get(mse::dependentVariables);
+    DAAL_CHECK(xTable && yTable, services::ErrorNullInputNumericTable);
+
+    const size_t nRows      = xTable->getNumberOfRows();
+    const size_t nFeatures  = xTable->getNumberOfColumns();
+    const size_t nResponses = nColsArgument;
+    DAAL_CHECK(nFeatures + 1 == nRowsArgument, services::ErrorIncorrectNumberOfFeatures);
+    DAAL_CHECK(yTable->getNumberOfRows() == nRows, services::ErrorInconsistentNumberOfRows);
+    DAAL_CHECK(yTable->getNumberOfColumns() == nResponses, services::ErrorIncorrectNumberOfColumns);
+
+    algorithmFPType l1 = 0;
+    algorithmFPType l2 = 0;
+    DAAL_CHECK_STATUS(s, (readPenalty<algorithmFPType, cpu>(mseParameter.penaltyL1, l1)));
+    DAAL_CHECK_STATUS(s, (readPenalty<algorithmFPType, cpu>(mseParameter.penaltyL2, l2)));
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nResponses);
+    TArray<algorithmFPType, cpu> xtArray(nRows * nFeatures);
+    TArray<algorithmFPType, cpu> hessianArray(nFeatures);
+    TArray<algorithmFPType, cpu> residualArray(nRows * nResponses);
+    DAAL_CHECK_MALLOC(xtArray.get() && hessianArray.get() && residualArray.get());
+    algorithmFPType * const xt       = xtArray.get();
+    algorithmFPType * const hessian  = hessianArray.get();
+    algorithmFPType * const residual = residualArray.get();
+
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::copyToColumnMajor<algorithmFPType, cpu>(*xTable, xt)));
+
+    const DAAL_INT n                    = (DAAL_INT)nRows;
+    const DAAL_INT one                  = 1;
+    const algorithmFPType inversedNRows = algorithmFPType(1) / algorithmFPType(nRows);
+    daal::threader_for(nFeatures, nFeatures, [&](const size_t j) {
+        const algorithmFPType * const xj = xt + j * nRows;
+        hessian[j]                       = Blas<algorithmFPType, cpu>::xxdot(&n, xj, &one, xj, &one) * inversedNRows;
+    });
+
+    const bool fitIntercept = !parameter.skipTheFirstComponents && mseParameter.interceptFlag;
+    const size_t blockSize  = 256;
+    size_t nRowBlocks       = nRows / blockSize;
+    nRowBlocks += (nRowBlocks * blockSize != nRows);
+
+    /* The residual is stored by dependent variables, r_k = y_k - X b_k - b0_k */
+    {
+        ReadRows<algorithmFPType, cpu> yBD(*yTable, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(yBD);
+        const algorithmFPType * const y = yBD.get();
+
+        daal::threader_for(nRowBlocks, nRowBlocks, [&](const size_t iBlock) {
+            const size_t startRow = iBlock * blockSize;
+            const size_t endRow   = (iBlock + 1 == nRowBlocks ? nRows : startRow + blockSize);
+            for (size_t k = 0; k < nResponses; ++k)
+            {
+                algorithmFPType * const r        = residual + k * nRows;
+                const algorithmFPType interceptK = mseParameter.interceptFlag ? workValue[k] : algorithmFPType(0);
+                for (size_t i = startRow; i < endRow; ++i)
+                {
+                    r[i] = y[i * nResponses + k] - interceptK;
+                }
+                for (size_t j = 0; j < nFeatures; ++j)
+                {
+                    const algorithmFPType bj = workValue[(j + 1) * nResponses + k];
+                    if (bj == 0) continue;
+                    const algorithmFPType * const xj = xt + j * nRows;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = startRow; i < endRow; ++i)
+                    {
+                        r[i] -= bj * xj[i];
+                    }
+                }
+            }
+        });
+    }
+
+    const size_t nBlocks      = (parameter.nParallelCoordinates < nFeatures ? parameter.nParallelCoordinates : nFeatures);
+    const size_t maxBlockSize = nFeatures / nBlocks + (nFeatures % nBlocks != 0);
+    DAAL_CHECK(maxBlockSize <= services::internal::MaxVal<int>::get(), services::ErrorIncorrectParameter);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBlocks, nResponses);
+    TArray<size_t, cpu> selectedArray(nBlocks);
+    TArray<int, cpu> randomArray(parameter.selection == random ? nBlocks : 0);
+    TArray<algorithmFPType, cpu> deltaArray(nBlocks * nResponses);
+    TArray<algorithmFPType, cpu> penaltyDiffArray(nBlocks * nResponses);
+    TArray<algorithmFPType, cpu> directionArray(parameter.safeParallelUpdates ? nRows * nResponses : 0);
+    TArray<algorithmFPType, cpu> stepArray(nResponses);
+    TArray<algorithmFPType, cpu> productsArray(2 * nResponses);
+    DAAL_CHECK_MALLOC(selectedArray.get() && deltaArray.get() && penaltyDiffArray.get() && stepArray.get() && productsArray.get());
+    DAAL_CHECK_MALLOC(parameter.selection != random || randomArray.get());
+    DAAL_CHECK_MALLOC(!parameter.safeParallelUpdates || directionArray.get());
+    size_t * const selected             = selectedArray.get();
+    int * const randomIndices           = randomArray.get();
+    algorithmFPType * const delta       = deltaArray.get();
+    algorithmFPType * const penaltyDiff = penaltyDiffArray.get();
+    algorithmFPType * const direction   = directionArray.get();
+    algorithmFPType * const step        = stepArray.get();
+    algorithmFPType * const products    = productsArray.get();
+
+    const algorithmFPType accuracyThreshold = parameter.accuracyThreshold;
+    const size_t maxIterations              = parameter.nIterations;
+    const bool positive                     = parameter.positive;
+
+    algorithmFPType maxDiff  = 0;
+    algorithmFPType maxValue = 0;
+    for (nIterations = 0; nIterations < maxIterations; nIterations++)
+    {
+        if (!parameter.skipTheFirstComponents)
+        {
+            /* The intercept is updated once per iteration, its hessian is 1 if the intercept is computed and 0 otherwise */
+            for (size_t k = 0; k < nResponses; ++k)
+            {
+                algorithmFPType * const r  = residual + k * nRows;
+                const algorithmFPType prev = workValue[k];
+                if (fitIntercept)
+                {
+                    algorithmFPType sum = 0;
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < nRows; ++i)
+                    {
+                        sum += r[i];
+                    }
+                    algorithmFPType value = prev + sum * inversedNRows;
+                    if (positive && value < 0) value = 0;
+                    if (l2) value *= algorithmFPType(1) / (algorithmFPType(1) + l2);
+
+                    const algorithmFPType diff = value - prev;
+                    if (diff != 0)
+                    {
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (size_t i = 0; i < nRows; ++i)
+                        {
+                            r[i] -= diff;
+                        }
+                    }
+                    workValue[k] = value;
+                }
+                const algorithmFPType diff  = Math<algorithmFPType, cpu>::sFabs(workValue[k] - prev);
+                const algorithmFPType value = Math<algorithmFPType, cpu>::sFabs(workValue[k]);
+                maxDiff                     = diff > maxDiff ? diff : maxDiff;
+                maxValue                    = value > maxValue ? value : maxValue;
+            }
+        }
+
+        for (size_t iRound = 0; iRound < maxBlockSize; ++iRound)
+        {
+            if (parameter.selection == random)
+            {
+                DAAL_CHECK_STATUS(s, (IterativeSolverKernel<algorithmFPType, cpu>::getRandom(0, (int)maxBlockSize, randomIndices, (int)nBlocks,
+                                                                                            engine)));
+            }
+
+            size_t nSelected = 0;
+            for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                const size_t blockBegin = iBlock * nFeatures / nBlocks;
+                const size_t blockSizeB = (iBlock + 1) * nFeatures / nBlocks - blockBegin;
+                if (parameter.selection == random)
+                {
+                    selected[nSelected++] = blockBegin + (size_t)randomIndices[iBlock] % blockSizeB;
+                }
+                else if (iRound < blockSizeB)
+                {
+                    selected[nSelected++] = blockBegin + iRound;
+                }
+            }
+
+            /* The updates of the selected coordinates are computed for the same residual */
+            daal::threader_for(nSelected, nSelected, [&](const size_t iSelected) {
+                const size_t j                   = selected[iSelected];
+                const algorithmFPType * const xj = xt + j * nRows;
+                for (size_t k = 0; k < nResponses; ++k)
+                {
+                    delta[iSelected * nResponses + k]       = 0;
+                    penaltyDiff[iSelected * nResponses + k] = 0;
+                    if (hessian[j] == 0) continue;
+
+                    const algorithmFPType prev        = workValue[(j + 1) * nResponses + k];
+                    const algorithmFPType correlation = Blas<algorithmFPType, cpu>::xxdot(&n, xj, &one, residual + k * nRows, &one) * inversedNRows;
+                    const algorithmFPType value       = updateCoordinate<algorithmFPType, cpu>(prev, correlation, hessian[j], l1, l2, positive);
+                    delta[iSelected * nResponses + k] = value - prev;
+                    penaltyDiff[iSelected * nResponses + k] =
+                        penaltyValue<algorithmFPType, cpu>(value, l1, l2) - penaltyValue<algorithmFPType, cpu>(prev, l1, l2);
+                }
+            });
+
+            for (size_t k = 0; k < nResponses; ++k)
+            {
+                step[k] = 1;
+            }
+
+            if (parameter.safeParallelUpdates)
+            {
+                /* Direction u = X d and the products r^T u, u^T u */
+                TlsSum<algorithmFPType, cpu> productsTls(2 * nResponses);
+                daal::threader_for(nRowBlocks, nRowBlocks, [&](const size_t iBlock) {
+                    algorithmFPType * const localProducts = productsTls.local();
+                    const size_t startRow                 = iBlock * blockSize;
+                    const size_t endRow                   = (iBlock + 1 == nRowBlocks ? nRows : startRow + blockSize);
+                    for (size_t k = 0; k < nResponses; ++k)
+                    {
+                        algorithmFPType * const u       = direction + k * nRows;
+                        const algorithmFPType * const r = residual + k * nRows;
+                        for (size_t i = startRow; i < endRow; ++i)
+                        {
+                            u[i] = 0;
+                        }
+                        for (size_t iSelected = 0; iSelected < nSelected; ++iSelected)
+                        {
+                            const algorithmFPType d = delta[iSelected * nResponses + k];
+                            if (d == 0) continue;
+                            const algorithmFPType * const xj = xt + selected[iSelected] * nRows;
+                            PRAGMA_IVDEP
+                            PRAGMA_VECTOR_ALWAYS
+                            for (size_t i = startRow; i < endRow; ++i)
+                            {
+                                u[i] += d * xj[i];
+                            }
+                        }
+                        algorithmFPType ru = 0;
+                        algorithmFPType uu = 0;
+                        PRAGMA_VECTOR_ALWAYS
+                        for (size_t i = startRow; i < endRow; ++i)
+                        {
+                            ru += r[i] * u[i];
+                            uu += u[i] * u[i];
+                        }
+                        localProducts[2 * k] += ru;
+                        localProducts[2 * k + 1] += uu;
+                    }
+                });
+                daal::services::internal::service_memset<algorithmFPType, cpu>(products, 0, 2 * nResponses);
+                productsTls.reduceTo(products, 2 * nResponses);
+
+                for (size_t k = 0; k < nResponses; ++k)
+                {
+                    algorithmFPType decrease = products[2 * k] * inversedNRows;
+                    for (size_t iSelected = 0; iSelected < nSelected; ++iSelected)
+                    {
+                        decrease -= penaltyDiff[iSelected * nResponses + k];
+                    }
+                    const algorithmFPType curvature = products[2 * k + 1] * inversedNRows;
+                    if (curvature > 0)
+                    {
+                        step[k] = decrease < curvature ? decrease / curvature : algorithmFPType(1);
+                        step[k] = step[k] > 0 ? step[k] : algorithmFPType(0);
+                    }
+                }
+
+                daal::threader_for(nRowBlocks, nRowBlocks, [&](const size_t iBlock) {
+                    const size_t startRow = iBlock * blockSize;
+                    const size_t endRow   = (iBlock + 1 == nRowBlocks ? nRows : startRow + blockSize);
+                    for (size_t k = 0; k < nResponses; ++k)
+                    {
+                        algorithmFPType * const r       = residual + k * nRows;
+                        const algorithmFPType * const u = direction + k * nRows;
+                        const algorithmFPType t         = step[k];
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (size_t i = startRow; i < endRow; ++i)
+                        {
+                            r[i] -= t * u[i];
+                        }
+                    }
+                });
+            }
+            else
+            {
+                daal::threader_for(nRowBlocks, nRowBlocks, [&](const size_t iBlock) {
+                    const size_t startRow = iBlock * blockSize;
+                    const size_t endRow   = (iBlock + 1 == nRowBlocks ? nRows : startRow + blockSize);
+                    for (size_t k = 0; k < nResponses; ++k)
+                    {
+                        algorithmFPType * const r = residual + k * nRows;
+                        for (size_t iSelected = 0; iSelected < nSelected; ++iSelected)
+                        {
+                            const algorithmFPType d = delta[iSelected * nResponses + k];
+                            if (d == 0) continue;
+                            const algorithmFPType * const xj = xt + selected[iSelected] * nRows;
+                            PRAGMA_IVDEP
+                            PRAGMA_VECTOR_ALWAYS
+                            for (size_t i = startRow; i < endRow; ++i)
+                            {
+                                r[i] -= d * xj[i];
+                            }
+                        }
+                    }
+                });
+            }
+
+            for (size_t iSelected = 0; iSelected < nSelected; ++iSelected)
+            {
+                algorithmFPType * const bj = workValue + (selected[iSelected] + 1) * nResponses;
+                for (size_t k = 0; k < nResponses; ++k)
+                {
+                    const algorithmFPType change = step[k] * delta[iSelected * nResponses + k];
+                    bj[k] += change;
+
+                    const algorithmFPType diff  = Math<algorithmFPType, cpu>::sFabs(change);
+                    const algorithmFPType value = Math<algorithmFPType, cpu>::sFabs(bj[k]);
+                    maxDiff                     = diff > maxDiff ? diff : maxDiff;
+                    maxValue                    = value > maxValue ? value : maxValue;
+                }
+            }
+        }
+
+        if (maxDiff <= accuracyThreshold * maxValue)
+        {
+            break;
+        }
+        maxValue = 0;
+        maxDiff  = 0;
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace coordinate_descent
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
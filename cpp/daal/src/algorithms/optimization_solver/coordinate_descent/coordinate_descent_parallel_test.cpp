@@ -0,0 +1,198 @@
+/* file: coordinate_descent_parallel_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
+#include "algorithms/optimization_solver/objective_function/mse_batch.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "gtest/gtest.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+namespace coordinate_descent = daal::algorithms::optimization_solver::coordinate_descent;
+namespace iterative_solver   = daal::algorithms::optimization_solver::iterative_solver;
+namespace mse                = daal::algorithms::optimization_solver::mse;
+
+namespace
+{
+const size_t nRows        = 300;
+const size_t nFeatures    = 12;
+const size_t nIterations  = 20000;
+const double accuracy     = 1.0e-12;
+const double penaltyL1    = 0.01;
+const size_t nParallel    = 4;
+const double solutionEps  = 1.0e-6;
+const unsigned int dataId = 17;
+
+/*
+ * Mean squared error objective function that counts its copies. The sequential coordinate descent computes
+ * the components of the gradient with a copy of the objective function, the parallel one does not copy it.
+ */
+template <typename MSEBatch>
+class CountingMSE : public MSEBatch
+{
+public:
+    CountingMSE(size_t numberOfTerms, size_t * nCopies) : MSEBatch(numberOfTerms), _nCopies(nCopies) {}
+    CountingMSE(const CountingMSE & other) : MSEBatch(other), _nCopies(other._nCopies) {}
+
+protected:
+    CountingMSE * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        ++*_nCopies;
+        return new CountingMSE(*this);
+    }
+
+private:
+    size_t * _nCopies;
+};
+
+NumericTablePtr createTable(const std::vector<double> & values, size_t nColumns)
+{
+    const size_t n = values.size() / nColumns;
+    NumericTablePtr table(new HomogenNumericTable<double>(nColumns, n, NumericTable::doAllocate));
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, n, writeOnly, block);
+    for (size_t i = 0; i < values.size(); i++) block.getBlockPtr()[i] = values[i];
+    table->releaseBlockOfRows(block);
+    return table;
+}
+
+std::vector<double> readRows(const NumericTablePtr & table)
+{
+    const size_t n = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, n, readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + n * table->getNumberOfColumns());
+    table->releaseBlockOfRows(block);
+    return values;
+}
+
+/* Returns the data set with a sparse linear dependency and a small noise */
+void generateData(NumericTablePtr & data, NumericTablePtr & dependentVariables)
+{
+    std::vector<double> x(nRows * nFeatures), y(nRows, 0.5);
+    unsigned int state = dataId;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            state                = state * 1664525u + 1013904223u;
+            x[i * nFeatures + j] = double((state >> 8) % 2001) / 1000.0 - 1.0;
+            if (j % 3 == 0) y[i] += double(j / 3 + 1) * x[i * nFeatures + j];
+        }
+        state = state * 1664525u + 1013904223u;
+        y[i] += 0.01 * (double((state >> 8) % 2001) / 1000.0 - 1.0);
+    }
+    data               = createTable(x, nFeatures);
+    dependentVariables = createTable(y, 1);
+}
+
+template <typename MSEBatch>
+services::SharedPtr<CountingMSE<MSEBatch> > createFunction(size_t * nCopies)
+{
+    NumericTablePtr data, dependentVariables;
+    generateData(data, dependentVariables);
+
+    services::SharedPtr<CountingMSE<MSEBatch> > function(new CountingMSE<MSEBatch>(nRows, nCopies));
+    function->input.set(mse::data, data);
+    function->input.set(mse::dependentVariables, dependentVariables);
+    function->parameter().penaltyL1 = NumericTablePtr(new HomogenNumericTable<double>(1, 1, NumericTable::doAllocate, penaltyL1));
+    return function;
+}
+
+template <typename SolverBatch>
+std::vector<double> solve(SolverBatch & solver, const optimization_solver::sum_of_functions::BatchPtr & function)
+{
+    solver.parameter().function          = function;
+    solver.parameter().nIterations       = nIterations;
+    solver.parameter().accuracyThreshold = accuracy;
+    NumericTablePtr initialPoint(new HomogenNumericTable<double>(1, nFeatures + 1, NumericTable::doAllocate, 0.0));
+    solver.input.set(iterative_solver::inputArgument, initialPoint);
+    EXPECT_TRUE(solver.compute().ok());
+    return readRows(solver.getResult()->get(iterative_solver::minimum));
+}
+
+std::vector<double> solveSequential()
+{
+    size_t nCopies = 0;
+    coordinate_descent::Batch<double> solver;
+    const std::vector<double> minimum = solve(solver, createFunction<mse::Batch<double> >(&nCopies));
+    EXPECT_GT(nCopies, size_t(0));
+    return minimum;
+}
+
+void expectNear(const std::vector<double> & actual, const std::vector<double> & expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_NEAR(actual[i], expected[i], solutionEps * (1.0 + std::fabs(expected[i]))) << "component " << i;
+    }
+}
+
+template <typename MSEBatch>
+void checkParallelPathRuns(bool safeParallelUpdates)
+{
+    size_t nCopies = 0;
+    coordinate_descent::Batch<double> solver;
+    solver.parameter().nParallelCoordinates = nParallel;
+    solver.parameter().safeParallelUpdates  = safeParallelUpdates;
+    const std::vector<double> minimum       = solve(solver, createFunction<MSEBatch>(&nCopies));
+
+    EXPECT_EQ(nCopies, size_t(0));
+    expectNear(minimum, solveSequential());
+}
+} // namespace
+
+TEST(coordinate_descent_parallel_test, parallel_path_runs_for_mse)
+{
+    checkParallelPathRuns<mse::Batch<double> >(true);
+    checkParallelPathRuns<mse::Batch<double> >(false);
+}
+
+TEST(coordinate_descent_parallel_test, parallel_path_runs_for_previous_mse_interface)
+{
+    checkParallelPathRuns<mse::interface2::Batch<double> >(true);
+}
+
+TEST(coordinate_descent_parallel_test, weights_select_sequential_path)
+{
+    size_t nCopies                                                  = 0;
+    services::SharedPtr<CountingMSE<mse::Batch<double> > > function = createFunction<mse::Batch<double> >(&nCopies);
+    function->input.set(mse::weights, NumericTablePtr(new HomogenNumericTable<double>(1, nRows, NumericTable::doAllocate, 1.0)));
+
+    coordinate_descent::Batch<double> solver;
+    solver.parameter().nParallelCoordinates = nParallel;
+    const std::vector<double> minimum       = solve(solver, function);
+
+    EXPECT_GT(nCopies, size_t(0));
+    expectNear(minimum, solveSequential());
+}
+
+TEST(coordinate_descent_parallel_test, previous_solver_interface_is_sequential)
+{
+    size_t nCopies = 0;
+    coordinate_descent::interface1::Batch<double> solver;
+    const std::vector<double> minimum = solve(solver, createFunction<mse::Batch<double> >(&nCopies));
+
+    EXPECT_GT(nCopies, size_t(0));
+    expectNear(minimum, solveSequential());
+}
@@ -0,0 +1,43 @@
+/* file: coordinate_descent_dense_default_batch_v1_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Instantiation of coordinate_descent computation functions for specific CPUs.
+//--
+
+#include "src/algorithms/optimization_solver/coordinate_descent/inner/coordinate_descent_batch_container_v1.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+
+} // namespace coordinate_descent
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
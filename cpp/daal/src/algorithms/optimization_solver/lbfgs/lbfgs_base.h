@@ -29,6 +29,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_rng.h"
 #include "src/algorithms/engines/engine_batch_impl.h"
+#include "src/algorithms/optimization_solver/objective_function_reducer.h"
 
 namespace daal
 {
@@ -202,6 +203,8 @@ public:
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > argumentLCurTable;
     /** Correction pair batch indices block descriptor */
     ReadRows<int, cpu> mtCorrectionPairBatchIndices;
+    /** Averages the results of the objective function over the ranks of the communicator */
+    iterative_solver::internal::ObjectiveFunctionReducer<algorithmFPType, cpu> reducer;
 
 private:
     /** Step-length sequence block descriptor*/
@@ -34,7 +34,7 @@ namespace optimization_solver
 {
 namespace lbfgs
 {
-namespace interface2
+namespace interface3
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -76,7 +76,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                        optionalArgumentResult, parameter, *parameter->engine);
 }
 
-} // namespace interface2
+} // namespace interface3
 } // namespace lbfgs
 
 } // namespace optimization_solver
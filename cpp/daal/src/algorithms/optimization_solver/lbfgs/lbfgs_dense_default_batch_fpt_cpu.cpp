@@ -31,7 +31,7 @@ namespace optimization_solver
 {
 namespace lbfgs
 {
-namespace interface2
+namespace interface3
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 }
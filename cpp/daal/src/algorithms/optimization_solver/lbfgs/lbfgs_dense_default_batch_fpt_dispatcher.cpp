@@ -31,7 +31,7 @@ namespace optimization_solver
 {
 namespace lbfgs
 {
-namespace interface2
+namespace interface3
 {
 using BatchType = Batch<DAAL_FPTYPE, optimization_solver::lbfgs::defaultDense>;
 
@@ -40,7 +40,7 @@ services::SharedPtr<BatchType> BatchType::create()
 {
     return services::SharedPtr<BatchType>(new BatchType());
 }
-} // namespace interface2
+} // namespace interface3
 } // namespace lbfgs
 } // namespace optimization_solver
 
@@ -88,8 +88,10 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
     const size_t correctionPairBatchSize = ((parameter->correctionPairBatchSize < nTerms) ? parameter->correctionPairBatchSize : nTerms);
     const bool useWolfeConditions        = (batchSize == nTerms && correctionPairBatchSize == nTerms && L == 1);
     LBFGSTask<algorithmFPType, cpu> task(parameter, minimum);
-    DAAL_CHECK_STATUS(s, task.init(inputArgument, correctionPairsInput, averageArgLIterInput, optionalArgumentInput, parameter, minimum,
-                                   averageArgLIterResult, correctionPairsResult, nTerms, batchSize, correctionPairBatchSize));
+    s = task.init(inputArgument, correctionPairsInput, averageArgLIterInput, optionalArgumentInput, parameter, minimum, averageArgLIterResult,
+                  correctionPairsResult, nTerms, batchSize, correctionPairBatchSize);
+    /* A rank that fails or is cancelled still joins the reductions, so that all ranks stop together */
+    DAAL_CHECK_STATUS(s, task.reducer.reduceStatus(s));
 
     NumericTablePtr argumentTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(task.argument, 1, task.argumentSize, s));
     gradientFunction->sumOfFunctionsParameter->batchIndices     = task.ntBatchIndices;
@@ -167,15 +169,23 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
 
             if (!useWolfeConditions)
             {
-                DAAL_CHECK_STATUS(
-                    s, task.updateCorrectionPairBatchIndices(iPredefinedIndicesCorrectionRow, nTerms, correctionPairBatchSize, engineImpl));
+                s = task.updateCorrectionPairBatchIndices(iPredefinedIndicesCorrectionRow, nTerms, correctionPairBatchSize, engineImpl);
             }
             iPredefinedIndicesCorrectionRow++;
-            if (!useWolfeConditions)
+            if (s && !useWolfeConditions)
             {
                 s = hessianFunction->computeNoThrow();
             }
-            if (!s || host.isCancelled(s, 1))
+            if (s) host.isCancelled(s, 1);
+            if (!useWolfeConditions)
+            {
+                s = task.reducer.reduce(hessianFunction->getResult(), objective_function::hessian, correctionPairBatchSize, s);
+            }
+            else
+            {
+                s = task.reducer.reduceStatus(s);
+            }
+            if (!s)
             {
                 s |= task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch, correctionIndex);
                 return s;
@@ -441,7 +451,9 @@ algorithmFPType LBFGSTask<algorithmFPType, cpu>::lineSearch(algorithmFPType * x,
         DAAL_INT nCasted = static_cast<DAAL_INT>(n);
         Blas<algorithmFPType, cpu>::xxaxpy(&nCasted, &stepLength, dn, &one, x, &one);
 
-        DAAL_CHECK_STATUS(s, gradientFunction->computeNoThrow());
+        s = gradientFunction->computeNoThrow();
+        DAAL_CHECK_STATUS(s, reducer.reduce(gradientFunction->getResult(), gradientFunction->sumOfFunctionsParameter->resultsToCompute,
+                                            gradientFunction->sumOfFunctionsParameter->numberOfTerms, s));
 
         ntNewGradient = gradientFunction->getResult()->get(objective_function::gradientIdx);
         ntNewValue    = gradientFunction->getResult()->get(objective_function::valueIdx);
@@ -595,16 +607,17 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration, size_t
     algorithmFPType * gradientCurr = (algorithmFPType *)_gradientCurrPtr.get();
     if (!useWolfeConditions)
     {
-        DAAL_CHECK_STATUS(
-            s, updateBatchIndices(iIteration, nTerms, batchSize, batchIndices, batchIndicesStatus, mtBatchIndices, ntBatchIndices, engine));
+        s = updateBatchIndices(iIteration, nTerms, batchSize, batchIndices, batchIndicesStatus, mtBatchIndices, ntBatchIndices, engine);
     }
     else
     {
         result |= daal::services::internal::daal_memcpy_s(gradientPrev, this->argumentSize * sizeof(algorithmFPType), gradientCurr,
                                                           this->argumentSize * sizeof(algorithmFPType));
-        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        if (result) s = Status(services::ErrorMemoryCopyFailedInternal);
     }
-    DAAL_CHECK_STATUS(s, gradientFunction->compute());
+    /* A rank that failed still joins the reduction, so that all ranks stop together */
+    if (s) s = gradientFunction->computeNoThrow();
+    DAAL_CHECK_STATUS(s, reducer.reduce(gradientFunction->getResult(), gradientFunction->sumOfFunctionsParameter->resultsToCompute, batchSize, s));
     if (batchIndicesStatus == user)
     {
         mtBatchIndices.release();
@@ -987,7 +1000,8 @@ LBFGSTask<algorithmFPType, cpu>::LBFGSTask(const Parameter * parameter, NumericT
       correctionPairBatchIndices(nullptr),
       correctionPairBatchIndicesStatus(all),
       nStepLength(parameter->stepLengthSequence->getNumberOfColumns()),
-      _rng()
+      _rng(),
+      reducer(parameter->communicator, this->argumentSize)
 {}
 
 /**
@@ -1010,7 +1024,8 @@ LBFGSTask<algorithmFPType, cpu>::LBFGSTask(const interface1::Parameter * paramet
       correctionPairBatchIndices(nullptr),
       correctionPairBatchIndicesStatus(all),
       nStepLength(parameter->stepLengthSequence->getNumberOfColumns()),
-      _rng()
+      _rng(),
+      reducer(services::SharedPtr<daal::preview::services::Communicator>(), this->argumentSize)
 {}
 /**
 * Initializes the task for itermediate computations in LBFGS algorithm
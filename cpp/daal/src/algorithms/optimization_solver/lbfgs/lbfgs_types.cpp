@@ -254,6 +254,17 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+Parameter::Parameter(sum_of_functions::BatchPtr function, size_t nIterations, double accuracyThreshold, size_t batchSize,
+                     size_t correctionPairBatchSize, size_t m, size_t L, size_t seed)
+    : interface2::Parameter(function, nIterations, accuracyThreshold, batchSize, correctionPairBatchSize, m, L, seed)
+{}
+
+Parameter::Parameter(const interface2::Parameter & other) : interface2::Parameter(other) {}
+
+} // namespace interface3
 } // namespace lbfgs
 } // namespace optimization_solver
 } // namespace algorithms
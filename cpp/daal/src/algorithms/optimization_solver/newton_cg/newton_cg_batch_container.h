@@ -0,0 +1,77 @@
+/* file: newton_cg_batch_container.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of newton_cg calculation algorithm container.
+//--
+*/
+
+#ifndef __NEWTON_CG_BATCH_CONTAINER_H__
+#define __NEWTON_CG_BATCH_CONTAINER_H__
+
+#include "algorithms/optimization_solver/newton_cg/newton_cg_batch.h"
+#include "src/algorithms/optimization_solver/newton_cg/newton_cg_dense_default_kernel.h"
+#include "src/services/service_algo_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace interface1
+{
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::NewtonCGKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input         = static_cast<Input *>(_in);
+    Result * result       = static_cast<Result *>(_res);
+    Parameter * parameter = static_cast<Parameter *>(_par);
+
+    daal::services::Environment::env & env = *_env;
+
+    NumericTable * inputArgument = input->get(iterative_solver::inputArgument).get();
+
+    NumericTable * minimum     = result->get(iterative_solver::minimum).get();
+    NumericTable * nIterations = result->get(iterative_solver::nIterations).get();
+
+    __DAAL_CALL_KERNEL(env, internal::NewtonCGKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       daal::services::internal::hostApp(*input), inputArgument, minimum, nIterations, parameter);
+}
+
+} // namespace interface1
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,271 @@
+/* file: newton_cg_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of newton_cg algorithm
+//--
+*/
+
+#ifndef __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+#define __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+
+/* Sufficient decrease constant of the Armijo condition and the maximal number of the step halvings in the line search */
+const double armijoConstant          = 1.0e-04;
+const size_t maxNumberOfStepHalvings = 30;
+
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType dotProduct(size_t n, const algorithmFPType * x, const algorithmFPType * y)
+{
+    const DAAL_INT size = (DAAL_INT)n;
+    const DAAL_INT inc  = 1;
+    return Blas<algorithmFPType, cpu>::xxdot(&size, x, &inc, y, &inc);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+inline void axpy(size_t n, algorithmFPType a, const algorithmFPType * x, algorithmFPType * y)
+{
+    const DAAL_INT size = (DAAL_INT)n;
+    const DAAL_INT inc  = 1;
+    Blas<algorithmFPType, cpu>::xxaxpy(&size, &a, x, &inc, y, &inc);
+}
+
+/**
+ *  \Kernel for NewtonCG calculation
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                       NumericTable * nIterations, Parameter * parameter)
+{
+    services::Status s;
+    const size_t argumentSize = inputArgument->getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> argumentBD(*minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(argumentBD);
+    algorithmFPType * const argument = argumentBD.get();
+
+    WriteRows<algorithmFPType, cpu> nIterationsBD(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    algorithmFPType * const nIter = nIterationsBD.get();
+    *nIter                        = 0;
+
+    {
+        ReadRows<algorithmFPType, cpu> initialPointBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(initialPointBD);
+        int result = daal::services::internal::daal_memcpy_s(argument, argumentSize * sizeof(algorithmFPType), initialPointBD.get(),
+                                                             argumentSize * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    const size_t maxIterations = parameter->nIterations;
+    if (maxIterations == 0) return s;
+
+    /* Trial point of the line search, gradients in the current and in the trial points, Newton direction,
+       residual and direction of the conjugate gradient iterations, hessian-vector product and value in the trial point */
+    const size_t nWorkArrays = 7;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, argumentSize, nWorkArrays);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, argumentSize * nWorkArrays + 1, sizeof(algorithmFPType));
+    TArray<algorithmFPType, cpu> workT(argumentSize * nWorkArrays + 1);
+    DAAL_CHECK_MALLOC(workT.get());
+    algorithmFPType * const trialArgument        = workT.get();
+    algorithmFPType * const gradient             = trialArgument + argumentSize;
+    algorithmFPType * const trialGradient        = gradient + argumentSize;
+    algorithmFPType * const newtonDirection      = trialGradient + argumentSize;
+    algorithmFPType * const residual             = newtonDirection + argumentSize;
+    algorithmFPType * const cgDirection          = residual + argumentSize;
+    algorithmFPType * const hessianVectorProduct = cgDirection + argumentSize;
+    algorithmFPType * const trialValue           = hessianVectorProduct + argumentSize;
+    daal::services::internal::service_memset<algorithmFPType, cpu>(workT.get(), algorithmFPType(0), argumentSize * nWorkArrays + 1);
+
+    NumericTablePtr argumentTable             = HomogenNumericTableCPU<algorithmFPType, cpu>::create(argument, 1, argumentSize, &s);
+    NumericTablePtr trialArgumentTable        = HomogenNumericTableCPU<algorithmFPType, cpu>::create(trialArgument, 1, argumentSize, &s);
+    NumericTablePtr trialGradientTable        = HomogenNumericTableCPU<algorithmFPType, cpu>::create(trialGradient, 1, argumentSize, &s);
+    NumericTablePtr trialValueTable           = HomogenNumericTableCPU<algorithmFPType, cpu>::create(trialValue, 1, 1, &s);
+    NumericTablePtr cgDirectionTable          = HomogenNumericTableCPU<algorithmFPType, cpu>::create(cgDirection, 1, argumentSize, &s);
+    NumericTablePtr hessianVectorProductTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(hessianVectorProduct, 1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The value and the gradient are computed in the trial points of the line search */
+    sum_of_functions::BatchPtr valueGradientFunction = parameter->function->clone();
+    valueGradientFunction->sumOfFunctionsInput->set(sum_of_functions::argument, trialArgumentTable);
+    valueGradientFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::value | objective_function::gradient;
+    objective_function::ResultPtr valueGradientResult(new objective_function::Result());
+    DAAL_CHECK_MALLOC(valueGradientResult.get());
+    valueGradientResult->set(objective_function::valueIdx, trialValueTable);
+    valueGradientResult->set(objective_function::gradientIdx, trialGradientTable);
+    valueGradientFunction->setResult(valueGradientResult);
+    valueGradientFunction->enableChecks(false);
+
+    /* The hessian-vector products are computed in the current point for the directions of the conjugate gradient iterations */
+    sum_of_functions::BatchPtr hessianVectorFunction = parameter->function->clone();
+    sum_of_functions::Parameter * const hessianVectorParameter =
+        dynamic_cast<sum_of_functions::Parameter *>(hessianVectorFunction->sumOfFunctionsParameter);
+    DAAL_CHECK(hessianVectorParameter, services::ErrorIncorrectParameter);
+    hessianVectorFunction->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
+    hessianVectorParameter->resultsToCompute       = objective_function::hessianVectorProduct;
+    hessianVectorParameter->hessianVectorDirection = cgDirectionTable;
+    objective_function::ResultPtr hessianVectorResult(new objective_function::Result());
+    DAAL_CHECK_MALLOC(hessianVectorResult.get());
+    hessianVectorResult->set(objective_function::hessianVectorProductIdx, hessianVectorProductTable);
+    hessianVectorFunction->setResult(hessianVectorResult);
+    hessianVectorFunction->enableChecks(false);
+
+    const size_t argumentSizeInBytes = argumentSize * sizeof(algorithmFPType);
+    int result                       = daal::services::internal::daal_memcpy_s(trialArgument, argumentSizeInBytes, argument, argumentSizeInBytes);
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    DAAL_CHECK_STATUS(s, valueGradientFunction->computeNoThrow());
+    algorithmFPType value = *trialValue;
+    result                = daal::services::internal::daal_memcpy_s(gradient, argumentSizeInBytes, trialGradient, argumentSizeInBytes);
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    const algorithmFPType one               = 1.0;
+    const algorithmFPType accuracyThreshold = parameter->accuracyThreshold;
+    size_t itr                              = 0;
+    for (; itr < maxIterations; itr++)
+    {
+        /* The same stopping criterion as in the LBFGS algorithm */
+        const algorithmFPType gradientNorm2 = dotProduct<algorithmFPType, cpu>(argumentSize, gradient, gradient);
+        const algorithmFPType argumentNorm2 = dotProduct<algorithmFPType, cpu>(argumentSize, argument, argument);
+        if (gradientNorm2 < accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, argumentNorm2))
+        {
+            break;
+        }
+
+        DAAL_CHECK_STATUS(s, solveNewtonSystem(*hessianVectorFunction, gradient, argumentSize, *parameter, newtonDirection, residual, cgDirection,
+                                               hessianVectorProduct));
+
+        algorithmFPType slope = dotProduct<algorithmFPType, cpu>(argumentSize, gradient, newtonDirection);
+        if (!(slope < 0))
+        {
+            for (size_t j = 0; j < argumentSize; j++)
+            {
+                newtonDirection[j] = -gradient[j];
+            }
+            slope = -gradientNorm2;
+        }
+
+        /* Backtracking line search that starts from the full Newton step */
+        algorithmFPType step = one;
+        bool isAccepted      = false;
+        for (size_t i = 0; i < maxNumberOfStepHalvings && !isAccepted; i++)
+        {
+            for (size_t j = 0; j < argumentSize; j++)
+            {
+                trialArgument[j] = argument[j] + step * newtonDirection[j];
+            }
+            DAAL_CHECK_STATUS(s, valueGradientFunction->computeNoThrow());
+            isAccepted = (*trialValue <= value + algorithmFPType(armijoConstant) * step * slope);
+            step *= algorithmFPType(0.5);
+        }
+        if (!isAccepted) break;
+
+        value  = *trialValue;
+        result = daal::services::internal::daal_memcpy_s(argument, argumentSizeInBytes, trialArgument, argumentSizeInBytes);
+        result |= daal::services::internal::daal_memcpy_s(gradient, argumentSizeInBytes, trialGradient, argumentSizeInBytes);
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+    *nIter = itr;
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::solveNewtonSystem(sum_of_functions::Batch & hessianVectorFunction,
+                                                                                 const algorithmFPType * gradient, size_t argumentSize,
+                                                                                 const Parameter & parameter, algorithmFPType * newtonDirection,
+                                                                                 algorithmFPType * residual, algorithmFPType * cgDirection,
+                                                                                 const algorithmFPType * hessianVectorProduct)
+{
+    services::Status s;
+    typedef daal::internal::Math<algorithmFPType, cpu> MathType;
+
+    /* Forcing term min(cgAccuracyThreshold, sqrt(|g|)) makes the convergence superlinear near the minimum */
+    const algorithmFPType gradientNorm = MathType::sSqrt(dotProduct<algorithmFPType, cpu>(argumentSize, gradient, gradient));
+    const algorithmFPType forcingTerm  = MathType::sMin(algorithmFPType(parameter.cgAccuracyThreshold), MathType::sSqrt(gradientNorm));
+    const algorithmFPType tolerance    = forcingTerm * gradientNorm;
+    const algorithmFPType epsilon      = daal::services::internal::EpsilonVal<algorithmFPType>::get();
+
+    for (size_t j = 0; j < argumentSize; j++)
+    {
+        newtonDirection[j] = 0;
+        residual[j]        = -gradient[j];
+        cgDirection[j]     = -gradient[j];
+    }
+    algorithmFPType residualNorm2 = gradientNorm * gradientNorm;
+
+    for (size_t k = 0; k < parameter.nCGIterations; k++)
+    {
+        DAAL_CHECK_STATUS(s, hessianVectorFunction.computeNoThrow());
+        const algorithmFPType curvature = dotProduct<algorithmFPType, cpu>(argumentSize, cgDirection, hessianVectorProduct);
+        if (curvature <= epsilon * dotProduct<algorithmFPType, cpu>(argumentSize, cgDirection, cgDirection))
+        {
+            /* The hessian is not positive definite along the direction: the iterations stop with the direction found so far,
+               the first iteration falls back to the steepest descent direction */
+            if (k == 0)
+            {
+                for (size_t j = 0; j < argumentSize; j++)
+                {
+                    newtonDirection[j] = -gradient[j];
+                }
+            }
+            break;
+        }
+
+        const algorithmFPType alpha = residualNorm2 / curvature;
+        axpy<algorithmFPType, cpu>(argumentSize, alpha, cgDirection, newtonDirection);
+        axpy<algorithmFPType, cpu>(argumentSize, -alpha, hessianVectorProduct, residual);
+
+        const algorithmFPType newResidualNorm2 = dotProduct<algorithmFPType, cpu>(argumentSize, residual, residual);
+        if (newResidualNorm2 <= tolerance * tolerance) break;
+
+        const algorithmFPType beta = newResidualNorm2 / residualNorm2;
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            cgDirection[j] = residual[j] + beta * cgDirection[j];
+        }
+        residualNorm2 = newResidualNorm2;
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
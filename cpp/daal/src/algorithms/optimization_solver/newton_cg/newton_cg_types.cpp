@@ -0,0 +1,124 @@
+/* file: newton_cg_types.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of newton_cg solver classes.
+//--
+*/
+
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_types.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_types.h"
+#include "algorithms/optimization_solver/objective_function/mse_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NEWTON_CG_RESULT_ID);
+
+/* Returns true if the L1 penalty of the objective function is set, the Newton system needs a twice differentiable function */
+static bool isL1PenaltySet(const sum_of_functions::Parameter * functionParameter)
+{
+    const logistic_loss::Parameter * logLossParameter = dynamic_cast<const logistic_loss::Parameter *>(functionParameter);
+    if (logLossParameter) return logLossParameter->penaltyL1 > 0;
+
+    const cross_entropy_loss::Parameter * crossEntropyParameter = dynamic_cast<const cross_entropy_loss::Parameter *>(functionParameter);
+    if (crossEntropyParameter) return crossEntropyParameter->penaltyL1 > 0;
+
+    const mse::Parameter * mseParameter = dynamic_cast<const mse::Parameter *>(functionParameter);
+    if (!mseParameter || !mseParameter->penaltyL1) return false;
+
+    data_management::NumericTable * penaltyL1 = mseParameter->penaltyL1.get();
+    data_management::BlockDescriptor<float> block;
+    penaltyL1->getBlockOfRows(0, penaltyL1->getNumberOfRows(), data_management::readOnly, block);
+    const float * const penalties = block.getBlockPtr();
+    const size_t nPenalties       = penaltyL1->getNumberOfRows() * penaltyL1->getNumberOfColumns();
+    bool isSet                    = false;
+    for (size_t i = 0; penalties && i < nPenalties; i++)
+    {
+        isSet |= penalties[i] > 0;
+    }
+    penaltyL1->releaseBlockOfRows(block);
+    return isSet;
+}
+
+Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold, size_t nCGIterations,
+                     double cgAccuracyThreshold)
+    : optimization_solver::iterative_solver::Parameter(function, nIterations, accuracyThreshold, false, 1),
+      nCGIterations(nCGIterations),
+      cgAccuracyThreshold(cgAccuracyThreshold)
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s = iterative_solver::Parameter::check();
+    if (!s) return s;
+
+    if (nCGIterations == 0)
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, nCGIterationsStr()));
+    if (cgAccuracyThreshold <= 0 || cgAccuracyThreshold >= 1)
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, cgAccuracyThresholdStr()));
+
+    /* The direction of the Hessian-vector product is set in the parameter of the latest sum of functions interface */
+    const sum_of_functions::Parameter * functionParameter = dynamic_cast<const sum_of_functions::Parameter *>(function->sumOfFunctionsParameter);
+    if (!functionParameter)
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, "function"));
+    if (isL1PenaltySet(functionParameter))
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, penaltyL1Str()));
+
+    return s;
+}
+
+Input::Input() {}
+Input::Input(const Input & other) {}
+
+services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    if (this->size() != 2) return services::Status(services::ErrorIncorrectNumberOfInputNumericTables);
+
+    /* The Newton system is solved for the argument represented as one column */
+    return data_management::checkNumericTable(get(iterative_solver::inputArgument).get(), inputArgumentStr(), 0, 0, 1);
+}
+
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    services::Status s;
+    if (!static_cast<const Parameter *>(par)->optionalResultRequired) return s;
+    algorithms::OptionalArgumentPtr pOpt = get(iterative_solver::optionalResult);
+    if (!pOpt.get())
+    {
+        return services::Status(services::ErrorNullOptionalResult);
+    }
+
+    return s;
+}
+
+} // namespace interface1
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
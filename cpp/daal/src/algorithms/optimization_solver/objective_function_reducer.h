@@ -0,0 +1,189 @@
+/* file: objective_function_reducer.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Reduction of the objective function results computed on the local parts of the data set
+//  over the ranks of the communicator
+//--
+*/
+
+#ifndef __OBJECTIVE_FUNCTION_REDUCER_H__
+#define __OBJECTIVE_FUNCTION_REDUCER_H__
+
+#include "services/communicator.h"
+#include "algorithms/optimization_solver/objective_function/objective_function_types.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace iterative_solver
+{
+namespace internal
+{
+/**
+ *  \brief Turns the value, the gradient and the Hessian computed by every rank on its part of the terms
+ *  into the ones of the objective function over all terms of all ranks.
+ *
+ *  The objective functions of the library average their terms, so the global result is the average
+ *  of the local results weighted by the number of the terms each rank used. All components are packed
+ *  into one buffer and summed with a single allreduce. The number of the ranks that failed to compute
+ *  their local result is summed as well, so that all ranks leave the solver loop together.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ObjectiveFunctionReducer
+{
+public:
+    ObjectiveFunctionReducer(const services::SharedPtr<daal::preview::services::Communicator> & communicator, size_t argumentSize)
+        : _argumentSize(argumentSize)
+    {
+        if (communicator)
+        {
+            _comm = daal::services::internal::ImplAccessor::getImplPtr<daal::preview::comm::internal::CommunicatorIface>(*communicator);
+        }
+    }
+
+    /* Returns true if the results have to be reduced over more than one rank */
+    bool isDistributed() const { return _comm && _comm->size() > 1; }
+
+    /*
+     * Replaces the local components of the result selected in resultsToCompute with the global ones.
+     * Must be called by all ranks with the same resultsToCompute, including the ranks whose local computation failed
+     * \param[in,out] result           Result of the objective function computed on the local terms
+     * \param[in]     resultsToCompute Components of the result to reduce
+     * \param[in]     nUsedTerms       Number of the local terms the result was computed on
+     * \param[in]     localStatus      Status of the local computation of the result
+     */
+    services::Status reduce(const objective_function::ResultPtr & result, DAAL_UINT64 resultsToCompute, size_t nUsedTerms,
+                            const services::Status & localStatus = services::Status())
+    {
+        if (!isDistributed()) return localStatus;
+
+        const objective_function::ResultId ids[nComponents] = { objective_function::valueIdx, objective_function::gradientIdx,
+                                                                 objective_function::hessianIdx };
+        const bool isRequested[nComponents] = { (resultsToCompute & objective_function::value) != 0,
+                                                (resultsToCompute & objective_function::gradient) != 0,
+                                                (resultsToCompute & objective_function::hessian) != 0 };
+        const size_t sizes[nComponents]     = { 1, _argumentSize, _argumentSize * _argumentSize };
+
+        size_t offsets[nComponents];
+        size_t bufferSize = 0;
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            offsets[i] = bufferSize;
+            bufferSize += isRequested[i] ? sizes[i] : 0;
+        }
+
+        /* The buffer ends with the number of the used terms and the number of the failed ranks */
+        _buffer.reset(bufferSize + 2);
+        algorithmFPType * const buffer = _buffer.get();
+        DAAL_CHECK_MALLOC(buffer);
+
+        services::Status s(localStatus);
+        const algorithmFPType weight = algorithmFPType(nUsedTerms);
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            if (!isRequested[i]) continue;
+            daal::services::internal::service_memset<algorithmFPType, cpu>(buffer + offsets[i], algorithmFPType(0), sizes[i]);
+            if (!s) continue;
+            if (!result)
+            {
+                s = services::Status(services::ErrorNullResult);
+                continue;
+            }
+
+            NumericTable * const table = result->get(ids[i]).get();
+            if (!table || table->getNumberOfRows() * table->getNumberOfColumns() != sizes[i])
+            {
+                s = services::Status(services::ErrorIncorrectSizeOfOutputNumericTable);
+                continue;
+            }
+            daal::internal::ReadRows<algorithmFPType, cpu> block(table, 0, table->getNumberOfRows());
+            s = block.status();
+            for (size_t j = 0; j < sizes[i] && s; j++)
+            {
+                buffer[offsets[i] + j] = weight * block.get()[j];
+            }
+        }
+        buffer[bufferSize]     = s ? weight : algorithmFPType(0);
+        buffer[bufferSize + 1] = s ? algorithmFPType(0) : algorithmFPType(1);
+
+        /* The reduction is done in place, so the order of the buffer arguments does not matter */
+        daal::services::Buffer<algorithmFPType> reduced(buffer, bufferSize + 2);
+        services::Status commStatus;
+        _comm->allReduceSum(reduced, reduced, bufferSize + 2, &commStatus);
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_STATUS_VAR(commStatus);
+        DAAL_CHECK(buffer[bufferSize + 1] == algorithmFPType(0), services::ErrorCollectiveComputationFailed);
+        DAAL_CHECK(buffer[bufferSize] > algorithmFPType(0), services::ErrorIncorrectNumberOfTerms);
+
+        const algorithmFPType invTotalWeight = algorithmFPType(1) / buffer[bufferSize];
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            if (!isRequested[i]) continue;
+            NumericTable * const table = result->get(ids[i]).get();
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> block(table, 0, table->getNumberOfRows());
+            DAAL_CHECK_BLOCK_STATUS(block);
+            algorithmFPType * const data = block.get();
+            for (size_t j = 0; j < sizes[i]; j++)
+            {
+                data[j] = buffer[offsets[i] + j] * invTotalWeight;
+            }
+        }
+        return s;
+    }
+
+    /*
+     * Passes the status of the local computation that has no result to reduce through the communicator.
+     * Must be called by all ranks, so that the ranks leave the solver together if any of them failed or was cancelled
+     * \param[in] localStatus Status of the local computation
+     * \return The local status if it is a failure, ErrorCollectiveComputationFailed if another rank failed
+     */
+    services::Status reduceStatus(const services::Status & localStatus)
+    {
+        if (!isDistributed()) return localStatus;
+
+        algorithmFPType nFailedRanks = localStatus ? algorithmFPType(0) : algorithmFPType(1);
+        daal::services::Buffer<algorithmFPType> reduced(&nFailedRanks, 1);
+        services::Status commStatus;
+        _comm->allReduceSum(reduced, reduced, 1, &commStatus);
+        DAAL_CHECK_STATUS_VAR(localStatus);
+        DAAL_CHECK_STATUS_VAR(commStatus);
+        DAAL_CHECK(nFailedRanks == algorithmFPType(0), services::ErrorCollectiveComputationFailed);
+        return localStatus;
+    }
+
+private:
+    static const size_t nComponents = 3;
+
+    daal::services::SharedPtr<daal::preview::comm::internal::CommunicatorIface> _comm;
+    const size_t _argumentSize;
+    daal::internal::TArray<algorithmFPType, cpu> _buffer;
+};
+
+} // namespace internal
+} // namespace iterative_solver
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -39,7 +39,7 @@ namespace optimization_solver
 {
 namespace sgd
 {
-namespace interface2
+namespace interface3
 {
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -98,7 +98,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     }
 }
 
-} // namespace interface2
+} // namespace interface3
 
 } // namespace sgd
 
@@ -31,7 +31,7 @@ namespace optimization_solver
 {
 namespace sgd
 {
-namespace interface2
+namespace interface3
 {
 using BatchType = Batch<DAAL_FPTYPE, optimization_solver::sgd::defaultDense>;
 
@@ -41,7 +41,7 @@ services::SharedPtr<BatchType> BatchType::create()
     return services::SharedPtr<BatchType>(new BatchType());
 }
 
-} // namespace interface2
+} // namespace interface3
 } // namespace sgd
 } // namespace optimization_solver
 } // namespace algorithms
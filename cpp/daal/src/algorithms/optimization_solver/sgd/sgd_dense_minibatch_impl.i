@@ -31,6 +31,7 @@
 #include "src/services/service_utils.h"
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_ittnotify.h"
+#include "src/algorithms/optimization_solver/objective_function_reducer.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -82,7 +83,21 @@ services::Status SGDKernel<algorithmFPType, miniBatch, cpu>::compute(HostAppIfac
         optionalResult ? NumericTable::cast(optionalResult->get(sgd::pastWorkValue)).get() : nullptr,
         optionalResult ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr);
 
-    DAAL_CHECK_STATUS(s, task.init(inputArgument, learningRateSequence, conservativeSequence, nIterations, batchIndices, optionalArgument));
+    s = task.init(inputArgument, learningRateSequence, conservativeSequence, nIterations, batchIndices, optionalArgument);
+
+    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, nIter);
+    using namespace iterative_solver::internal;
+    RngTask<int, cpu> rngTask(predefinedBatchIndicesBD.get(), batchSize);
+    if (s && !batchIndices && !rngTask.init(nTerms, engine))
+    {
+        s = Status(ErrorMemoryAllocationFailed);
+    }
+
+    /* Gradients of the local batches are averaged over the ranks of the communicator.
+       A rank that fails or is cancelled still joins the reduction, so that all ranks stop together */
+    ObjectiveFunctionReducer<algorithmFPType, cpu> reducer(parameter->communicator, argumentSize);
+    const size_t nUsedTerms = (task.indicesStatus == all) ? nTerms : batchSize;
+    DAAL_CHECK_STATUS(s, reducer.reduceStatus(s));
 
     algorithmFPType * workValue = task.mtWorkValue.get();
 
@@ -98,41 +113,38 @@ services::Status SGDKernel<algorithmFPType, miniBatch, cpu>::compute(HostAppIfac
     NumericTablePtr previousBatchIndices            = function->sumOfFunctionsParameter->batchIndices;
     function->sumOfFunctionsParameter->batchIndices = task.ntBatchIndices;
 
-    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, nIter);
-    using namespace iterative_solver::internal;
-    RngTask<int, cpu> rngTask(predefinedBatchIndicesBD.get(), batchSize);
-    DAAL_CHECK_MALLOC(batchIndices || rngTask.init(nTerms, engine));
-
     services::internal::HostAppHelper host(pHost, 10);
-    for (size_t epoch = task.startIteration; s.ok() && (epoch < (task.startIteration + nIter)); epoch++)
+    for (size_t epoch = task.startIteration; epoch < (task.startIteration + nIter); epoch++)
     {
         if (epoch % L == 0 || epoch == task.startIteration)
         {
             learningRate = task.learningRateArray[(epoch / L) % task.learningRateLength];
             consCoeff    = task.consCoeffsArray[(epoch / L) % task.consCoeffsLength];
-            if (task.indicesStatus == user || task.indicesStatus == random)
+            if (s && (task.indicesStatus == user || task.indicesStatus == random))
             {
                 DAAL_ITTNOTIFY_SCOPED_TASK(generateUniform);
                 const int * pValues = nullptr;
                 s                   = rngTask.get(pValues);
-                DAAL_CHECK_BREAK(!s);
-                task.ntBatchIndices->setArray(const_cast<int *>(pValues), task.ntBatchIndices->getNumberOfRows());
+                if (s) task.ntBatchIndices->setArray(const_cast<int *>(pValues), task.ntBatchIndices->getNumberOfRows());
             }
         }
-        s = function->computeNoThrow();
-        if (!s || host.isCancelled(s, 1))
+        if (s) s = function->computeNoThrow();
+        if (s) host.isCancelled(s, 1);
+        s = reducer.reduce(function->getResult(), function->sumOfFunctionsParameter->resultsToCompute, nUsedTerms, s);
+        if (!s)
         {
             DAAL_ASSERT((epoch - task.startIteration) <= services::internal::MaxVal<int>::get())
             task.nProceededIterations[0] = (int)(epoch - task.startIteration);
             break;
         }
 
+        /* The local failures below are passed through the reduction of the next iteration */
         ntGradient = function->getResult()->get(objective_function::gradientIdx);
         gradientBlock.set(*ntGradient, 0, argumentSize);
         if (!gradientBlock.status())
         {
             s = gradientBlock.status();
-            break;
+            continue;
         }
         const algorithmFPType * gradient = gradientBlock.get();
 
@@ -145,7 +157,8 @@ services::Status SGDKernel<algorithmFPType, miniBatch, cpu>::compute(HostAppIfac
                 algorithmFPType pointNorm, gradientNorm;
                 s = vectorNorm(workValue, argumentSize, pointNorm);
                 s |= vectorNorm(gradient, argumentSize, gradientNorm);
-                DAAL_CHECK_BREAK(!s);
+                if (!s) continue;
+                /* The gradient and the argument are the same on all ranks, so all ranks stop at the same iteration */
                 double gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(1.0, pointNorm);
                 DAAL_CHECK_BREAK(gradientNorm < gradientThreshold);
             }
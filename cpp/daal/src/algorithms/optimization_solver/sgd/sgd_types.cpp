@@ -230,6 +230,33 @@ void Result::set(OptionalDataId id, const NumericTablePtr & ptr)
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+Parameter<defaultDense>::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold,
+                                   NumericTablePtr batchIndices, NumericTablePtr learningRateSequence, size_t seed)
+    : interface2::Parameter<defaultDense>(function, nIterations, accuracyThreshold, batchIndices, learningRateSequence, seed)
+{}
+
+Parameter<defaultDense>::Parameter(const interface2::Parameter<defaultDense> & other) : interface2::Parameter<defaultDense>(other) {}
+
+Parameter<miniBatch>::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold,
+                                NumericTablePtr batchIndices, size_t batchSize, NumericTablePtr conservativeSequence, size_t innerNIterations,
+                                NumericTablePtr learningRateSequence, size_t seed)
+    : interface2::Parameter<miniBatch>(function, nIterations, accuracyThreshold, batchIndices, batchSize, conservativeSequence, innerNIterations,
+                                       learningRateSequence, seed)
+{}
+
+Parameter<miniBatch>::Parameter(const interface2::Parameter<miniBatch> & other) : interface2::Parameter<miniBatch>(other) {}
+
+Parameter<momentum>::Parameter(const sum_of_functions::BatchPtr & function, double momentum_, size_t nIterations, double accuracyThreshold,
+                               NumericTablePtr batchIndices, size_t batchSize, NumericTablePtr learningRateSequence, size_t seed)
+    : interface2::Parameter<sgd::momentum>(function, momentum_, nIterations, accuracyThreshold, batchIndices, batchSize, learningRateSequence, seed)
+{}
+
+Parameter<momentum>::Parameter(const interface2::Parameter<sgd::momentum> & other) : interface2::Parameter<sgd::momentum>(other) {}
+
+} // namespace interface3
 } // namespace sgd
 } // namespace optimization_solver
 } // namespace algorithms
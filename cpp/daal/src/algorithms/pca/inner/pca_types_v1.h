@@ -46,6 +46,84 @@ namespace pca
  */
 namespace interface1
 {
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER"></a>
+    * \brief Class that specifies the parameters of the PCA algorithm in the online computing mode
+    */
+template <typename algorithmFPType, Method method>
+class OnlineParameter : public BaseParameter<algorithmFPType, method>
+{};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the online computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, correlationDense> : public BaseParameter<algorithmFPType, correlationDense>
+{
+public:
+    /** Constructs PCA parameters */
+    OnlineParameter(const services::SharedPtr<covariance::OnlineImpl> & covarianceForOnlineParameter =
+                        services::SharedPtr<covariance::Online<algorithmFPType, covariance::defaultDense> >(
+                            new covariance::Online<algorithmFPType, covariance::defaultDense>()));
+
+    services::SharedPtr<covariance::OnlineImpl> covariance; /*!< Pointer to Online covariance */
+
+    /**
+    * Checks online parameter of the PCA correlation algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA SVD algorithm in the online computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, svdDense> : public BaseParameter<algorithmFPType, svdDense>
+{
+public:
+    /** Constructs PCA parameters */
+    OnlineParameter();
+
+    /**
+    * Checks online parameter of the PCA SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
+    * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
+    */
+template <ComputeStep step, typename algorithmFPType, Method method>
+class DistributedParameter : public BaseParameter<algorithmFPType, method>
+{};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP2MASTER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the distributed computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT DistributedParameter<step2Master, algorithmFPType, correlationDense> : public BaseParameter<algorithmFPType, correlationDense>
+{
+public:
+    /** Constructs PCA parameters */
+    DistributedParameter(const services::SharedPtr<covariance::DistributedIface<step2Master> > & covarianceForDistributedParameter =
+                             services::SharedPtr<covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense> >(
+                                 new covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense>()));
+
+    services::SharedPtr<covariance::DistributedIface<step2Master> > covariance; /*!< Pointer to Distributed covariance */
+
+    /**
+    * Checks distributed parameter of the PCA correlation algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER"></a>
 * \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
@@ -0,0 +1,106 @@
+/* file: pca_types_v3.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#ifndef __PCA_TYPES_V3_H__
+#define __PCA_TYPES_V3_H__
+
+#include "algorithms/pca/pca_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup pca Principal Component Analysis
+ * \copydoc daal::algorithms::pca
+ * @ingroup analysis
+ * @{
+ */
+/**
+ * \brief Contains classes for computing the results of the principal component analysis (PCA) algorithm
+ */
+namespace pca
+{
+/**
+ * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER"></a>
+* \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
+*/
+template <typename algorithmFPType, Method method>
+class BatchParameter
+{};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_CORRELATIONDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm in the batch computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, correlationDense> : public BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<covariance::BatchImpl> & covarianceForBatchParameter =
+                       services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >(
+                           new covariance::Batch<algorithmFPType, covariance::defaultDense>()));
+
+    services::SharedPtr<covariance::BatchImpl> covariance; /*!< Pointer to batch covariance */
+
+    /**
+    * Checks batch parameter of the PCA correlation algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA SVD algorithm in the batch computing mode
+*/
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, svdDense> : public BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
+                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
+                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    services::SharedPtr<normalization::zscore::BatchImpl> normalization; /*!< Pointer to batch covariance */
+
+    /**
+                                                            * Checks batch parameter of the PCA svd algorithm
+                                                            * \return Errors detected while checking
+                                                            */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/** @} */
+} // namespace interface3
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
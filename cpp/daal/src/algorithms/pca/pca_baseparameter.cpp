@@ -29,6 +29,18 @@ namespace algorithms
 {
 namespace pca
 {
+namespace interface2
+{
+EigenSolverParameter::EigenSolverParameter()
+    : method(fullEigenSolver), nComponents(0), nOversamples(10), nPowerIterations(2)
+{}
+
+services::Status EigenSolverParameter::check() const
+{
+    return services::Status();
+}
+} // namespace interface2
+
 namespace interface3
 {
 BaseBatchParameter::BaseBatchParameter() : resultsToCompute(none), nComponents(0), isDeterministic(false) {}
@@ -29,7 +29,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 /** Constructs PCA parameters */
 template <typename algorithmFPType>
@@ -40,12 +40,12 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status BatchParameter<algorithmFPType, correlationDense>::check() const
 {
     DAAL_CHECK(covariance, services::ErrorNullAuxiliaryAlgorithm);
-    return services::Status();
+    return eigenSolver.check();
 }
 
 template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, correlationDense>::BatchParameter(const services::SharedPtr<covariance::BatchImpl> & covariance);
 template DAAL_EXPORT services::Status BatchParameter<DAAL_FPTYPE, correlationDense>::check() const;
-} // namespace interface3
+} // namespace interface4
 } // namespace pca
 } // namespace algorithms
 } // namespace daal
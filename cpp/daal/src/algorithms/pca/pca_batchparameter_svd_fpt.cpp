@@ -29,7 +29,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 /** Constructs PCA parameters */
 template <typename algorithmFPType>
@@ -48,7 +48,7 @@ template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, svdDense>::BatchParameter(
 
 template DAAL_EXPORT services::Status BatchParameter<DAAL_FPTYPE, svdDense>::check() const;
 
-} // namespace interface3
+} // namespace interface4
 } // namespace pca
 } // namespace algorithms
 } // namespace daal
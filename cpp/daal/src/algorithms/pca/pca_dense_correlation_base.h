@@ -45,6 +45,11 @@ public:
 protected:
     services::Status computeCorrelationEigenvalues(const data_management::NumericTable & correlation, data_management::NumericTable & eigenvectors,
                                                    data_management::NumericTable & eigenvalues) DAAL_C11_OVERRIDE;
+    services::Status solveCorrelationEigenproblem(const data_management::NumericTable & correlation, data_management::NumericTable & eigenvectors,
+                                                  data_management::NumericTable & eigenvalues, const EigenSolverParameter * eigenSolver);
+    services::Status computeCorrelationEigenvaluesRandomized(const data_management::NumericTable & correlation,
+                                                             data_management::NumericTable & eigenvectors,
+                                                             data_management::NumericTable & eigenvalues, const EigenSolverParameter & eigenSolver);
     services::Status computeEigenvectorsInplace(size_t nFeatures, algorithmFPType * eigenvectors, algorithmFPType * eigenvalues);
     services::Status sortEigenvectorsDescending(size_t nFeatures, algorithmFPType * eigenvectors, algorithmFPType * eigenvalues);
     services::Status signFlipEigenvectors(NumericTable & eigenvectors) const DAAL_C11_OVERRIDE;
@@ -54,6 +59,7 @@ protected:
 
 private:
     void copyArray(size_t size, const algorithmFPType * source, algorithmFPType * destination);
+    services::Status orthonormalizeColumns(size_t nRows, size_t nCols, algorithmFPType * a, algorithmFPType * tau);
 };
 
 template <ComputeMode mode, typename algorithmFPType, CpuType cpu>
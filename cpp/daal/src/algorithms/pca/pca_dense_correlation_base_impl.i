@@ -17,7 +17,11 @@
 
 #include "src/algorithms/pca/pca_dense_correlation_base.h"
 #include "src/externals/service_lapack.h"
+#include "src/externals/service_blas.h"
 #include "src/externals/service_math.h"
+#include "src/externals/service_rng.h"
+#include "src/algorithms/engines/engine_batch_impl.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -160,6 +164,139 @@ services::Status PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEig
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCACorrelationBase<algorithmFPType, cpu>::solveCorrelationEigenproblem(const data_management::NumericTable & correlation,
+                                                                                        data_management::NumericTable & eigenvectors,
+                                                                                        data_management::NumericTable & eigenvalues,
+                                                                                        const EigenSolverParameter * eigenSolver)
+{
+    const size_t nFeatures   = correlation.getNumberOfColumns();
+    const size_t nComponents = eigenvalues.getNumberOfColumns();
+
+    /* The randomized solver pays off only if the sketch is narrower than the correlation matrix */
+    if (eigenSolver && eigenSolver->method == randomizedEigenSolver && nComponents + eigenSolver->nOversamples < nFeatures)
+    {
+        return computeCorrelationEigenvaluesRandomized(correlation, eigenvectors, eigenvalues, *eigenSolver);
+    }
+    return computeCorrelationEigenvalues(correlation, eigenvectors, eigenvalues);
+}
+
+/* Randomized range finder with power iterations (N. Halko, P.-G. Martinsson, J. A. Tropp, 2011) for the symmetric correlation matrix C:
+ * Q = orth(C^(q+1) * Omega) with Omega of size p x (k + s) drawn from N(0, 1), B = Q' * C * Q = U * diag(w) * U',
+ * C ~ (Q * U) * diag(w) * (Q * U)'.
+ * All the p x l matrices are stored column-major, i.e. each of l rows of the buffer contains one column of length p */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEigenvaluesRandomized(const data_management::NumericTable & correlation,
+                                                                                                   data_management::NumericTable & eigenvectors,
+                                                                                                   data_management::NumericTable & eigenvalues,
+                                                                                                   const EigenSolverParameter & eigenSolver)
+{
+    const size_t nFeatures   = correlation.getNumberOfColumns();
+    const size_t nComponents = eigenvalues.getNumberOfColumns();
+    const size_t nSketch     = nComponents + eigenSolver.nOversamples;
+    DAAL_ASSERT(nSketch < nFeatures);
+
+    /* The default engine is created only when the randomized solver runs without the user-provided one */
+    engines::EnginePtr engine = eigenSolver.engine;
+    if (!engine)
+    {
+        engine = engines::mt19937::Batch<algorithmFPType>::create();
+        DAAL_CHECK_MALLOC(engine);
+    }
+    engines::internal::BatchBaseImpl * engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engine.get());
+    DAAL_CHECK(engineImpl, services::ErrorIncorrectEngineParameter);
+
+    ReadRows<algorithmFPType, cpu> correlationBlock(const_cast<data_management::NumericTable &>(correlation), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(correlationBlock);
+    const algorithmFPType * const c = correlationBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nSketch);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * nSketch, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> qArr(nFeatures * nSketch);
+    TArray<algorithmFPType, cpu> tArr(nFeatures * nSketch);
+    TArray<algorithmFPType, cpu> bArr(nSketch * nSketch);
+    TArray<algorithmFPType, cpu> wArr(nSketch);
+    TArray<algorithmFPType, cpu> tauArr(nSketch);
+    DAAL_CHECK_MALLOC(qArr.get() && tArr.get() && bArr.get() && wArr.get() && tauArr.get());
+    algorithmFPType * q = qArr.get();
+    algorithmFPType * t = tArr.get();
+    algorithmFPType * b = bArr.get();
+    algorithmFPType * w = wArr.get();
+
+    /* Random projection Omega is kept in t */
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(nFeatures * nSketch, t, engineImpl->getState(), algorithmFPType(0), algorithmFPType(1)),
+               services::ErrorIncorrectErrorcodeFromGenerator);
+
+    char notrans                = 'N';
+    char trans                  = 'T';
+    const algorithmFPType one   = 1.0;
+    const algorithmFPType zero  = 0.0;
+    const DAAL_INT p            = (DAAL_INT)nFeatures;
+    const DAAL_INT l            = (DAAL_INT)nSketch;
+
+    services::Status s;
+    for (size_t iter = 0; iter <= eigenSolver.nPowerIterations; ++iter)
+    {
+        /* q = orth(C * t) */
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &p, &one, c, &p, t, &p, &zero, q, &p);
+        DAAL_CHECK_STATUS(s, orthonormalizeColumns(nFeatures, nSketch, q, tauArr.get()));
+        if (iter < eigenSolver.nPowerIterations) services::internal::swap<cpu, algorithmFPType *>(q, t);
+    }
+
+    /* B = Q' * (C * Q) */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &p, &one, c, &p, q, &p, &zero, t, &p);
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &l, &l, &p, &one, q, &p, t, &p, &zero, b, &l);
+
+    DAAL_CHECK_STATUS(s, computeEigenvectorsInplace(nSketch, b, w));
+
+    /* Ritz vectors Q * U, ordered by ascending eigenvalues */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &l, &one, q, &p, b, &l, &zero, t, &p);
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+    algorithmFPType * eigenvectorsArray = eigenvectorsBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    algorithmFPType * eigenvaluesArray = eigenvaluesBlock.get();
+
+    for (size_t i = 0; i < nComponents; ++i)
+    {
+        copyArray(nFeatures, t + (nSketch - 1 - i) * nFeatures, eigenvectorsArray + i * nFeatures);
+        eigenvaluesArray[i] = w[nSketch - 1 - i];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCACorrelationBase<algorithmFPType, cpu>::orthonormalizeColumns(size_t nRows, size_t nCols, algorithmFPType * a,
+                                                                                 algorithmFPType * tau)
+{
+    const DAAL_INT m = (DAAL_INT)nRows;
+    const DAAL_INT n = (DAAL_INT)nCols;
+    DAAL_INT info    = 0;
+
+    /* Workspace query */
+    algorithmFPType workQuery[2] = { 0, 0 };
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, a, m, tau, workQuery, -1, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeCorrelationEigenvalues);
+    Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, a, m, tau, workQuery + 1, -1, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeCorrelationEigenvalues);
+
+    const algorithmFPType lworkQuery = services::internal::max<cpu, algorithmFPType>(workQuery[0], workQuery[1]);
+    const DAAL_INT lwork             = services::internal::max<cpu, DAAL_INT>(n, (DAAL_INT)lworkQuery);
+    TArray<algorithmFPType, cpu> work(lwork);
+    DAAL_CHECK_MALLOC(work.get());
+
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, a, m, tau, work.get(), lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeCorrelationEigenvalues);
+    Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, a, m, tau, work.get(), lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeCorrelationEigenvalues);
+    return services::Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PCACorrelationBase<algorithmFPType, cpu>::computeEigenvectorsInplace(size_t nFeatures, algorithmFPType * eigenvectors,
                                                                                       algorithmFPType * eigenvalues)
@@ -38,7 +38,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 template <typename algorithmFPType, CpuType cpu>
 BatchContainer<algorithmFPType, correlationDense, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
@@ -71,8 +71,8 @@ services::Status BatchContainer<algorithmFPType, correlationDense, cpu>::compute
 
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
-    interface3::BatchParameter<algorithmFPType, correlationDense> * parameter =
-        static_cast<interface3::BatchParameter<algorithmFPType, correlationDense> *>(_par);
+    interface4::BatchParameter<algorithmFPType, correlationDense> * parameter =
+        static_cast<interface4::BatchParameter<algorithmFPType, correlationDense> *>(_par);
     services::Environment::env & env = *_env;
 
     data_management::NumericTablePtr data         = input->get(pca::data);
@@ -93,7 +93,7 @@ services::Status BatchContainer<algorithmFPType, correlationDense, cpu>::compute
     {
         __DAAL_CALL_KERNEL(env, internal::PCACorrelationKernel, __DAAL_KERNEL_ARGUMENTS(batch, algorithmFPType), compute, input->isCorrelation(),
                            parameter->isDeterministic, *data, covarianceAlgorithm.get(), parameter->resultsToCompute, *eigenvectors, *eigenvalues,
-                           *means, *variances);
+                           *means, *variances, &parameter->eigenSolver);
     }
     else
     {
@@ -103,7 +103,7 @@ services::Status BatchContainer<algorithmFPType, correlationDense, cpu>::compute
     }
 }
 
-} // namespace interface3
+} // namespace interface4
 } // namespace pca
 } // namespace algorithms
 } // namespace daal
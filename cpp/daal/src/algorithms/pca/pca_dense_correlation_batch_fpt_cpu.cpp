@@ -30,7 +30,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 template class BatchContainer<DAAL_FPTYPE, correlationDense, DAAL_CPU>;
 }
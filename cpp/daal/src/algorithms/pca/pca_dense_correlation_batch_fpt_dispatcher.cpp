@@ -27,6 +27,6 @@ namespace daal
 {
 namespace algorithms
 {
-__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(pca::interface3::BatchContainer, batch, DAAL_FPTYPE, pca::correlationDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(pca::interface4::BatchContainer, batch, DAAL_FPTYPE, pca::correlationDense)
 }
 } // namespace daal
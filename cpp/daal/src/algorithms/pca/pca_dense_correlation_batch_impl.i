@@ -64,7 +64,7 @@ template <typename algorithmFPType, CpuType cpu>
 services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute(
     bool isCorrelation, bool isDeterministic, const data_management::NumericTable & dataTable, covariance::BatchImpl * covarianceAlg,
     DAAL_UINT64 resultsToCompute, data_management::NumericTable & eigenvectors, data_management::NumericTable & eigenvalues,
-    data_management::NumericTable & means, data_management::NumericTable & variances)
+    data_management::NumericTable & means, data_management::NumericTable & variances, const EigenSolverParameter * eigenSolver)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(compute);
 
@@ -84,7 +84,7 @@ services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute(
 
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(compute.correlation.computeEigenvalues);
-            DAAL_CHECK_STATUS(status, this->computeCorrelationEigenvalues(dataTable, eigenvectors, eigenvalues));
+            DAAL_CHECK_STATUS(status, this->solveCorrelationEigenproblem(dataTable, eigenvectors, eigenvalues, eigenSolver));
         }
     }
     else
@@ -118,7 +118,7 @@ services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute(
 
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(compute.full.computeEigenvalues);
-            DAAL_CHECK_STATUS(status, this->computeCorrelationEigenvalues(covarianceTable, eigenvectors, eigenvalues));
+            DAAL_CHECK_STATUS(status, this->solveCorrelationEigenproblem(covarianceTable, eigenvectors, eigenvalues, eigenSolver));
         }
     }
 
@@ -48,7 +48,7 @@ public:
     services::Status compute(bool isCorrelation, bool isDeterministic, const data_management::NumericTable & dataTable,
                              covariance::BatchImpl * covarianceAlg, DAAL_UINT64 resultsToCompute, data_management::NumericTable & eigenvectors,
                              data_management::NumericTable & eigenvalues, data_management::NumericTable & means,
-                             data_management::NumericTable & variances);
+                             data_management::NumericTable & variances, const EigenSolverParameter * eigenSolver = nullptr);
 };
 
 } // namespace internal
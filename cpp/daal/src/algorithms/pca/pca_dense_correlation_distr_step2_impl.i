@@ -64,7 +64,7 @@ services::Status PCACorrelationKernel<distributed, algorithmFPType, cpu>::finali
     if (!s) return s;
 
     data_management::NumericTablePtr correlation = parameter->covariance->getResult()->get(covariance::covariance);
-    return this->computeCorrelationEigenvalues(*correlation, eigenvectors, eigenvalues);
+    return this->solveCorrelationEigenproblem(*correlation, eigenvectors, eigenvalues, &parameter->eigenSolver);
 }
 
 } // namespace internal
@@ -31,7 +31,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface1
+namespace interface2
 {
 template class OnlineContainer<DAAL_FPTYPE, correlationDense, DAAL_CPU>;
 }
@@ -62,7 +62,7 @@ services::Status PCACorrelationKernel<online, algorithmFPType, cpu>::finalize(Pa
     if (!s) return s;
 
     data_management::NumericTablePtr correlation = parameter->covariance->getResult()->get(covariance::covariance);
-    return this->computeCorrelationEigenvalues(*correlation, eigenvectors, eigenvalues);
+    return this->solveCorrelationEigenproblem(*correlation, eigenvectors, eigenvalues, &parameter->eigenSolver);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -28,7 +28,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface3
+namespace interface4
 {
 template class BatchContainer<DAAL_FPTYPE, svdDense, DAAL_CPU>;
 }
@@ -24,6 +24,7 @@
 #include "src/algorithms/pca/pca_dense_svd_batch_kernel.h"
 #include "src/algorithms/pca/pca_dense_svd_batch_impl.i"
 #include "src/algorithms/pca/inner/pca_types_v2.h"
+#include "src/algorithms/pca/inner/pca_types_v3.h"
 
 namespace daal
 {
@@ -37,6 +38,8 @@ template class PCASVDBatchKernel<DAAL_FPTYPE, interface2::BatchParameter<DAAL_FP
 
 template class PCASVDBatchKernel<DAAL_FPTYPE, interface3::BatchParameter<DAAL_FPTYPE, pca::svdDense>, DAAL_CPU>;
 
+template class PCASVDBatchKernel<DAAL_FPTYPE, interface4::BatchParameter<DAAL_FPTYPE, pca::svdDense>, DAAL_CPU>;
+
 } // namespace internal
 } // namespace pca
 } // namespace algorithms
@@ -29,7 +29,7 @@ namespace algorithms
 {
 namespace pca
 {
-namespace interface1
+namespace interface2
 {
 template class DistributedContainer<step2Master, DAAL_FPTYPE, svdDense, DAAL_CPU>;
 }
@@ -42,7 +42,7 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status DistributedParameter<step2Master, algorithmFPType, correlationDense>::check() const
 {
     DAAL_CHECK(covariance, services::ErrorNullAuxiliaryAlgorithm);
-    return services::Status();
+    return eigenSolver.check();
 }
 
 } // namespace pca
@@ -41,7 +41,7 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status OnlineParameter<algorithmFPType, correlationDense>::check() const
 {
     DAAL_CHECK(covariance, services::ErrorNullAuxiliaryAlgorithm);
-    return services::Status();
+    return eigenSolver.check();
 }
 
 } // namespace pca
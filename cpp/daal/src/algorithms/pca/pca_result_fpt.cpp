@@ -69,6 +69,21 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     size_t nComponents           = 0;
     DAAL_UINT64 resultsToCompute = eigenvalue;
 
+    /* The randomized eigenproblem solver computes only the requested number of leading eigenpairs */
+    const EigenSolverParameter * eigenSolver = NULL;
+    if (const auto * onlinePar = dynamic_cast<const OnlineParameter<algorithmFPType, correlationDense> *>(parameter))
+    {
+        eigenSolver = &onlinePar->eigenSolver;
+    }
+    else if (const auto * distributedPar = dynamic_cast<const DistributedParameter<step2Master, algorithmFPType, correlationDense> *>(parameter))
+    {
+        eigenSolver = &distributedPar->eigenSolver;
+    }
+    if (eigenSolver && eigenSolver->method == randomizedEigenSolver)
+    {
+        nComponents = eigenSolver->nComponents;
+    }
+
     auto impl = ResultImpl::cast(getStorage(*this));
     DAAL_CHECK(impl, services::ErrorNullPtr);
 
@@ -67,11 +67,6 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
 
-    bool hasTransform           = input->get(dataForTransform).get() != nullptr;
-    NumericTable * pMeans       = hasTransform ? input->get(dataForTransform, mean).get() : NULL;
-    NumericTable * pVariances   = hasTransform ? input->get(dataForTransform, variance).get() : NULL;
-    NumericTable * pEigenvalues = hasTransform ? input->get(dataForTransform, eigenvalue).get() : NULL;
-
     daal::services::Environment::env & env = *_env;
 
     auto & context    = daal::oneapi::internal::getDefaultContext();
@@ -79,16 +74,55 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (deviceInfo.isCpu)
     {
-        __DAAL_CALL_KERNEL(env, internal::TransformKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
-                           *(input->get(eigenvectors)), pMeans, pVariances, pEigenvalues, *(result->get(transformedData)));
+        __DAAL_CALL_KERNEL(env, internal::TransformKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computePrepared, *(input->get(data)),
+                           *(result->get(transformedData)));
     }
     else
     {
+        bool hasTransform           = input->get(dataForTransform).get() != nullptr;
+        NumericTable * pMeans       = hasTransform ? input->get(dataForTransform, mean).get() : NULL;
+        NumericTable * pVariances   = hasTransform ? input->get(dataForTransform, variance).get() : NULL;
+        NumericTable * pEigenvalues = hasTransform ? input->get(dataForTransform, eigenvalue).get() : NULL;
+
         __DAAL_CALL_KERNEL_SYCL(env, oneapi::internal::TransformKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 *(input->get(data)), *(input->get(eigenvectors)), pMeans, pVariances, pEigenvalues, *(result->get(transformedData)));
     }
 }
 
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
+{
+    auto & context    = daal::oneapi::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+    if (!deviceInfo.isCpu) return services::Status();
+
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
+
+    bool hasTransform           = input->get(dataForTransform).get() != nullptr;
+    NumericTable * pMeans       = hasTransform ? input->get(dataForTransform, mean).get() : NULL;
+    NumericTable * pVariances   = hasTransform ? input->get(dataForTransform, variance).get() : NULL;
+    NumericTable * pEigenvalues = hasTransform ? input->get(dataForTransform, eigenvalue).get() : NULL;
+
+    const size_t nFeatures   = input->get(data)->getNumberOfColumns();
+    const size_t nComponents = result->get(transformedData)->getNumberOfColumns();
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TransformKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), prepare, *(input->get(eigenvectors)), pMeans,
+                       pVariances, pEigenvalues, nFeatures, nComponents);
+}
+
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::resetCompute()
+{
+    auto & context    = daal::oneapi::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+    if (!deviceInfo.isCpu) return services::Status();
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TransformKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), reset);
+}
+
 } // namespace transform
 } // namespace pca
 } // namespace algorithms
@@ -31,6 +31,7 @@
 
 #include "src/externals/service_blas.h"
 #include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
 #include "src/services/service_unique_ptr.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
@@ -50,17 +51,16 @@ using namespace daal::services;
 
 template <typename algorithmFPType, transform::Method method, CpuType cpu>
 void TransformKernel<algorithmFPType, method, cpu>::computeTransformedBlock(DAAL_INT * numRows, DAAL_INT * numFeatures, DAAL_INT * numComponents,
-                                                                            const algorithmFPType * dataBlock, const algorithmFPType * eigenvectors,
+                                                                            const algorithmFPType * dataBlock, const algorithmFPType * projection,
                                                                             algorithmFPType * resultBlock)
 {
     /* GEMM parameters */
-    char trans           = 'T';
     char notrans         = 'N';
     algorithmFPType one  = 1.0;
     algorithmFPType zero = 0.0;
 
-    Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, numComponents, numRows, numFeatures, &one, eigenvectors, numFeatures, dataBlock, numFeatures,
-                                       &zero, resultBlock, numComponents);
+    Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, numComponents, numRows, numFeatures, &one, projection, numComponents, dataBlock,
+                                       numFeatures, &zero, resultBlock, numComponents);
 
 } /* void TransformKernel<algorithmFPType, defaultDense, cpu>::computeTransformedBlock */
 
@@ -91,74 +91,140 @@ services::Status ComputeInvSigmas(NumericTable * pVariances, TArray<algorithmFPT
 }
 
 template <typename algorithmFPType, transform::Method method, CpuType cpu>
-services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans,
-                                                                        NumericTable * pVariances, NumericTable * pEigenvalues,
-                                                                        NumericTable & transformedData)
+services::Status TransformKernel<algorithmFPType, method, cpu>::prepare(NumericTable & eigenvectors, NumericTable * pMeans, NumericTable * pVariances,
+                                                                        NumericTable * pEigenvalues, size_t nFeatures, size_t nComponents)
 {
-    DAAL_INT numVectors    = data.getNumberOfRows();
-    DAAL_INT numFeatures   = data.getNumberOfColumns();
-    DAAL_INT numComponents = transformedData.getNumberOfColumns();
+    _isPrepared = false;
+
+    Status status;
+
+    TArray<algorithmFPType, cpu> invSigmas(0);
+    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pVariances, invSigmas, nFeatures));
+
+    TArray<algorithmFPType, cpu> invEigenvalues(0);
+    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pEigenvalues, invEigenvalues, nComponents));
+
+    const algorithmFPType * pInvSigmas      = invSigmas.get();
+    const algorithmFPType * pInvEigenvalues = invEigenvalues.get();
 
     /* Retrieve data associated with coefficients */
-    ReadRows<algorithmFPType, cpu> basis(eigenvectors, 0, numComponents);
+    ReadRows<algorithmFPType, cpu> basis(eigenvectors, 0, nComponents);
     DAAL_CHECK_BLOCK_STATUS(basis)
     const algorithmFPType * pBasis = basis.get();
 
-    size_t numRowsInBlock = _numRowsInBlock;
-    if (numRowsInBlock < 1)
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nComponents);
+    algorithmFPType * pProjection = _projection.reset(nFeatures * nComponents);
+    DAAL_CHECK_MALLOC(pProjection);
+
+    /* Projection matrix is the transposed basis scaled by the inverse standard deviations of the features
+       and by the inverse square roots of the eigenvalues */
+    for (size_t featureId = 0; featureId < nFeatures; ++featureId)
     {
-        numRowsInBlock = 1;
+        const algorithmFPType invSigma = pInvSigmas ? pInvSigmas[featureId] : algorithmFPType(1.0);
+        algorithmFPType * pRow         = pProjection + featureId * nComponents;
+        for (size_t componentId = 0; componentId < nComponents; ++componentId)
+        {
+            pRow[componentId] = pBasis[componentId * nFeatures + featureId] * invSigma;
+        }
+        if (pInvEigenvalues)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t componentId = 0; componentId < nComponents; ++componentId)
+            {
+                pRow[componentId] *= pInvEigenvalues[componentId];
+            }
+        }
     }
 
-    /* Calculate number of blocks of rows including tail block */
-    size_t numBlocks = numVectors / numRowsInBlock;
-    if (numBlocks * numRowsInBlock < numVectors)
+    releaseCenteredBlocks();
+    _means.reset(0);
+    if (pMeans != nullptr)
     {
-        numBlocks++;
-    }
+        ReadRows<algorithmFPType, cpu> meansRows(*pMeans, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(meansRows);
+        const algorithmFPType * pRawMeans = meansRows.get();
 
-    Status status;
+        algorithmFPType * pMeansCopy = _means.reset(nFeatures);
+        DAAL_CHECK_MALLOC(pMeansCopy);
 
-    TArray<algorithmFPType, cpu> invSigmas(0);
-    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pVariances, invSigmas, numFeatures));
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t featureId = 0; featureId < nFeatures; ++featureId)
+        {
+            pMeansCopy[featureId] = pRawMeans[featureId];
+        }
 
-    TArray<algorithmFPType, cpu> invEigenvalues(0);
-    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pEigenvalues, invEigenvalues, numComponents));
+        /* Each thread allocates its buffer on the first block it centers and keeps it until reset() */
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _numRowsInBlock * nFeatures, sizeof(algorithmFPType));
+        const size_t blockSize = _numRowsInBlock * nFeatures;
+        _centeredBlocks.reset(new daal::tls<algorithmFPType *>(
+            [=]() { return daal::services::internal::service_malloc<algorithmFPType, cpu>(blockSize); }));
+        DAAL_CHECK_MALLOC(_centeredBlocks.get());
+    }
 
-    const algorithmFPType * pInvSigmas      = invSigmas.get();
-    const algorithmFPType * pInvEigenvalues = invEigenvalues.get();
+    _nFeatures   = nFeatures;
+    _nComponents = nComponents;
+    _isPrepared  = true;
+    return status;
+} /* void TransformKernel<algorithmFPType, defaultDense, cpu>::prepare */
 
-    size_t numInvSigmas = invSigmas.size();
-    size_t numMeans     = 0;
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, method, cpu>::reset()
+{
+    releaseCenteredBlocks();
+    _projection.reset(0);
+    _means.reset(0);
+    _nFeatures   = 0;
+    _nComponents = 0;
+    _isPrepared  = false;
+    return services::Status();
+}
 
-    const algorithmFPType * pRawMeans = nullptr;
-    ReadRows<algorithmFPType, cpu> meansRows;
-    if (pMeans != nullptr)
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+void TransformKernel<algorithmFPType, method, cpu>::releaseCenteredBlocks()
+{
+    if (_centeredBlocks.get())
     {
-        numMeans = numFeatures;
-        meansRows.set(*pMeans, 0, numFeatures);
-        DAAL_CHECK_BLOCK_STATUS(meansRows);
-        pRawMeans = meansRows.get();
+        _centeredBlocks->reduce([](algorithmFPType * pCenteredBlock) { daal_free(pCenteredBlock); });
+        _centeredBlocks.reset();
     }
+}
 
-    bool isWhitening = pEigenvalues != nullptr;
-    bool isNormalize = pMeans != nullptr || pVariances != nullptr;
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, method, cpu>::applyProjection(NumericTable & data, NumericTable & transformedData)
+{
+    const size_t numVectors = data.getNumberOfRows();
+    DAAL_CHECK(data.getNumberOfColumns() == _nFeatures, ErrorIncorrectNumberOfColumns);
+    DAAL_CHECK(transformedData.getNumberOfColumns() == _nComponents, ErrorIncorrectNumberOfColumns);
+    DAAL_CHECK(transformedData.getNumberOfRows() >= numVectors, ErrorIncorrectNumberOfRows);
 
-    UniquePtr<daal::tls<algorithmFPType *>, cpu> tls;
-    if (isNormalize)
+    size_t numRowsInBlock = _numRowsInBlock;
+    if (numRowsInBlock < 1)
     {
-        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numRowsInBlock * numFeatures * sizeof(algorithmFPType), sizeof(algorithmFPType));
-        tls.reset(new daal::tls<algorithmFPType *>([=]() {
-            return (algorithmFPType *)daal::services::internal::service_malloc<algorithmFPType, cpu>(numRowsInBlock * numFeatures
-                                                                                                     * sizeof(algorithmFPType));
-        }));
-        DAAL_CHECK_MALLOC(tls.get());
+        numRowsInBlock = 1;
     }
 
+    /* Calculate number of blocks of rows including tail block */
+    size_t numBlocks = numVectors / numRowsInBlock;
+    if (numBlocks * numRowsInBlock < numVectors)
+    {
+        numBlocks++;
+    }
+
+    const algorithmFPType * pProjection = _projection.get();
+    const algorithmFPType * pMeans      = _means.get();
+    DAAL_INT numFeatures                = _nFeatures;
+    DAAL_INT numComponents              = _nComponents;
+
+    /* The centered copies of the data blocks, allocated by prepare() */
+    daal::tls<algorithmFPType *> * centeredBlocks = _centeredBlocks.get();
+    DAAL_CHECK(!pMeans || centeredBlocks, ErrorIncorrectInternalFunctionParameter);
+
     SafeStatus safeStat;
 
     /* Loop over input data blocks */
-    daal::threader_for(numBlocks, numBlocks, [=, &tls, &transformedData, &data, &safeStat](int iBlock) {
+    daal::threader_for(numBlocks, numBlocks, [=, &transformedData, &data, &safeStat](int iBlock) {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow   = startRow + numRowsInBlock;
         if (endRow > numVectors)
@@ -167,7 +233,8 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         }
 
         DAAL_INT numRows     = endRow - startRow;
-        DAAL_INT numFeatures = data.getNumberOfColumns();
+        DAAL_INT nFeatures   = numFeatures;
+        DAAL_INT nComponents = numComponents;
 
         WriteRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
         DAAL_CHECK_BLOCK_STATUS_THR(blockRows);
@@ -177,52 +244,47 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
         const algorithmFPType * pDataBlock = dataRows.get();
 
-        if (isNormalize)
+        /* The data are centered before the projection to avoid the cancellation of the large means */
+        if (pMeans)
         {
-            algorithmFPType * pCopyBlock       = tls->local();
-            const algorithmFPType * pNormBlock = numMeans ? pCopyBlock : pDataBlock;
-            DAAL_CHECK_MALLOC_THR(pCopyBlock);
-            for (size_t rowId = 0; rowId < numRows; ++rowId)
+            algorithmFPType * pCenteredBlock = centeredBlocks->local();
+            DAAL_CHECK_MALLOC_THR(pCenteredBlock);
+            for (DAAL_INT rowId = 0; rowId < numRows; ++rowId)
             {
-                /* compute centering if numMeans != 0 */
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numMeans; ++colId)
+                for (DAAL_INT colId = 0; colId < nFeatures; ++colId)
                 {
-                    pCopyBlock[rowId * numMeans + colId] = pDataBlock[rowId * numMeans + colId] - pRawMeans[colId];
-                }
-                /* compute normalization to unit variance if numInvSigmas!= 0 */
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numInvSigmas; ++colId)
-                {
-                    pCopyBlock[rowId * numInvSigmas + colId] = pNormBlock[rowId * numInvSigmas + colId] * pInvSigmas[colId];
+                    pCenteredBlock[rowId * nFeatures + colId] = pDataBlock[rowId * nFeatures + colId] - pMeans[colId];
                 }
             }
-            pDataBlock = pCopyBlock;
+            pDataBlock = pCenteredBlock;
         }
-        computeTransformedBlock(&numRows, &numFeatures, (DAAL_INT *)&numComponents, pDataBlock, pBasis, pTransformedBlock);
-        /* compute whitening to unit variance of transformed data if required */
-        if (isWhitening)
-        {
-            for (size_t rowId = 0; rowId < numRows; ++rowId)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numComponents; ++colId)
-                {
-                    pTransformedBlock[rowId * numComponents + colId] = pTransformedBlock[rowId * numComponents + colId] * pInvEigenvalues[colId];
-                }
-            }
-        }
-    }); /* daal::threader_for */
 
-    if (isNormalize)
-    {
-        tls->reduce([&](algorithmFPType * pCopyBlock) { daal_free(pCopyBlock); });
-    }
+        computeTransformedBlock(&numRows, &nFeatures, &nComponents, pDataBlock, pProjection, pTransformedBlock);
+    }); /* daal::threader_for */
 
     return safeStat.detach();
+}
+
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, method, cpu>::computePrepared(NumericTable & data, NumericTable & transformedData)
+{
+    DAAL_CHECK(_isPrepared, ErrorIncorrectInternalFunctionParameter);
+    return applyProjection(data, transformedData);
+}
+
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans,
+                                                                        NumericTable * pVariances, NumericTable * pEigenvalues,
+                                                                        NumericTable & transformedData)
+{
+    Status status;
+    DAAL_CHECK_STATUS(status,
+                      prepare(eigenvectors, pMeans, pVariances, pEigenvalues, data.getNumberOfColumns(), transformedData.getNumberOfColumns()));
+    status = applyProjection(data, transformedData);
+    reset();
+    return status;
 } /* void TransformKernel<algorithmFPType, defaultDense, cpu>::compute */
 
 } /* namespace internal */
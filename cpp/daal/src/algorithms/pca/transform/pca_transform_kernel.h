@@ -29,6 +29,9 @@
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
 #include "src/externals/service_blas.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_unique_ptr.h"
+#include "src/threading/threading.h"
 
 using namespace daal::data_management;
 
@@ -46,6 +49,9 @@ template <typename algorithmFPType, transform::Method method, CpuType cpu>
 class TransformKernel : public Kernel
 {
 public:
+    TransformKernel() : _nFeatures(0), _nComponents(0), _isPrepared(false) {}
+    ~TransformKernel() { releaseCenteredBlocks(); }
+
     /**
      *  \brief Compute PCA transformation.
      *
@@ -59,6 +65,37 @@ public:
     services::Status compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans, NumericTable * pVariances,
                              NumericTable * pEigenvalues, NumericTable & transformedData);
 
+    /**
+     *  \brief Prepare the projection used by computePrepared(): the normalization to unit variance and the whitening
+     *         are folded into a projection matrix laid out for GEMM. The data are centered explicitly before the projection,
+     *         as the means folded into a bias cancel with the projection of the data when the means are large.
+     *         The per-thread buffers of the centered row blocks are kept with the projection and reused by every call
+     *
+     *  \param eigenvectors[in]     PCA eigenvectors
+     *  \param means[in]            PCA means
+     *  \param variances[in]        PCA variances
+     *  \param eigenvalues[in]      PCA eigenvalues
+     *  \param nFeatures[in]        Number of features in input data row
+     *  \param nComponents[in]      Number of components
+     */
+    services::Status prepare(NumericTable & eigenvectors, NumericTable * pMeans, NumericTable * pVariances, NumericTable * pEigenvalues,
+                             size_t nFeatures, size_t nComponents);
+
+    /**
+     *  \brief Compute PCA transformation with the projection built by the last call of prepare()
+     *
+     *  \param data[in]             Matrix of input vectors X
+     *  \param transformedData[out] Transformed data
+     */
+    services::Status computePrepared(NumericTable & data, NumericTable & transformedData);
+
+    /**
+     *  \brief Release the projection and the centering buffers built by prepare()
+     */
+    services::Status reset();
+
+    bool isPrepared() const { return _isPrepared; }
+
     /**
     *  \brief Function that computes PCA transformation
     *         for a block of input data rows
@@ -67,13 +104,25 @@ public:
     *  \param numFeatures[in]      Number of features in input data row
     *  \param numComponents[in]    Number of components
     *  \param dataBlock[in]        Block of input data rows
-    *  \param eigenvectors[in]     Eigenvectors
+    *  \param projection[in]       Projection matrix
     *  \param resultBlock[out]     Resulting block of responses
     */
     void computeTransformedBlock(DAAL_INT * numRows, DAAL_INT * numFeatures, DAAL_INT * numComponents, const algorithmFPType * dataBlock,
-                                 const algorithmFPType * eigenvectors, algorithmFPType * resultBlock);
+                                 const algorithmFPType * projection, algorithmFPType * resultBlock);
 
     static const size_t _numRowsInBlock = 256;
+
+protected:
+    services::Status applyProjection(NumericTable & data, NumericTable & transformedData);
+    void releaseCenteredBlocks();
+
+    daal::internal::TArray<algorithmFPType, cpu> _projection; /* nFeatures x nComponents matrix stored by rows */
+    daal::internal::TArray<algorithmFPType, cpu> _means;      /* nFeatures values, empty if the data are not centered */
+    /* Per-thread buffers of _numRowsInBlock centered rows, null if the data are not centered */
+    daal::internal::UniquePtr<daal::tls<algorithmFPType *>, cpu> _centeredBlocks;
+    size_t _nFeatures;
+    size_t _nComponents;
+    bool _isPrepared;
 };
 } // namespace internal
 } // namespace transform
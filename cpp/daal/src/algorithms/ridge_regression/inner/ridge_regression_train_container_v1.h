@@ -0,0 +1,77 @@
+/* file: ridge_regression_train_container_v1.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of ridge regression container.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_TRAIN_CONTAINER_V1_H__
+#define __RIDGE_REGRESSION_TRAIN_CONTAINER_V1_H__
+
+#include "src/algorithms/kernel.h"
+#include "src/algorithms/ridge_regression/inner/ridge_regression_training_batch_v1.h"
+#include "src/algorithms/ridge_regression/ridge_regression_train_kernel.h"
+#include "algorithms/ridge_regression/ridge_regression_ne_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace training
+{
+namespace interface1
+{
+template <typename algorithmFPType, training::Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::BatchKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, training::Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+/* The parameter of the previous interface has no grid of ridge parameters, so the single model is trained */
+template <typename algorithmFPType, training::Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * const input                                            = static_cast<Input *>(_in);
+    Result * const result                                          = static_cast<Result *>(_res);
+    const ridge_regression::interface1::TrainParameter * const par = static_cast<const ridge_regression::interface1::TrainParameter *>(_par);
+
+    ridge_regression::ModelNormEqPtr m = ridge_regression::ModelNormEq::cast(result->get(model));
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
+                       *(input->get(dependentVariables)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag,
+                       *(par->ridgeParameters));
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
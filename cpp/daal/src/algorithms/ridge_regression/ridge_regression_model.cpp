@@ -46,6 +46,24 @@ services::Status TrainParameter::check() const
 
 } // namespace interface1
 
+namespace interface2
+{
+TrainParameter::TrainParameter() : interface1::TrainParameter(), nFolds(5) {}
+
+services::Status TrainParameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, interface1::TrainParameter::check());
+    if (ridgeParametersGrid)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(ridgeParametersGrid.get(), ridgeParametersGridStr(), packed_mask));
+        DAAL_CHECK_EX(nFolds >= 2, ErrorIncorrectParameter, ParameterName, nFoldsStr());
+    }
+    return s;
+}
+
+} // namespace interface2
+
 Status checkModel(ridge_regression::Model * model, const daal::algorithms::Parameter & par, size_t nBeta, size_t nResponses, int method)
 {
     services::Status s;
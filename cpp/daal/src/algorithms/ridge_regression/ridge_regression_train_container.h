@@ -73,6 +73,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
+    if (par->ridgeParametersGrid)
+    {
+        __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeCrossValidation,
+                           *(input->get(data)), *(input->get(dependentVariables)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()),
+                           par->interceptFlag, *(par->ridgeParametersGrid), par->nFolds, *(result->get(crossValidationErrors)),
+                           *(result->get(bestRidgeParameters)));
+    }
+
     __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
                        *(input->get(dependentVariables)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag,
                        *(par->ridgeParameters));
@@ -99,9 +107,9 @@ OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
 template <typename algorithmFPType, training::Method method, CpuType cpu>
 services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
 {
-    Input * const input                 = static_cast<Input *>(_in);
-    PartialResult * const partialResult = static_cast<PartialResult *>(_pres);
-    TrainParameter * const par          = static_cast<TrainParameter *>(_par);
+    Input * const input                                            = static_cast<Input *>(_in);
+    PartialResult * const partialResult                            = static_cast<PartialResult *>(_pres);
+    const ridge_regression::interface1::TrainParameter * const par = static_cast<const ridge_regression::interface1::TrainParameter *>(_par);
 
     ridge_regression::ModelNormEqPtr m = ridge_regression::ModelNormEq::cast(partialResult->get(training::partialModel));
 
@@ -117,9 +125,9 @@ services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
 template <typename algorithmFPType, training::Method method, CpuType cpu>
 services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
 {
-    PartialResult * const partialResult = static_cast<PartialResult *>(_pres);
-    Result * const result               = static_cast<Result *>(_res);
-    TrainParameter * const par          = static_cast<TrainParameter *>(_par);
+    PartialResult * const partialResult                            = static_cast<PartialResult *>(_pres);
+    Result * const result                                          = static_cast<Result *>(_res);
+    const ridge_regression::interface1::TrainParameter * const par = static_cast<const ridge_regression::interface1::TrainParameter *>(_par);
 
     ridge_regression::ModelNormEqPtr pm = ridge_regression::ModelNormEq::cast(partialResult->get(training::partialModel));
     ridge_regression::ModelNormEqPtr m  = ridge_regression::ModelNormEq::cast(result->get(training::model));
@@ -180,9 +188,9 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
 template <typename algorithmFPType, training::Method method, CpuType cpu>
 services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
 {
-    PartialResult * const partialResult = static_cast<PartialResult *>(_pres);
-    Result * const result               = static_cast<Result *>(_res);
-    TrainParameter * const par          = static_cast<TrainParameter *>(_par);
+    PartialResult * const partialResult                            = static_cast<PartialResult *>(_pres);
+    Result * const result                                          = static_cast<Result *>(_res);
+    const ridge_regression::interface1::TrainParameter * const par = static_cast<const ridge_regression::interface1::TrainParameter *>(_par);
 
     ridge_regression::ModelNormEqPtr pm = ridge_regression::ModelNormEq::cast(partialResult->get(training::partialModel));
     ridge_regression::ModelNormEqPtr m  = ridge_regression::ModelNormEq::cast(result->get(training::model));
@@ -24,6 +24,7 @@
 
 #include "src/algorithms/ridge_regression/ridge_regression_train_container.h"
 #include "src/algorithms/ridge_regression/ridge_regression_train_dense_normeq_impl.i"
+#include "src/algorithms/ridge_regression/ridge_regression_train_dense_normeq_cv_impl.i"
 
 namespace daal
 {
@@ -33,11 +34,11 @@ namespace ridge_regression
 {
 namespace training
 {
-namespace interface1
+namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, normEqDense, DAAL_CPU>;
 
-} // namespace interface1
+} // namespace interface2
 
 namespace internal
 {
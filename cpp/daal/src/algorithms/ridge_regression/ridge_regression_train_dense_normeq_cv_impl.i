@@ -0,0 +1,408 @@
+/* file: ridge_regression_train_dense_normeq_cv_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the ridge parameters selection by the k-fold cross-validation
+//  for the normal equations method.
+//  The folds are the contiguous ranges of rows. X'^T X', X'^T Y and Y^T Y are
+//  accumulated for every fold in one pass over the data set, the partial sums of
+//  the training part of the fold are the totals minus the sums of the fold.
+//  The intercept term is not penalized, so the normal equations are solved for the
+//  centered data: with X_c^T X_c = V diag(l) V^T the coefficients for the ridge
+//  parameter a are b(a) = V diag(1 / (l + a)) V^T X_c^T y_c for all the candidate
+//  ridge parameters at once. The sum of the squared errors on the fold is
+//  y^T y - 2 b'^T X'^T y + b'^T X'^T X' b', computed from the partial sums of the fold.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_CV_IMPL_I__
+#define __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_CV_IMPL_I__
+
+#include "src/algorithms/ridge_regression/ridge_regression_train_kernel.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_lapack.h"
+#include "src/externals/service_memory.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/**
+ *  Eigendecomposition of the normal equations for the centered data.
+ *  The coefficients are stored in the arrays of size P' with the intercept term in the last position,
+ *  the same way as the columns of X'^T X'
+ */
+template <typename algorithmFPType, CpuType cpu>
+class RidgeEigenSystem
+{
+public:
+    RidgeEigenSystem(size_t nFeatures, size_t nResponses, bool interceptFlag)
+        : _nFeatures(nFeatures),
+          _nResponses(nResponses),
+          _nBetasIntercept(interceptFlag ? nFeatures + 1 : nFeatures),
+          _interceptFlag(interceptFlag),
+          _eigenvectors(nFeatures * nFeatures),
+          _eigenvalues(nFeatures),
+          _projections(nResponses * nFeatures),
+          _xMeans(nFeatures),
+          _yMeans(nResponses)
+    {}
+
+    /**
+     *  Computes the eigendecomposition of the normal equations
+     *  \param[in] xtx  Symmetric matrix X'^T X' of size P' x P'
+     *  \param[in] xty  Matrix X'^T Y of size Ny x P'
+     */
+    Status init(const algorithmFPType * xtx, const algorithmFPType * xty)
+    {
+        algorithmFPType * const v     = _eigenvectors.get();
+        algorithmFPType * const u     = _projections.get();
+        algorithmFPType * const xMean = _xMeans.get();
+        algorithmFPType * const yMean = _yMeans.get();
+        DAAL_CHECK_MALLOC(v && u && _eigenvalues.get() && xMean && yMean);
+
+        const size_t p          = _nFeatures;
+        const size_t nBetas     = _nBetasIntercept;
+        const algorithmFPType n = (_interceptFlag ? xtx[p * nBetas + p] : algorithmFPType(0));
+        DAAL_CHECK(!_interceptFlag || n > 0, services::ErrorIncorrectNumberOfObservations);
+
+        for (size_t j = 0; j < p; ++j) xMean[j] = (_interceptFlag ? xtx[p * nBetas + j] / n : algorithmFPType(0));
+        for (size_t r = 0; r < _nResponses; ++r) yMean[r] = (_interceptFlag ? xty[r * nBetas + p] / n : algorithmFPType(0));
+
+        /* X_c^T y_c is stored in the projections array until the eigenvectors are computed */
+        for (size_t i = 0; i < p; ++i)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; ++j)
+            {
+                v[i * p + j] = xtx[i * nBetas + j] - n * xMean[i] * xMean[j];
+            }
+        }
+        for (size_t r = 0; r < _nResponses; ++r)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; ++j)
+            {
+                u[r * p + j] = xty[r * nBetas + j] - n * xMean[j] * yMean[r];
+            }
+        }
+
+        char jobz       = 'V';
+        char uplo       = 'U';
+        DAAL_INT dim    = p;
+        DAAL_INT lwork  = 2 * p * p + 6 * p + 1;
+        DAAL_INT liwork = 5 * p + 3;
+        DAAL_INT info   = 0;
+
+        TArray<algorithmFPType, cpu> work(lwork);
+        TArray<DAAL_INT, cpu> iwork(liwork);
+        TArray<algorithmFPType, cpu> xtyCentered(_nResponses * p);
+        DAAL_CHECK_MALLOC(work.get() && iwork.get() && xtyCentered.get());
+
+        Lapack<algorithmFPType, cpu>::xxsyevd(&jobz, &uplo, &dim, v, &dim, _eigenvalues.get(), work.get(), &lwork, iwork.get(), &liwork, &info);
+        DAAL_CHECK(info == 0, services::ErrorRidgeRegressionInternal);
+
+        /* Projections of X_c^T y_c onto the eigenvectors: row i of v contains eigenvector i */
+        const size_t xtySize = _nResponses * p * sizeof(algorithmFPType);
+        int result           = daal::services::internal::daal_memcpy_s(xtyCentered.get(), xtySize, u, xtySize);
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        const char trans   = 'T';
+        const char notrans = 'N';
+        const DAAL_INT ny  = _nResponses;
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &dim, &ny, &dim, &one, v, &dim, xtyCentered.get(), &dim, &zero, u, &dim);
+        return Status();
+    }
+
+    /**
+     *  Computes the coefficients for all the pairs of the candidate ridge parameters and the dependent variables
+     *  \param[in]  ridge        Array of size nRidge x nRidgeColumns with the candidate ridge parameters,
+     *                           nRidgeColumns is 1 or Ny
+     *  \param[in]  nRidge       Number of the candidate ridge parameters
+     *  \param[in]  nRidgeColumns Number of columns in the array of the ridge parameters
+     *  \param[out] betas        Array of size (nRidge * Ny) x P', row a * Ny + r contains the coefficients
+     *                           of the dependent variable r for the ridge parameter a
+     */
+    Status computeBetas(const algorithmFPType * ridge, size_t nRidge, size_t nRidgeColumns, algorithmFPType * betas) const
+    {
+        const size_t p          = _nFeatures;
+        const size_t nSolutions = nRidge * _nResponses;
+        TArray<algorithmFPType, cpu> weightsArray(nSolutions * p);
+        algorithmFPType * const weights = weightsArray.get();
+        DAAL_CHECK_MALLOC(weights);
+
+        const algorithmFPType * const lambda = _eigenvalues.get();
+        const algorithmFPType * const u      = _projections.get();
+        for (size_t a = 0; a < nRidge; ++a)
+        {
+            for (size_t r = 0; r < _nResponses; ++r)
+            {
+                const algorithmFPType alpha = ridge[a * nRidgeColumns + (nRidgeColumns == 1 ? 0 : r)];
+                algorithmFPType * const w   = weights + (a * _nResponses + r) * p;
+                for (size_t i = 0; i < p; ++i)
+                {
+                    /* Negative eigenvalues of the positive semi-definite matrix come from the rounding errors */
+                    const algorithmFPType denominator = (lambda[i] > 0 ? lambda[i] : algorithmFPType(0)) + alpha;
+                    w[i]                              = (denominator > 0 ? u[r * p + i] / denominator : algorithmFPType(0));
+                }
+            }
+        }
+
+        const char notrans     = 'N';
+        const DAAL_INT dim     = p;
+        const DAAL_INT nSol    = nSolutions;
+        const DAAL_INT ldBetas = _nBetasIntercept;
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &nSol, &dim, &one, _eigenvectors.get(), &dim, weights, &dim, &zero, betas,
+                                           &ldBetas);
+
+        if (_interceptFlag)
+        {
+            const algorithmFPType * const xMean = _xMeans.get();
+            for (size_t q = 0; q < nSolutions; ++q)
+            {
+                algorithmFPType * const b = betas + q * _nBetasIntercept;
+                algorithmFPType intercept = _yMeans.get()[q % _nResponses];
+                for (size_t j = 0; j < p; ++j)
+                {
+                    intercept -= xMean[j] * b[j];
+                }
+                b[p] = intercept;
+            }
+        }
+        return Status();
+    }
+
+private:
+    size_t _nFeatures;
+    size_t _nResponses;
+    size_t _nBetasIntercept;
+    bool _interceptFlag;
+    TArray<algorithmFPType, cpu> _eigenvectors; /* Matrix of size P x P, row i contains eigenvector i */
+    TArray<algorithmFPType, cpu> _eigenvalues;
+    TArray<algorithmFPType, cpu> _projections; /* Matrix of size Ny x P with V^T X_c^T y_c */
+    TArray<algorithmFPType, cpu> _xMeans;
+    TArray<algorithmFPType, cpu> _yMeans;
+};
+
+/**
+ *  Fills the lower triangle of the matrix X'^T X' of size P' x P' computed by the normal equations update
+ */
+template <typename algorithmFPType, CpuType cpu>
+void symmetrize(algorithmFPType * xtx, size_t nBetasIntercept)
+{
+    for (size_t i = 0; i < nBetasIntercept; ++i)
+    {
+        for (size_t j = 0; j < i; ++j)
+        {
+            xtx[j * nBetasIntercept + i] = xtx[i * nBetasIntercept + j];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computeCrossValidation(const NumericTable & x, const NumericTable & y,
+                                                                                        NumericTable & xtx, NumericTable & xty, NumericTable & beta,
+                                                                                        bool interceptFlag, const NumericTable & ridgeGrid,
+                                                                                        size_t nFolds, NumericTable & cvErrors,
+                                                                                        NumericTable & bestRidge) const
+{
+    const size_t nRows           = x.getNumberOfRows();
+    const size_t nFeatures       = x.getNumberOfColumns();
+    const size_t nResponses      = y.getNumberOfColumns();
+    const size_t nBetasIntercept = (interceptFlag ? nFeatures + 1 : nFeatures);
+    const size_t nRidge          = ridgeGrid.getNumberOfRows();
+    const size_t nRidgeColumns   = ridgeGrid.getNumberOfColumns();
+    const size_t nSolutions      = nRidge * nResponses;
+    const size_t xtxSize         = nBetasIntercept * nBetasIntercept;
+    const size_t xtySize         = nResponses * nBetasIntercept;
+
+    ReadRows<algorithmFPType, cpu> ridgeBlock(const_cast<NumericTable &>(ridgeGrid), 0, nRidge);
+    DAAL_CHECK_BLOCK_STATUS(ridgeBlock);
+    const algorithmFPType * const ridge = ridgeBlock.get();
+
+    /* Partial sums of every fold followed by the totals */
+    TArray<algorithmFPType, cpu> foldXtxArray((nFolds + 1) * xtxSize);
+    TArray<algorithmFPType, cpu> foldXtyArray((nFolds + 1) * xtySize);
+    TArray<algorithmFPType, cpu> foldYtyArray(nFolds * nResponses);
+    algorithmFPType * const foldXtx = foldXtxArray.get();
+    algorithmFPType * const foldXty = foldXtyArray.get();
+    algorithmFPType * const foldYty = foldYtyArray.get();
+    DAAL_CHECK_MALLOC(foldXtx && foldXty && foldYty);
+    service_memset<algorithmFPType, cpu>(foldXtx, 0, (nFolds + 1) * xtxSize);
+    service_memset<algorithmFPType, cpu>(foldXty, 0, (nFolds + 1) * xtySize);
+    service_memset<algorithmFPType, cpu>(foldYty, 0, nFolds * nResponses);
+
+    algorithmFPType * const totalXtx = foldXtx + nFolds * xtxSize;
+    algorithmFPType * const totalXty = foldXty + nFolds * xtySize;
+
+    Status st;
+    for (size_t f = 0; f < nFolds; ++f)
+    {
+        const size_t startRow           = f * nRows / nFolds;
+        const size_t endRow             = (f + 1) * nRows / nFolds;
+        algorithmFPType * const xtxFold = foldXtx + f * xtxSize;
+        algorithmFPType * const xtyFold = foldXty + f * xtySize;
+        DAAL_CHECK_STATUS(st, UpdateKernelType::updateRows(x, y, startRow, endRow - startRow, xtxFold, xtyFold, nBetasIntercept));
+        symmetrize<algorithmFPType, cpu>(xtxFold, nBetasIntercept);
+
+        ReadRows<algorithmFPType, cpu> yBlock(const_cast<NumericTable &>(y), startRow, endRow - startRow);
+        DAAL_CHECK_BLOCK_STATUS(yBlock);
+        const algorithmFPType * const yFold = yBlock.get();
+        for (size_t i = 0; i < endRow - startRow; ++i)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t r = 0; r < nResponses; ++r)
+            {
+                foldYty[f * nResponses + r] += yFold[i * nResponses + r] * yFold[i * nResponses + r];
+            }
+        }
+
+        for (size_t i = 0; i < xtxSize; ++i) totalXtx[i] += xtxFold[i];
+        for (size_t i = 0; i < xtySize; ++i) totalXty[i] += xtyFold[i];
+    }
+
+    /* Sums of the squared errors of every fold for all the pairs of the candidate ridge parameters and the dependent variables */
+    TArray<double, cpu> foldErrorsArray(nFolds * nSolutions);
+    double * const foldErrors = foldErrorsArray.get();
+    DAAL_CHECK_MALLOC(foldErrors);
+
+    SafeStatus safeStat;
+    daal::threader_for(nFolds, nFolds, [&](size_t f) {
+        const algorithmFPType * const xtxFold = foldXtx + f * xtxSize;
+        const algorithmFPType * const xtyFold = foldXty + f * xtySize;
+
+        TArray<algorithmFPType, cpu> trainXtx(xtxSize);
+        TArray<algorithmFPType, cpu> trainXty(xtySize);
+        TArray<algorithmFPType, cpu> betas(nSolutions * nBetasIntercept);
+        TArray<algorithmFPType, cpu> xtxBetas(nSolutions * nBetasIntercept);
+        DAAL_CHECK_THR(trainXtx.get() && trainXty.get() && betas.get() && xtxBetas.get(), services::ErrorMemoryAllocationFailed);
+
+        for (size_t i = 0; i < xtxSize; ++i) trainXtx[i] = totalXtx[i] - xtxFold[i];
+        for (size_t i = 0; i < xtySize; ++i) trainXty[i] = totalXty[i] - xtyFold[i];
+
+        RidgeEigenSystem<algorithmFPType, cpu> system(nFeatures, nResponses, interceptFlag);
+        Status localSt = system.init(trainXtx.get(), trainXty.get());
+        DAAL_CHECK_STATUS_THR(localSt);
+        localSt = system.computeBetas(ridge, nRidge, nRidgeColumns, betas.get());
+        DAAL_CHECK_STATUS_THR(localSt);
+
+        const char notrans  = 'N';
+        const DAAL_INT dim  = nBetasIntercept;
+        const DAAL_INT nSol = nSolutions;
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &nSol, &dim, &one, xtxFold, &dim, betas.get(), &dim, &zero, xtxBetas.get(),
+                                           &dim);
+
+        /* The error y^T y + b^T (G b - 2 X^T y) is a small difference of large terms, so it is accumulated in double precision */
+        for (size_t q = 0; q < nSolutions; ++q)
+        {
+            const size_t r                   = q % nResponses;
+            const algorithmFPType * const b  = betas.get() + q * nBetasIntercept;
+            const algorithmFPType * const gb = xtxBetas.get() + q * nBetasIntercept;
+            double error                     = double(foldYty[f * nResponses + r]);
+            for (size_t j = 0; j < nBetasIntercept; ++j)
+            {
+                error += double(b[j]) * (double(gb[j]) - 2.0 * double(xtyFold[r * nBetasIntercept + j]));
+            }
+            foldErrors[f * nSolutions + q] = (error > 0.0 ? error : 0.0);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> errorsBlock(cvErrors, 0, nRidge);
+        DAAL_CHECK_BLOCK_STATUS(errorsBlock);
+        algorithmFPType * const errors = errorsBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> bestRidgeBlock(bestRidge, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(bestRidgeBlock);
+        algorithmFPType * const best = bestRidgeBlock.get();
+
+        for (size_t q = 0; q < nSolutions; ++q)
+        {
+            double error = 0.0;
+            for (size_t f = 0; f < nFolds; ++f)
+            {
+                error += foldErrors[f * nSolutions + q];
+            }
+            errors[q] = algorithmFPType(error / double(nRows));
+        }
+
+        for (size_t r = 0; r < nResponses; ++r)
+        {
+            size_t bestIndex = 0;
+            for (size_t a = 1; a < nRidge; ++a)
+            {
+                if (errors[a * nResponses + r] < errors[bestIndex * nResponses + r]) bestIndex = a;
+            }
+            best[r] = ridge[bestIndex * nRidgeColumns + (nRidgeColumns == 1 ? 0 : r)];
+        }
+
+        /* The model is trained on the full data set with the selected ridge parameters */
+        TArray<algorithmFPType, cpu> betasArray(nResponses * nBetasIntercept);
+        DAAL_CHECK_MALLOC(betasArray.get());
+        RidgeEigenSystem<algorithmFPType, cpu> system(nFeatures, nResponses, interceptFlag);
+        DAAL_CHECK_STATUS(st, system.init(totalXtx, totalXty));
+        DAAL_CHECK_STATUS(st, system.computeBetas(best, 1, nResponses, betasArray.get()));
+
+        WriteOnlyRows<algorithmFPType, cpu> betaBlock(beta, 0, nResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaBlock);
+        algorithmFPType * const betaPtr = betaBlock.get();
+        for (size_t r = 0; r < nResponses; ++r)
+        {
+            const algorithmFPType * const b = betasArray.get() + r * nBetasIntercept;
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                betaPtr[r * (nFeatures + 1) + j + 1] = b[j];
+            }
+            betaPtr[r * (nFeatures + 1)] = (interceptFlag ? b[nFeatures] : algorithmFPType(0));
+        }
+    }
+
+    DAAL_CHECK_STATUS(st, FinalizeKernelType::copyDataToTable(totalXtx, xtxSize * sizeof(algorithmFPType), xtx));
+    DAAL_CHECK_STATUS(st, FinalizeKernelType::copyDataToTable(totalXty, xtySize * sizeof(algorithmFPType), xty));
+    return st;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -68,6 +68,15 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
 public:
     Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, NumericTable & beta, bool interceptFlag,
                    const NumericTable & ridge) const;
+
+    /**
+     * Selects the ridge parameters by the k-fold cross-validation and trains the model with the selected parameters.
+     * The data set is read once: the partial sums of the normal equations are accumulated for every fold and the
+     * systems for all the candidate ridge parameters are solved via one eigendecomposition per fold
+     */
+    Status computeCrossValidation(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, NumericTable & beta,
+                                  bool interceptFlag, const NumericTable & ridgeGrid, size_t nFolds, NumericTable & cvErrors,
+                                  NumericTable & bestRidge) const;
 };
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
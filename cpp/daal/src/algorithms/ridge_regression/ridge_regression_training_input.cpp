@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
+#include "src/services/daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -98,11 +99,20 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     const NumericTablePtr dependentVariableTable = get(dependentVariables);
     const size_t nColumnsInDepVariable           = dependentVariableTable->getNumberOfColumns();
 
-    TrainParameter * trainParameter = static_cast<TrainParameter *>(const_cast<daal::algorithms::Parameter *>(par));
+    const ridge_regression::interface1::TrainParameter * trainParameter = static_cast<const ridge_regression::interface1::TrainParameter *>(par);
     DAAL_CHECK_STATUS(s, trainParameter->check());
 
     size_t ridgeParamsNumberOfColumns = trainParameter->ridgeParameters->getNumberOfColumns();
     DAAL_CHECK((ridgeParamsNumberOfColumns == 1) || (nColumnsInDepVariable == ridgeParamsNumberOfColumns), ErrorIncorrectNumberOfColumns);
+
+    /* Only the parameter of the batch processing mode has the grid of ridge parameters */
+    const ridge_regression::interface2::TrainParameter * cvParameter = dynamic_cast<const ridge_regression::interface2::TrainParameter *>(par);
+    if (cvParameter && cvParameter->ridgeParametersGrid)
+    {
+        size_t gridNumberOfColumns = cvParameter->ridgeParametersGrid->getNumberOfColumns();
+        DAAL_CHECK((gridNumberOfColumns == 1) || (nColumnsInDepVariable == gridNumberOfColumns), ErrorIncorrectNumberOfColumns);
+        DAAL_CHECK_EX(cvParameter->nFolds <= nRowsInData, ErrorIncorrectParameter, ParameterName, nFoldsStr());
+    }
     return services::Status();
 }
 
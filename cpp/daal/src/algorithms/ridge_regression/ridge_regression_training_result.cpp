@@ -23,6 +23,7 @@
 
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
 #include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -38,7 +39,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultId + 1) {}
+Result::Result() : linear_model::training::Result(lastOptionalResultNumericTableId + 1) {}
 
 /**
  * Returns the result of ridge regression model-based training
@@ -60,6 +61,26 @@ void Result::set(ResultId id, const daal::algorithms::ridge_regression::ModelPtr
     linear_model::training::Result::set(linear_model::training::ResultId(id), value);
 }
 
+/**
+ * Returns the optional result of ridge regression model-based training
+ * \param[in] id    Identifier of the optional result
+ * \return          Optional result that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Result::get(OptionalResultNumericTableId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the optional result of ridge regression model-based training
+ * \param[in] id      Identifier of the optional result
+ * \param[in] value   Optional result
+ */
+void Result::set(OptionalResultNumericTableId id, const data_management::NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of ridge regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -83,6 +104,14 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 
     const ridge_regression::ModelPtr model = get(training::model);
 
+    const ridge_regression::interface2::TrainParameter * trainParameter = dynamic_cast<const ridge_regression::interface2::TrainParameter *>(par);
+    if (trainParameter && trainParameter->ridgeParametersGrid)
+    {
+        const size_t nRidgeParameters = trainParameter->ridgeParametersGrid->getNumberOfRows();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(crossValidationErrors).get(), crossValidationErrorsStr(), 0, 0, nResponses, nRidgeParameters));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(bestRidgeParameters).get(), bestRidgeParametersStr(), 0, 0, nResponses, 1));
+    }
+
     return ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
 }
 
@@ -96,7 +125,7 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
  */
 services::Status Result::check(const daal::algorithms::PartialResult * pr, const daal::algorithms::Parameter * par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastOptionalResultNumericTableId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     const PartialResult * partRes = static_cast<const PartialResult *>(pr);
 
     ridge_regression::ModelPtr model = get(training::model);
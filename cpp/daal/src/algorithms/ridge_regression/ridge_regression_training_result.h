@@ -25,6 +25,7 @@
 #define __RIDGE_REGRESSION_TRAINING_RESULT_H__
 
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "src/algorithms/ridge_regression/ridge_regression_ne_model_impl.h"
 
 namespace daal
@@ -56,6 +57,18 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
                        in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s)));
     }
 
+    const ridge_regression::interface2::TrainParameter * const trainParameter =
+        dynamic_cast<const ridge_regression::interface2::TrainParameter *>(parameter);
+    if (s && trainParameter && trainParameter->ridgeParametersGrid)
+    {
+        const size_t nResponses       = in->getNumberOfDependentVariables();
+        const size_t nRidgeParameters = trainParameter->ridgeParametersGrid->getNumberOfRows();
+        set(crossValidationErrors, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                       nResponses, nRidgeParameters, data_management::NumericTableIface::doAllocate, &s));
+        set(bestRidgeParameters,
+            data_management::HomogenNumericTable<algorithmFPType>::create(nResponses, 1, data_management::NumericTableIface::doAllocate, &s));
+    }
+
     return s;
 }
 
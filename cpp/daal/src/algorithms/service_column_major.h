@@ -0,0 +1,95 @@
+/* file: service_column_major.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Copying of numeric tables into the column-major layout used by the solvers
+//  that access the data set by features.
+//--
+*/
+
+#ifndef __SERVICE_COLUMN_MAJOR_H__
+#define __SERVICE_COLUMN_MAJOR_H__
+
+#include "data_management/data/soa_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+using daal::data_management::NumericTable;
+using daal::data_management::SOANumericTable;
+
+/**
+ *  Copies the data set into the array of the columns of size nRows
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status copyToColumnMajor(NumericTable & x, algorithmFPType * xt)
+{
+    const size_t nRows     = x.getNumberOfRows();
+    const size_t nFeatures = x.getNumberOfColumns();
+    SafeStatus safeStat;
+
+    if (dynamic_cast<SOANumericTable *>(&x))
+    {
+        daal::threader_for(nFeatures, nFeatures, [&](const size_t j) {
+            daal::internal::ReadColumns<algorithmFPType, cpu> xBD(x, j, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            const int result = daal::services::internal::daal_memcpy_s(xt + j * nRows, nRows * sizeof(algorithmFPType), xBD.get(),
+                                                                       nRows * sizeof(algorithmFPType));
+            DAAL_CHECK_THR(!result, services::ErrorMemoryCopyFailedInternal);
+        });
+        return safeStat.detach();
+    }
+
+    const size_t blockSize = 256;
+    size_t nBlocks         = nRows / blockSize;
+    nBlocks += (nBlocks * blockSize != nRows);
+
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t startRow       = iBlock * blockSize;
+        const size_t numRowsInBlock = (iBlock + 1 == nBlocks ? nRows : startRow + blockSize) - startRow;
+
+        daal::internal::ReadRows<algorithmFPType, cpu> xBD(x, startRow, numRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType * const xPtr = xBD.get();
+
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            algorithmFPType * const column = xt + j * nRows + startRow;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < numRowsInBlock; ++i)
+            {
+                column[i] = xPtr[i * nFeatures + j];
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -27,7 +27,9 @@
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_blas.h"
+#include "src/externals/service_spblas.h"
 #include "src/externals/service_memory.h"
+#include "src/algorithms/svm/svm_primal_weights.h"
 
 namespace daal
 {
@@ -198,6 +200,13 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         const size_t nBlocks = nVectors / nRowsPerBlock + !!(nVectors % nRowsPerBlock);
 
         const NumericTablePtr svTable = model->getSupportVectors();
+
+        const kernel_function::linear::Parameter * const linearPar = svm::internal::getLinearKernelParameter(kernel);
+        if (linearPar)
+        {
+            return computeLinear(xTable, model, svTable, svCoeff, nSV, *linearPar, bias, distance, nRowsPerBlock, nBlocks);
+        }
+
         /* LS data initialization */
         using TPredictTask = PredictTask<algorithmFPType, cpu>;
         daal::ls<TPredictTask *> lsTask([&]() {
@@ -247,6 +256,97 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         lsTask.reduce([](PredictTask<algorithmFPType, cpu> * local) { delete local; });
         return safeStat.detach();
     }
+
+protected:
+    /**
+     *  Computes the distance function of the model with the linear kernel k * <x, y> + b in the primal form
+     *  D(x) = k * <w, x> + b * sum(coeff_i) + bias, w = sum(coeff_i * sv_i), that does not depend on the number of support vectors.
+     *  The weights stored in the model at the training are used if the model has them, otherwise they are computed at each call
+     */
+    services::Status computeLinear(const NumericTablePtr & xTable, Model * model, const NumericTablePtr & svTable,
+                                   const algorithmFPType * const svCoeff, const size_t nSV, const kernel_function::linear::Parameter & linearPar,
+                                   const algorithmFPType bias, algorithmFPType * const distance, const size_t nRowsPerBlock, const size_t nBlocks)
+    {
+        const size_t nVectors  = xTable->getNumberOfRows();
+        const size_t nFeatures = xTable->getNumberOfColumns();
+
+        services::Status s;
+        TArray<algorithmFPType, cpu> wArray;
+        ReadRows<algorithmFPType, cpu> mtW;
+        const algorithmFPType * w    = nullptr;
+        const NumericTablePtr wTable = model->getPrimalWeights();
+        if (wTable && wTable->getNumberOfColumns() == nFeatures && wTable->getNumberOfRows() == 1)
+        {
+            w = mtW.set(*wTable, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(mtW);
+        }
+        else
+        {
+            wArray.reset(nFeatures);
+            DAAL_CHECK_MALLOC(wArray.get());
+            DAAL_CHECK_STATUS(s, (svm::internal::computePrimalWeights<algorithmFPType, cpu>(*svTable, svCoeff, wArray.get())));
+            w = wArray.get();
+        }
+
+        algorithmFPType sumCoeff(0.0);
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            sumCoeff += svCoeff[i];
+        }
+        const algorithmFPType k(linearPar.k);
+        const algorithmFPType shift = algorithmFPType(linearPar.b) * sumCoeff + bias;
+
+        const bool isCSR                      = xTable->getDataLayout() == NumericTableIface::csrArray;
+        CSRNumericTableIface * const csrIface = isCSR ? dynamic_cast<CSRNumericTableIface *>(xTable.get()) : nullptr;
+        DAAL_CHECK(!isCSR || csrIface, services::ErrorEmptyCSRNumericTable);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+            const size_t startRow          = iBlock * nRowsPerBlock;
+            const size_t nRowsPerBlockReal = (iBlock != nBlocks - 1) ? nRowsPerBlock : nVectors - iBlock * nRowsPerBlock;
+
+            algorithmFPType * const distanceBlock = distance + startRow;
+            service_memset_seq<algorithmFPType, cpu>(distanceBlock, shift, nRowsPerBlockReal);
+
+            algorithmFPType alpha(k);
+            algorithmFPType beta(1.0);
+            if (isCSR)
+            {
+                const bool toOneBaseRowIndices = true;
+                ReadRowsCSR<algorithmFPType, cpu> mtX(csrIface, startRow, nRowsPerBlockReal, toOneBaseRowIndices);
+                DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+
+                const char trans        = 'N';
+                const DAAL_INT m        = nRowsPerBlockReal;
+                const DAAL_INT n        = 1;
+                const DAAL_INT p        = nFeatures;
+                const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+                SpBlas<algorithmFPType, cpu>::xxcsrmm(&trans, &m, &n, &p, &alpha, matdescra, mtX.values(), (DAAL_INT *)mtX.cols(),
+                                                      (DAAL_INT *)mtX.rows(), w, &p, &beta, distanceBlock, &m);
+            }
+            else
+            {
+                ReadRows<algorithmFPType, cpu> mtX(*xTable, startRow, nRowsPerBlockReal);
+                DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+
+                char trans = 'T';
+                DAAL_INT m = nFeatures;
+                DAAL_INT n = nRowsPerBlockReal;
+                DAAL_INT incX(1);
+                DAAL_INT ldA = m;
+                DAAL_INT incY(1);
+                if (nBlocks == 1)
+                {
+                    Blas<algorithmFPType, cpu>::xgemv(&trans, &m, &n, &alpha, mtX.get(), &ldA, w, &incX, &beta, distanceBlock, &incY);
+                }
+                else
+                {
+                    Blas<algorithmFPType, cpu>::xxgemv(&trans, &m, &n, &alpha, mtX.get(), &ldA, w, &incX, &beta, distanceBlock, &incY);
+                }
+            }
+        });
+        return safeStat.detach();
+    }
 }; // namespace internal
 
 } // namespace internal
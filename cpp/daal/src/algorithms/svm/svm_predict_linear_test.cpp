@@ -0,0 +1,282 @@
+/* file: svm_predict_linear_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "algorithms/kernel_function/kernel_function_linear.h"
+#include "algorithms/svm/svm_model_builder.h"
+#include "algorithms/svm/svm_predict.h"
+#include "algorithms/svm/svm_train.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/data_archive.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "gtest/gtest.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+namespace
+{
+const size_t nFeatures = 7;
+const size_t nSV       = 5;
+const size_t nVectors  = 40;
+const double k         = 0.5;
+const double b         = 2.0;
+const double bias      = -0.25;
+
+typedef kernel_function::linear::Batch<double, kernel_function::linear::defaultDense> DenseLinearKernel;
+typedef kernel_function::linear::Batch<double, kernel_function::linear::fastCSR> CSRLinearKernel;
+
+/* Returns the rows of the matrix with about 40 percent of zeros */
+std::vector<double> generateRows(size_t nRows, unsigned int seed)
+{
+    std::vector<double> values(nRows * nFeatures);
+    unsigned int state = seed;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        state     = state * 1664525u + 1013904223u;
+        values[i] = ((state >> 8) % 10 < 4) ? 0.0 : double((state >> 8) % 2001) / 500.0 - 2.0;
+    }
+    return values;
+}
+
+NumericTablePtr createDenseTable(const std::vector<double> & values)
+{
+    const size_t nRows = values.size() / nFeatures;
+    NumericTablePtr table(new HomogenNumericTable<double>(nFeatures, nRows, NumericTable::doAllocate));
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nRows, writeOnly, block);
+    for (size_t i = 0; i < values.size(); i++) block.getBlockPtr()[i] = values[i];
+    table->releaseBlockOfRows(block);
+    return table;
+}
+
+/* Returns the table in the CSR format with the one-based indices that contains the non-zero values of the rows */
+CSRNumericTablePtr createCSRTable(const std::vector<double> & values)
+{
+    const size_t nRows = values.size() / nFeatures;
+    size_t nNonZeros   = 0;
+    for (size_t i = 0; i < values.size(); i++) nNonZeros += (values[i] != 0.0);
+
+    double * data      = NULL;
+    size_t * colIdx    = NULL;
+    size_t * rowOffset = NULL;
+    CSRNumericTablePtr table(new CSRNumericTable(data, colIdx, rowOffset, nFeatures, nRows));
+    table->allocateDataMemory(nNonZeros);
+    table->getArrays<double>(&data, &colIdx, &rowOffset);
+
+    size_t iNonZero = 0;
+    rowOffset[0]    = 1;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (values[i * nFeatures + j] == 0.0) continue;
+            data[iNonZero]   = values[i * nFeatures + j];
+            colIdx[iNonZero] = j + 1;
+            iNonZero++;
+        }
+        rowOffset[i + 1] = iNonZero + 1;
+    }
+    return table;
+}
+
+std::vector<double> readColumn(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfColumnValues(0, 0, nRows, readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + nRows);
+    table->releaseBlockOfColumnValues(block);
+    return values;
+}
+
+std::vector<double> readRows(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + nRows * table->getNumberOfColumns());
+    table->releaseBlockOfRows(block);
+    return values;
+}
+
+/* Returns the support vectors of the model as dense rows */
+std::vector<double> readSupportVectors(const svm::ModelPtr & model)
+{
+    const NumericTablePtr svTable = model->getSupportVectors();
+    const size_t nRows            = svTable->getNumberOfRows();
+    std::vector<double> values(nRows * nFeatures, 0.0);
+    if (svTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        CSRNumericTableIface * csrTable = dynamic_cast<CSRNumericTableIface *>(svTable.get());
+        CSRBlockDescriptor<double> block;
+        csrTable->getSparseBlock(0, nRows, readOnly, block);
+        const double * data      = block.getBlockValuesPtr();
+        const size_t * colIdx    = block.getBlockColumnIndicesPtr();
+        const size_t * rowOffset = block.getBlockRowIndicesPtr();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = rowOffset[i] - 1; j < rowOffset[i + 1] - 1; j++) values[i * nFeatures + colIdx[j] - 1] = data[j];
+        }
+        csrTable->releaseSparseBlock(block);
+    }
+    else
+    {
+        values = readRows(svTable);
+    }
+    return values;
+}
+
+/* Decision function in the dual form D(x) = sum(coeff_i * (k * <sv_i, x> + b)) + bias */
+std::vector<double> computeDualForm(const svm::ModelPtr & model, const std::vector<double> & x)
+{
+    const std::vector<double> sv    = readSupportVectors(model);
+    const std::vector<double> coeff = readColumn(model->getClassificationCoefficients());
+    const size_t nRows              = x.size() / nFeatures;
+
+    std::vector<double> distance(nRows, model->getBias());
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t s = 0; s < coeff.size(); s++)
+        {
+            double dot = 0.0;
+            for (size_t j = 0; j < nFeatures; j++) dot += sv[s * nFeatures + j] * x[i * nFeatures + j];
+            distance[i] += coeff[s] * (k * dot + b);
+        }
+    }
+    return distance;
+}
+
+template <typename Kernel>
+std::vector<double> predict(const svm::ModelPtr & model, const NumericTablePtr & data)
+{
+    services::SharedPtr<Kernel> kernel(new Kernel());
+    kernel->parameter.k = k;
+    kernel->parameter.b = b;
+
+    svm::prediction::Batch<double> algorithm;
+    algorithm.parameter.kernel = kernel;
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, model);
+    EXPECT_TRUE(algorithm.compute().ok());
+    return readColumn(algorithm.getResult()->get(classifier::prediction::prediction));
+}
+
+svm::ModelPtr buildModel()
+{
+    const std::vector<double> sv = generateRows(nSV, 11);
+    const double coeff[nSV]      = { -1.0, 0.75, -0.5, 1.25, -0.5 };
+
+    svm::ModelBuilder<double> builder(nFeatures, nSV);
+    builder.setSupportVectors(sv.begin(), sv.end());
+    builder.setClassificationCoefficients(coeff, coeff + nSV);
+    builder.setBias(bias);
+    return builder.getModel();
+}
+
+void expectNear(const std::vector<double> & actual, const std::vector<double> & expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_NEAR(actual[i], expected[i], 1e-10 * (1.0 + std::fabs(expected[i]))) << "observation " << i;
+    }
+}
+} // namespace
+
+TEST(svm_predict_linear_test, dense_data_matches_dual_form)
+{
+    const svm::ModelPtr model   = buildModel();
+    const std::vector<double> x = generateRows(nVectors, 22);
+    ASSERT_FALSE(model->getPrimalWeights());
+    expectNear(predict<DenseLinearKernel>(model, createDenseTable(x)), computeDualForm(model, x));
+}
+
+TEST(svm_predict_linear_test, csr_data_matches_dual_form)
+{
+    const svm::ModelPtr model   = buildModel();
+    const std::vector<double> x = generateRows(nVectors, 22);
+    expectNear(predict<CSRLinearKernel>(model, createCSRTable(x)), computeDualForm(model, x));
+}
+
+TEST(svm_predict_linear_test, stored_primal_weights_are_used)
+{
+    const svm::ModelPtr model   = buildModel();
+    const std::vector<double> x = generateRows(nVectors, 22);
+
+    /* The weights differ from the support vector expansion, so the result shows which of them is used */
+    const std::vector<double> w = generateRows(1, 33);
+    model->setPrimalWeights(createDenseTable(w));
+
+    const std::vector<double> coeff = readColumn(model->getClassificationCoefficients());
+    double sumCoeff                 = 0.0;
+    for (size_t s = 0; s < nSV; s++) sumCoeff += coeff[s];
+
+    std::vector<double> expected(nVectors, b * sumCoeff + bias);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++) expected[i] += k * w[j] * x[i * nFeatures + j];
+    }
+    expectNear(predict<DenseLinearKernel>(model, createDenseTable(x)), expected);
+    expectNear(predict<CSRLinearKernel>(model, createCSRTable(x)), expected);
+
+    model->setPrimalWeights(NumericTablePtr());
+    expectNear(predict<DenseLinearKernel>(model, createDenseTable(x)), computeDualForm(model, x));
+}
+
+TEST(svm_predict_linear_test, trained_csr_model_stores_and_serializes_primal_weights)
+{
+    const std::vector<double> xTrain = generateRows(nVectors, 44);
+    NumericTablePtr labels(new HomogenNumericTable<double>(1, nVectors, NumericTable::doAllocate));
+    BlockDescriptor<double> block;
+    labels->getBlockOfRows(0, nVectors, writeOnly, block);
+    for (size_t i = 0; i < nVectors; i++) block.getBlockPtr()[i] = (xTrain[i * nFeatures] + xTrain[i * nFeatures + 1] > 0.0) ? 1.0 : -1.0;
+    labels->releaseBlockOfRows(block);
+
+    services::SharedPtr<CSRLinearKernel> kernel(new CSRLinearKernel());
+    kernel->parameter.k = k;
+    kernel->parameter.b = b;
+
+    svm::training::Batch<double, svm::training::boser> training;
+    training.parameter.kernel = kernel;
+    training.input.set(classifier::training::data, createCSRTable(xTrain));
+    training.input.set(classifier::training::labels, labels);
+    ASSERT_TRUE(training.compute().ok());
+    const svm::ModelPtr model = training.getResult()->get(classifier::training::model);
+    ASSERT_TRUE(model->getPrimalWeights());
+    ASSERT_EQ(model->getSupportVectors()->getDataLayout(), NumericTableIface::csrArray);
+
+    const std::vector<double> x        = generateRows(nVectors, 55);
+    const std::vector<double> expected = computeDualForm(model, x);
+    expectNear(predict<CSRLinearKernel>(model, createCSRTable(x)), expected);
+
+    InputDataArchive inputArchive;
+    model->serialize(inputArchive);
+    const size_t size = inputArchive.getSizeOfArchive();
+    std::vector<byte> buffer(size);
+    inputArchive.copyArchiveToArray(buffer.data(), size);
+
+    OutputDataArchive outputArchive(buffer.data(), size);
+    const svm::ModelPtr deserialized = svm::Model::create();
+    deserialized->deserialize(outputArchive);
+    ASSERT_TRUE(deserialized->getPrimalWeights());
+    expectNear(readRows(deserialized->getPrimalWeights()), readRows(model->getPrimalWeights()));
+    expectNear(predict<CSRLinearKernel>(deserialized, createCSRTable(x)), expected);
+}
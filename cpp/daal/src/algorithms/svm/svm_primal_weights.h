@@ -0,0 +1,139 @@
+/* file: svm_primal_weights.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Weights of the SVM model with the linear kernel in the primal form:
+//  D(x) = sum(coeff_i * (k * <sv_i, x> + b)) + bias = k * <w, x> + b * sum(coeff_i) + bias,
+//  where w = sum(coeff_i * sv_i)
+//--
+*/
+
+#ifndef __SVM_PRIMAL_WEIGHTS_H__
+#define __SVM_PRIMAL_WEIGHTS_H__
+
+#include "algorithms/svm/svm_model.h"
+#include "algorithms/kernel_function/kernel_function_types_linear.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+/**
+ *  Returns the parameter of the kernel if the kernel is linear, null otherwise
+ */
+inline const kernel_function::linear::Parameter * getLinearKernelParameter(const kernel_function::KernelIfacePtr & kernel)
+{
+    return kernel ? dynamic_cast<const kernel_function::linear::Parameter *>(kernel->getParameter()) : nullptr;
+}
+
+/**
+ *  Computes the sum of the support vectors weighted by the classification coefficients, w = sum(coeff_i * sv_i)
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computePrimalWeights(NumericTable & svTable, const algorithmFPType * svCoeff, algorithmFPType * w)
+{
+    const size_t nSV       = svTable.getNumberOfRows();
+    const size_t nFeatures = svTable.getNumberOfColumns();
+    service_memset<algorithmFPType, cpu>(w, algorithmFPType(0), nFeatures);
+    if (nSV == 0) return services::Status();
+
+    if (svTable.getDataLayout() == NumericTableIface::csrArray)
+    {
+        CSRNumericTableIface * const csrIface = dynamic_cast<CSRNumericTableIface *>(&svTable);
+        DAAL_CHECK(csrIface, services::ErrorEmptyCSRNumericTable);
+
+        const bool toOneBaseRowIndices = true;
+        ReadRowsCSR<algorithmFPType, cpu> mtSV(csrIface, 0, nSV, toOneBaseRowIndices);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+        const algorithmFPType * const values = mtSV.values();
+        const size_t * const cols            = mtSV.cols();
+        const size_t * const rows            = mtSV.rows();
+
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; ++j)
+            {
+                w[cols[j] - 1] += svCoeff[i] * values[j];
+            }
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> mtSV(svTable, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+        const algorithmFPType * const sv = mtSV.get();
+
+        /* Support vectors are stored by rows, so w = SV^t * coeff */
+        char trans = 'N';
+        DAAL_INT m = nFeatures;
+        DAAL_INT n = nSV;
+        algorithmFPType alpha(1.0);
+        DAAL_INT ldA = m;
+        DAAL_INT incX(1);
+        algorithmFPType beta(0.0);
+        DAAL_INT incY(1);
+        Blas<algorithmFPType, cpu>::xgemv(&trans, &m, &n, &alpha, sv, &ldA, svCoeff, &incX, &beta, w, &incY);
+    }
+    return services::Status();
+}
+
+/**
+ *  Computes the primal weights of the trained model and stores them in the model
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status setPrimalWeights(Model & model)
+{
+    NumericTablePtr svTable      = model.getSupportVectors();
+    NumericTablePtr svCoeffTable = model.getClassificationCoefficients();
+    DAAL_CHECK(svTable && svCoeffTable, services::ErrorNullModel);
+
+    const size_t nSV       = svTable->getNumberOfRows();
+    const size_t nFeatures = svTable->getNumberOfColumns();
+
+    services::Status s;
+    NumericTablePtr wTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(nFeatures, 1, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteOnlyRows<algorithmFPType, cpu> mtW(*wTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtW);
+
+    ReadColumns<algorithmFPType, cpu> mtSVCoeff(*svCoeffTable, 0, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
+
+    DAAL_CHECK_STATUS(s, (computePrimalWeights<algorithmFPType, cpu>(*svTable, mtSVCoeff.get(), mtW.get())));
+    model.setPrimalWeights(wTable);
+    return s;
+}
+
+} // namespace internal
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
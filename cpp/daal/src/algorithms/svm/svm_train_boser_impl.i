@@ -47,6 +47,7 @@
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_ittnotify.h"
 #include "src/algorithms/svm/svm_train_result.h"
+#include "src/algorithms/svm/svm_primal_weights.h"
 #include "src/algorithms/svm/svm_train_common_impl.i"
 
 namespace daal
@@ -73,6 +74,10 @@ services::Status SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu>::compu
     DAAL_CHECK_STATUS(s, task.init(svmPar->C, wTable, yTable));
     DAAL_CHECK_STATUS(s, task.compute(*svmPar));
     DAAL_CHECK_STATUS(s, task.setResultsToModel(*xTable, *static_cast<Model *>(r)));
+    if (svm::internal::getLinearKernelParameter(svmPar->kernel))
+    {
+        DAAL_CHECK_STATUS(s, (svm::internal::setPrimalWeights<algorithmFPType, cpu>(*static_cast<Model *>(r))));
+    }
     return s;
 }
 
@@ -56,6 +56,7 @@
 #include "src/algorithms/svm/svm_train_thunder_workset.h"
 #include "src/algorithms/svm/svm_train_thunder_cache.h"
 #include "src/algorithms/svm/svm_train_result.h"
+#include "src/algorithms/svm/svm_primal_weights.h"
 
 #include "src/algorithms/svm/svm_train_common_impl.i"
 
@@ -204,6 +205,10 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu>::com
     }
     SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, cachePtr.get());
     DAAL_CHECK_STATUS(status, saveResult.compute(*xTable, *static_cast<Model *>(r), cw));
+    if (svm::internal::getLinearKernelParameter(svmPar->kernel))
+    {
+        DAAL_CHECK_STATUS(status, (svm::internal::setPrimalWeights<algorithmFPType, cpu>(*static_cast<Model *>(r))));
+    }
 
     return status;
 }
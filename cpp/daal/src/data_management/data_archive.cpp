@@ -0,0 +1,209 @@
+/* file: data_archive.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data archive over a file mapped to memory
+//--
+*/
+
+#include "data_management/data/data_archive.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface2
+{
+namespace
+{
+/* Unmaps the file when the archive and all the views of the mapping are destroyed */
+class MappingDeleter : public services::DeleterIface
+{
+public:
+    MappingDeleter(size_t size) : _size(size) {}
+
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        UnmapViewOfFile(ptr);
+#else
+        munmap(const_cast<void *>(ptr), _size);
+#endif
+    }
+
+private:
+    size_t _size;
+};
+
+/* Maps the file to the copy-on-write memory, so the objects restored from the archive are allowed to modify their data */
+byte * mapFile(const char * fileName, size_t & size)
+{
+    size = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) return NULL;
+
+    void * ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!ptr) return NULL;
+
+    size = (size_t)fileSize.QuadPart;
+    return (byte *)ptr;
+#else
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void * ptr = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) return NULL;
+
+    size = (size_t)fileStat.st_size;
+    return (byte *)ptr;
+#endif
+}
+} // namespace
+
+MappedDataArchive::MappedDataArchive(const char * fileName) : _size(0), _readOffset(0), _errors(new services::ErrorCollection())
+{
+    size_t size = 0;
+    byte * ptr  = fileName ? mapFile(fileName, size) : NULL;
+    if (!ptr)
+    {
+        _errors->add(services::ErrorOnFileOpen);
+        return;
+    }
+    _mapping = services::SharedPtr<byte>(ptr, MappingDeleter(size));
+    _size    = size;
+}
+
+void MappedDataArchive::write(byte * /*ptr*/, size_t /*size*/)
+{
+    _errors->add(services::ErrorMethodNotSupported);
+}
+
+void MappedDataArchive::read(byte * ptr, size_t size)
+{
+    const size_t alignedSize = alignValueUp(size);
+    if (!_mapping || _size < _readOffset + alignedSize)
+    {
+        _errors->add(services::ErrorOnFileRead);
+        return;
+    }
+
+    int result = daal::services::internal::daal_memcpy_s(ptr, size, _mapping.get() + _readOffset, size);
+    if (result)
+    {
+        _errors->add(services::ErrorMemoryCopyFailedInternal);
+        return;
+    }
+    _readOffset += alignedSize;
+}
+
+void MappedDataArchive::writeAligned(byte * /*ptr*/, size_t /*size*/, size_t /*alignment*/)
+{
+    _errors->add(services::ErrorMethodNotSupported);
+}
+
+size_t MappedDataArchive::alignValueUp(size_t value) const
+{
+    if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+    {
+        return value;
+    }
+
+    const size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+    return (value + alignm1) & ~alignm1;
+}
+
+bool MappedDataArchive::skipPadding(size_t alignment)
+{
+    const size_t padding = alignmentPadding(_readOffset, alignment);
+    if (!_mapping || _size < _readOffset + padding)
+    {
+        _errors->add(services::ErrorOnFileRead);
+        return false;
+    }
+    _readOffset += padding;
+    return true;
+}
+
+void MappedDataArchive::readAligned(byte * ptr, size_t size, size_t alignment)
+{
+    if (skipPadding(alignment))
+    {
+        read(ptr, size);
+    }
+}
+
+services::SharedPtr<byte> MappedDataArchive::readAlignedView(size_t size, size_t alignment)
+{
+    const size_t start = _readOffset + alignmentPadding(_readOffset, alignment);
+    if (!_mapping || _size < start + alignValueUp(size))
+    {
+        return services::SharedPtr<byte>();
+    }
+    _readOffset = start + alignValueUp(size);
+    return services::SharedPtr<byte>(_mapping, _mapping.get() + start);
+}
+
+size_t MappedDataArchive::copyArchiveToArray(byte * ptr, size_t maxLength) const
+{
+    if (!_mapping || _size > maxLength)
+    {
+        return _size;
+    }
+
+    int result = daal::services::internal::daal_memcpy_s(ptr, maxLength, _mapping.get(), _size);
+    if (result)
+    {
+        _errors->add(services::ErrorMemoryCopyFailedInternal);
+        return 0;
+    }
+    return _size;
+}
+
+} // namespace interface2
+} // namespace data_management
+} // namespace daal
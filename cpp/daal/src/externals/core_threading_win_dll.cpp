@@ -245,6 +245,13 @@ typedef void (*_daal_threader_for_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::functype2);
 typedef int (*_daal_threader_get_max_threads_t)(void);
 typedef void (*_daal_threader_for_break_t)(int, int, const void *, daal::functype_break);
+typedef void (*_daal_threader_for_grained_t)(int, int, int, const void *, daal::functype);
+typedef void (*_daal_threader_for_blocked_grained_t)(int, int, int, const void *, daal::functype2);
+
+typedef void * (*_daal_new_affinity_partitioner_t)();
+typedef void (*_daal_del_affinity_partitioner_t)(void *);
+typedef void (*_daal_threader_for_affinity_t)(int, int, void *, const void *, daal::functype);
+typedef void (*_daal_threader_for_blocked_affinity_t)(int, int, void *, const void *, daal::functype2);
 
 typedef void * (*_daal_get_tls_ptr_t)(void *, daal::tls_functype);
 typedef void (*_daal_del_tls_ptr_t)(void *);
@@ -273,6 +280,11 @@ typedef void (*_daal_tbb_task_scheduler_free_t)(void *& globalControl);
 typedef size_t (*_setNumberOfThreads_t)(const size_t, void **);
 typedef void * (*_daal_threader_env_t)();
 
+typedef void * (*_daal_new_task_arena_t)(int);
+typedef void (*_daal_del_task_arena_t)(void *);
+typedef int (*_daal_task_arena_max_concurrency_t)(void *);
+typedef void (*_daal_execute_in_task_arena_t)(void *, const void *, daal::functype_arena);
+
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 typedef void (*_thread_pinner_thread_pinner_init_t)();
 typedef void (*_thread_pinner_read_topology_t)();
@@ -294,6 +306,14 @@ static _daal_threader_for_t _daal_threader_for_optional_ptr                = NUL
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 static _daal_threader_for_break_t _daal_threader_for_break_ptr             = NULL;
 
+static _daal_threader_for_grained_t _daal_threader_for_grained_ptr                 = NULL;
+static _daal_threader_for_blocked_grained_t _daal_threader_for_blocked_grained_ptr = NULL;
+
+static _daal_new_affinity_partitioner_t _daal_new_affinity_partitioner_ptr           = NULL;
+static _daal_del_affinity_partitioner_t _daal_del_affinity_partitioner_ptr           = NULL;
+static _daal_threader_for_affinity_t _daal_threader_for_affinity_ptr                 = NULL;
+static _daal_threader_for_blocked_affinity_t _daal_threader_for_blocked_affinity_ptr = NULL;
+
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr                 = NULL;
 static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr                 = NULL;
 static _daal_get_tls_local_t _daal_get_tls_local_ptr             = NULL;
@@ -321,6 +341,11 @@ static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr                     = NULL;
 static _daal_threader_env_t _daal_threader_env_ptr                       = NULL;
 
+static _daal_new_task_arena_t _daal_new_task_arena_ptr                         = NULL;
+static _daal_del_task_arena_t _daal_del_task_arena_ptr                         = NULL;
+static _daal_task_arena_max_concurrency_t _daal_task_arena_max_concurrency_ptr = NULL;
+static _daal_execute_in_task_arena_t _daal_execute_in_task_arena_ptr           = NULL;
+
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 static _thread_pinner_thread_pinner_init_t _thread_pinner_thread_pinner_init_ptr = NULL;
 static _thread_pinner_read_topology_t _thread_pinner_read_topology_ptr           = NULL;
@@ -393,6 +418,66 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
     _daal_threader_for_break_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_grained(int n, int grainSize, int partitioner, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_grained_ptr == NULL)
+    {
+        _daal_threader_for_grained_ptr = (_daal_threader_for_grained_t)load_daal_thr_func("_daal_threader_for_grained");
+    }
+    _daal_threader_for_grained_ptr(n, grainSize, partitioner, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_grained(int n, int grainSize, int partitioner, const void * a, daal::functype2 func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_blocked_grained_ptr == NULL)
+    {
+        _daal_threader_for_blocked_grained_ptr = (_daal_threader_for_blocked_grained_t)load_daal_thr_func("_daal_threader_for_blocked_grained");
+    }
+    _daal_threader_for_blocked_grained_ptr(n, grainSize, partitioner, a, func);
+}
+
+DAAL_EXPORT void * _daal_new_affinity_partitioner()
+{
+    load_daal_thr_dll();
+    if (_daal_new_affinity_partitioner_ptr == NULL)
+    {
+        _daal_new_affinity_partitioner_ptr = (_daal_new_affinity_partitioner_t)load_daal_thr_func("_daal_new_affinity_partitioner");
+    }
+    return _daal_new_affinity_partitioner_ptr();
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_affinity_partitioner_ptr == NULL)
+    {
+        _daal_del_affinity_partitioner_ptr = (_daal_del_affinity_partitioner_t)load_daal_thr_func("_daal_del_affinity_partitioner");
+    }
+    _daal_del_affinity_partitioner_ptr(partitionerPtr);
+}
+
+DAAL_EXPORT void _daal_threader_for_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_affinity_ptr == NULL)
+    {
+        _daal_threader_for_affinity_ptr = (_daal_threader_for_affinity_t)load_daal_thr_func("_daal_threader_for_affinity");
+    }
+    _daal_threader_for_affinity_ptr(n, grainSize, partitionerPtr, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype2 func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_blocked_affinity_ptr == NULL)
+    {
+        _daal_threader_for_blocked_affinity_ptr = (_daal_threader_for_blocked_affinity_t)load_daal_thr_func("_daal_threader_for_blocked_affinity");
+    }
+    _daal_threader_for_blocked_affinity_ptr(n, grainSize, partitionerPtr, a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -623,6 +708,46 @@ DAAL_EXPORT void * _daal_threader_env()
     return _daal_threader_env_ptr();
 }
 
+DAAL_EXPORT void * _daal_new_task_arena(int max_concurrency)
+{
+    load_daal_thr_dll();
+    if (_daal_new_task_arena_ptr == NULL)
+    {
+        _daal_new_task_arena_ptr = (_daal_new_task_arena_t)load_daal_thr_func("_daal_new_task_arena");
+    }
+    return _daal_new_task_arena_ptr(max_concurrency);
+}
+
+DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_task_arena_ptr == NULL)
+    {
+        _daal_del_task_arena_ptr = (_daal_del_task_arena_t)load_daal_thr_func("_daal_del_task_arena");
+    }
+    _daal_del_task_arena_ptr(taskArenaPtr);
+}
+
+DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_task_arena_max_concurrency_ptr == NULL)
+    {
+        _daal_task_arena_max_concurrency_ptr = (_daal_task_arena_max_concurrency_t)load_daal_thr_func("_daal_task_arena_max_concurrency");
+    }
+    return _daal_task_arena_max_concurrency_ptr(taskArenaPtr);
+}
+
+DAAL_EXPORT void _daal_execute_in_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_execute_in_task_arena_ptr == NULL)
+    {
+        _daal_execute_in_task_arena_ptr = (_daal_execute_in_task_arena_t)load_daal_thr_func("_daal_execute_in_task_arena");
+    }
+    _daal_execute_in_task_arena_ptr(taskArenaPtr, a, func);
+}
+
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 DAAL_EXPORT void _thread_pinner_thread_pinner_init()
 {
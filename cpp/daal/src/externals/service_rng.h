@@ -39,6 +39,7 @@ class BaseRNGs : public BaseRNGIface<cpu>
 {
 public:
     BaseRNGs(const unsigned int _seed = 777, const int _brngId = __DAAL_BRNG_MT19937) : _baseRNG(_seed, _brngId) {}
+    BaseRNGs(const size_t n, const unsigned int * _seed, const int _brngId) : _baseRNG(n, _seed, _brngId) {}
     ~BaseRNGs() {}
 
     int getStateSize() const { return _baseRNG.getStateSize(); }
@@ -0,0 +1,299 @@
+/* file: communicator_shared_memory.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the communicator between the ranks that run in the threads of one process
+//--
+*/
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <sched.h>
+#endif
+
+#include "services/communicator.h"
+#include "services/daal_atomic_int.h"
+
+namespace daal
+{
+namespace preview
+{
+namespace comm
+{
+namespace internal
+{
+namespace
+{
+using daal::oneapi::internal::UniversalBuffer;
+using daal::oneapi::internal::TypeId;
+using daal::oneapi::internal::TypeIds;
+
+/* Gives the processor to another thread while the rank waits for the rest of the group */
+inline void yieldThread()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+/*
+ * State shared by all ranks of the group. Every collective operation publishes the local
+ * arrays of the ranks, waits on the barrier until all of them are published, lets every
+ * rank read the arrays of the others and waits on the barrier again before the arrays
+ * can be released or overwritten
+ */
+class SharedMemoryGroup
+{
+public:
+    SharedMemoryGroup(size_t nRanks) : _nRanks(nRanks), _data(nRanks), _counts(nRanks), _types(nRanks) {}
+
+    bool isAllocated() const { return _data.size() == _nRanks && _counts.size() == _nRanks && _types.size() == _nRanks; }
+
+    size_t size() const { return _nRanks; }
+
+    void publish(size_t rank, const void * data, size_t count, TypeId type)
+    {
+        _data[rank]   = data;
+        _counts[rank] = count;
+        _types[rank]  = type;
+    }
+
+    const void * data(size_t rank) const { return _data[rank]; }
+    size_t count(size_t rank) const { return _counts[rank]; }
+
+    /* Returns true if all ranks published the arrays of the same type */
+    bool isConsistent(TypeId type) const
+    {
+        for (size_t r = 0; r < _nRanks; r++)
+        {
+            if (!_data[r] || _types[r] != type) return false;
+        }
+        return true;
+    }
+
+    void barrier()
+    {
+        const int generation = _generation.get();
+        if (_arrived.inc() == int(_nRanks))
+        {
+            _arrived.set(0);
+            _generation.inc();
+            return;
+        }
+        while (_generation.get() == generation)
+        {
+            yieldThread();
+        }
+    }
+
+private:
+    const size_t _nRanks;
+    daal::services::Collection<const void *> _data;
+    daal::services::Collection<size_t> _counts;
+    daal::services::Collection<TypeId> _types;
+    daal::services::Atomic<int> _arrived;
+    daal::services::Atomic<int> _generation;
+};
+
+typedef daal::services::SharedPtr<SharedMemoryGroup> SharedMemoryGroupPtr;
+
+/*
+ * Communicator of one rank of the group. The buffers passed to the collective operations
+ * must be accessible on the host
+ */
+class SharedMemoryCommunicatorImpl : public CommunicatorIface
+{
+public:
+    SharedMemoryCommunicatorImpl(const SharedMemoryGroupPtr & group, size_t rank) : _group(group), _rank(rank) {}
+
+    virtual void allReduceSum(UniversalBuffer dest, UniversalBuffer src, size_t count, daal::services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        const daal::services::Status s = dispatchAllReduceSum(dest, src, count);
+        if (status) status->add(s);
+    }
+
+    virtual void allGatherV(UniversalBuffer dest, size_t * recvCount, UniversalBuffer src, size_t srcCount,
+                            daal::services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        const daal::services::Status s = dispatchAllGatherV(dest, recvCount, src, srcCount);
+        if (status) status->add(s);
+    }
+
+    virtual size_t size() const DAAL_C11_OVERRIDE { return _group->size(); }
+    virtual size_t rank() const DAAL_C11_OVERRIDE { return _rank; }
+
+private:
+    daal::services::Status dispatchAllReduceSum(const UniversalBuffer & dest, const UniversalBuffer & src, size_t count)
+    {
+        switch (src.type())
+        {
+        case TypeIds::float32: return allReduceSumImpl<float>(dest, src, count);
+        case TypeIds::float64: return allReduceSumImpl<double>(dest, src, count);
+        case TypeIds::int32: return allReduceSumImpl<daal::oneapi::internal::int32_t>(dest, src, count);
+        case TypeIds::int64: return allReduceSumImpl<daal::oneapi::internal::int64_t>(dest, src, count);
+        case TypeIds::uint32: return allReduceSumImpl<daal::oneapi::internal::uint32_t>(dest, src, count);
+        case TypeIds::uint64: return allReduceSumImpl<daal::oneapi::internal::uint64_t>(dest, src, count);
+        default: return skipCollective(src.type());
+        }
+    }
+
+    daal::services::Status dispatchAllGatherV(const UniversalBuffer & dest, const size_t * recvCount, const UniversalBuffer & src, size_t srcCount)
+    {
+        switch (src.type())
+        {
+        case TypeIds::float32: return allGatherVImpl<float>(dest, recvCount, src, srcCount);
+        case TypeIds::float64: return allGatherVImpl<double>(dest, recvCount, src, srcCount);
+        case TypeIds::int32: return allGatherVImpl<daal::oneapi::internal::int32_t>(dest, recvCount, src, srcCount);
+        case TypeIds::int64: return allGatherVImpl<daal::oneapi::internal::int64_t>(dest, recvCount, src, srcCount);
+        case TypeIds::uint32: return allGatherVImpl<daal::oneapi::internal::uint32_t>(dest, recvCount, src, srcCount);
+        case TypeIds::uint64: return allGatherVImpl<daal::oneapi::internal::uint64_t>(dest, recvCount, src, srcCount);
+        default: return skipCollective(src.type());
+        }
+    }
+
+    /* Takes part in the collective operation without data so that the other ranks are not blocked */
+    daal::services::Status skipCollective(TypeId type)
+    {
+        _group->publish(_rank, NULL, 0, type);
+        _group->barrier();
+        _group->barrier();
+        return daal::services::Status(daal::services::ErrorDataTypeNotSupported);
+    }
+
+    /* The sum is accumulated in the temporary array so that dest may be the same buffer as src */
+    template <typename T>
+    daal::services::Status allReduceSumImpl(const UniversalBuffer & dest, const UniversalBuffer & src, size_t count)
+    {
+        daal::services::Status s;
+        daal::services::SharedPtr<T> srcHost  = src.get<T>().toHost(data_management::readOnly, &s);
+        daal::services::SharedPtr<T> destHost = dest.get<T>().toHost(data_management::readWrite, &s);
+        daal::services::Collection<T> sum(count);
+
+        const bool isReady = s && srcHost && destHost && sum.size() == count;
+        _group->publish(_rank, isReady ? srcHost.get() : NULL, count, TypeIds::id<T>());
+        _group->barrier();
+
+        bool isConsistent = _group->isConsistent(TypeIds::id<T>());
+        for (size_t r = 0; isConsistent && r < _group->size(); r++)
+        {
+            isConsistent = _group->count(r) == count;
+        }
+        if (isConsistent)
+        {
+            for (size_t r = 0; r < _group->size(); r++)
+            {
+                const T * const data = static_cast<const T *>(_group->data(r));
+                for (size_t i = 0; i < count; i++)
+                {
+                    sum[i] += data[i];
+                }
+            }
+        }
+        _group->barrier();
+
+        if (!isReady) return s ? daal::services::Status(daal::services::ErrorMemoryAllocationFailed) : s;
+        if (!isConsistent) return daal::services::Status(daal::services::ErrorIncorrectSizeOfArray);
+
+        T * const out = destHost.get();
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = sum[i];
+        }
+        return s;
+    }
+
+    template <typename T>
+    daal::services::Status allGatherVImpl(const UniversalBuffer & dest, const size_t * recvCount, const UniversalBuffer & src, size_t srcCount)
+    {
+        daal::services::Status s;
+        daal::services::SharedPtr<T> srcHost  = src.get<T>().toHost(data_management::readOnly, &s);
+        daal::services::SharedPtr<T> destHost = dest.get<T>().toHost(data_management::writeOnly, &s);
+
+        const bool isReady = s && srcHost && destHost && recvCount;
+        _group->publish(_rank, isReady ? srcHost.get() : NULL, srcCount, TypeIds::id<T>());
+        _group->barrier();
+
+        bool isConsistent = _group->isConsistent(TypeIds::id<T>());
+        for (size_t r = 0; isConsistent && r < _group->size(); r++)
+        {
+            isConsistent = _group->count(r) == recvCount[r];
+        }
+        if (isConsistent)
+        {
+            T * out = destHost.get();
+            for (size_t r = 0; r < _group->size(); r++)
+            {
+                const T * const data = static_cast<const T *>(_group->data(r));
+                for (size_t i = 0; i < recvCount[r]; i++)
+                {
+                    out[i] = data[i];
+                }
+                out += recvCount[r];
+            }
+        }
+        _group->barrier();
+
+        if (!isReady) return s ? daal::services::Status(daal::services::ErrorNullParameterNotSupported) : s;
+        if (!isConsistent) return daal::services::Status(daal::services::ErrorIncorrectSizeOfArray);
+        return s;
+    }
+
+    SharedMemoryGroupPtr _group;
+    const size_t _rank;
+};
+
+} // namespace
+} // namespace internal
+} // namespace comm
+
+namespace services
+{
+namespace interface1
+{
+daal::services::Collection<SharedMemoryCommunicator> SharedMemoryCommunicator::createGroup(size_t nRanks, daal::services::Status * status)
+{
+    using namespace daal::preview::comm::internal;
+
+    daal::services::Collection<SharedMemoryCommunicator> group;
+    if (nRanks == 0)
+    {
+        if (status) status->add(daal::services::ErrorIncorrectParameter);
+        return group;
+    }
+
+    SharedMemoryGroupPtr sharedState(new SharedMemoryGroup(nRanks));
+    if (!sharedState || !sharedState->isAllocated())
+    {
+        if (status) status->add(daal::services::ErrorMemoryAllocationFailed);
+        return group;
+    }
+
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        group.push_back(SharedMemoryCommunicator(new SharedMemoryCommunicatorImpl(sharedState, r)));
+    }
+    return group;
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace preview
+} // namespace daal
@@ -22,6 +22,11 @@
 */
 
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/bzip2compression.h"
+#include "data_management/compression/lzocompression.h"
+#include "data_management/compression/rlecompression.h"
+#include "data_management/compression/zlibcompression.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -565,5 +570,684 @@ size_t DecompressionStream::getDecompressedDataSize()
     return _decompressedDataSize;
 }
 
+namespace internal
+{
+/* Compressed data of ParallelCompressionStream consists of segments. A segment starts with the magic number,
+   the compression method and the number of frames, followed by the raw and the compressed size of each frame
+   and by the compressed frames themselves */
+const DAAL_UINT64 frameSegmentMagic = 0x314D52464C414144ULL;
+const size_t frameSegmentHeaderSize = 3 * sizeof(DAAL_UINT64);
+const size_t frameIndexEntrySize   = 2 * sizeof(DAAL_UINT64);
+
+struct FramedCompressionState
+{
+    CBC rawFrames;                         /* Raw frames waiting for compression, the last one may be filled partially */
+    CBC frames;                            /* Compressed frames of the current segment */
+    services::Collection<size_t> rawSizes; /* Raw sizes of the compressed frames of the current segment */
+    CBC output;                            /* Sealed segments ready to be read */
+};
+
+struct FrameInfo
+{
+    size_t rawOffset;
+    size_t rawSize;
+    size_t comprOffset;
+    size_t comprSize;
+};
+
+struct FramedDecompressionState
+{
+    FramedDecompressionState()
+        : input(NULL), inputSize(0), inputCapacity(0), parsedSize(0), rawDataSize(0), readPos(0), cachedFrame(0), cache(NULL), cacheSize(0)
+    {}
+
+    ~FramedDecompressionState()
+    {
+        daal::services::daal_free(input);
+        daal::services::daal_free(cache);
+    }
+
+    byte * input;                           /* Compressed data written to the stream */
+    size_t inputSize;                       /* Size of the compressed data written to the stream */
+    size_t inputCapacity;                   /* Size of the memory allocated for the compressed data */
+    size_t parsedSize;                      /* Size of the complete segments at the beginning of the compressed data */
+    services::Collection<FrameInfo> frames; /* Frames of the complete segments */
+    size_t rawDataSize;                     /* Total size of the frames of the complete segments */
+    size_t readPos;                         /* Read position in the decompressed data */
+    size_t cachedFrame;                     /* Index of the frame stored in the cache plus one, zero if the cache is empty */
+    byte * cache;                           /* Last frame read partially */
+    size_t cacheSize;                       /* Size of the memory allocated for the cache */
+};
+
+static CompressorImpl * createCompressor(CompressionMethod method, CompressionLevel level)
+{
+    switch (method)
+    {
+    case zlib:
+    {
+        Compressor<zlib> * compressor = new Compressor<zlib>();
+        compressor->parameter.level   = level;
+        return compressor;
+    }
+    case bzip2:
+    {
+        Compressor<bzip2> * compressor = new Compressor<bzip2>();
+        compressor->parameter.level    = level;
+        return compressor;
+    }
+    case lzo: return new Compressor<lzo>();
+    case rle: return new Compressor<rle>();
+    }
+    return NULL;
+}
+
+static DecompressorImpl * createDecompressor(CompressionMethod method)
+{
+    switch (method)
+    {
+    case zlib: return new Decompressor<zlib>();
+    case bzip2: return new Decompressor<bzip2>();
+    case lzo: return new Decompressor<lzo>();
+    case rle: return new Decompressor<rle>();
+    }
+    return NULL;
+}
+
+/* Compresses one frame with its own compressor, the output buffer grows until the whole frame is compressed */
+static CompressionBlockPtr compressFrame(CompressionMethod method, CompressionLevel level, CompressionBlock * rawFrame,
+                                         services::ErrorCollection & errors)
+{
+    CompressorImpl * compressor = createCompressor(method, level);
+    if (!compressor)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return CompressionBlockPtr();
+    }
+
+    const size_t rawSize = rawFrame->getWriteOffset();
+    size_t capacity      = rawSize + rawSize / 8 + 1024;
+    size_t usedSize      = 0;
+    byte * buffer        = (byte *)daal::services::daal_malloc(capacity);
+
+    compressor->setInputDataBlock(rawFrame->getPtr(), rawSize, 0);
+    while (buffer && compressor->getErrors()->size() == 0)
+    {
+        compressor->run(buffer, capacity - usedSize, usedSize);
+        usedSize += compressor->getUsedOutputDataBlockSize();
+        if (!compressor->isOutputDataBlockFull()) break;
+
+        byte * newBuffer = (byte *)daal::services::daal_malloc(2 * capacity);
+        if (newBuffer && daal::services::internal::daal_memcpy_s(newBuffer, 2 * capacity, buffer, usedSize))
+        {
+            daal::services::daal_free(newBuffer);
+            newBuffer = NULL;
+        }
+        daal::services::daal_free(buffer);
+        buffer = newBuffer;
+        capacity *= 2;
+    }
+
+    if (!buffer)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (compressor->getErrors()->size() != 0)
+    {
+        errors.add(*(compressor->getErrors()));
+    }
+    delete compressor;
+
+    if (errors.size() != 0)
+    {
+        daal::services::daal_free(buffer);
+        return CompressionBlockPtr();
+    }
+
+    CompressionBlock * frame = new CompressionBlock(buffer, usedSize);
+    frame->setAllocState(internallocated);
+    frame->setComprState(compressed);
+    return CompressionBlockPtr(frame);
+}
+
+/* Decompresses one frame with its own decompressor directly to the output array of the frame size */
+static void decompressFrame(CompressionMethod method, byte * comprPtr, size_t comprSize, byte * outPtr, size_t rawSize,
+                            services::ErrorCollection & errors)
+{
+    DecompressorImpl * decompressor = createDecompressor(method);
+    if (!decompressor)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    decompressor->setInputDataBlock(comprPtr, comprSize, 0);
+    if (decompressor->getErrors()->size() == 0)
+    {
+        decompressor->run(outPtr, rawSize, 0);
+    }
+
+    if (decompressor->getErrors()->size() != 0)
+    {
+        errors.add(*(decompressor->getErrors()));
+    }
+    else if (decompressor->getUsedOutputDataBlockSize() != rawSize)
+    {
+        errors.add(services::ErrorCompressionFrameFormat);
+    }
+    delete decompressor;
+}
+
+static void writeUInt64(byte * ptr, size_t value)
+{
+    const DAAL_UINT64 v = (DAAL_UINT64)value;
+    daal::services::internal::daal_memcpy_s(ptr, sizeof(DAAL_UINT64), &v, sizeof(DAAL_UINT64));
+}
+
+static DAAL_UINT64 readUInt64(const byte * ptr)
+{
+    DAAL_UINT64 v = 0;
+    daal::services::internal::daal_memcpy_s(&v, sizeof(DAAL_UINT64), ptr, sizeof(DAAL_UINT64));
+    return v;
+}
+
+} // namespace internal
+
+//parallel compression stream realization
+ParallelCompressionStream::ParallelCompressionStream(CompressionMethod method, CompressionLevel level, size_t frameSize)
+    : _state(NULL), _method(method), _level(level), _frameSize(0), _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (frameSize == 0 || method < zlib || method > bzip2)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _frameSize = frameSize;
+    _state     = new internal::FramedCompressionState();
+}
+
+ParallelCompressionStream::~ParallelCompressionStream()
+{
+    delete _state;
+    _state = NULL;
+}
+
+void ParallelCompressionStream::compressFrames()
+{
+    CBC & rawFrames      = _state->rawFrames;
+    const size_t nFrames = rawFrames.size();
+    if (nFrames == 0 || this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    /* Each frame is compressed by its own compressor, the errors are collected per frame
+       and merged after the parallel region */
+    CBC frames(nFrames);
+    services::Collection<services::ErrorCollection> errors(nFrames);
+    for (size_t i = 0; i < nFrames; i++) errors[i].setCanThrow(false);
+
+    const CompressionMethod method = _method;
+    const CompressionLevel level   = _level;
+    daal::threader_for(int(nFrames), int(nFrames),
+                       [&](int i) { frames[i] = internal::compressFrame(method, level, rawFrames[i].get(), errors[i]); });
+
+    for (size_t i = 0; i < nFrames; i++)
+    {
+        if (errors[i].size() != 0)
+        {
+            this->_errors->add(errors[i]);
+            continue;
+        }
+        _state->frames.push_back(frames[i]);
+        _state->rawSizes.push_back(rawFrames[i]->getWriteOffset());
+    }
+    rawFrames.clear();
+}
+
+void ParallelCompressionStream::seal()
+{
+    compressFrames();
+    const size_t nFrames = _state->frames.size();
+    if (nFrames == 0 || this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    CompressionBlock * header = new CompressionBlock(internal::frameSegmentHeaderSize + nFrames * internal::frameIndexEntrySize);
+    byte * ptr                = header->getPtr();
+    if (!ptr)
+    {
+        delete header;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    internal::writeUInt64(ptr, internal::frameSegmentMagic);
+    internal::writeUInt64(ptr + sizeof(DAAL_UINT64), _method);
+    internal::writeUInt64(ptr + 2 * sizeof(DAAL_UINT64), nFrames);
+    ptr += internal::frameSegmentHeaderSize;
+    for (size_t i = 0; i < nFrames; i++, ptr += internal::frameIndexEntrySize)
+    {
+        internal::writeUInt64(ptr, _state->rawSizes[i]);
+        internal::writeUInt64(ptr + sizeof(DAAL_UINT64), _state->frames[i]->getWriteOffset());
+    }
+    header->setWriteOffset(header->getSize());
+    header->setComprState(compressed);
+
+    _state->output.push_back(CompressionBlockPtr(header));
+    _state->output.insert(_state->output.size(), _state->frames);
+    _state->frames.clear();
+    _state->rawSizes.clear();
+}
+
+void ParallelCompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    //checkParams;
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    const size_t nThreads = daal::threader_get_threads_number();
+    CBC & rawFrames       = _state->rawFrames;
+
+    byte * inPtr  = block->getPtr();
+    size_t inSize = block->getSize();
+    while (inSize > 0)
+    {
+        if (rawFrames.size() == 0 || rawFrames[rawFrames.size() - 1]->getWriteOffset() == _frameSize)
+        {
+            /* Compress the filled frames once there are enough of them to load all the threads */
+            if (rawFrames.size() >= nThreads)
+            {
+                compressFrames();
+                if (this->_errors->size() != 0)
+                {
+                    return;
+                }
+            }
+            CompressionBlock * frame = new CompressionBlock(_frameSize);
+            if (!frame->getPtr())
+            {
+                delete frame;
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            rawFrames.push_back(CompressionBlockPtr(frame));
+        }
+
+        CompressionBlock * frame = rawFrames[rawFrames.size() - 1].get();
+        const size_t offset      = frame->getWriteOffset();
+        const size_t copySize    = inSize < _frameSize - offset ? inSize : _frameSize - offset;
+        if (daal::services::internal::daal_memcpy_s(frame->getPtr() + offset, _frameSize - offset, inPtr, copySize))
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        frame->setWriteOffset(offset + copySize);
+        inPtr += copySize;
+        inSize -= copySize;
+    }
+}
+
+size_t ParallelCompressionStream::getCompressedDataSize()
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    seal();
+
+    size_t compressedDataSize = 0;
+    for (size_t i = 0; i < _state->output.size(); i++)
+    {
+        compressedDataSize += _state->output[i]->getWriteOffset() - _state->output[i]->getReadOffset();
+    }
+    return compressedDataSize;
+}
+
+size_t ParallelCompressionStream::copyCompressedArray(byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    if (_state->output.size() == 0)
+    {
+        seal();
+    }
+
+    CBC & output    = _state->output;
+    size_t readSize = 0;
+    int result      = 0;
+    while (readSize < size && output.size() > 0)
+    {
+        CompressionBlock * block = output[0].get();
+        const size_t availSize   = block->getWriteOffset() - block->getReadOffset();
+        const size_t rs          = size - readSize > availSize ? availSize : size - readSize;
+
+        result |= daal::services::internal::daal_memcpy_s(ptr + readSize, size - readSize, block->getPtr() + block->getReadOffset(), rs);
+        block->setReadOffset(block->getReadOffset() + rs);
+        readSize += rs;
+
+        if (block->getReadOffset() == block->getWriteOffset())
+        {
+            output.erase(0);
+        }
+    }
+
+    if (result)
+    {
+        this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+    }
+    return readSize;
+}
+
+//parallel decompression stream realization
+ParallelDecompressionStream::ParallelDecompressionStream(CompressionMethod method)
+    : _state(NULL), _method(method), _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (method < zlib || method > bzip2)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _state = new internal::FramedDecompressionState();
+}
+
+ParallelDecompressionStream::~ParallelDecompressionStream()
+{
+    delete _state;
+    _state = NULL;
+}
+
+void ParallelDecompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+    //checkParams;
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    const size_t inSize = block->getSize();
+    if (inSize == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    internal::FramedDecompressionState & state = *_state;
+    if (state.inputSize + inSize > state.inputCapacity)
+    {
+        size_t capacity = 2 * state.inputCapacity;
+        if (capacity < state.inputSize + inSize) capacity = state.inputSize + inSize;
+
+        byte * input = (byte *)daal::services::daal_malloc(capacity);
+        if (!input)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        if (state.inputSize && daal::services::internal::daal_memcpy_s(input, capacity, state.input, state.inputSize))
+        {
+            daal::services::daal_free(input);
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        daal::services::daal_free(state.input);
+        state.input         = input;
+        state.inputCapacity = capacity;
+    }
+
+    if (daal::services::internal::daal_memcpy_s(state.input + state.inputSize, state.inputCapacity - state.inputSize, block->getPtr(), inSize))
+    {
+        this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+        return;
+    }
+    state.inputSize += inSize;
+    parseFrames();
+}
+
+void ParallelDecompressionStream::parseFrames()
+{
+    internal::FramedDecompressionState & state = *_state;
+    while (state.inputSize - state.parsedSize >= internal::frameSegmentHeaderSize)
+    {
+        const byte * header      = state.input + state.parsedSize;
+        const DAAL_UINT64 magic  = internal::readUInt64(header);
+        const DAAL_UINT64 method = internal::readUInt64(header + sizeof(DAAL_UINT64));
+        const size_t nFrames     = (size_t)internal::readUInt64(header + 2 * sizeof(DAAL_UINT64));
+        if (magic != internal::frameSegmentMagic || method != (DAAL_UINT64)_method
+            || nFrames > (size_t(-1) - internal::frameSegmentHeaderSize) / internal::frameIndexEntrySize)
+        {
+            this->_errors->add(services::ErrorCompressionFrameFormat);
+            return;
+        }
+
+        const size_t indexSize = internal::frameSegmentHeaderSize + nFrames * internal::frameIndexEntrySize;
+        if (state.inputSize - state.parsedSize < indexSize)
+        {
+            return;
+        }
+
+        size_t segmentSize = indexSize;
+        for (size_t i = 0; i < nFrames; i++)
+        {
+            const size_t comprSize = (size_t)internal::readUInt64(header + internal::frameSegmentHeaderSize + i * internal::frameIndexEntrySize
+                                                                  + sizeof(DAAL_UINT64));
+            if (comprSize > size_t(-1) - segmentSize)
+            {
+                this->_errors->add(services::ErrorCompressionFrameFormat);
+                return;
+            }
+            segmentSize += comprSize;
+        }
+        if (state.inputSize - state.parsedSize < segmentSize)
+        {
+            return;
+        }
+
+        /* The segment is complete, register its frames */
+        size_t comprOffset = state.parsedSize + indexSize;
+        for (size_t i = 0; i < nFrames; i++)
+        {
+            const byte * entry = header + internal::frameSegmentHeaderSize + i * internal::frameIndexEntrySize;
+            internal::FrameInfo frame;
+            frame.rawOffset   = state.rawDataSize;
+            frame.rawSize     = (size_t)internal::readUInt64(entry);
+            frame.comprOffset = comprOffset;
+            frame.comprSize   = (size_t)internal::readUInt64(entry + sizeof(DAAL_UINT64));
+            state.frames.push_back(frame);
+            state.rawDataSize += frame.rawSize;
+            comprOffset += frame.comprSize;
+        }
+        state.parsedSize += segmentSize;
+    }
+}
+
+void ParallelDecompressionStream::decompressFrames(size_t first, size_t last, size_t offset, byte * ptr, size_t size)
+{
+    internal::FramedDecompressionState & state = *_state;
+    const size_t nFrames                       = last - first;
+
+    /* The frames that lie in the requested range entirely are decompressed directly to the output array,
+       the frames at the boundaries of the range are decompressed to temporary buffers */
+    services::Collection<services::ErrorCollection> errors(nFrames);
+    for (size_t i = 0; i < nFrames; i++) errors[i].setCanThrow(false);
+
+    const CompressionMethod method = _method;
+    daal::threader_for(int(nFrames), int(nFrames), [&](int i) {
+        const internal::FrameInfo & frame = state.frames[first + i];
+        const bool isInside               = frame.rawOffset >= offset && frame.rawOffset + frame.rawSize <= offset + size;
+        if (isInside)
+        {
+            internal::decompressFrame(method, state.input + frame.comprOffset, frame.comprSize, ptr + (frame.rawOffset - offset), frame.rawSize,
+                                      errors[i]);
+            return;
+        }
+
+        byte * buffer = (byte *)daal::services::daal_malloc(frame.rawSize);
+        if (!buffer)
+        {
+            errors[i].add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        internal::decompressFrame(method, state.input + frame.comprOffset, frame.comprSize, buffer, frame.rawSize, errors[i]);
+        if (errors[i].size() == 0)
+        {
+            const size_t begin = offset > frame.rawOffset ? offset : frame.rawOffset;
+            const size_t end   = offset + size < frame.rawOffset + frame.rawSize ? offset + size : frame.rawOffset + frame.rawSize;
+            if (daal::services::internal::daal_memcpy_s(ptr + (begin - offset), size - (begin - offset), buffer + (begin - frame.rawOffset),
+                                                         end - begin))
+            {
+                errors[i].add(services::ErrorMemoryCopyFailedInternal);
+            }
+        }
+        daal::services::daal_free(buffer);
+    });
+
+    for (size_t i = 0; i < nFrames; i++)
+    {
+        if (errors[i].size() != 0) this->_errors->add(errors[i]);
+    }
+}
+
+size_t ParallelDecompressionStream::copyDecompressedRange(size_t offset, byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    internal::FramedDecompressionState & state = *_state;
+    if (offset >= state.rawDataSize)
+    {
+        return 0;
+    }
+    if (size > state.rawDataSize - offset)
+    {
+        size = state.rawDataSize - offset;
+    }
+
+    /* Binary search of the first frame that overlaps the requested range */
+    size_t first = 0;
+    size_t last  = state.frames.size();
+    while (last - first > 1)
+    {
+        const size_t middle = (first + last) / 2;
+        if (state.frames[middle].rawOffset <= offset)
+            first = middle;
+        else
+            last = middle;
+    }
+    last = first + 1;
+    while (last < state.frames.size() && state.frames[last].rawOffset < offset + size)
+    {
+        last++;
+    }
+
+    /* Small sequential reads of the same frame are served from the cache */
+    if (last - first == 1)
+    {
+        const internal::FrameInfo & frame = state.frames[first];
+        if (state.cachedFrame != first + 1)
+        {
+            if (state.cacheSize < frame.rawSize)
+            {
+                daal::services::daal_free(state.cache);
+                state.cache     = (byte *)daal::services::daal_malloc(frame.rawSize);
+                state.cacheSize = state.cache ? frame.rawSize : 0;
+                if (!state.cache)
+                {
+                    state.cachedFrame = 0;
+                    this->_errors->add(services::ErrorMemoryAllocationFailed);
+                    return 0;
+                }
+            }
+            state.cachedFrame = 0;
+            internal::decompressFrame(_method, state.input + frame.comprOffset, frame.comprSize, state.cache, frame.rawSize, *(this->_errors));
+            if (this->_errors->size() != 0)
+            {
+                return 0;
+            }
+            state.cachedFrame = first + 1;
+        }
+        if (daal::services::internal::daal_memcpy_s(ptr, size, state.cache + (offset - frame.rawOffset), size))
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+        return size;
+    }
+
+    decompressFrames(first, last, offset, ptr, size);
+    return this->_errors->size() == 0 ? size : 0;
+}
+
+size_t ParallelDecompressionStream::copyDecompressedArray(byte * ptr, size_t size)
+{
+    const size_t readSize = copyDecompressedRange(_state ? _state->readPos : 0, ptr, size);
+    if (_state) _state->readPos += readSize;
+    return readSize;
+}
+
+size_t ParallelDecompressionStream::getDecompressedDataSize()
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return _state->rawDataSize - _state->readPos;
+}
+
+size_t ParallelDecompressionStream::getNumberOfFrames()
+{
+    return _state ? _state->frames.size() : 0;
+}
+
 } //namespace data_management
 } //namespace daal
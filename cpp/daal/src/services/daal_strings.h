@@ -376,7 +376,22 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(lassoParametersPath)               \
+    DECLARE_DAAL_STRING_CONST(penaltyL1Path)                     \
+    DECLARE_DAAL_STRING_CONST(betaPath)                          \
+    DECLARE_DAAL_STRING_CONST(ridgeParametersGrid)               \
+    DECLARE_DAAL_STRING_CONST(nFolds)                            \
+    DECLARE_DAAL_STRING_CONST(crossValidationErrors)             \
+    DECLARE_DAAL_STRING_CONST(bestRidgeParameters)               \
+    DECLARE_DAAL_STRING_CONST(models)                            \
+    DECLARE_DAAL_STRING_CONST(hessianVectorProductIdx)           \
+    DECLARE_DAAL_STRING_CONST(hessianVectorDirection)            \
+    DECLARE_DAAL_STRING_CONST(nCGIterations)                     \
+    DECLARE_DAAL_STRING_CONST(cgAccuracyThreshold)               \
+    DECLARE_DAAL_STRING_CONST(nDependentVariables)               \
+    DECLARE_DAAL_STRING_CONST(nRowsInChunk)                      \
+    DECLARE_DAAL_STRING_CONST(nChunksInSegment)
 
 /**
  *  Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) namespace
@@ -713,6 +713,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorDataTypeNotSupported, "Data type not supported");
     add(ErrorNullByteInjection, "Null byte injection has been detected");
     add(ErrorBufferSizeIntegerOverflow, "Integer overflow is occured");
+    add(ErrorIncorrectArrayAlignment, "Incorrect alignment of the arrays in the data archive");
+    add(ErrorUnsupportedArchiveVersion, "Data archive header version is not supported");
 
     // Environment errors: -2000..-2999
     add(ErrorCpuNotSupported, "CPU not supported");
@@ -877,6 +879,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
 
+    add(ErrorCompressionFrameFormat, "Input compressed stream is not in the frame format or corrupted");
+
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
 
@@ -970,6 +974,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorIncorrectNumberOfTerms, "Incorrect number of summands (terms) in objective function");
     add(ErrorIncorrectNumberOfNodes, "Incorrect number of nodes");
     add(ErrorInconsistenceModelAndBatchSizeInParameter, "Inconsistence of model and batch size parameter in optimization solver");
+    add(ErrorCollectiveComputationFailed, "Computation failed on another rank of the communicator");
 }
 
 void ErrorDetailCollection::parseResourceFile()
@@ -24,6 +24,8 @@
 #define __SERVICE_ALGO_UTILS_H__
 
 #include "services/host_app.h"
+#include "services/threading_context.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -45,6 +47,20 @@ void setHostApp(const services::SharedPtr<services::HostAppIface> & pHostApp, al
 services::HostAppIfacePtr getHostApp(daal::algorithms::interface1::Input & inp);
 bool isCancelled(services::Status & s, services::HostAppIface * pHostApp);
 
+void setThreadingContext(const services::ThreadingContextPtr & pContext, algorithms::interface1::Input & inp);
+services::ThreadingContextPtr getThreadingContext(daal::algorithms::interface1::Input & inp);
+
+class ScratchPool;
+/* Returns the scratch pool of the threading context of the call, or the default pool of the library */
+ScratchPool * scratchPool(daal::algorithms::interface1::Input & inp);
+
+/* Runs func in the task arena of the threading context, or in place if there is no context */
+template <typename Func>
+void executeInThreadingContext(const services::ThreadingContextPtr & pContext, const Func & func)
+{
+    daal::threader_execute_in_arena(pContext ? pContext->getTaskArena() : NULL, func);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Helper class handling cancellation status depending on the number of jobs to be done
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -34,15 +34,17 @@ bool daal_check_is_intel_cpu();
 #define DAAL_CHECK_CPU_ENVIRONMENT (daal_check_is_intel_cpu())
 
 #if defined(__INTEL_COMPILER)
-    #define PRAGMA_IVDEP            _Pragma("ivdep")
-    #define PRAGMA_NOVECTOR         _Pragma("novector")
-    #define PRAGMA_VECTOR_ALIGNED   _Pragma("vector aligned")
-    #define PRAGMA_VECTOR_UNALIGNED _Pragma("vector unaligned")
-    #define PRAGMA_VECTOR_ALWAYS    _Pragma("vector always")
-    #define PRAGMA_ICC_TO_STR(ARGS) _Pragma(#ARGS)
-    #define PRAGMA_ICC_OMP(ARGS)    PRAGMA_ICC_TO_STR(omp ARGS)
-    #define PRAGMA_ICC_NO16(ARGS)   PRAGMA_ICC_TO_STR(ARGS)
-    #define DAAL_TYPENAME           typename
+    #define PRAGMA_IVDEP              _Pragma("ivdep")
+    #define PRAGMA_NOVECTOR           _Pragma("novector")
+    #define PRAGMA_VECTOR_ALIGNED     _Pragma("vector aligned")
+    #define PRAGMA_VECTOR_UNALIGNED   _Pragma("vector unaligned")
+    #define PRAGMA_VECTOR_ALWAYS      _Pragma("vector always")
+    #define PRAGMA_ICC_TO_STR(ARGS)   _Pragma(#ARGS)
+    #define PRAGMA_ICC_OMP(ARGS)      PRAGMA_ICC_TO_STR(omp ARGS)
+    #define PRAGMA_ICC_NO16(ARGS)     PRAGMA_ICC_TO_STR(ARGS)
+    #define PRAGMA_FLOAT_PRECISE_PUSH _Pragma("float_control(precise, on, push)")
+    #define PRAGMA_FLOAT_PRECISE_POP  _Pragma("float_control(pop)")
+    #define DAAL_TYPENAME             typename
 #elif defined(__GNUC__)
     #define PRAGMA_IVDEP
     #define PRAGMA_NOVECTOR
@@ -52,6 +54,8 @@ bool daal_check_is_intel_cpu();
     #define PRAGMA_ICC_TO_STR(ARGS)
     #define PRAGMA_ICC_OMP(ARGS)
     #define PRAGMA_ICC_NO16(ARGS)
+    #define PRAGMA_FLOAT_PRECISE_PUSH
+    #define PRAGMA_FLOAT_PRECISE_POP
     #define DAAL_TYPENAME typename
 #elif defined(_MSC_VER)
     #define PRAGMA_IVDEP
@@ -62,6 +66,8 @@ bool daal_check_is_intel_cpu();
     #define PRAGMA_ICC_TO_STR(ARGS)
     #define PRAGMA_ICC_OMP(ARGS)
     #define PRAGMA_ICC_NO16(ARGS)
+    #define PRAGMA_FLOAT_PRECISE_PUSH
+    #define PRAGMA_FLOAT_PRECISE_POP
     #define DAAL_TYPENAME
 #else
     #define PRAGMA_IVDEP
@@ -71,6 +77,8 @@ bool daal_check_is_intel_cpu();
     #define PRAGMA_VECTOR_ALWAYS
     #define PRAGMA_ICC_OMP(ARGS)
     #define PRAGMA_ICC_NO16(ARGS)
+    #define PRAGMA_FLOAT_PRECISE_PUSH
+    #define PRAGMA_FLOAT_PRECISE_POP
     #define DAAL_TYPENAME typename
 #endif
 
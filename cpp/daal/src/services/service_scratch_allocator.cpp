@@ -0,0 +1,176 @@
+/* file: service_scratch_allocator.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the per-thread scratch arenas
+//--
+*/
+
+#include "src/services/service_scratch_allocator.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+typedef daal::tls<ScratchArena *> ScratchArenaTls;
+
+const size_t ScratchArena::maxReservedSize;
+const size_t ScratchArena::maxRetainedSize;
+
+ScratchArena::ScratchArena() : _nChunks(0), _curChunk(0), _curOffset(0), _used(0), _peak(0), _reserved(0)
+{
+    for (size_t i = 0; i < s_maxChunks; ++i)
+    {
+        _chunks[i].ptr  = nullptr;
+        _chunks[i].size = 0;
+    }
+}
+
+ScratchArena::~ScratchArena()
+{
+    for (size_t i = 0; i < _nChunks; ++i)
+    {
+        daal::services::daal_free(_chunks[i].ptr);
+        _chunks[i].ptr = nullptr;
+    }
+    _nChunks = 0;
+}
+
+void * ScratchArena::allocate(size_t nBytes)
+{
+    if (nBytes > size_t(-1) - s_alignment) return nullptr;
+    nBytes = (nBytes + s_alignment - 1) & ~(s_alignment - 1);
+
+    /* Look for the first chunk starting from the current one that has enough room,
+       the tails of the skipped chunks are accounted as used until the rollback */
+    size_t iChunk = _curChunk;
+    size_t offset = _curOffset;
+    size_t used   = _used;
+    for (; iChunk < _nChunks; ++iChunk, offset = 0)
+    {
+        if (_chunks[iChunk].size - offset >= nBytes) break;
+        used += _chunks[iChunk].size - offset;
+    }
+
+    if (iChunk == _nChunks)
+    {
+        if (_nChunks == s_maxChunks || nBytes > maxReservedSize - _reserved) return nullptr;
+        size_t chunkSize = (_nChunks ? 2 * _chunks[_nChunks - 1].size : s_minChunkSize);
+        if (chunkSize > maxReservedSize - _reserved) chunkSize = maxReservedSize - _reserved;
+        if (chunkSize < nBytes) chunkSize = nBytes;
+        char * ptr = static_cast<char *>(daal::services::daal_malloc(chunkSize, s_alignment));
+        if (!ptr) return nullptr;
+        _chunks[_nChunks].ptr  = ptr;
+        _chunks[_nChunks].size = chunkSize;
+        _reserved += chunkSize;
+        ++_nChunks;
+        offset = 0;
+    }
+
+    void * result = _chunks[iChunk].ptr + offset;
+    _curChunk     = iChunk;
+    _curOffset    = offset + nBytes;
+    _used         = used + nBytes;
+    if (_used > _peak) _peak = _used;
+    return result;
+}
+
+void ScratchArena::trim()
+{
+    size_t retained = 0;
+    size_t nChunks  = 0;
+    for (; nChunks < _nChunks && retained + _chunks[nChunks].size <= maxRetainedSize; ++nChunks)
+    {
+        retained += _chunks[nChunks].size;
+    }
+    for (size_t i = nChunks; i < _nChunks; ++i)
+    {
+        daal::services::daal_free(_chunks[i].ptr);
+        _chunks[i].ptr  = nullptr;
+        _chunks[i].size = 0;
+    }
+    _nChunks   = nChunks;
+    _reserved  = retained;
+    _curChunk  = 0;
+    _curOffset = 0;
+}
+
+ScratchPool::ScratchPool() : _tls(nullptr)
+{
+    _tls = new ScratchArenaTls([]() -> ScratchArena * { return new ScratchArena(); });
+}
+
+ScratchPool::~ScratchPool()
+{
+    ScratchArenaTls * tlsPtr = static_cast<ScratchArenaTls *>(_tls);
+    if (tlsPtr)
+    {
+        tlsPtr->reduce([](ScratchArena * arena) -> void { delete arena; });
+        delete tlsPtr;
+    }
+    _tls = nullptr;
+}
+
+ScratchArena * ScratchPool::local()
+{
+    return _tls ? static_cast<ScratchArenaTls *>(_tls)->local() : nullptr;
+}
+
+size_t ScratchPool::peak()
+{
+    size_t result = 0;
+    if (_tls)
+        static_cast<ScratchArenaTls *>(_tls)->reduce([&](ScratchArena * arena) -> void {
+            if (arena) result += arena->peak();
+        });
+    return result;
+}
+
+size_t ScratchPool::reserved()
+{
+    size_t result = 0;
+    if (_tls)
+        static_cast<ScratchArenaTls *>(_tls)->reduce([&](ScratchArena * arena) -> void {
+            if (arena) result += arena->reserved();
+        });
+    return result;
+}
+
+void ScratchPool::resetPeak()
+{
+    if (_tls)
+        static_cast<ScratchArenaTls *>(_tls)->reduce([](ScratchArena * arena) -> void {
+            if (arena) arena->resetPeak();
+        });
+}
+
+ScratchPool * getDefaultScratchPool()
+{
+    /* The default pool is never destroyed: its destructor walks and deletes the thread local storage,
+       which would run at process exit after the threading layer may already be unloaded.
+       The memory of the arenas is returned to the system with the process */
+    static ScratchPool * pool = new ScratchPool();
+    return pool;
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
@@ -0,0 +1,204 @@
+/* file: service_scratch_allocator.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Per-thread bump allocator for short-lived temporary buffers of the kernels
+//--
+*/
+
+#ifndef __SERVICE_SCRATCH_ALLOCATOR_H__
+#define __SERVICE_SCRATCH_ALLOCATOR_H__
+
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/**
+ * Bump allocator owned by one thread. Memory is taken from a list of chunks that grow geometrically
+ * and are kept for reuse: releasing a buffer only moves the top of the arena back to the marker
+ * taken before the allocation, so buffers must be released in the reverse order of allocation.
+ * The arena holds at most maxReservedSize bytes, larger requests fail and are served from the heap.
+ * When the arena becomes empty, the chunks above the first maxRetainedSize bytes are freed,
+ * so one large call does not keep its memory for the life of the thread.
+ */
+class ScratchArena
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static const size_t maxReservedSize = 64 * 1024 * 1024; /*!< Maximal size of the memory held by the arena */
+    static const size_t maxRetainedSize = 4 * 1024 * 1024;  /*!< Maximal size of the memory kept by the empty arena */
+
+    struct Marker
+    {
+        size_t chunk;
+        size_t offset;
+        size_t used;
+    };
+
+    ScratchArena();
+    ~ScratchArena();
+
+    void * allocate(size_t nBytes);
+
+    Marker mark() const
+    {
+        Marker m = { _curChunk, _curOffset, _used };
+        return m;
+    }
+
+    void rollback(const Marker & m)
+    {
+        _curChunk  = m.chunk;
+        _curOffset = m.offset;
+        _used      = m.used;
+        if (!_used && _reserved > maxRetainedSize) trim();
+    }
+
+    size_t peak() const { return _peak; }
+    size_t reserved() const { return _reserved; }
+    void resetPeak() { _peak = _used; }
+
+private:
+    ScratchArena(const ScratchArena &);
+    ScratchArena & operator=(const ScratchArena &);
+
+    /* Frees the chunks of the empty arena above the first maxRetainedSize bytes */
+    void trim();
+
+    struct Chunk
+    {
+        char * ptr;
+        size_t size;
+    };
+
+    static const size_t s_maxChunks    = 48;
+    static const size_t s_minChunkSize = 64 * 1024;
+    static const size_t s_alignment    = DAAL_MALLOC_DEFAULT_ALIGNMENT;
+
+    Chunk _chunks[s_maxChunks];
+    size_t _nChunks;
+    size_t _curChunk;
+    size_t _curOffset;
+    size_t _used;
+    size_t _peak;
+    size_t _reserved;
+};
+
+/**
+ * Set of per-thread scratch arenas. A pool is owned by a threading context, the computations
+ * that run without a threading context use the default pool of the library.
+ */
+class ScratchPool
+{
+public:
+    DAAL_NEW_DELETE();
+
+    ScratchPool();
+    ~ScratchPool();
+
+    /* Returns the arena of the calling thread, nullptr if it cannot be created */
+    ScratchArena * local();
+
+    /* Sum over the threads of the peak scratch memory in use, in bytes */
+    size_t peak();
+
+    /* Total memory held by the arenas of the pool, in bytes */
+    size_t reserved();
+
+    void resetPeak();
+
+private:
+    ScratchPool(const ScratchPool &);
+    ScratchPool & operator=(const ScratchPool &);
+
+    void * _tls;
+};
+
+/* Returns the pool of the computations that run without a threading context, the pool lives until the process exits */
+ScratchPool * getDefaultScratchPool();
+
+/**
+ * Temporary array allocated in the scratch arena of the calling thread.
+ * The memory is returned to the arena when the array goes out of scope, hence the array
+ * must be created and destroyed on the same thread, in the stack order of its scope.
+ * Falls back to the heap if the arena is unavailable.
+ */
+template <typename T, CpuType cpu>
+class TScratchArray
+{
+public:
+    TScratchArray(ScratchPool * pool, size_t n) : _arena(nullptr), _data(nullptr), _size(0), _onHeap(false)
+    {
+        if (!n || n > size_t(-1) / sizeof(T)) return;
+        _arena = (pool ? pool : getDefaultScratchPool())->local();
+        if (_arena)
+        {
+            _marker = _arena->mark();
+            _data   = static_cast<T *>(_arena->allocate(n * sizeof(T)));
+            if (!_data) _arena = nullptr;
+        }
+        if (!_data)
+        {
+            _data   = static_cast<T *>(daal::services::daal_malloc(n * sizeof(T)));
+            _onHeap = true;
+        }
+        if (_data) _size = n;
+    }
+
+    ~TScratchArray()
+    {
+        if (_onHeap)
+        {
+            daal::services::daal_free(_data);
+        }
+        else if (_arena)
+        {
+            _arena->rollback(_marker);
+        }
+    }
+
+    inline T * get() { return _data; }
+    inline const T * get() const { return _data; }
+    inline size_t size() const { return _size; }
+
+    inline T & operator[](size_t index) { return _data[index]; }
+    inline const T & operator[](size_t index) const { return _data[index]; }
+
+    TScratchArray(const TScratchArray &) = delete;
+    TScratchArray & operator=(const TScratchArray &) = delete;
+
+private:
+    ScratchArena * _arena;
+    ScratchArena::Marker _marker;
+    T * _data;
+    size_t _size;
+    bool _onHeap;
+};
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
@@ -0,0 +1,166 @@
+/* file: service_scratch_allocator_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <thread>
+
+#include "src/services/service_scratch_allocator.h"
+#include "gtest/gtest.h"
+
+using daal::services::internal::ScratchArena;
+using daal::services::internal::ScratchPool;
+using daal::services::internal::TScratchArray;
+
+TEST(scratch_allocator_test, released_memory_is_reused)
+{
+    ScratchArena arena;
+
+    const ScratchArena::Marker marker = arena.mark();
+    void * first                      = arena.allocate(1000);
+    ASSERT_TRUE(first != nullptr);
+    const size_t reserved = arena.reserved();
+    arena.rollback(marker);
+
+    void * second = arena.allocate(1000);
+    ASSERT_EQ(second, first);
+    ASSERT_EQ(arena.reserved(), reserved);
+    arena.rollback(marker);
+}
+
+TEST(scratch_allocator_test, nested_buffers_do_not_overlap)
+{
+    ScratchArena arena;
+
+    const ScratchArena::Marker outerMarker = arena.mark();
+    char * outer                           = static_cast<char *>(arena.allocate(100));
+    const ScratchArena::Marker innerMarker = arena.mark();
+    char * inner                           = static_cast<char *>(arena.allocate(100));
+    ASSERT_TRUE(outer != nullptr && inner != nullptr);
+    ASSERT_TRUE(inner >= outer + 100 || outer >= inner + 100);
+
+    arena.rollback(innerMarker);
+    ASSERT_EQ(static_cast<char *>(arena.allocate(100)), inner);
+    arena.rollback(outerMarker);
+}
+
+TEST(scratch_allocator_test, arena_grows_and_trims_when_empty)
+{
+    ScratchArena arena;
+
+    const ScratchArena::Marker marker = arena.mark();
+    ASSERT_TRUE(arena.allocate(1024) != nullptr);
+    const size_t initialReserved = arena.reserved();
+
+    const size_t largeSize = 2 * ScratchArena::maxRetainedSize;
+    ASSERT_TRUE(arena.allocate(largeSize) != nullptr);
+    ASSERT_GE(arena.reserved(), initialReserved + largeSize);
+    ASSERT_GE(arena.peak(), largeSize);
+
+    arena.rollback(marker);
+    ASSERT_LE(arena.reserved(), ScratchArena::maxRetainedSize);
+    ASSERT_TRUE(arena.allocate(1024) != nullptr);
+    arena.rollback(marker);
+}
+
+TEST(scratch_allocator_test, arena_size_is_capped)
+{
+    ScratchArena arena;
+
+    const ScratchArena::Marker marker = arena.mark();
+    ASSERT_TRUE(arena.allocate(ScratchArena::maxReservedSize + 1) == nullptr);
+    ASSERT_LE(arena.reserved(), ScratchArena::maxReservedSize);
+    arena.rollback(marker);
+}
+
+TEST(scratch_allocator_test, oversized_array_falls_back_to_heap)
+{
+    ScratchPool pool;
+    const size_t count = ScratchArena::maxReservedSize / sizeof(float) + 1;
+    {
+        TScratchArray<float, daal::sse2> array(&pool, count);
+        ASSERT_TRUE(array.get() != nullptr);
+        ASSERT_EQ(array.size(), count);
+        array[count - 1] = 1.0f;
+    }
+    ASSERT_LE(pool.reserved(), ScratchArena::maxReservedSize);
+}
+
+TEST(scratch_allocator_test, default_pool_is_shared)
+{
+    ScratchPool * pool = daal::services::internal::getDefaultScratchPool();
+    ASSERT_TRUE(pool != nullptr);
+    ASSERT_EQ(daal::services::internal::getDefaultScratchPool(), pool);
+    {
+        TScratchArray<float, daal::sse2> array(nullptr, 100);
+        ASSERT_TRUE(array.get() != nullptr);
+        ASSERT_EQ(array.size(), size_t(100));
+    }
+}
+
+TEST(scratch_allocator_test, threads_use_separate_arenas)
+{
+    ScratchPool pool;
+    const size_t nThreads   = 4;
+    const size_t bufferSize = 4096;
+
+    ScratchArena * arenas[nThreads] = {};
+    char * buffers[nThreads]        = {};
+    std::atomic<size_t> nStarted(0);
+    std::thread threads[nThreads];
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        threads[i] = std::thread([&, i]() {
+            /* All threads are alive at once, so that none of them reuses the id of another one */
+            nStarted++;
+            while (nStarted.load() < nThreads)
+            {
+                std::this_thread::yield();
+            }
+            arenas[i]                         = pool.local();
+            const ScratchArena::Marker marker = arenas[i]->mark();
+            buffers[i]                        = static_cast<char *>(arenas[i]->allocate(bufferSize));
+            for (size_t j = 0; j < bufferSize; j++)
+            {
+                buffers[i][j] = static_cast<char>(i);
+            }
+            for (size_t j = 0; j < bufferSize; j++)
+            {
+                if (buffers[i][j] != static_cast<char>(i))
+                {
+                    buffers[i] = nullptr;
+                    break;
+                }
+            }
+            arenas[i]->rollback(marker);
+        });
+    }
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        threads[i].join();
+    }
+
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        ASSERT_TRUE(arenas[i] != nullptr);
+        ASSERT_TRUE(buffers[i] != nullptr);
+        for (size_t j = 0; j < i; j++)
+        {
+            ASSERT_NE(arenas[i], arenas[j]);
+            ASSERT_NE(buffers[i], buffers[j]);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/* file: threading_context.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the per-call threading context
+//--
+*/
+
+#include "services/threading_context.h"
+#include "services/error_indexes.h"
+#include "src/services/service_scratch_allocator.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+ThreadingContextPtr ThreadingContext::create(size_t maxThreads, services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(ThreadingContext, maxThreads);
+}
+
+ThreadingContextPtr ThreadingContext::createFromTaskArena(void * taskArena, services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(ThreadingContext, taskArena);
+}
+
+ThreadingContext::ThreadingContext(size_t maxThreads, services::Status & stat)
+    : _taskArena(NULL), _ownsTaskArena(true), _maxThreads(0), _scratchPool(NULL)
+{
+    const size_t nThreadsAvailable = daal::threader_get_threads_number();
+    if (!maxThreads || maxThreads > nThreadsAvailable) maxThreads = nThreadsAvailable;
+
+    _taskArena = _daal_new_task_arena(int(maxThreads));
+    /* Sequential threading layer has no task arenas, all the computations run in the calling thread */
+    _maxThreads = _taskArena ? size_t(_daal_task_arena_max_concurrency(_taskArena)) : 1;
+
+    _scratchPool = new internal::ScratchPool();
+    if (!_scratchPool) stat.add(services::ErrorMemoryAllocationFailed);
+}
+
+ThreadingContext::ThreadingContext(void * taskArena, services::Status & stat)
+    : _taskArena(taskArena), _ownsTaskArena(false), _maxThreads(0), _scratchPool(NULL)
+{
+    if (!_taskArena)
+    {
+        stat.add(services::ErrorNullParameterNotSupported);
+        return;
+    }
+    _maxThreads = size_t(_daal_task_arena_max_concurrency(_taskArena));
+
+    _scratchPool = new internal::ScratchPool();
+    if (!_scratchPool) stat.add(services::ErrorMemoryAllocationFailed);
+}
+
+ThreadingContext::~ThreadingContext()
+{
+    if (_ownsTaskArena && _taskArena) _daal_del_task_arena(_taskArena);
+    _taskArena = NULL;
+    delete _scratchPool;
+    _scratchPool = NULL;
+}
+
+size_t ThreadingContext::getPeakScratchSize() const
+{
+    return _scratchPool ? _scratchPool->peak() : 0;
+}
+
+void ThreadingContext::resetPeakScratchSize()
+{
+    if (_scratchPool) _scratchPool->resetPeak();
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace daal
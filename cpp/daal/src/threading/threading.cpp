@@ -166,6 +166,107 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
 #endif
 }
 
+#if defined(__DO_TBB_LAYER__)
+template <typename Body>
+static void _daal_parallel_for_grained(int n, int grainSize, int partitioner, const Body & body)
+{
+    const tbb::blocked_range<int> range(0, n, grainSize > 0 ? grainSize : 1);
+    switch (partitioner)
+    {
+    case daal::threader_static_partitioner: tbb::parallel_for(range, body, tbb::static_partitioner()); break;
+    case daal::threader_simple_partitioner: tbb::parallel_for(range, body, tbb::simple_partitioner()); break;
+    default: tbb::parallel_for(range, body, tbb::auto_partitioner()); break;
+    }
+}
+#endif
+
+DAAL_EXPORT void _daal_threader_for_grained(int n, int grainSize, int partitioner, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    _daal_parallel_for_grained(n, grainSize, partitioner, [&](const tbb::blocked_range<int> & r) {
+        int i;
+        for (i = r.begin(); i < r.end(); i++)
+        {
+            func(i, a);
+        }
+    });
+#elif defined(__DO_SEQ_LAYER__)
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        func(i, a);
+    }
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_grained(int n, int grainSize, int partitioner, const void * a, daal::functype2 func)
+{
+#if defined(__DO_TBB_LAYER__)
+    _daal_parallel_for_grained(n, grainSize, partitioner,
+                               [&](const tbb::blocked_range<int> & r) { func(r.begin(), r.end() - r.begin(), a); });
+#elif defined(__DO_SEQ_LAYER__)
+    /* Same chunks as the parallel layer gives at most: no empty chunk, and grain size chunks for the simple partitioner */
+    const int chunkSize = (partitioner == daal::threader_simple_partitioner && grainSize > 0) ? grainSize : n;
+    int i0;
+    for (i0 = 0; i0 < n; i0 += chunkSize)
+    {
+        func(i0, (n - i0 < chunkSize) ? n - i0 : chunkSize, a);
+    }
+#endif
+}
+
+DAAL_EXPORT void * _daal_new_affinity_partitioner()
+{
+#if defined(__DO_TBB_LAYER__)
+    return new tbb::affinity_partitioner();
+#else
+    return NULL;
+#endif
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    delete static_cast<tbb::affinity_partitioner *>(partitionerPtr);
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (partitionerPtr)
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, grainSize > 0 ? grainSize : 1),
+            [&](const tbb::blocked_range<int> & r) {
+                int i;
+                for (i = r.begin(); i < r.end(); i++)
+                {
+                    func(i, a);
+                }
+            },
+            *static_cast<tbb::affinity_partitioner *>(partitionerPtr));
+        return;
+    }
+#endif
+    _daal_threader_for_grained(n, grainSize, daal::threader_auto_partitioner, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype2 func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (partitionerPtr)
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, grainSize > 0 ? grainSize : 1),
+            [&](const tbb::blocked_range<int> & r) { func(r.begin(), r.end() - r.begin(), a); },
+            *static_cast<tbb::affinity_partitioner *>(partitionerPtr));
+        return;
+    }
+#endif
+    _daal_threader_for_blocked_grained(n, grainSize, daal::threader_auto_partitioner, a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
 #if defined(__DO_TBB_LAYER__)
@@ -294,6 +395,49 @@ DAAL_EXPORT void * _daal_threader_env()
     return &env;
 }
 
+DAAL_EXPORT void * _daal_new_task_arena(int max_concurrency)
+{
+#if defined(__DO_TBB_LAYER__)
+    tbb::task_arena * arena = new tbb::task_arena(max_concurrency > 0 ? max_concurrency : tbb::task_arena::automatic);
+    arena->initialize();
+    return arena;
+#else
+    return NULL;
+#endif
+}
+
+DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    delete static_cast<tbb::task_arena *>(taskArenaPtr);
+#endif
+}
+
+DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (taskArenaPtr)
+    {
+        tbb::task_arena * arena = static_cast<tbb::task_arena *>(taskArenaPtr);
+        if (!arena->is_active()) arena->initialize();
+        return arena->max_concurrency();
+    }
+#endif
+    return _daal_threader_get_max_threads();
+}
+
+DAAL_EXPORT void _daal_execute_in_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (taskArenaPtr)
+    {
+        static_cast<tbb::task_arena *>(taskArenaPtr)->execute([&]() { func(a); });
+        return;
+    }
+#endif
+    func(a);
+}
+
 #if defined(__DO_TBB_LAYER__)
 template <typename T, typename Key, typename Pred>
 //Returns an index of the first element in the range[ar, ar + n) that is not less than(i.e.greater or equal to) value.
@@ -33,7 +33,18 @@ typedef void (*functype2)(int i, int n, const void * a);
 typedef void * (*tls_functype)(const void * a);
 typedef void (*tls_reduce_functype)(void * p, const void * a);
 typedef void (*functype_break)(int i, bool & needBreak, const void * a);
+typedef void (*functype_arena)(const void * a);
 class task;
+
+/* Partitioning strategies of the iteration space for the threader_for_*_grained functions.
+   A range is split only while it is larger than the grain size, so a range of at most
+   grain size iterations, including the whole range if n <= grain size, is never split */
+enum ThreaderPartitioner
+{
+    threader_auto_partitioner   = 0, /* Adaptive splitting, stops early on idle threads, chunks may be larger than the grain size */
+    threader_static_partitioner = 1, /* Even distribution of the iterations between threads, minimal scheduling overhead */
+    threader_simple_partitioner = 2  /* Splitting until every chunk has at most grain size iterations */
+};
 } // namespace daal
 
 extern "C"
@@ -43,6 +54,13 @@ extern "C"
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func);
+    DAAL_EXPORT void _daal_threader_for_grained(int n, int grainSize, int partitioner, const void * a, daal::functype func);
+    DAAL_EXPORT void _daal_threader_for_blocked_grained(int n, int grainSize, int partitioner, const void * a, daal::functype2 func);
+
+    DAAL_EXPORT void * _daal_new_affinity_partitioner();
+    DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr);
+    DAAL_EXPORT void _daal_threader_for_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype func);
+    DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int grainSize, void * partitionerPtr, const void * a, daal::functype2 func);
 
     DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func);
     DAAL_EXPORT void * _daal_get_tls_local(void * tlsPtr);
@@ -72,6 +90,11 @@ extern "C"
 
     DAAL_EXPORT void * _daal_threader_env();
 
+    DAAL_EXPORT void * _daal_new_task_arena(int max_concurrency);
+    DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr);
+    DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr);
+    DAAL_EXPORT void _daal_execute_in_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func);
+
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
 }
@@ -109,9 +132,13 @@ inline ThreaderEnvironment * threader_env()
     return static_cast<ThreaderEnvironment *>(_daal_threader_env());
 }
 
+/* Number of threads available to the caller: the global setting further limited by the
+   concurrency of the task arena the caller currently runs in (see ThreadingContext) */
 inline size_t threader_get_threads_number()
 {
-    return threader_env()->getNumberOfThreads();
+    const size_t nThreadsEnv   = threader_env()->getNumberOfThreads();
+    const size_t nThreadsArena = size_t(_daal_threader_get_max_threads());
+    return (nThreadsArena > 0 && nThreadsArena < nThreadsEnv) ? nThreadsArena : nThreadsEnv;
 }
 
 inline size_t setNumberOfThreads(const size_t numThreads, void ** globalControl)
@@ -140,6 +167,13 @@ inline void threader_func_break(int i, bool & needBreak, const void * a)
     lambda(i, needBreak);
 }
 
+template <typename F>
+inline void threader_func_arena(const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
 template <typename F>
 inline void threader_for(int n, int threads_request, const F & lambda)
 {
@@ -172,6 +206,76 @@ inline void threader_for_break(int n, int threads_request, const F & lambda)
     _daal_threader_for_break(n, threads_request, a, threader_func_break<F>);
 }
 
+/* threader_for with explicit grain size and partitioning strategy.
+   Use a large grain size with threader_static_partitioner for tiny uniform bodies
+   and threader_auto_partitioner for uneven ones */
+template <typename F>
+inline void threader_for_grained(int n, int grainSize, ThreaderPartitioner partitioner, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_grained(n, grainSize, int(partitioner), a, threader_func<F>);
+}
+
+template <typename F>
+inline void threader_for_blocked_grained(int n, int grainSize, ThreaderPartitioner partitioner, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_grained(n, grainSize, int(partitioner), a, threader_func_b<F>);
+}
+
+/* Remembers the mapping of the iterations to threads between the threader_for_affinity calls.
+   Reusing the same object across the iterations of an iterative algorithm makes
+   the same threads process the same data, so it stays warm in their caches */
+class affinity_partitioner
+{
+public:
+    affinity_partitioner() : _impl(_daal_new_affinity_partitioner()) {}
+    ~affinity_partitioner()
+    {
+        if (_impl) _daal_del_affinity_partitioner(_impl);
+    }
+    void * get() const { return _impl; }
+
+private:
+    affinity_partitioner(const affinity_partitioner &);
+    affinity_partitioner & operator=(const affinity_partitioner &);
+
+    void * _impl;
+};
+
+template <typename F>
+inline void threader_for_affinity(int n, int grainSize, affinity_partitioner & partitioner, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_affinity(n, grainSize, partitioner.get(), a, threader_func<F>);
+}
+
+template <typename F>
+inline void threader_for_blocked_affinity(int n, int grainSize, affinity_partitioner & partitioner, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_affinity(n, grainSize, partitioner.get(), a, threader_func_b<F>);
+}
+
+/* Runs lambda inside the given task arena, so that all nested threader_for and tls
+   calls are served by the threads of that arena only. Runs lambda in place if arena is null */
+template <typename F>
+inline void threader_execute_in_arena(void * taskArenaPtr, const F & lambda)
+{
+    if (!taskArenaPtr)
+    {
+        lambda();
+        return;
+    }
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_execute_in_task_arena(taskArenaPtr, a, threader_func_arena<F>);
+}
+
 template <typename lambdaType>
 inline void * tls_func(const void * a)
 {
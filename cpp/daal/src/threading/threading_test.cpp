@@ -0,0 +1,149 @@
+/* file: threading_test.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <memory>
+
+#include "src/threading/threading.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+const int sizes[]       = { 0, 1, 5, 63, 64, 65, 1000, 10007 };
+const int grainSizes[]  = { 1, 7, 64, 1000 };
+const int nPartitioners = 3;
+
+const daal::ThreaderPartitioner partitioners[nPartitioners] = { daal::threader_auto_partitioner, daal::threader_static_partitioner,
+                                                                daal::threader_simple_partitioner };
+
+class VisitCounter
+{
+public:
+    explicit VisitCounter(int n) : _n(n), _counts(new std::atomic<int>[n > 0 ? n : 1]), _badRanges(0)
+    {
+        for (int i = 0; i < _n; i++) _counts[i] = 0;
+    }
+
+    void visit(int i) const
+    {
+        if (i < 0 || i >= _n)
+        {
+            _badRanges++;
+            return;
+        }
+        _counts[i]++;
+    }
+
+    /* Counts the chunk [begin, begin + size), the chunk must be non-empty and not larger than maxSize if maxSize > 0 */
+    void visitRange(int begin, int size, int maxSize) const
+    {
+        if (size <= 0 || (maxSize > 0 && size > maxSize)) _badRanges++;
+        for (int i = begin; i < begin + size; i++) visit(i);
+    }
+
+    void expectVisitedOnce() const
+    {
+        EXPECT_EQ(_badRanges.load(), 0);
+        for (int i = 0; i < _n; i++)
+        {
+            ASSERT_EQ(_counts[i].load(), 1) << "index " << i << " of " << _n;
+        }
+    }
+
+private:
+    int _n;
+    std::unique_ptr<std::atomic<int>[]> _counts;
+    mutable std::atomic<int> _badRanges;
+};
+} // namespace
+
+TEST(threading_test, threader_for_grained_visits_every_index_once)
+{
+    for (int p = 0; p < nPartitioners; p++)
+    {
+        for (int grainSize : grainSizes)
+        {
+            for (int n : sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "partitioner " << p << ", grain size " << grainSize << ", n " << n);
+                const VisitCounter counter(n);
+                daal::threader_for_grained(n, grainSize, partitioners[p], [&](int i) { counter.visit(i); });
+                counter.expectVisitedOnce();
+            }
+        }
+    }
+}
+
+TEST(threading_test, threader_for_blocked_grained_visits_every_index_once)
+{
+    for (int p = 0; p < nPartitioners; p++)
+    {
+        for (int grainSize : grainSizes)
+        {
+            for (int n : sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "partitioner " << p << ", grain size " << grainSize << ", n " << n);
+                /* Only the simple partitioner guarantees that the chunks are not larger than the grain size */
+                const int maxSize = (partitioners[p] == daal::threader_simple_partitioner) ? grainSize : 0;
+                const VisitCounter counter(n);
+                daal::threader_for_blocked_grained(n, grainSize, partitioners[p],
+                                                   [&](int begin, int size) { counter.visitRange(begin, size, maxSize); });
+                counter.expectVisitedOnce();
+            }
+        }
+    }
+}
+
+TEST(threading_test, range_not_larger_than_grain_size_is_not_split)
+{
+    for (int p = 0; p < nPartitioners; p++)
+    {
+        const int n = 50;
+        std::atomic<int> nChunks(0);
+        daal::threader_for_blocked_grained(n, 64, partitioners[p], [&](int begin, int size) {
+            EXPECT_EQ(begin, 0);
+            EXPECT_EQ(size, n);
+            nChunks++;
+        });
+        EXPECT_EQ(nChunks.load(), 1);
+    }
+}
+
+TEST(threading_test, reused_affinity_partitioner_visits_every_index_once)
+{
+    daal::affinity_partitioner partitioner;
+
+    /* The partitioner keeps the mapping of the previous call, which must stay valid when the size or the grain size change */
+    for (int iteration = 0; iteration < 3; iteration++)
+    {
+        for (int grainSize : grainSizes)
+        {
+            for (int n : sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "iteration " << iteration << ", grain size " << grainSize << ", n " << n);
+                const VisitCounter counter(n);
+                daal::threader_for_affinity(n, grainSize, partitioner, [&](int i) { counter.visit(i); });
+                counter.expectVisitedOnce();
+
+                const VisitCounter blockedCounter(n);
+                daal::threader_for_blocked_affinity(n, grainSize, partitioner,
+                                                    [&](int begin, int size) { blockedCounter.visitRange(begin, size, 0); });
+                blockedCounter.expectVisitedOnce();
+            }
+        }
+    }
+}
@@ -0,0 +1,251 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/covariance_kernel.h>
+
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_online_kernel_t =
+    daal_cov::internal::CovarianceDenseOnlineKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_distributed_kernel_t =
+    daal_cov::internal::CovarianceDistributedKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float>
+static table build_table(array<Float>& arr, int64_t row_count, int64_t column_count) {
+    return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+}
+
+/// Copies the statistics of the previous partial result, the DAAL kernel updates
+/// them in place while the previous result shall stay unchanged
+template <typename Float>
+static array<Float> copy_partial(const table& t, int64_t count) {
+    if (!t.has_data()) {
+        return array<Float>::zeros(count);
+    }
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(count);
+    std::copy(src.get_data(), src.get_data() + count, dst.get_mutable_data());
+    return dst;
+}
+
+template <typename Float>
+static partial_compute_result call_daal_partial_kernel(const context_cpu& ctx,
+                                                       const table& data,
+                                                       const partial_compute_result& prev) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_nobs = copy_partial<Float>(prev.get_nobs(), 1);
+    auto arr_crossproduct =
+        copy_partial<Float>(prev.get_crossproduct(), column_count * column_count);
+    auto arr_sums = copy_partial<Float>(prev.get_sums(), column_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
+    const auto daal_nobs = interop::convert_to_daal_homogen_table(arr_nobs, 1, 1);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sums = interop::convert_to_daal_homogen_table(arr_sums, 1, column_count);
+
+    const daal_cov::Parameter daal_parameter;
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_cov_online_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   daal_nobs.get(),
+                                                                   daal_crossproduct.get(),
+                                                                   daal_sums.get(),
+                                                                   &daal_parameter));
+
+    return partial_compute_result()
+        .set_nobs(build_table(arr_nobs, 1, 1))
+        .set_crossproduct(build_table(arr_crossproduct, column_count, column_count))
+        .set_sums(build_table(arr_sums, 1, column_count));
+}
+
+template <typename Float>
+static daal_dm::NumericTablePtr to_daal_table(const table& t,
+                                              int64_t row_count,
+                                              int64_t column_count) {
+    const auto arr = row_accessor<const Float>{ t }.pull();
+    return interop::convert_to_daal_read_only_homogen_table(arr, row_count, column_count);
+}
+
+/// Merges the partial results computed over the shards of the data
+template <typename Float>
+static partial_compute_result call_daal_merge_kernel(
+    const context_cpu& ctx,
+    const std::vector<partial_compute_result>& partials) {
+    const int64_t column_count = partials.front().get_sums().get_column_count();
+
+    daal_dm::DataCollectionPtr daal_partials(new daal_dm::DataCollection());
+    for (const auto& partial : partials) {
+        daal_cov::PartialResultPtr daal_partial(new daal_cov::PartialResult());
+        daal_partial->set(daal_cov::nObservations, to_daal_table<Float>(partial.get_nobs(), 1, 1));
+        daal_partial->set(daal_cov::crossProduct,
+                          to_daal_table<Float>(partial.get_crossproduct(),
+                                               column_count,
+                                               column_count));
+        daal_partial->set(daal_cov::sum, to_daal_table<Float>(partial.get_sums(), 1, column_count));
+        daal_partials->push_back(daal_partial);
+    }
+
+    auto arr_nobs = array<Float>::empty(1);
+    auto arr_crossproduct = array<Float>::empty(column_count * column_count);
+    auto arr_sums = array<Float>::empty(column_count);
+
+    const auto daal_nobs = interop::convert_to_daal_homogen_table(arr_nobs, 1, 1);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sums = interop::convert_to_daal_homogen_table(arr_sums, 1, column_count);
+
+    const daal_cov::Parameter daal_parameter;
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_cov_distributed_kernel_t>(ctx,
+                                                                        daal_partials.get(),
+                                                                        daal_nobs.get(),
+                                                                        daal_crossproduct.get(),
+                                                                        daal_sums.get(),
+                                                                        &daal_parameter));
+
+    return partial_compute_result()
+        .set_nobs(build_table(arr_nobs, 1, 1))
+        .set_crossproduct(build_table(arr_crossproduct, column_count, column_count))
+        .set_sums(build_table(arr_sums, 1, column_count));
+}
+
+template <typename Float>
+static array<Float> call_daal_finalize_kernel(const context_cpu& ctx,
+                                              const daal_dm::NumericTablePtr& daal_nobs,
+                                              const daal_dm::NumericTablePtr& daal_crossproduct,
+                                              const daal_dm::NumericTablePtr& daal_sums,
+                                              daal_cov::OutputMatrixType matrix_type,
+                                              array<Float>& arr_means) {
+    const int64_t column_count = daal_sums->getNumberOfColumns();
+
+    auto arr_matrix = array<Float>::empty(column_count * column_count);
+    const auto daal_matrix =
+        interop::convert_to_daal_homogen_table(arr_matrix, column_count, column_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    daal_parameter.outputMatrixType = matrix_type;
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_cov_online_kernel_t<
+                   Float,
+                   oneapi::dal::backend::interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .finalizeCompute(daal_nobs.get(),
+                             daal_crossproduct.get(),
+                             daal_sums.get(),
+                             daal_matrix.get(),
+                             daal_means.get(),
+                             &daal_parameter);
+    }));
+
+    return arr_matrix;
+}
+
+template <typename Float>
+static compute_result finalize(const context_cpu& ctx, const partial_compute_result& partial) {
+    const int64_t column_count = partial.get_sums().get_column_count();
+
+    const auto daal_nobs = to_daal_table<Float>(partial.get_nobs(), 1, 1);
+    const auto daal_crossproduct =
+        to_daal_table<Float>(partial.get_crossproduct(), column_count, column_count);
+    const auto daal_sums = to_daal_table<Float>(partial.get_sums(), 1, column_count);
+
+    auto arr_means = array<Float>::empty(column_count);
+    auto arr_cov = call_daal_finalize_kernel<Float>(ctx,
+                                                    daal_nobs,
+                                                    daal_crossproduct,
+                                                    daal_sums,
+                                                    daal_cov::covarianceMatrix,
+                                                    arr_means);
+    auto arr_cor = call_daal_finalize_kernel<Float>(ctx,
+                                                    daal_nobs,
+                                                    daal_crossproduct,
+                                                    daal_sums,
+                                                    daal_cov::correlationMatrix,
+                                                    arr_means);
+
+    return compute_result()
+        .set_cov_matrix(build_table(arr_cov, column_count, column_count))
+        .set_cor_matrix(build_table(arr_cor, column_count, column_count))
+        .set_means(build_table(arr_means, 1, column_count));
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        const auto partial =
+            call_daal_partial_kernel<Float>(ctx, input.get_data(), partial_compute_result{});
+        return finalize<Float>(ctx, partial);
+    }
+};
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method::dense> {
+    partial_compute_result operator()(const context_cpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        return call_daal_partial_kernel<Float>(ctx, input.get_data(), input.get_prev());
+    }
+};
+
+template <typename Float>
+struct finalize_compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const finalize_compute_input& input) const {
+        const auto partials = input.get_partials();
+        if (partials.size() == 1) {
+            return finalize<Float>(ctx, partials.front());
+        }
+        return finalize<Float>(ctx, call_daal_merge_kernel<Float>(ctx, partials));
+    }
+};
+
+template struct compute_kernel_cpu<float, method::dense>;
+template struct compute_kernel_cpu<double, method::dense>;
+template struct partial_compute_kernel_cpu<float, method::dense>;
+template struct partial_compute_kernel_cpu<double, method::dense>;
+template struct finalize_compute_kernel_cpu<float, method::dense>;
+template struct finalize_compute_kernel_cpu<double, method::dense>;
+
+} // namespace oneapi::dal::covariance::backend
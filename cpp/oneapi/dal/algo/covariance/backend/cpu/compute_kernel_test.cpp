@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/covariance.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+constexpr std::int64_t row_count = 6;
+constexpr std::int64_t column_count = 3;
+
+const double data[row_count * column_count] = {
+    1.0, 2.0, -1.0, //
+    2.0, 0.5, 3.0, //
+    3.0, 4.0, 2.0, //
+    4.0, 1.0, 0.0, //
+    5.0, 7.0, -2.0, //
+    6.0, 3.0, 5.0, //
+};
+
+static void compute_reference(double* cov, double* cor, double* means) {
+    for (std::int64_t j = 0; j < column_count; j++) {
+        means[j] = 0.0;
+        for (std::int64_t i = 0; i < row_count; i++) {
+            means[j] += data[i * column_count + j] / row_count;
+        }
+    }
+    for (std::int64_t j = 0; j < column_count; j++) {
+        for (std::int64_t k = 0; k < column_count; k++) {
+            double sum = 0.0;
+            for (std::int64_t i = 0; i < row_count; i++) {
+                sum += (data[i * column_count + j] - means[j]) *
+                       (data[i * column_count + k] - means[k]);
+            }
+            cov[j * column_count + k] = sum / (row_count - 1);
+        }
+    }
+    for (std::int64_t j = 0; j < column_count; j++) {
+        for (std::int64_t k = 0; k < column_count; k++) {
+            cor[j * column_count + k] =
+                cov[j * column_count + k] /
+                std::sqrt(cov[j * column_count + j] * cov[k * column_count + k]);
+        }
+    }
+}
+
+static void check_result(const covariance::compute_result& result) {
+    double cov[column_count * column_count];
+    double cor[column_count * column_count];
+    double means[column_count];
+    compute_reference(cov, cor, means);
+
+    const auto arr_cov = row_accessor<const double>(result.get_cov_matrix()).pull();
+    const auto arr_cor = row_accessor<const double>(result.get_cor_matrix()).pull();
+    const auto arr_means = row_accessor<const double>(result.get_means()).pull();
+
+    ASSERT_EQ(arr_cov.get_count(), column_count * column_count);
+    ASSERT_EQ(arr_cor.get_count(), column_count * column_count);
+    ASSERT_EQ(arr_means.get_count(), column_count);
+
+    for (std::int64_t i = 0; i < column_count * column_count; i++) {
+        ASSERT_NEAR(arr_cov[i], cov[i], 1e-10);
+        ASSERT_NEAR(arr_cor[i], cor[i], 1e-10);
+    }
+    for (std::int64_t j = 0; j < column_count; j++) {
+        ASSERT_NEAR(arr_means[j], means[j], 1e-10);
+    }
+}
+
+TEST(covariance_dense_test, can_compute_batch) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = covariance::descriptor<double>{};
+
+    check_result(compute(desc, data_table));
+}
+
+TEST(covariance_dense_test, partial_compute_over_row_batches_matches_batch) {
+    const auto desc = covariance::descriptor<double>{};
+    constexpr std::int64_t batch_row_count = 2;
+
+    covariance::partial_compute_result partial;
+    for (std::int64_t first = 0; first < row_count; first += batch_row_count) {
+        const auto batch =
+            homogen_table::wrap(data + first * column_count, batch_row_count, column_count);
+        partial = first == 0 ? partial_compute(desc, batch) : partial_compute(desc, partial, batch);
+    }
+
+    const auto nobs = row_accessor<const double>(partial.get_nobs()).pull();
+    ASSERT_DOUBLE_EQ(nobs[0], double(row_count));
+
+    check_result(finalize_compute(desc, partial));
+}
+
+TEST(covariance_dense_test, finalize_compute_merges_partial_results_of_shards) {
+    const auto desc = covariance::descriptor<double>{};
+
+    const auto shard_a = homogen_table::wrap(data, 1, column_count);
+    const auto shard_b = homogen_table::wrap(data + column_count, 3, column_count);
+    const auto shard_c = homogen_table::wrap(data + 4 * column_count, 2, column_count);
+
+    const std::vector<covariance::partial_compute_result> partials = {
+        partial_compute(desc, shard_a),
+        partial_compute(desc, shard_b),
+        partial_compute(desc, shard_c),
+    };
+
+    check_result(finalize_compute(desc, partials));
+}
+
+TEST(covariance_dense_test, partial_compute_keeps_previous_result_unchanged) {
+    const auto desc = covariance::descriptor<double>{};
+
+    const auto first = partial_compute(desc, homogen_table::wrap(data, 3, column_count));
+    const auto sums_before = row_accessor<const double>(first.get_sums()).pull();
+    const double first_sum = sums_before[0];
+
+    partial_compute(desc, first, homogen_table::wrap(data + 3 * column_count, 3, column_count));
+
+    const auto sums_after = row_accessor<const double>(first.get_sums()).pull();
+    ASSERT_DOUBLE_EQ(sums_after[0], first_sum);
+}
+
+TEST(covariance_dense_test, partial_compute_throws_on_column_count_mismatch) {
+    const auto desc = covariance::descriptor<double>{};
+
+    const auto partial = partial_compute(desc, homogen_table::wrap(data, row_count, column_count));
+    const auto other = homogen_table::wrap(data, column_count, row_count);
+
+    ASSERT_THROW(partial_compute(desc, partial, other), invalid_argument);
+}
@@ -0,0 +1,27 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+class detail::descriptor_impl : public base {};
+
+using detail::descriptor_impl;
+
+descriptor_base::descriptor_base() : impl_(new descriptor_impl{}) {}
+
+} // namespace oneapi::dal::covariance
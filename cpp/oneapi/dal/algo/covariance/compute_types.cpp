@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+class detail::compute_input_impl : public base {
+public:
+    compute_input_impl(const table& data) : data(data) {}
+    table data;
+};
+
+class detail::compute_result_impl : public base {
+public:
+    table cov_matrix;
+    table cor_matrix;
+    table means;
+};
+
+class detail::partial_compute_result_impl : public base {
+public:
+    table nobs;
+    table crossproduct;
+    table sums;
+};
+
+class detail::partial_compute_input_impl : public base {
+public:
+    partial_compute_input_impl(const partial_compute_result& prev, const table& data)
+            : prev(prev), data(data) {}
+    partial_compute_result prev;
+    table data;
+};
+
+class detail::finalize_compute_input_impl : public base {
+public:
+    finalize_compute_input_impl(const std::vector<partial_compute_result>& partials)
+            : partials(partials) {}
+    std::vector<partial_compute_result> partials;
+};
+
+using detail::compute_input_impl;
+using detail::compute_result_impl;
+using detail::partial_compute_input_impl;
+using detail::partial_compute_result_impl;
+using detail::finalize_compute_input_impl;
+
+compute_input::compute_input(const table& data) : impl_(new compute_input_impl(data)) {}
+
+table compute_input::get_data() const {
+    return impl_->data;
+}
+
+void compute_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+compute_result::compute_result() : impl_(new compute_result_impl{}) {}
+
+table compute_result::get_cov_matrix() const {
+    return impl_->cov_matrix;
+}
+
+table compute_result::get_cor_matrix() const {
+    return impl_->cor_matrix;
+}
+
+table compute_result::get_means() const {
+    return impl_->means;
+}
+
+void compute_result::set_cov_matrix_impl(const table& value) {
+    impl_->cov_matrix = value;
+}
+
+void compute_result::set_cor_matrix_impl(const table& value) {
+    impl_->cor_matrix = value;
+}
+
+void compute_result::set_means_impl(const table& value) {
+    impl_->means = value;
+}
+
+partial_compute_result::partial_compute_result() : impl_(new partial_compute_result_impl{}) {}
+
+table partial_compute_result::get_nobs() const {
+    return impl_->nobs;
+}
+
+table partial_compute_result::get_crossproduct() const {
+    return impl_->crossproduct;
+}
+
+table partial_compute_result::get_sums() const {
+    return impl_->sums;
+}
+
+void partial_compute_result::set_nobs_impl(const table& value) {
+    impl_->nobs = value;
+}
+
+void partial_compute_result::set_crossproduct_impl(const table& value) {
+    impl_->crossproduct = value;
+}
+
+void partial_compute_result::set_sums_impl(const table& value) {
+    impl_->sums = value;
+}
+
+partial_compute_input::partial_compute_input(const table& data)
+        : impl_(new partial_compute_input_impl(partial_compute_result{}, data)) {}
+
+partial_compute_input::partial_compute_input(const partial_compute_result& prev, const table& data)
+        : impl_(new partial_compute_input_impl(prev, data)) {}
+
+table partial_compute_input::get_data() const {
+    return impl_->data;
+}
+
+partial_compute_result partial_compute_input::get_prev() const {
+    return impl_->prev;
+}
+
+void partial_compute_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+void partial_compute_input::set_prev_impl(const partial_compute_result& value) {
+    impl_->prev = value;
+}
+
+finalize_compute_input::finalize_compute_input(const partial_compute_result& partial)
+        : impl_(new finalize_compute_input_impl(std::vector<partial_compute_result>{ partial })) {}
+
+finalize_compute_input::finalize_compute_input(const std::vector<partial_compute_result>& partials)
+        : impl_(new finalize_compute_input_impl(partials)) {}
+
+std::vector<partial_compute_result> finalize_compute_input::get_partials() const {
+    return impl_->partials;
+}
+
+void finalize_compute_input::set_partials_impl(const std::vector<partial_compute_result>& value) {
+    impl_->partials = value;
+}
+
+} // namespace oneapi::dal::covariance
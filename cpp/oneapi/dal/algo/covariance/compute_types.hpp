@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/covariance/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+namespace detail {
+class compute_input_impl;
+class compute_result_impl;
+class partial_compute_input_impl;
+class partial_compute_result_impl;
+class finalize_compute_input_impl;
+} // namespace detail
+
+class ONEAPI_DAL_EXPORT compute_input : public base {
+public:
+    compute_input(const table& data);
+
+    table get_data() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+
+    dal::detail::pimpl<detail::compute_input_impl> impl_;
+};
+
+class ONEAPI_DAL_EXPORT compute_result : public base {
+public:
+    compute_result();
+
+    table get_cov_matrix() const;
+    table get_cor_matrix() const;
+    table get_means() const;
+
+    auto& set_cov_matrix(const table& value) {
+        set_cov_matrix_impl(value);
+        return *this;
+    }
+
+    auto& set_cor_matrix(const table& value) {
+        set_cor_matrix_impl(value);
+        return *this;
+    }
+
+    auto& set_means(const table& value) {
+        set_means_impl(value);
+        return *this;
+    }
+
+private:
+    void set_cov_matrix_impl(const table&);
+    void set_cor_matrix_impl(const table&);
+    void set_means_impl(const table&);
+
+    dal::detail::pimpl<detail::compute_result_impl> impl_;
+};
+
+/// Sufficient statistics of the rows processed so far: the number of rows,
+/// the cross-product matrix of the centered rows and the column sums.
+/// The memory footprint does not depend on the number of the processed rows
+class ONEAPI_DAL_EXPORT partial_compute_result : public base {
+public:
+    partial_compute_result();
+
+    table get_nobs() const;
+    table get_crossproduct() const;
+    table get_sums() const;
+
+    auto& set_nobs(const table& value) {
+        set_nobs_impl(value);
+        return *this;
+    }
+
+    auto& set_crossproduct(const table& value) {
+        set_crossproduct_impl(value);
+        return *this;
+    }
+
+    auto& set_sums(const table& value) {
+        set_sums_impl(value);
+        return *this;
+    }
+
+private:
+    void set_nobs_impl(const table&);
+    void set_crossproduct_impl(const table&);
+    void set_sums_impl(const table&);
+
+    dal::detail::pimpl<detail::partial_compute_result_impl> impl_;
+};
+
+class ONEAPI_DAL_EXPORT partial_compute_input : public base {
+public:
+    partial_compute_input(const table& data);
+    partial_compute_input(const partial_compute_result& prev, const table& data);
+
+    table get_data() const;
+    partial_compute_result get_prev() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+    auto& set_prev(const partial_compute_result& prev) {
+        set_prev_impl(prev);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+    void set_prev_impl(const partial_compute_result& prev);
+
+    dal::detail::pimpl<detail::partial_compute_input_impl> impl_;
+};
+
+/// Partial results to be merged and finalized. Several partial results
+/// come from the independent partial computations over the shards of the data
+class ONEAPI_DAL_EXPORT finalize_compute_input : public base {
+public:
+    finalize_compute_input(const partial_compute_result& partial);
+    finalize_compute_input(const std::vector<partial_compute_result>& partials);
+
+    std::vector<partial_compute_result> get_partials() const;
+
+    auto& set_partials(const std::vector<partial_compute_result>& partials) {
+        set_partials_impl(partials);
+        return *this;
+    }
+
+private:
+    void set_partials_impl(const std::vector<partial_compute_result>& partials);
+
+    dal::detail::pimpl<detail::finalize_compute_input_impl> impl_;
+};
+
+} // namespace oneapi::dal::covariance
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::covariance::detail {
+
+template <typename Context, typename... Options>
+struct partial_compute_ops_dispatcher {
+    partial_compute_result operator()(const Context&,
+                                      const descriptor_base&,
+                                      const partial_compute_input&) const;
+};
+
+inline void check_partial_result(const partial_compute_result& partial,
+                                 std::int64_t column_count) {
+    if (partial.get_nobs().get_row_count() != 1 || partial.get_nobs().get_column_count() != 1) {
+        throw invalid_argument("Partial result nobs should be 1 x 1 table");
+    }
+    if (partial.get_crossproduct().get_row_count() != column_count ||
+        partial.get_crossproduct().get_column_count() != column_count) {
+        throw invalid_argument("Partial result crossproduct should be column_count x column_count");
+    }
+    if (partial.get_sums().get_row_count() != 1 ||
+        partial.get_sums().get_column_count() != column_count) {
+        throw invalid_argument("Partial result sums should be 1 x column_count table");
+    }
+}
+
+template <typename Descriptor>
+struct partial_compute_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = partial_compute_input;
+    using result_t = partial_compute_result;
+    using descriptor_base_t = descriptor_base;
+
+    void check_preconditions(const Descriptor& params, const partial_compute_input& input) const {
+        if (!(input.get_data().has_data())) {
+            throw domain_error("Input data should not be empty");
+        }
+        if (input.get_prev().get_nobs().has_data()) {
+            check_partial_result(input.get_prev(), input.get_data().get_column_count());
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const partial_compute_input& input,
+                              const partial_compute_result& result) const {
+        const std::int64_t column_count = input.get_data().get_column_count();
+        if (result.get_crossproduct().get_column_count() != column_count) {
+            throw internal_error("Result crossproduct column_count should be equal to column_count");
+        }
+        if (result.get_sums().get_column_count() != column_count) {
+            throw internal_error("Result sums column_count should be equal to column_count");
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx,
+                    const Descriptor& desc,
+                    const partial_compute_input& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            partial_compute_ops_dispatcher<Context, float_t, method_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::covariance::detail
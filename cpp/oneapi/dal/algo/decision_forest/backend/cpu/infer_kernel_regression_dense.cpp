@@ -51,7 +51,7 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
     auto arr_data = row_accessor<const Float>{ data }.pull();
 
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
 
     /* init param for daal kernel */
     auto daal_input = rgr::prediction::Input();
@@ -62,8 +62,9 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     auto arr_label = row_accessor<const Float>{ labels }.pull();
 
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
-    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_label, row_count, 1);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
+    const auto daal_labels =
+        interop::convert_to_daal_read_only_homogen_table(arr_label, row_count, 1);
 
     /* init param for daal kernel */
     auto daal_input = reg::training::Input();
@@ -57,11 +57,14 @@ static infer_result call_daal_kernel(const context_cpu& ctx,
     array<Float> arr_objective_function_value = array<Float>::empty(1);
     array<int> arr_iteration_count = array<int>::empty(1);
 
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data =
+        interop::convert_to_daal_read_only_homogen_table(arr_data,
+                                                         data.get_row_count(),
+                                                         data.get_column_count());
     const auto daal_initial_centroids =
-        interop::convert_to_daal_homogen_table(arr_initial_centroids, cluster_count, column_count);
+        interop::convert_to_daal_read_only_homogen_table(arr_initial_centroids,
+                                                         cluster_count,
+                                                         column_count);
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
     const auto daal_objective_function_value =
         interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
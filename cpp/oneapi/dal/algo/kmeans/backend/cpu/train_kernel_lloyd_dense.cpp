@@ -58,9 +58,10 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     par.accuracyThreshold = accuracy_threshold;
 
     auto arr_data = row_accessor<const Float>{ data }.pull();
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data =
+        interop::convert_to_daal_read_only_homogen_table(arr_data,
+                                                         data.get_row_count(),
+                                                         data.get_column_count());
 
     auto new_initial_centroids = initial_centroids;
     if (!new_initial_centroids.has_data()) {
@@ -97,9 +98,9 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     array<int> arr_iteration_count = array<int>::empty(1);
 
     const auto daal_initial_centroids =
-        interop::convert_to_daal_homogen_table(arr_initial_centroids,
-                                               new_initial_centroids.get_row_count(),
-                                               new_initial_centroids.get_column_count());
+        interop::convert_to_daal_read_only_homogen_table(arr_initial_centroids,
+                                                         new_initial_centroids.get_row_count(),
+                                                         new_initial_centroids.get_column_count());
     const auto daal_centroids =
         interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
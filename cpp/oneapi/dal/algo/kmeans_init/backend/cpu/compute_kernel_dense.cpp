@@ -45,9 +45,10 @@ static compute_result call_daal_kernel(const context_cpu& ctx,
     daal_kmeans_init::Parameter par(cluster_count);
 
     auto arr_data = row_accessor<const Float>{ data }.pull();
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data =
+        interop::convert_to_daal_read_only_homogen_table(arr_data,
+                                                         data.get_row_count(),
+                                                         data.get_column_count());
     const size_t len_input = 1;
     daal::data_management::NumericTable* input[len_input] = { daal_data.get() };
 
@@ -47,7 +47,7 @@ static infer_result call_daal_kernel(const context_cpu &ctx,
     auto arr_labels = array<Float>::empty(1 * row_count);
 
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
 
     const std::int64_t dummy_seed = 777;
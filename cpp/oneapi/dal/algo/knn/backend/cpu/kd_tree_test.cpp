@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/knn.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+constexpr std::int64_t row_count = 64;
+constexpr std::int64_t column_count = 2;
+
+// Two well separated groups of points, the points of the first group are
+// labeled 0 and the points of the second one are labeled 1. The rows of the
+// groups are interleaved, so the kd-tree training has to rearrange them
+static void make_data(std::vector<float>& data, std::vector<float>& labels) {
+    data.resize(row_count * column_count);
+    labels.resize(row_count);
+    for (std::int64_t i = 0; i < row_count; i++) {
+        const float label = float(i % 2);
+        const float offset = 0.1f * float(i / 2);
+        data[i * column_count + 0] = 100.f * label + offset;
+        data[i * column_count + 1] = 100.f * label - offset;
+        labels[i] = label;
+    }
+}
+
+static void check_kd_tree(bool data_use_in_model) {
+    std::vector<float> data, labels;
+    make_data(data, labels);
+    const std::vector<float> original_data = data;
+    const std::vector<float> original_labels = labels;
+
+    const auto data_table = homogen_table::wrap(data.data(), row_count, column_count);
+    const auto labels_table = homogen_table::wrap(labels.data(), row_count, 1);
+
+    const auto desc = knn::descriptor<float, knn::method::kd_tree>{}
+                          .set_class_count(2)
+                          .set_neighbor_count(3)
+                          .set_data_use_in_model(data_use_in_model);
+
+    const auto train_result = train(desc, data_table, labels_table);
+
+    // The training works on the copies of the inputs
+    for (std::int64_t i = 0; i < row_count * column_count; i++) {
+        ASSERT_EQ(data[i], original_data[i]);
+    }
+    for (std::int64_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(labels[i], original_labels[i]);
+    }
+
+    const auto infer_result = infer(desc, data_table, train_result.get_model());
+    const auto predicted_table = infer_result.get_labels();
+    ASSERT_EQ(predicted_table.get_row_count(), row_count);
+    ASSERT_EQ(predicted_table.get_column_count(), 1);
+
+    const auto predicted = row_accessor<const float>(predicted_table).pull();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(predicted[i], original_labels[i]);
+    }
+}
+
+TEST(knn_kd_tree_test, can_train_and_infer) {
+    check_kd_tree(false);
+}
+
+TEST(knn_kd_tree_test, can_train_and_infer_with_data_in_model) {
+    check_kd_tree(true);
+}
@@ -47,8 +47,10 @@ static compute_result call_daal_kernel(const context_cpu& ctx,
 
     auto arr_values = array<Float>::empty(row_count_x * row_count_y);
 
-    const auto daal_x = interop::convert_to_daal_homogen_table(arr_x, row_count_x, column_count);
-    const auto daal_y = interop::convert_to_daal_homogen_table(arr_y, row_count_y, column_count);
+    const auto daal_x =
+        interop::convert_to_daal_read_only_homogen_table(arr_x, row_count_x, column_count);
+    const auto daal_y =
+        interop::convert_to_daal_read_only_homogen_table(arr_y, row_count_y, column_count);
     const auto daal_values =
         interop::convert_to_daal_homogen_table(arr_values, row_count_x, row_count_y);
 
@@ -0,0 +1,291 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+#include "oneapi/dal/algo/low_order_moments/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::low_order_moments::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_lom = daal::algorithms::low_order_moments;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, daal_lom::defaultDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_distributed_kernel_t =
+    daal_lom::internal::LowOrderMomentsDistributedKernel<Float, daal_lom::defaultDense, Cpu>;
+
+template <typename Float>
+static table build_table(array<Float>& arr, int64_t row_count, int64_t column_count) {
+    return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+}
+
+/// Copies the statistics of the previous partial result, the DAAL kernel updates
+/// them in place while the previous result shall stay unchanged
+template <typename Float>
+static array<Float> copy_partial(const table& t, int64_t count) {
+    if (!t.has_data()) {
+        return array<Float>::zeros(count);
+    }
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(count);
+    std::copy(src.get_data(), src.get_data() + count, dst.get_mutable_data());
+    return dst;
+}
+
+template <typename Float>
+static daal_dm::NumericTablePtr to_daal_table(const table& t, int64_t column_count) {
+    const auto arr = row_accessor<const Float>{ t }.pull();
+    return interop::convert_to_daal_read_only_homogen_table(arr, 1, column_count);
+}
+
+/// Partial statistics in the layout of the DAAL partial result: the number of
+/// observations followed by the minimum, maximum, sums, sums of squares and sums
+/// of squared differences from the means
+template <typename Float>
+struct partial_arrays {
+    explicit partial_arrays(int64_t column_count)
+            : column_count(column_count),
+              nobs(array<Float>::zeros(1)),
+              min(array<Float>::zeros(column_count)),
+              max(array<Float>::zeros(column_count)),
+              sum(array<Float>::zeros(column_count)),
+              sum_squares(array<Float>::zeros(column_count)),
+              sum_squares_centered(array<Float>::zeros(column_count)) {}
+
+    partial_arrays(const partial_compute_result& prev, int64_t column_count)
+            : column_count(column_count),
+              nobs(copy_partial<Float>(prev.get_nobs(), 1)),
+              min(copy_partial<Float>(prev.get_partial_min(), column_count)),
+              max(copy_partial<Float>(prev.get_partial_max(), column_count)),
+              sum(copy_partial<Float>(prev.get_partial_sum(), column_count)),
+              sum_squares(copy_partial<Float>(prev.get_partial_sum_squares(), column_count)),
+              sum_squares_centered(
+                  copy_partial<Float>(prev.get_partial_sum_squares_centered(), column_count)) {}
+
+    daal_lom::PartialResultPtr to_daal() {
+        daal_lom::PartialResultPtr daal_partial(new daal_lom::PartialResult());
+        daal_partial->set(daal_lom::nObservations,
+                          interop::convert_to_daal_homogen_table(nobs, 1, 1));
+        daal_partial->set(daal_lom::partialMinimum,
+                          interop::convert_to_daal_homogen_table(min, 1, column_count));
+        daal_partial->set(daal_lom::partialMaximum,
+                          interop::convert_to_daal_homogen_table(max, 1, column_count));
+        daal_partial->set(daal_lom::partialSum,
+                          interop::convert_to_daal_homogen_table(sum, 1, column_count));
+        daal_partial->set(daal_lom::partialSumSquares,
+                          interop::convert_to_daal_homogen_table(sum_squares, 1, column_count));
+        daal_partial->set(
+            daal_lom::partialSumSquaresCentered,
+            interop::convert_to_daal_homogen_table(sum_squares_centered, 1, column_count));
+        return daal_partial;
+    }
+
+    partial_compute_result to_result() {
+        return partial_compute_result()
+            .set_nobs(build_table(nobs, 1, 1))
+            .set_partial_min(build_table(min, 1, column_count))
+            .set_partial_max(build_table(max, 1, column_count))
+            .set_partial_sum(build_table(sum, 1, column_count))
+            .set_partial_sum_squares(build_table(sum_squares, 1, column_count))
+            .set_partial_sum_squares_centered(build_table(sum_squares_centered, 1, column_count));
+    }
+
+    int64_t column_count;
+    array<Float> nobs;
+    array<Float> min;
+    array<Float> max;
+    array<Float> sum;
+    array<Float> sum_squares;
+    array<Float> sum_squares_centered;
+};
+
+template <typename Float>
+static partial_compute_result call_daal_partial_kernel(const context_cpu& ctx,
+                                                       const table& data,
+                                                       const partial_compute_result& prev) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const bool has_prev = prev.get_nobs().has_data();
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    const auto daal_data =
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
+
+    auto partial = has_prev ? partial_arrays<Float>(prev, column_count)
+                            : partial_arrays<Float>(column_count);
+    auto daal_partial = partial.to_daal();
+
+    const daal_lom::Parameter daal_parameter;
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lom_online_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   daal_partial.get(),
+                                                                   &daal_parameter,
+                                                                   has_prev));
+
+    return partial.to_result();
+}
+
+/// Merges the partial results computed over the shards of the data
+template <typename Float>
+static partial_compute_result call_daal_merge_kernel(
+    const context_cpu& ctx,
+    const std::vector<partial_compute_result>& partials) {
+    const int64_t column_count = partials.front().get_partial_sum().get_column_count();
+
+    daal_dm::DataCollectionPtr daal_partials(new daal_dm::DataCollection());
+    for (const auto& p : partials) {
+        daal_lom::PartialResultPtr daal_partial(new daal_lom::PartialResult());
+        daal_partial->set(daal_lom::nObservations, to_daal_table<Float>(p.get_nobs(), 1));
+        daal_partial->set(daal_lom::partialMinimum,
+                          to_daal_table<Float>(p.get_partial_min(), column_count));
+        daal_partial->set(daal_lom::partialMaximum,
+                          to_daal_table<Float>(p.get_partial_max(), column_count));
+        daal_partial->set(daal_lom::partialSum,
+                          to_daal_table<Float>(p.get_partial_sum(), column_count));
+        daal_partial->set(daal_lom::partialSumSquares,
+                          to_daal_table<Float>(p.get_partial_sum_squares(), column_count));
+        daal_partial->set(daal_lom::partialSumSquaresCentered,
+                          to_daal_table<Float>(p.get_partial_sum_squares_centered(), column_count));
+        daal_partials->push_back(daal_partial);
+    }
+
+    partial_arrays<Float> merged(column_count);
+    auto daal_merged = merged.to_daal();
+
+    const daal_lom::Parameter daal_parameter;
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lom_distributed_kernel_t>(ctx,
+                                                                        daal_partials.get(),
+                                                                        daal_merged.get(),
+                                                                        &daal_parameter));
+
+    return merged.to_result();
+}
+
+template <typename Float>
+static compute_result finalize(const context_cpu& ctx, const partial_compute_result& partial) {
+    const int64_t column_count = partial.get_partial_sum().get_column_count();
+
+    const auto daal_nobs = to_daal_table<Float>(partial.get_nobs(), 1);
+    const auto daal_sum = to_daal_table<Float>(partial.get_partial_sum(), column_count);
+    const auto daal_sum_squares =
+        to_daal_table<Float>(partial.get_partial_sum_squares(), column_count);
+    const auto daal_sum_squares_centered =
+        to_daal_table<Float>(partial.get_partial_sum_squares_centered(), column_count);
+
+    auto arr_mean = array<Float>::empty(column_count);
+    auto arr_raw_moment = array<Float>::empty(column_count);
+    auto arr_variance = array<Float>::empty(column_count);
+    auto arr_std = array<Float>::empty(column_count);
+    auto arr_variation = array<Float>::empty(column_count);
+
+    const auto daal_mean = interop::convert_to_daal_homogen_table(arr_mean, 1, column_count);
+    const auto daal_raw_moment =
+        interop::convert_to_daal_homogen_table(arr_raw_moment, 1, column_count);
+    const auto daal_variance =
+        interop::convert_to_daal_homogen_table(arr_variance, 1, column_count);
+    const auto daal_std = interop::convert_to_daal_homogen_table(arr_std, 1, column_count);
+    const auto daal_variation =
+        interop::convert_to_daal_homogen_table(arr_variation, 1, column_count);
+
+    const daal_lom::Parameter daal_parameter;
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_lom_online_kernel_t<
+                   Float,
+                   oneapi::dal::backend::interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .finalizeCompute(daal_nobs.get(),
+                             daal_sum.get(),
+                             daal_sum_squares.get(),
+                             daal_sum_squares_centered.get(),
+                             daal_mean.get(),
+                             daal_raw_moment.get(),
+                             daal_variance.get(),
+                             daal_std.get(),
+                             daal_variation.get(),
+                             &daal_parameter);
+    }));
+
+    return compute_result()
+        .set_min(partial.get_partial_min())
+        .set_max(partial.get_partial_max())
+        .set_sum(partial.get_partial_sum())
+        .set_sum_squares(partial.get_partial_sum_squares())
+        .set_sum_squares_centered(partial.get_partial_sum_squares_centered())
+        .set_mean(build_table(arr_mean, 1, column_count))
+        .set_second_order_raw_moment(build_table(arr_raw_moment, 1, column_count))
+        .set_variance(build_table(arr_variance, 1, column_count))
+        .set_standard_deviation(build_table(arr_std, 1, column_count))
+        .set_variation(build_table(arr_variation, 1, column_count));
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        const auto partial =
+            call_daal_partial_kernel<Float>(ctx, input.get_data(), partial_compute_result{});
+        return finalize<Float>(ctx, partial);
+    }
+};
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method::dense> {
+    partial_compute_result operator()(const context_cpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        return call_daal_partial_kernel<Float>(ctx, input.get_data(), input.get_prev());
+    }
+};
+
+template <typename Float>
+struct finalize_compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const finalize_compute_input& input) const {
+        const auto partials = input.get_partials();
+        if (partials.size() == 1) {
+            return finalize<Float>(ctx, partials.front());
+        }
+        return finalize<Float>(ctx, call_daal_merge_kernel<Float>(ctx, partials));
+    }
+};
+
+template struct compute_kernel_cpu<float, method::dense>;
+template struct compute_kernel_cpu<double, method::dense>;
+template struct partial_compute_kernel_cpu<float, method::dense>;
+template struct partial_compute_kernel_cpu<double, method::dense>;
+template struct finalize_compute_kernel_cpu<float, method::dense>;
+template struct finalize_compute_kernel_cpu<double, method::dense>;
+
+} // namespace oneapi::dal::low_order_moments::backend
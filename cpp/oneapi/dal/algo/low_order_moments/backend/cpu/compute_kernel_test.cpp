@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/low_order_moments.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+constexpr std::int64_t row_count = 6;
+constexpr std::int64_t column_count = 3;
+
+const double data[row_count * column_count] = {
+    1.0, 2.0, -1.0, //
+    2.0, 0.5, 3.0, //
+    3.0, 4.0, 2.0, //
+    4.0, 1.0, 0.0, //
+    5.0, 7.0, -2.0, //
+    6.0, 3.0, 5.0, //
+};
+
+static void check_result(const low_order_moments::compute_result& result) {
+    const auto arr_min = row_accessor<const double>(result.get_min()).pull();
+    const auto arr_max = row_accessor<const double>(result.get_max()).pull();
+    const auto arr_sum = row_accessor<const double>(result.get_sum()).pull();
+    const auto arr_mean = row_accessor<const double>(result.get_mean()).pull();
+    const auto arr_variance = row_accessor<const double>(result.get_variance()).pull();
+
+    for (std::int64_t j = 0; j < column_count; j++) {
+        double min = data[j], max = data[j], sum = 0.0;
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const double x = data[i * column_count + j];
+            min = std::min(min, x);
+            max = std::max(max, x);
+            sum += x;
+        }
+        const double mean = sum / row_count;
+        double variance = 0.0;
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const double d = data[i * column_count + j] - mean;
+            variance += d * d / (row_count - 1);
+        }
+
+        ASSERT_DOUBLE_EQ(arr_min[j], min);
+        ASSERT_DOUBLE_EQ(arr_max[j], max);
+        ASSERT_NEAR(arr_sum[j], sum, 1e-10);
+        ASSERT_NEAR(arr_mean[j], mean, 1e-10);
+        ASSERT_NEAR(arr_variance[j], variance, 1e-10);
+    }
+}
+
+TEST(low_order_moments_dense_test, can_compute_batch) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = low_order_moments::descriptor<double>{};
+
+    check_result(compute(desc, data_table));
+}
+
+TEST(low_order_moments_dense_test, partial_compute_over_row_batches_matches_batch) {
+    const auto desc = low_order_moments::descriptor<double>{};
+    constexpr std::int64_t batch_row_count = 2;
+
+    low_order_moments::partial_compute_result partial;
+    for (std::int64_t first = 0; first < row_count; first += batch_row_count) {
+        const auto batch =
+            homogen_table::wrap(data + first * column_count, batch_row_count, column_count);
+        partial = first == 0 ? partial_compute(desc, batch) : partial_compute(desc, partial, batch);
+    }
+
+    const auto nobs = row_accessor<const double>(partial.get_nobs()).pull();
+    ASSERT_DOUBLE_EQ(nobs[0], double(row_count));
+
+    check_result(finalize_compute(desc, partial));
+}
+
+TEST(low_order_moments_dense_test, finalize_compute_merges_partial_results_of_shards) {
+    const auto desc = low_order_moments::descriptor<double>{};
+
+    const auto shard_a = homogen_table::wrap(data, 1, column_count);
+    const auto shard_b = homogen_table::wrap(data + column_count, 3, column_count);
+    const auto shard_c = homogen_table::wrap(data + 4 * column_count, 2, column_count);
+
+    const std::vector<low_order_moments::partial_compute_result> partials = {
+        partial_compute(desc, shard_a),
+        partial_compute(desc, shard_b),
+        partial_compute(desc, shard_c),
+    };
+
+    check_result(finalize_compute(desc, partials));
+}
+
+TEST(low_order_moments_dense_test, partial_compute_throws_on_column_count_mismatch) {
+    const auto desc = low_order_moments::descriptor<double>{};
+
+    const auto partial = partial_compute(desc, homogen_table::wrap(data, row_count, column_count));
+    const auto other = homogen_table::wrap(data, column_count, row_count);
+
+    ASSERT_THROW(partial_compute(desc, partial, other), invalid_argument);
+}
@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/low_order_moments/common.hpp"
+
+namespace oneapi::dal::low_order_moments {
+
+namespace detail {
+class compute_input_impl;
+class compute_result_impl;
+class partial_compute_input_impl;
+class partial_compute_result_impl;
+class finalize_compute_input_impl;
+} // namespace detail
+
+class ONEAPI_DAL_EXPORT compute_input : public base {
+public:
+    compute_input(const table& data);
+
+    table get_data() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+
+    dal::detail::pimpl<detail::compute_input_impl> impl_;
+};
+
+/// Each of the results is 1 x column_count table
+class ONEAPI_DAL_EXPORT compute_result : public base {
+public:
+    compute_result();
+
+    table get_min() const;
+    table get_max() const;
+    table get_sum() const;
+    table get_sum_squares() const;
+    table get_sum_squares_centered() const;
+    table get_mean() const;
+    table get_second_order_raw_moment() const;
+    table get_variance() const;
+    table get_standard_deviation() const;
+    table get_variation() const;
+
+    auto& set_min(const table& value) {
+        set_min_impl(value);
+        return *this;
+    }
+
+    auto& set_max(const table& value) {
+        set_max_impl(value);
+        return *this;
+    }
+
+    auto& set_sum(const table& value) {
+        set_sum_impl(value);
+        return *this;
+    }
+
+    auto& set_sum_squares(const table& value) {
+        set_sum_squares_impl(value);
+        return *this;
+    }
+
+    auto& set_sum_squares_centered(const table& value) {
+        set_sum_squares_centered_impl(value);
+        return *this;
+    }
+
+    auto& set_mean(const table& value) {
+        set_mean_impl(value);
+        return *this;
+    }
+
+    auto& set_second_order_raw_moment(const table& value) {
+        set_second_order_raw_moment_impl(value);
+        return *this;
+    }
+
+    auto& set_variance(const table& value) {
+        set_variance_impl(value);
+        return *this;
+    }
+
+    auto& set_standard_deviation(const table& value) {
+        set_standard_deviation_impl(value);
+        return *this;
+    }
+
+    auto& set_variation(const table& value) {
+        set_variation_impl(value);
+        return *this;
+    }
+
+private:
+    void set_min_impl(const table&);
+    void set_max_impl(const table&);
+    void set_sum_impl(const table&);
+    void set_sum_squares_impl(const table&);
+    void set_sum_squares_centered_impl(const table&);
+    void set_mean_impl(const table&);
+    void set_second_order_raw_moment_impl(const table&);
+    void set_variance_impl(const table&);
+    void set_standard_deviation_impl(const table&);
+    void set_variation_impl(const table&);
+
+    dal::detail::pimpl<detail::compute_result_impl> impl_;
+};
+
+/// Statistics of the rows processed so far: the number of rows in 1 x 1 table
+/// and the per-column minimums, maximums, sums, sums of squares and sums of squared
+/// differences from the means in 1 x column_count tables
+class ONEAPI_DAL_EXPORT partial_compute_result : public base {
+public:
+    partial_compute_result();
+
+    table get_nobs() const;
+    table get_partial_min() const;
+    table get_partial_max() const;
+    table get_partial_sum() const;
+    table get_partial_sum_squares() const;
+    table get_partial_sum_squares_centered() const;
+
+    auto& set_nobs(const table& value) {
+        set_nobs_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_min(const table& value) {
+        set_partial_min_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_max(const table& value) {
+        set_partial_max_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum_squares(const table& value) {
+        set_partial_sum_squares_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum_squares_centered(const table& value) {
+        set_partial_sum_squares_centered_impl(value);
+        return *this;
+    }
+
+private:
+    void set_nobs_impl(const table&);
+    void set_partial_min_impl(const table&);
+    void set_partial_max_impl(const table&);
+    void set_partial_sum_impl(const table&);
+    void set_partial_sum_squares_impl(const table&);
+    void set_partial_sum_squares_centered_impl(const table&);
+
+    dal::detail::pimpl<detail::partial_compute_result_impl> impl_;
+};
+
+class ONEAPI_DAL_EXPORT partial_compute_input : public base {
+public:
+    partial_compute_input(const table& data);
+    partial_compute_input(const partial_compute_result& prev, const table& data);
+
+    table get_data() const;
+    partial_compute_result get_prev() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+    auto& set_prev(const partial_compute_result& prev) {
+        set_prev_impl(prev);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+    void set_prev_impl(const partial_compute_result& prev);
+
+    dal::detail::pimpl<detail::partial_compute_input_impl> impl_;
+};
+
+/// Partial results to be merged and finalized. Several partial results
+/// come from the independent partial computations over the shards of the data
+class ONEAPI_DAL_EXPORT finalize_compute_input : public base {
+public:
+    finalize_compute_input(const partial_compute_result& partial);
+    finalize_compute_input(const std::vector<partial_compute_result>& partials);
+
+    std::vector<partial_compute_result> get_partials() const;
+
+    auto& set_partials(const std::vector<partial_compute_result>& partials) {
+        set_partials_impl(partials);
+        return *this;
+    }
+
+private:
+    void set_partials_impl(const std::vector<partial_compute_result>& partials);
+
+    dal::detail::pimpl<detail::finalize_compute_input_impl> impl_;
+};
+
+} // namespace oneapi::dal::low_order_moments
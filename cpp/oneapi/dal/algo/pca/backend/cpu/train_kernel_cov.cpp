@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <daal/src/algorithms/pca/pca_dense_correlation_batch_kernel.h>
+#include <daal/include/algorithms/engines/mt19937/mt19937.h>
 
 #include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
@@ -30,6 +31,7 @@ using dal::backend::context_cpu;
 
 namespace daal_pca = daal::algorithms::pca;
 namespace daal_cov = daal::algorithms::covariance;
+namespace daal_engines = daal::algorithms::engines;
 namespace interop = dal::backend::interop;
 
 template <typename Float, daal::CpuType Cpu>
@@ -38,7 +40,8 @@ using daal_pca_cor_kernel_t = daal_pca::internal::PCACorrelationKernel<daal::bat
 template <typename Float>
 static train_result call_daal_kernel(const context_cpu& ctx,
                                      const descriptor_base& desc,
-                                     const table& data) {
+                                     const table& data,
+                                     const daal_pca::EigenSolverParameter* eigen_solver) {
     const int64_t row_count = data.get_row_count();
     const int64_t column_count = data.get_column_count();
     const int64_t component_count = desc.get_component_count();
@@ -46,22 +49,18 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     auto arr_data = row_accessor<const Float>{ data }.pull();
     auto arr_eigvec = array<Float>::empty(column_count * component_count);
     auto arr_eigval = array<Float>::empty(1 * component_count);
-    auto arr_means = array<Float>::empty(1 * component_count);
-    auto arr_vars = array<Float>::empty(1 * component_count);
-
-    // TODO: read-only access performed with deep copy of data since daal numeric tables are mutable.
-    // Need to create special immutable homogen table on daal interop side
+    auto arr_means = array<Float>::empty(1 * column_count);
+    auto arr_vars = array<Float>::empty(1 * column_count);
 
     // TODO: data is table, not a homogen_table. Think better about accessor - is it enough to have just a row_accessor?
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
     const auto daal_eigenvectors =
-        interop::convert_to_daal_homogen_table(arr_eigvec, column_count, component_count);
+        interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
     const auto daal_eigenvalues =
         interop::convert_to_daal_homogen_table(arr_eigval, 1, component_count);
-    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, component_count);
-    const auto daal_variances =
-        interop::convert_to_daal_homogen_table(arr_vars, 1, component_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+    const auto daal_variances = interop::convert_to_daal_homogen_table(arr_vars, 1, column_count);
 
     daal_cov::Batch<Float, daal_cov::defaultDense> covariance_alg;
     covariance_alg.input.set(daal_cov::data, daal_data);
@@ -80,11 +79,12 @@ static train_result call_daal_kernel(const context_cpu& ctx,
                                                                 *daal_eigenvectors,
                                                                 *daal_eigenvalues,
                                                                 *daal_means,
-                                                                *daal_variances));
+                                                                *daal_variances,
+                                                                eigen_solver));
 
     return train_result()
         .set_model(model().set_eigenvectors(dal::detail::homogen_table_builder{}
-                                                .reset(arr_eigvec, column_count, component_count)
+                                                .reset(arr_eigvec, component_count, column_count)
                                                 .build()))
         .set_eigenvalues(
             dal::detail::homogen_table_builder{}.reset(arr_eigval, 1, component_count).build());
@@ -94,7 +94,21 @@ template <typename Float>
 static train_result train(const context_cpu& ctx,
                           const descriptor_base& desc,
                           const train_input& input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_data());
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), nullptr);
+}
+
+template <typename Float>
+static train_result train_randomized(const context_cpu& ctx,
+                                     const descriptor_base& desc,
+                                     const train_input& input) {
+    daal_pca::EigenSolverParameter eigen_solver;
+    eigen_solver.method = daal_pca::randomizedEigenSolver;
+    eigen_solver.nComponents = desc.get_component_count();
+    eigen_solver.nOversamples = desc.get_oversampling_count();
+    eigen_solver.nPowerIterations = desc.get_power_iteration_count();
+    eigen_solver.engine = daal_engines::mt19937::Batch<Float>::create(desc.get_seed());
+
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), &eigen_solver);
 }
 
 template <typename Float>
@@ -106,7 +120,18 @@ struct train_kernel_cpu<Float, method::cov> {
     }
 };
 
+template <typename Float>
+struct train_kernel_cpu<Float, method::randomized> {
+    train_result operator()(const context_cpu& ctx,
+                            const descriptor_base& desc,
+                            const train_input& input) const {
+        return train_randomized<Float>(ctx, desc, input);
+    }
+};
+
 template struct train_kernel_cpu<float, method::cov>;
 template struct train_kernel_cpu<double, method::cov>;
+template struct train_kernel_cpu<float, method::randomized>;
+template struct train_kernel_cpu<double, method::randomized>;
 
 } // namespace oneapi::dal::pca::backend
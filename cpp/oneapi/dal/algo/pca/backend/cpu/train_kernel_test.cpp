@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/pca.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+constexpr std::int64_t row_count = 200;
+constexpr std::int64_t column_count = 20;
+constexpr std::int64_t component_count = 3;
+
+// Data set with three dominant directions of well separated variances and small noise,
+// so the leading eigenpairs of the correlation matrix are well conditioned
+static std::vector<double> make_data() {
+    const double scales[component_count] = { 10.0, 5.0, 2.0 };
+    std::vector<double> data(row_count * column_count);
+    std::uint32_t state = 12345;
+    const auto next_uniform = [&]() {
+        state = state * 1664525u + 1013904223u;
+        return double(state) / 4294967296.0 - 0.5;
+    };
+    for (std::int64_t i = 0; i < row_count; i++) {
+        double factors[component_count];
+        for (std::int64_t k = 0; k < component_count; k++) {
+            factors[k] = scales[k] * next_uniform();
+        }
+        for (std::int64_t j = 0; j < column_count; j++) {
+            double value = 0.1 * next_uniform();
+            for (std::int64_t k = 0; k < component_count; k++) {
+                value += factors[k] * std::cos(double((k + 1) * (j + 1)));
+            }
+            data[i * column_count + j] = value;
+        }
+    }
+    return data;
+}
+
+TEST(pca_randomized_test, matches_covariance_method) {
+    const auto data = make_data();
+    const auto data_table = homogen_table::wrap(data.data(), row_count, column_count);
+
+    const auto cov_desc = pca::descriptor<double, pca::method::cov>{}
+                              .set_component_count(component_count)
+                              .set_is_deterministic(true);
+    const auto randomized_desc = pca::descriptor<double, pca::method::randomized>{}
+                                     .set_component_count(component_count)
+                                     .set_is_deterministic(true)
+                                     .set_oversampling_count(5)
+                                     .set_power_iteration_count(4)
+                                     .set_seed(42);
+
+    const auto cov_result = train(cov_desc, data_table);
+    const auto randomized_result = train(randomized_desc, data_table);
+
+    const auto cov_eigenvalues = row_accessor<const double>(cov_result.get_eigenvalues()).pull();
+    const auto randomized_eigenvalues =
+        row_accessor<const double>(randomized_result.get_eigenvalues()).pull();
+    ASSERT_EQ(cov_eigenvalues.get_count(), component_count);
+    ASSERT_EQ(randomized_eigenvalues.get_count(), component_count);
+    for (std::int64_t k = 0; k < component_count; k++) {
+        ASSERT_NEAR(randomized_eigenvalues[k], cov_eigenvalues[k], 1e-6 * cov_eigenvalues[0]);
+    }
+
+    const auto cov_eigenvectors =
+        row_accessor<const double>(cov_result.get_model().get_eigenvectors()).pull();
+    const auto randomized_eigenvectors =
+        row_accessor<const double>(randomized_result.get_model().get_eigenvectors()).pull();
+    ASSERT_EQ(cov_eigenvectors.get_count(), component_count * column_count);
+    ASSERT_EQ(randomized_eigenvectors.get_count(), component_count * column_count);
+
+    // The eigenvectors are unit vectors, they match up to the sign if their dot product is +-1
+    for (std::int64_t k = 0; k < component_count; k++) {
+        double dot = 0.0;
+        for (std::int64_t j = 0; j < column_count; j++) {
+            dot += cov_eigenvectors[k * column_count + j] *
+                   randomized_eigenvectors[k * column_count + j];
+        }
+        ASSERT_NEAR(std::abs(dot), 1.0, 1e-6);
+    }
+}
+
+TEST(pca_randomized_test, is_reproducible_with_the_same_seed) {
+    const auto data = make_data();
+    const auto data_table = homogen_table::wrap(data.data(), row_count, column_count);
+
+    const auto desc = pca::descriptor<double, pca::method::randomized>{}
+                          .set_component_count(component_count)
+                          .set_oversampling_count(2)
+                          .set_power_iteration_count(0)
+                          .set_seed(7);
+
+    const auto first = row_accessor<const double>(train(desc, data_table).get_eigenvalues()).pull();
+    const auto second =
+        row_accessor<const double>(train(desc, data_table).get_eigenvalues()).pull();
+    for (std::int64_t k = 0; k < component_count; k++) {
+        ASSERT_EQ(first[k], second[k]);
+    }
+}
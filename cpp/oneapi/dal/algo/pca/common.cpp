@@ -23,6 +23,9 @@ class detail::descriptor_impl : public base {
 public:
     std::int64_t component_count = -1;
     bool is_deterministic = false;
+    std::int64_t oversampling_count = 10;
+    std::int64_t power_iteration_count = 2;
+    std::int64_t seed = 777;
 };
 
 class detail::model_impl : public base {
@@ -43,6 +46,18 @@ bool descriptor_base::get_is_deterministic() const {
     return impl_->is_deterministic;
 }
 
+std::int64_t descriptor_base::get_oversampling_count() const {
+    return impl_->oversampling_count;
+}
+
+std::int64_t descriptor_base::get_power_iteration_count() const {
+    return impl_->power_iteration_count;
+}
+
+std::int64_t descriptor_base::get_seed() const {
+    return impl_->seed;
+}
+
 void descriptor_base::set_component_count_impl(std::int64_t value) {
     if (value < 0) {
         throw domain_error("Descriptor component_count should be >= 0");
@@ -54,6 +69,24 @@ void descriptor_base::set_is_deterministic_impl(bool value) {
     impl_->is_deterministic = value;
 }
 
+void descriptor_base::set_oversampling_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error("Descriptor oversampling_count should be >= 0");
+    }
+    impl_->oversampling_count = value;
+}
+
+void descriptor_base::set_power_iteration_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error("Descriptor power_iteration_count should be >= 0");
+    }
+    impl_->power_iteration_count = value;
+}
+
+void descriptor_base::set_seed_impl(std::int64_t value) {
+    impl_->seed = value;
+}
+
 model::model() : impl_(new model_impl{}) {}
 
 table model::get_eigenvectors() const {
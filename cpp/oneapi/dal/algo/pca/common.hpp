@@ -30,6 +30,9 @@ class model_impl;
 namespace method {
 struct cov {};
 struct svd {};
+/// Covariance-based method that finds the leading eigenvectors with the randomized
+/// range finder instead of the full eigendecomposition of the correlation matrix
+struct randomized {};
 using by_default = cov;
 } // namespace method
 
@@ -43,10 +46,16 @@ public:
 
     auto get_component_count() const -> std::int64_t;
     auto get_is_deterministic() const -> bool;
+    auto get_oversampling_count() const -> std::int64_t;
+    auto get_power_iteration_count() const -> std::int64_t;
+    auto get_seed() const -> std::int64_t;
 
 protected:
     void set_component_count_impl(std::int64_t value);
     void set_is_deterministic_impl(bool value);
+    void set_oversampling_count_impl(std::int64_t value);
+    void set_power_iteration_count_impl(std::int64_t value);
+    void set_seed_impl(std::int64_t value);
 
     dal::detail::pimpl<detail::descriptor_impl> impl_;
 };
@@ -66,6 +75,27 @@ public:
         set_is_deterministic_impl(value);
         return *this;
     }
+
+    /// Number of additional random directions of the randomized range finder,
+    /// used by method::randomized only
+    auto& set_oversampling_count(std::int64_t value) {
+        set_oversampling_count_impl(value);
+        return *this;
+    }
+
+    /// Number of power iterations of the randomized range finder,
+    /// used by method::randomized only
+    auto& set_power_iteration_count(std::int64_t value) {
+        set_power_iteration_count_impl(value);
+        return *this;
+    }
+
+    /// Seed of the engine that generates the random projection,
+    /// used by method::randomized only
+    auto& set_seed(std::int64_t value) {
+        set_seed_impl(value);
+        return *this;
+    }
 };
 
 class ONEAPI_DAL_EXPORT model : public base {
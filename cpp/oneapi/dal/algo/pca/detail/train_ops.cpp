@@ -36,7 +36,9 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method> {
 
 INSTANTIATE(float, method::cov)
 INSTANTIATE(float, method::svd)
+INSTANTIATE(float, method::randomized)
 INSTANTIATE(double, method::cov)
 INSTANTIATE(double, method::svd)
+INSTANTIATE(double, method::randomized)
 
 } // namespace oneapi::dal::pca::detail
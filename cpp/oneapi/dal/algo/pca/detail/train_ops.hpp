@@ -84,9 +84,9 @@ struct train_ops {
             throw internal_error(
                 "Result eigenvectors row_count should be equal to descriptor compunent_count");
         }
-        if (result.get_eigenvectors().get_column_count() != params.get_component_count()) {
+        if (result.get_eigenvectors().get_column_count() != input.get_data().get_column_count()) {
             throw internal_error(
-                "Result eigenvectors row_count should be equal to descriptor compunent_count");
+                "Result eigenvectors column_count should be equal to input data column_count");
         }
     }
 
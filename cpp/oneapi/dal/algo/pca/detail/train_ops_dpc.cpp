@@ -39,7 +39,9 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<data_parallel_policy, Float, Metho
 
 INSTANTIATE(float, method::cov)
 INSTANTIATE(float, method::svd)
+INSTANTIATE(float, method::randomized)
 INSTANTIATE(double, method::cov)
 INSTANTIATE(double, method::svd)
+INSTANTIATE(double, method::randomized)
 
 } // namespace oneapi::dal::pca::detail
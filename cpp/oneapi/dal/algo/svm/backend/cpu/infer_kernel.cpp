@@ -54,18 +54,28 @@ static infer_result call_daal_kernel(const context_cpu& ctx,
     auto arr_coeffs = row_accessor<const Float>{ trained_model.get_coeffs() }.pull();
 
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
-    const auto daal_support_vectors = interop::convert_to_daal_homogen_table(arr_support_vectors,
-                                                                             support_vector_count,
-                                                                             column_count);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
+    const auto daal_support_vectors =
+        interop::convert_to_daal_read_only_homogen_table(arr_support_vectors,
+                                                         support_vector_count,
+                                                         column_count);
     const auto daal_coeffs =
-        interop::convert_to_daal_homogen_table(arr_coeffs, support_vector_count, 1);
+        interop::convert_to_daal_read_only_homogen_table(arr_coeffs, support_vector_count, 1);
 
     auto daal_model = daal_model_builder{}
                           .set_support_vectors(daal_support_vectors)
                           .set_coeffs(daal_coeffs)
                           .set_bias(trained_model.get_bias());
 
+    /* Weights computed at the training let the inference with the linear kernel skip the support vectors */
+    const auto& primal_weights =
+        dal::detail::get_impl<detail::model_impl>(trained_model).primal_weights;
+    if (primal_weights.has_data()) {
+        auto arr_primal_weights = row_accessor<const Float>{ primal_weights }.pull();
+        daal_model.set_primal_weights(
+            interop::convert_to_daal_read_only_homogen_table(arr_primal_weights, 1, column_count));
+    }
+
     auto kernel_impl = desc.get_kernel_impl()->get_impl();
     const auto daal_kernel = kernel_impl->get_daal_kernel_function();
 
@@ -64,9 +64,11 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     auto arr_new_label = convert_labels(arr_label, { Float(-1.0), Float(1.0) }, unique_label);
 
     const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
-    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_new_label, row_count, 1);
-    const auto daal_weights = interop::convert_to_daal_homogen_table(arr_weights, row_count, 1);
+        interop::convert_to_daal_read_only_homogen_table(arr_data, row_count, column_count);
+    const auto daal_labels =
+        interop::convert_to_daal_read_only_homogen_table(arr_new_label, row_count, 1);
+    const auto daal_weights =
+        interop::convert_to_daal_read_only_homogen_table(arr_weights, row_count, 1);
 
     auto kernel_impl = desc.get_kernel_impl()->get_impl();
     const auto daal_kernel = kernel_impl->get_daal_kernel_function();
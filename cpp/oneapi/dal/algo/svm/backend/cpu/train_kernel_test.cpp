@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 #include "oneapi/dal/algo/svm/infer.hpp"
 #include "oneapi/dal/algo/svm/train.hpp"
+#include "oneapi/dal/algo/svm/detail/model_impl.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
@@ -364,3 +365,124 @@ TEST(svm_thunder_dense_test, can_classify_any_two_labels) {
         ASSERT_EQ(result_train.get_model().get_second_class_label(), expected_labels[1]);
     }
 }
+
+TEST(svm_thunder_dense_test, infer_with_linear_kernel_matches_support_vector_expansion) {
+    constexpr std::int64_t support_vector_count = 3;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t row_count_test = 4;
+    const float support_vectors[] = { -1.f, -1.f, +1.f, +2.f, +2.f, +1.f };
+    const float coeffs[] = { -1.f, +0.5f, +0.25f };
+    const float x_test[] = { 0.f, 0.f, 1.f, -1.f, -2.f, 3.f, 0.5f, 0.25f };
+    constexpr double bias = 0.5;
+    constexpr double scale = 0.5;
+    constexpr double shift = 2.0;
+
+    const auto model = svm::model()
+                           .set_support_vectors(homogen_table::wrap(support_vectors,
+                                                                    support_vector_count,
+                                                                    column_count))
+                           .set_coeffs(homogen_table::wrap(coeffs, support_vector_count, 1))
+                           .set_bias(bias)
+                           .set_support_vector_count(support_vector_count)
+                           .set_first_class_label(-1)
+                           .set_second_class_label(+1);
+
+    const auto kernel_desc = linear_kernel::descriptor{}.set_scale(scale).set_shift(shift);
+    const auto svm_desc = svm::descriptor{ kernel_desc };
+    const auto x_test_table = homogen_table::wrap(x_test, row_count_test, column_count);
+    const auto result_infer = infer(svm_desc, model, x_test_table);
+    const auto decision_function =
+        row_accessor<const float>(result_infer.get_decision_function()).pull();
+
+    for (std::int64_t i = 0; i < row_count_test; ++i) {
+        double expected = bias;
+        for (std::int64_t j = 0; j < support_vector_count; ++j) {
+            double dot = 0.0;
+            for (std::int64_t f = 0; f < column_count; ++f) {
+                dot += x_test[i * column_count + f] * support_vectors[j * column_count + f];
+            }
+            expected += coeffs[j] * (scale * dot + shift);
+        }
+        ASSERT_NEAR(decision_function[i], expected, 1e-5);
+    }
+}
+
+TEST(svm_thunder_dense_test, train_with_linear_kernel_stores_primal_weights) {
+    constexpr std::int64_t row_count_train = 8;
+    constexpr std::int64_t column_count = 2;
+    const float x_train[] = { -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f,
+                              +1.f, +2.f, +2.f, +1.f, -3.f, -3.f, +3.f, +3.f };
+    const float y_train[] = { -1.f, -1.f, -1.f, +1.f, +1.f, +1.f, +1.f, -1.f };
+    const auto x_train_table = homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = homogen_table::wrap(y_train, row_count_train, 1);
+
+    const auto svm_desc = svm::descriptor{}.set_c(1.0);
+    auto trained_model = train(svm_desc, x_train_table, y_train_table).get_model();
+
+    const auto& primal_weights =
+        detail::get_impl<svm::detail::model_impl>(trained_model).primal_weights;
+    ASSERT_TRUE(primal_weights.has_data());
+    ASSERT_EQ(primal_weights.get_row_count(), 1);
+    ASSERT_EQ(primal_weights.get_column_count(), column_count);
+
+    const std::int64_t support_vector_count = trained_model.get_support_vector_count();
+    const auto support_vectors =
+        row_accessor<const float>(trained_model.get_support_vectors()).pull();
+    const auto coeffs = row_accessor<const float>(trained_model.get_coeffs()).pull();
+    const auto weights = row_accessor<const float>(primal_weights).pull();
+    for (std::int64_t f = 0; f < column_count; ++f) {
+        double expected = 0.0;
+        for (std::int64_t j = 0; j < support_vector_count; ++j) {
+            expected += coeffs[j] * support_vectors[j * column_count + f];
+        }
+        ASSERT_NEAR(weights[f], expected, 1e-5);
+    }
+}
+
+TEST(svm_thunder_dense_test, infer_with_linear_kernel_uses_stored_primal_weights) {
+    constexpr std::int64_t support_vector_count = 2;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t row_count_test = 3;
+    const float support_vectors[] = { -1.f, -1.f, +1.f, +1.f };
+    const float coeffs[] = { -1.f, +1.f };
+    const float x_test[] = { 1.f, 0.f, 0.f, 1.f, 2.f, -1.f };
+    constexpr double bias = 0.25;
+
+    /* The stored weights differ from the support vector expansion w = (2, 2) on purpose */
+    const float stored_weights[] = { 3.f, -1.f };
+
+    auto model = svm::model()
+                     .set_support_vectors(homogen_table::wrap(support_vectors,
+                                                              support_vector_count,
+                                                              column_count))
+                     .set_coeffs(homogen_table::wrap(coeffs, support_vector_count, 1))
+                     .set_bias(bias)
+                     .set_support_vector_count(support_vector_count)
+                     .set_first_class_label(-1)
+                     .set_second_class_label(+1);
+    detail::get_impl<svm::detail::model_impl>(model).primal_weights =
+        homogen_table::wrap(stored_weights, 1, column_count);
+
+    const auto svm_desc = svm::descriptor{};
+    const auto x_test_table = homogen_table::wrap(x_test, row_count_test, column_count);
+    const auto stored = row_accessor<const float>(
+                            infer(svm_desc, model, x_test_table).get_decision_function())
+                            .pull();
+    for (std::int64_t i = 0; i < row_count_test; ++i) {
+        const double expected = bias + stored_weights[0] * x_test[i * column_count] +
+                                stored_weights[1] * x_test[i * column_count + 1];
+        ASSERT_NEAR(stored[i], expected, 1e-5);
+    }
+
+    /* Setting the coefficients resets the weights, the inference computes them from the model */
+    model.set_coeffs(homogen_table::wrap(coeffs, support_vector_count, 1));
+    ASSERT_FALSE(detail::get_impl<svm::detail::model_impl>(model).primal_weights.has_data());
+    const auto computed = row_accessor<const float>(
+                              infer(svm_desc, model, x_test_table).get_decision_function())
+                              .pull();
+    for (std::int64_t i = 0; i < row_count_test; ++i) {
+        const double expected = bias + 2.0 * x_test[i * column_count] +
+                                2.0 * x_test[i * column_count + 1];
+        ASSERT_NEAR(computed[i], expected, 1e-5);
+    }
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/algo/svm/detail/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
@@ -44,6 +45,11 @@ struct daal_model_builder : public daal::algorithms::svm::Model {
         _bias = bias;
         return *this;
     }
+
+    auto& set_primal_weights(daal::data_management::NumericTablePtr primal_weights) {
+        _primalWeights = primal_weights;
+        return *this;
+    }
 };
 
 template <typename T>
@@ -55,11 +61,17 @@ inline auto convert_from_daal_model(daal_svm::Model& model) {
     const double bias = model.getBias();
     const std::int64_t support_vector_count = table_support_vectors.get_row_count();
 
-    return dal::svm::model()
-        .set_support_vectors(table_support_vectors)
-        .set_coeffs(table_classification_coeffs)
-        .set_bias(bias)
-        .set_support_vector_count(support_vector_count);
+    auto trained_model = dal::svm::model()
+                             .set_support_vectors(table_support_vectors)
+                             .set_coeffs(table_classification_coeffs)
+                             .set_bias(bias)
+                             .set_support_vector_count(support_vector_count);
+
+    if (model.getPrimalWeights()) {
+        dal::detail::get_impl<detail::model_impl>(trained_model).primal_weights =
+            interop::convert_from_daal_homogen_table<T>(model.getPrimalWeights());
+    }
+    return trained_model;
 }
 
 } // namespace oneapi::dal::svm::backend
@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/algo/svm/common.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/algo/svm/detail/model_impl.hpp"
 #include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::svm {
@@ -136,16 +137,6 @@ public:
     bool shrinking = true;
 };
 
-class detail::model_impl : public base {
-public:
-    table support_vectors;
-    table coeffs;
-    double bias;
-    std::int64_t support_vector_count;
-    double first_class_label;
-    double second_class_label;
-};
-
 using detail::descriptor_impl;
 using detail::model_impl;
 
@@ -251,10 +242,12 @@ std::int64_t model::get_second_class_label() const {
 
 void model::set_support_vectors_impl(const table &value) {
     impl_->support_vectors = value;
+    impl_->primal_weights = table{};
 }
 
 void model::set_coeffs_impl(const table &value) {
     impl_->coeffs = value;
+    impl_->primal_weights = table{};
 }
 
 void model::set_bias_impl(double value) {
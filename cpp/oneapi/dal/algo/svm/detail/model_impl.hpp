@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/svm/common.hpp"
+
+namespace oneapi::dal::svm {
+
+class detail::model_impl : public base {
+public:
+    table support_vectors;
+    table coeffs;
+    double bias;
+    std::int64_t support_vector_count;
+    double first_class_label;
+    double second_class_label;
+
+    /* Sum of the support vectors weighted by the coefficients computed at the training with
+       the linear kernel, the inference with the linear kernel uses it instead of the support vectors.
+       The table is reset when the support vectors or the coefficients are changed */
+    table primal_weights;
+};
+
+} // namespace oneapi::dal::svm
@@ -0,0 +1,29 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/threading/threading.h>
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::backend {
+
+void execute_in_task_arena(void* task_arena, const std::function<void()>& op) {
+    daal::threader_execute_in_arena(task_arena, [&]() {
+        op();
+    });
+}
+
+} // namespace oneapi::dal::backend
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+
 #include "oneapi/dal/backend/dispatcher_cpu.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 
@@ -34,21 +37,50 @@ struct kernel_dispatcher {};
 class context_cpu {
 public:
     explicit context_cpu(const detail::host_policy& ctx)
-            : cpu_extensions_(ctx.get_enabled_cpu_extensions()) {}
+            : cpu_extensions_(ctx.get_enabled_cpu_extensions()),
+              task_arena_(ctx.get_task_arena()) {}
 
     detail::cpu_extension get_enabled_cpu_extensions() const {
         return cpu_extensions_;
     }
 
+    void* get_task_arena() const {
+        return task_arena_;
+    }
+
 private:
     detail::cpu_extension cpu_extensions_;
+    void* task_arena_;
 };
 
+/// Runs `op` in the task arena, the threading primitives of the library are
+/// only included in the implementation file
+void execute_in_task_arena(void* task_arena, const std::function<void()>& op);
+
+/// Runs `op` in the task arena of the context, so that all the threading
+/// primitives used by the kernel are limited to the threads of that arena
+template <typename Op>
+inline auto execute_in_task_arena(const context_cpu& ctx, Op&& op) {
+    using result_t = decltype(op());
+    void* task_arena = ctx.get_task_arena();
+    if (!task_arena) {
+        return op();
+    }
+    std::optional<result_t> result;
+    execute_in_task_arena(task_arena, [&]() {
+        result.emplace(op());
+    });
+    return std::move(*result);
+}
+
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
-        return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        const context_cpu cpu_ctx{ ctx };
+        return execute_in_task_arena(cpu_ctx, [&]() {
+            return CpuKernel()(cpu_ctx, std::forward<Args>(args)...);
+        });
     }
 };
 
@@ -61,6 +61,135 @@ inline auto convert_to_daal_homogen_table(array<T>& data,
                                                                  row_count);
 }
 
+/// Homogen numeric table over the data the table does not own and must not modify.
+/// Blocks of rows and columns can be acquired only for reading, the requests
+/// that may write to the data are rejected with the ErrorMethodNotSupported status
+template <typename T>
+class daal_read_only_homogen_table : public daal::data_management::HomogenNumericTable<T> {
+    using base_t = daal::data_management::HomogenNumericTable<T>;
+    using rw_mode_t = daal::data_management::ReadWriteMode;
+    using status_t = daal::services::Status;
+
+    template <typename U>
+    using block_t = daal::data_management::BlockDescriptor<U>;
+
+public:
+    using ptr_t = daal::services::SharedPtr<daal_read_only_homogen_table<T>>;
+
+    static ptr_t create(const daal::services::SharedPtr<T>& data,
+                        std::int64_t row_count,
+                        std::int64_t column_count) {
+        status_t status;
+        ptr_t table{ new daal_read_only_homogen_table(data, row_count, column_count, status) };
+        return status.ok() ? table : ptr_t{};
+    }
+
+    status_t getBlockOfRows(size_t vector_idx,
+                            size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_t<double>& block) override {
+        return get_rows(vector_idx, vector_num, rwflag, block);
+    }
+
+    status_t getBlockOfRows(size_t vector_idx,
+                            size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_t<float>& block) override {
+        return get_rows(vector_idx, vector_num, rwflag, block);
+    }
+
+    status_t getBlockOfRows(size_t vector_idx,
+                            size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_t<int>& block) override {
+        return get_rows(vector_idx, vector_num, rwflag, block);
+    }
+
+    status_t getBlockOfColumnValues(size_t feature_idx,
+                                    size_t vector_idx,
+                                    size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_t<double>& block) override {
+        return get_column(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    status_t getBlockOfColumnValues(size_t feature_idx,
+                                    size_t vector_idx,
+                                    size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_t<float>& block) override {
+        return get_column(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    status_t getBlockOfColumnValues(size_t feature_idx,
+                                    size_t vector_idx,
+                                    size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_t<int>& block) override {
+        return get_column(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    status_t assign(float) override {
+        return status_t{ daal::services::ErrorMethodNotSupported };
+    }
+
+    status_t assign(double) override {
+        return status_t{ daal::services::ErrorMethodNotSupported };
+    }
+
+    status_t assign(int) override {
+        return status_t{ daal::services::ErrorMethodNotSupported };
+    }
+
+private:
+    daal_read_only_homogen_table(const daal::services::SharedPtr<T>& data,
+                                 std::int64_t row_count,
+                                 std::int64_t column_count,
+                                 status_t& status)
+            : base_t(daal::data_management::DictionaryIface::notEqual,
+                     data,
+                     column_count,
+                     row_count,
+                     status) {}
+
+    static bool is_write(rw_mode_t rwflag) {
+        return (rwflag & daal::data_management::writeOnly) != 0;
+    }
+
+    template <typename U>
+    status_t get_rows(size_t vector_idx, size_t vector_num, rw_mode_t rwflag, block_t<U>& block) {
+        if (is_write(rwflag))
+            return status_t{ daal::services::ErrorMethodNotSupported };
+        return base_t::getBlockOfRows(vector_idx, vector_num, rwflag, block);
+    }
+
+    template <typename U>
+    status_t get_column(size_t feature_idx,
+                        size_t vector_idx,
+                        size_t value_num,
+                        rw_mode_t rwflag,
+                        block_t<U>& block) {
+        if (is_write(rwflag))
+            return status_t{ daal::services::ErrorMethodNotSupported };
+        return base_t::getBlockOfColumnValues(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+};
+
+/// Wraps the data of the array into the DAAL table without copying it,
+/// even if the array holds immutable data. The table is read-only and
+/// shall be used only for the inputs of the DAAL kernels
+template <typename T>
+inline auto convert_to_daal_read_only_homogen_table(const array<T>& data,
+                                                    std::int64_t row_count,
+                                                    std::int64_t column_count) {
+    using table_t = daal_read_only_homogen_table<T>;
+    if (!data.get_count())
+        return typename table_t::ptr_t();
+    const auto daal_data =
+        daal::services::SharedPtr<T>(const_cast<T*>(data.get_data()), daal_array_owner<T>{ data });
+    return table_t::create(daal_data, row_count, column_count);
+}
+
 template <typename T>
 inline table convert_from_daal_homogen_table(const daal::data_management::NumericTablePtr& nt) {
     daal::data_management::BlockDescriptor<T> block;
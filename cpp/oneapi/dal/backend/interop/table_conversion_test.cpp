@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+namespace daal_dm = daal::data_management;
+
+TEST(table_conversion_test, read_only_table_does_not_copy_immutable_data) {
+    constexpr std::int64_t row_count = 4;
+    constexpr std::int64_t column_count = 3;
+    const float data[row_count * column_count] = { 0.f, 1.f, 2.f, 3.f, 4.f,  5.f,
+                                                   6.f, 7.f, 8.f, 9.f, 10.f, 11.f };
+
+    array<float> arr(data, row_count * column_count, [](const float*) {});
+    ASSERT_FALSE(arr.has_mutable_data());
+
+    const auto daal_table =
+        backend::interop::convert_to_daal_read_only_homogen_table(arr, row_count, column_count);
+    ASSERT_TRUE(daal_table.get() != nullptr);
+    ASSERT_EQ(daal_table->getNumberOfRows(), row_count);
+    ASSERT_EQ(daal_table->getNumberOfColumns(), column_count);
+    ASSERT_EQ(daal_table->getArray(), data);
+    ASSERT_FALSE(arr.has_mutable_data());
+
+    daal_dm::BlockDescriptor<float> block;
+    ASSERT_TRUE(daal_table->getBlockOfRows(1, 2, daal_dm::readOnly, block).ok());
+    ASSERT_EQ(block.getBlockPtr(), data + column_count);
+    ASSERT_TRUE(daal_table->releaseBlockOfRows(block).ok());
+}
+
+TEST(table_conversion_test, read_only_table_rejects_write_access) {
+    constexpr std::int64_t row_count = 2;
+    constexpr std::int64_t column_count = 2;
+    const double data[row_count * column_count] = { 1.0, 2.0, 3.0, 4.0 };
+
+    array<double> arr(data, row_count * column_count, [](const double*) {});
+    const auto daal_table =
+        backend::interop::convert_to_daal_read_only_homogen_table(arr, row_count, column_count);
+    ASSERT_TRUE(daal_table.get() != nullptr);
+
+    daal_dm::BlockDescriptor<double> rows;
+    ASSERT_FALSE(daal_table->getBlockOfRows(0, row_count, daal_dm::writeOnly, rows).ok());
+    ASSERT_FALSE(daal_table->getBlockOfRows(0, row_count, daal_dm::readWrite, rows).ok());
+
+    daal_dm::BlockDescriptor<float> column;
+    ASSERT_FALSE(
+        daal_table->getBlockOfColumnValues(0, 0, row_count, daal_dm::readWrite, column).ok());
+    ASSERT_TRUE(
+        daal_table->getBlockOfColumnValues(1, 0, row_count, daal_dm::readOnly, column).ok());
+    ASSERT_FLOAT_EQ(column.getBlockPtr()[1], 4.0f);
+    ASSERT_TRUE(daal_table->releaseBlockOfColumnValues(column).ok());
+
+    ASSERT_FALSE(daal_table->assign(0.0).ok());
+    ASSERT_DOUBLE_EQ(data[0], 1.0);
+}
+
+TEST(table_conversion_test, read_only_table_keeps_array_alive) {
+    constexpr std::int64_t count = 6;
+    bool deleted = false;
+    const auto ptr = new float[count]{};
+
+    auto daal_table = [&]() {
+        array<float> arr(static_cast<const float*>(ptr), count, [&](const float* p) {
+            deleted = true;
+            delete[] p;
+        });
+        return backend::interop::convert_to_daal_read_only_homogen_table(arr, 2, 3);
+    }();
+
+    ASSERT_FALSE(deleted);
+    ASSERT_EQ(daal_table->getArray(), ptr);
+    daal_table.reset();
+    ASSERT_TRUE(deleted);
+}
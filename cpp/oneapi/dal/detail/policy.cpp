@@ -14,14 +14,18 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <daal/include/services/threading_context.h>
+
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::detail {
 
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::interop::detect_top_cpu_extension();
+    daal::services::ThreadingContextPtr threading_context;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -34,6 +38,42 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+std::int64_t host_policy::get_max_thread_count() const noexcept {
+    if (impl_->threading_context) {
+        return static_cast<std::int64_t>(impl_->threading_context->getMaxThreads());
+    }
+    return static_cast<std::int64_t>(daal::services::Environment::getInstance()->getNumberOfThreads());
+}
+
+void* host_policy::get_task_arena() const noexcept {
+    return impl_->threading_context ? impl_->threading_context->getTaskArena() : nullptr;
+}
+
+void host_policy::set_max_thread_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw invalid_argument("Max thread count should be >= 0");
+    }
+    if (value == 0) {
+        impl_->threading_context.reset();
+        return;
+    }
+    impl_->threading_context = daal::services::ThreadingContext::create(static_cast<size_t>(value));
+    if (!impl_->threading_context) {
+        throw bad_alloc();
+    }
+}
+
+void host_policy::set_task_arena_impl(void* task_arena) {
+    if (!task_arena) {
+        impl_->threading_context.reset();
+        return;
+    }
+    impl_->threading_context = daal::services::ThreadingContext::createFromTaskArena(task_arena);
+    if (!impl_->threading_context) {
+        throw bad_alloc();
+    }
+}
+
 #ifdef ONEAPI_DAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
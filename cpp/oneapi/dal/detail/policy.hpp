@@ -46,13 +46,38 @@ public:
 
     cpu_extension get_enabled_cpu_extensions() const noexcept;
 
+    /// The maximal number of threads used by the computations run with this policy
+    std::int64_t get_max_thread_count() const noexcept;
+
+    /// The task arena the computations run with this policy are executed in,
+    /// `nullptr` if the computations run in the arena of the calling thread
+    void* get_task_arena() const noexcept;
+
     auto& set_enabled_cpu_extensions(const cpu_extension& extensions) {
         set_enabled_cpu_extensions_impl(extensions);
         return *this;
     }
 
+    /// Limits the number of threads used by the computations run with this policy.
+    /// The computations run in a task arena owned by the policy, so concurrent calls
+    /// with different policies do not compete for the global threading setting.
+    /// Zero removes the limit.
+    auto& set_max_thread_count(std::int64_t value) {
+        set_max_thread_count_impl(value);
+        return *this;
+    }
+
+    /// Runs the computations in the caller-owned `tbb::task_arena`.
+    /// The arena must outlive all the calls made with this policy.
+    auto& set_task_arena(void* task_arena) {
+        set_task_arena_impl(task_arena);
+        return *this;
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_thread_count_impl(std::int64_t value);
+    void set_task_arena_impl(void* task_arena);
 
     pimpl<detail::host_policy_impl> impl_;
 };
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using detail::host_policy;
+
+TEST(host_policy_test, runs_in_calling_arena_by_default) {
+    host_policy policy;
+
+    ASSERT_EQ(policy.get_task_arena(), nullptr);
+    ASSERT_GT(policy.get_max_thread_count(), 0);
+}
+
+TEST(host_policy_test, can_limit_max_thread_count) {
+    host_policy policy;
+    policy.set_max_thread_count(2);
+
+    ASSERT_NE(policy.get_task_arena(), nullptr);
+    ASSERT_GE(policy.get_max_thread_count(), 1);
+    ASSERT_LE(policy.get_max_thread_count(), 2);
+}
+
+TEST(host_policy_test, copies_share_task_arena) {
+    host_policy policy;
+    policy.set_max_thread_count(1);
+    const host_policy copy = policy;
+
+    ASSERT_EQ(copy.get_task_arena(), policy.get_task_arena());
+    ASSERT_EQ(copy.get_max_thread_count(), 1);
+}
+
+TEST(host_policy_test, can_reset_max_thread_count) {
+    host_policy policy;
+    policy.set_max_thread_count(1);
+    policy.set_max_thread_count(0);
+
+    ASSERT_EQ(policy.get_task_arena(), nullptr);
+}
+
+TEST(host_policy_test, throws_on_negative_max_thread_count) {
+    host_policy policy;
+
+    ASSERT_THROW(policy.set_max_thread_count(-1), invalid_argument);
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "src/threading/threading.h"
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/parser.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+template <typename Float>
+table parse_table(const char* begin, const char* end, char delimiter, int64_t column_count) {
+    const int64_t data_size = end - begin;
+    const int64_t thread_count = int64_t(daal::threader_get_threads_number());
+    const int64_t chunk_count =
+        std::max(int64_t(1),
+                 std::min(thread_count * chunks_per_thread,
+                          (data_size + min_chunk_size - 1) / min_chunk_size));
+
+    std::vector<const char*> chunk_bounds(chunk_count + 1);
+    std::vector<int64_t> row_offsets(chunk_count + 1);
+
+    for (int64_t i = 0; i <= chunk_count; ++i) {
+        chunk_bounds[i] = align_to_line(begin + data_size * i / chunk_count, begin, end);
+    }
+
+    daal::threader_for(chunk_count, chunk_count, [&](int64_t i) {
+        int64_t row_count = 0;
+        for_each_line(chunk_bounds[i], chunk_bounds[i + 1], [&](const char*, const char*) {
+            ++row_count;
+        });
+        row_offsets[i + 1] = row_count;
+    });
+
+    row_offsets[0] = 0;
+    for (int64_t i = 0; i < chunk_count; ++i) {
+        row_offsets[i + 1] += row_offsets[i];
+    }
+    const int64_t row_count = row_offsets[chunk_count];
+
+    auto arr = array<Float>::empty(row_count * column_count);
+    Float* const data = arr.get_mutable_data();
+
+    // Only the first row is checked before the parsing, so the chunks report
+    // the non-numeric tokens of the other rows here
+    std::vector<char> is_chunk_numeric(chunk_count, 1);
+
+    daal::threader_for(chunk_count, chunk_count, [&](int64_t i) {
+        Float* row = data + row_offsets[i] * column_count;
+        bool is_numeric = true;
+        for_each_line(chunk_bounds[i],
+                      chunk_bounds[i + 1],
+                      [&](const char* line_begin, const char* line_end) {
+                          is_numeric &=
+                              parse_row(line_begin, line_end, delimiter, column_count, row);
+                          row += column_count;
+                      });
+        is_chunk_numeric[i] = is_numeric;
+    });
+
+    for (int64_t i = 0; i < chunk_count; ++i) {
+        if (!is_chunk_numeric[i]) {
+            throw invalid_argument("CSV file has non-numeric values after the first row");
+        }
+    }
+
+    return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+}
+
+template table parse_table<float>(const char*, const char*, char, int64_t);
+template table parse_table<double>(const char*, const char*, char, int64_t);
+
+} // namespace oneapi::dal::csv::backend
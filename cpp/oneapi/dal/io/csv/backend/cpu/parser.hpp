@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+using std::int64_t;
+using std::uint64_t;
+
+/// The file is split into chunks of whole lines parsed by separate tasks. A chunk
+/// is not smaller than min_chunk_size bytes, and there are at most
+/// chunks_per_thread chunks per thread to balance lines of uneven length
+constexpr int64_t min_chunk_size = 1 << 20;
+constexpr int64_t chunks_per_thread = 4;
+
+inline const char* find_line_end(const char* begin, const char* end) {
+    const void* p = std::memchr(begin, '\n', end - begin);
+    return p ? static_cast<const char*>(p) : end;
+}
+
+/// Calls body(line_begin, line_end) for each non-empty line in [begin, end),
+/// the line terminators are not included in the line
+template <typename Body>
+inline void for_each_line(const char* begin, const char* end, const Body& body) {
+    while (begin < end) {
+        const char* line_end = find_line_end(begin, end);
+        const char* next = (line_end < end) ? line_end + 1 : end;
+        while (line_end > begin && line_end[-1] == '\r') {
+            --line_end;
+        }
+        if (line_end > begin) {
+            body(begin, line_end);
+        }
+        begin = next;
+    }
+}
+
+/// Moves the position forward to the beginning of the next line unless it
+/// already points to a beginning of a line
+inline const char* align_to_line(const char* pos, const char* begin, const char* end) {
+    if (pos <= begin || pos >= end || pos[-1] == '\n') {
+        return std::min(std::max(pos, begin), end);
+    }
+    const char* line_end = find_line_end(pos, end);
+    return (line_end < end) ? line_end + 1 : end;
+}
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/// Parses the token with strtod, the token is copied since the file contents
+/// are not null-terminated
+inline bool parse_token_slow(const char* begin, const char* end, double& value) {
+    char small_buffer[64];
+    std::string large_buffer;
+    const int64_t length = end - begin;
+    char* token = small_buffer;
+    if (length < int64_t(sizeof(small_buffer))) {
+        std::memcpy(small_buffer, begin, length);
+        small_buffer[length] = '\0';
+    }
+    else {
+        large_buffer.assign(begin, end);
+        token = &large_buffer[0];
+    }
+
+    char* parsed_end = nullptr;
+    value = std::strtod(token, &parsed_end);
+    if (parsed_end == token) {
+        value = 0.0;
+        return false;
+    }
+    return true;
+}
+
+/// Parses a decimal floating-point token. Tokens with at most 19 significant
+/// digits and a small decimal exponent are converted exactly with a single
+/// multiplication or division by a power of ten, other tokens go to strtod
+inline bool parse_token(const char* begin, const char* end, double& value) {
+    static const double powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    constexpr uint64_t max_exact_mantissa = uint64_t(1) << 53;
+
+    while (begin < end && is_blank(*begin)) {
+        ++begin;
+    }
+    while (end > begin && is_blank(end[-1])) {
+        --end;
+    }
+
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int64_t digit_count = 0;
+    int64_t significant_count = 0;
+    int64_t exponent = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, ++digit_count) {
+        if (mantissa || *p != '0') {
+            mantissa = mantissa * 10 + (*p - '0');
+            ++significant_count;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p, ++digit_count) {
+            if (mantissa || *p != '0') {
+                mantissa = mantissa * 10 + (*p - '0');
+                ++significant_count;
+            }
+            --exponent;
+        }
+    }
+    if (digit_count == 0 || significant_count > 19) {
+        return parse_token_slow(begin, end, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negative_exponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative_exponent = (*p == '-');
+            ++p;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            return parse_token_slow(begin, end, value);
+        }
+        int64_t e = 0;
+        for (; p < end && *p >= '0' && *p <= '9' && e < 100000; ++p) {
+            e = e * 10 + (*p - '0');
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+    if (p != end || mantissa > max_exact_mantissa || exponent < -22 || exponent > 22) {
+        return parse_token_slow(begin, end, value);
+    }
+
+    double result = double(mantissa);
+    result = (exponent < 0) ? result / powers_of_ten[-exponent] : result * powers_of_ten[exponent];
+    value = negative ? -result : result;
+    return true;
+}
+
+/// Parses the tokens of the line into the row, the missing values are set to zero
+/// and the extra tokens are ignored. Returns false if some token is not a number
+template <typename Float>
+inline bool parse_row(const char* begin,
+                      const char* end,
+                      char delimiter,
+                      int64_t column_count,
+                      Float* row) {
+    bool is_numeric = true;
+    int64_t column = 0;
+    const char* token_begin = begin;
+    while (column < column_count && token_begin <= end) {
+        const void* p = std::memchr(token_begin, delimiter, end - token_begin);
+        const char* token_end = p ? static_cast<const char*>(p) : end;
+
+        double value = 0.0;
+        is_numeric &= parse_token(token_begin, token_end, value);
+        row[column++] = static_cast<Float>(value);
+
+        token_begin = token_end + 1;
+    }
+    for (; column < column_count; ++column) {
+        row[column] = Float(0);
+    }
+    return is_numeric;
+}
+
+inline int64_t count_tokens(const char* begin, const char* end, char delimiter) {
+    return 1 + std::count(begin, end, delimiter);
+}
+
+/// Finds the first non-empty line in [begin, end), returns false if there is none
+inline bool find_first_line(const char* begin,
+                            const char* end,
+                            const char*& line_begin,
+                            const char*& line_end) {
+    while (begin < end) {
+        const char* last = find_line_end(begin, end);
+        const char* next = (last < end) ? last + 1 : end;
+        while (last > begin && last[-1] == '\r') {
+            --last;
+        }
+        if (last > begin) {
+            line_begin = begin;
+            line_end = last;
+            return true;
+        }
+        begin = next;
+    }
+    return false;
+}
+
+/// Parses the non-empty lines of [begin, end) into a table with column_count
+/// columns. The data are split into chunks of whole lines, the rows of each
+/// chunk are counted in parallel, and after the prefix sum of the counts each
+/// chunk is parsed directly into its rows of the table
+template <typename Float>
+table parse_table(const char* begin, const char* end, char delimiter, int64_t column_count);
+
+} // namespace oneapi::dal::csv::backend
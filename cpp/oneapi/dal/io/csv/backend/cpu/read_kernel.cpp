@@ -23,9 +23,23 @@
 
 #endif
 
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/parser.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
 #include "oneapi/dal/table/common.hpp"
 
@@ -34,10 +48,71 @@ namespace oneapi::dal::csv::backend {
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const data_source& ds,
-                                         const read_args<table>& args) const {
+/// Read-only view of the file contents: the file is memory-mapped where
+/// available and read into memory otherwise
+class file_view {
+public:
+    explicit file_view(const std::string& file_name) {
+#if !defined(_WIN32) && !defined(_WIN64)
+        const int fd = ::open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw invalid_argument("File not found");
+        }
+        struct stat st = {};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* ptr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED) {
+                ::madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+                mapped_ = ptr;
+                data_ = static_cast<const char*>(ptr);
+                size_ = st.st_size;
+            }
+        }
+        ::close(fd);
+        if (mapped_ || st.st_size == 0) {
+            return;
+        }
+#endif
+        std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            throw invalid_argument("File not found");
+        }
+        size_ = static_cast<int64_t>(file.tellg());
+        buffer_.reset(new char[size_ > 0 ? size_ : 1]);
+        file.seekg(0);
+        file.read(buffer_.get(), size_);
+        data_ = buffer_.get();
+    }
+
+    ~file_view() {
+#if !defined(_WIN32) && !defined(_WIN64)
+        if (mapped_) {
+            ::munmap(mapped_, size_);
+        }
+#endif
+    }
+
+    file_view(const file_view&) = delete;
+    file_view& operator=(const file_view&) = delete;
+
+    const char* begin() const {
+        return data_;
+    }
+
+    const char* end() const {
+        return data_ + size_;
+    }
+
+private:
+    void* mapped_ = nullptr;
+    std::unique_ptr<char[]> buffer_;
+    const char* data_ = nullptr;
+    int64_t size_ = 0;
+};
+
+/// Reads the file with DAAL CSV data source, used for the files with
+/// categorical features that need a dictionary of the feature values
+static table read_with_daal(const data_source& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -56,4 +131,38 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
         daal_data_source.getNumericTable());
 }
 
+/// Reads the numeric CSV file in parallel directly into the resulting table
+template <typename Float>
+static table read_parallel(const data_source& ds) {
+    const file_view file(ds.get_file_name());
+    const char delimiter = ds.get_delimiter();
+
+    const char* data_begin = file.begin();
+    const char* const data_end = file.end();
+    if (ds.get_parse_header()) {
+        data_begin = align_to_line(find_line_end(data_begin, data_end), data_begin, data_end);
+    }
+
+    const char* first_row_begin = nullptr;
+    const char* first_row_end = nullptr;
+    if (!find_first_line(data_begin, data_end, first_row_begin, first_row_end)) {
+        return read_with_daal(ds);
+    }
+
+    const int64_t column_count = count_tokens(first_row_begin, first_row_end, delimiter);
+    std::vector<Float> first_row(column_count);
+    if (!parse_row(first_row_begin, first_row_end, delimiter, column_count, first_row.data())) {
+        return read_with_daal(ds);
+    }
+
+    return parse_table<Float>(data_begin, data_end, delimiter, column_count);
+}
+
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const data_source& ds,
+                                         const read_args<table>& args) const {
+    return read_parallel<DAAL_DATA_TYPE>(ds);
+}
+
 } // namespace oneapi::dal::csv::backend
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+class temp_csv_file {
+public:
+    temp_csv_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_csv_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+TEST(csv_read_test, can_read_numeric_data) {
+    const temp_csv_file file("csv_read_test_numeric.csv",
+                             "1,2.5,-3\n"
+                             "4e1, 5 ,6.25E-2\n"
+                             "-0.5,+7,8\n");
+
+    const auto t = read<table>(csv::data_source{ file.get_name() });
+    ASSERT_EQ(t.get_row_count(), 3);
+    ASSERT_EQ(t.get_column_count(), 3);
+
+    const float expected[] = { 1.f, 2.5f, -3.f, 40.f, 5.f, 0.0625f, -0.5f, 7.f, 8.f };
+    const auto values = row_accessor<const float>(t).pull();
+    for (std::int64_t i = 0; i < values.get_count(); i++) {
+        ASSERT_FLOAT_EQ(values[i], expected[i]);
+    }
+}
+
+TEST(csv_read_test, skips_header_and_empty_lines) {
+    const temp_csv_file file("csv_read_test_header.csv",
+                             "x;y\r\n"
+                             "1;2\r\n"
+                             "\r\n"
+                             "3;4\r\n"
+                             "5\n"
+                             "6;7;8");
+
+    const auto t = read<table>(
+        csv::data_source{ file.get_name() }.set_parse_header(true).set_delimiter(';'));
+    ASSERT_EQ(t.get_row_count(), 4);
+    ASSERT_EQ(t.get_column_count(), 2);
+
+    const float expected[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 0.f, 6.f, 7.f };
+    const auto values = row_accessor<const float>(t).pull();
+    for (std::int64_t i = 0; i < values.get_count(); i++) {
+        ASSERT_FLOAT_EQ(values[i], expected[i]);
+    }
+}
+
+TEST(csv_read_test, can_read_file_of_several_chunks) {
+    constexpr std::int64_t row_count = 200000;
+    constexpr std::int64_t column_count = 4;
+
+    std::string content;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        content += std::to_string(i) + "," + std::to_string(i % 97) + ".5," +
+                   std::to_string(-i % 13) + "e-1,0.125\n";
+    }
+    const temp_csv_file file("csv_read_test_chunks.csv", content);
+
+    const auto t = read<table>(csv::data_source{ file.get_name() });
+    ASSERT_EQ(t.get_row_count(), row_count);
+    ASSERT_EQ(t.get_column_count(), column_count);
+
+    const auto values = row_accessor<const float>(t).pull();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        ASSERT_FLOAT_EQ(values[i * column_count + 0], float(i));
+        ASSERT_FLOAT_EQ(values[i * column_count + 1], float(i % 97) + 0.5f);
+        ASSERT_FLOAT_EQ(values[i * column_count + 2], float(-i % 13) * 0.1f);
+        ASSERT_FLOAT_EQ(values[i * column_count + 3], 0.125f);
+    }
+}
+
+TEST(csv_read_test, throws_on_non_numeric_values_after_the_first_row) {
+    const temp_csv_file file("csv_read_test_non_numeric.csv",
+                             "1,2,3\n"
+                             "4,5,6\n"
+                             "7,abc,9\n");
+
+    ASSERT_THROW(read<table>(csv::data_source{ file.get_name() }), invalid_argument);
+}
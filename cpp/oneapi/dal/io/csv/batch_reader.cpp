@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <exception>
+#include <fstream>
+#include <future>
+#include <vector>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/parser.hpp"
+#include "oneapi/dal/io/csv/batch_reader.hpp"
+
+namespace oneapi::dal::csv {
+
+/// Size of the blocks the file is read by
+constexpr std::int64_t read_block_size = 1 << 24;
+
+class detail::batch_reader_impl : public base {
+public:
+    batch_reader_impl(const data_source& ds, std::int64_t batch_row_count, data_type dtype)
+            : file(ds.get_file_name(), std::ios::binary),
+              delimiter(ds.get_delimiter()),
+              batch_row_count(batch_row_count),
+              dtype(dtype) {
+        if (batch_row_count <= 0) {
+            throw domain_error("Batch row count should be > 0");
+        }
+        if (dtype != data_type::float32 && dtype != data_type::float64) {
+            throw invalid_argument("CSV batch reader supports only float32 and float64 data types");
+        }
+        if (!file.is_open()) {
+            throw invalid_argument("File not found");
+        }
+        if (ds.get_parse_header()) {
+            skip_header();
+        }
+        init_column_count();
+        schedule();
+    }
+
+    bool has_next() {
+        if (!is_peeked) {
+            // The future is invalid after get(), so the error of a failed batch
+            // is kept to be thrown again instead of calling get() twice
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            try {
+                next_batch = pending_batch.get();
+            }
+            catch (...) {
+                error = std::current_exception();
+                throw;
+            }
+            is_peeked = true;
+        }
+        return next_batch.get_row_count() > 0;
+    }
+
+    table next() {
+        if (!has_next()) {
+            throw out_of_range("No more batches in the file");
+        }
+        table batch = next_batch;
+        next_batch = table{};
+        is_peeked = false;
+        schedule();
+        return batch;
+    }
+
+    std::ifstream file;
+    char delimiter;
+    std::int64_t batch_row_count;
+    data_type dtype;
+    std::int64_t column_count = 0;
+
+private:
+    /// Appends the next block of the file to the buffer, returns false at the end of the file
+    bool read_block() {
+        if (is_eof) {
+            return false;
+        }
+        const std::size_t size = buffer.size();
+        buffer.resize(size + read_block_size);
+        file.read(buffer.data() + size, read_block_size);
+        const std::int64_t read_count = file.gcount();
+        buffer.resize(size + read_count);
+        is_eof = (read_count < read_block_size);
+        return read_count > 0;
+    }
+
+    void skip_header() {
+        std::size_t pos = 0;
+        for (;;) {
+            const char* begin = buffer.data();
+            const char* end = begin + buffer.size();
+            const char* line_end = backend::find_line_end(begin + pos, end);
+            if (line_end < end) {
+                buffer.erase(buffer.begin(), buffer.begin() + (line_end - begin) + 1);
+                return;
+            }
+            pos = buffer.size();
+            if (!read_block()) {
+                buffer.clear();
+                return;
+            }
+        }
+    }
+
+    /// Defines the number of columns by the first complete non-empty line
+    void init_column_count() {
+        for (;;) {
+            const char* begin = buffer.data();
+            const char* end = begin + buffer.size();
+            const char* line_begin = nullptr;
+            const char* line_end = nullptr;
+            const bool has_line = backend::find_first_line(begin, end, line_begin, line_end);
+            if (has_line && (is_eof || backend::find_line_end(line_begin, end) < end)) {
+                column_count = backend::count_tokens(line_begin, line_end, delimiter);
+                std::vector<double> row(column_count);
+                const bool is_numeric =
+                    backend::parse_row(line_begin, line_end, delimiter, column_count, row.data());
+                if (!is_numeric) {
+                    throw invalid_argument("CSV batch reader supports only numeric data");
+                }
+                return;
+            }
+            if (!read_block() && !has_line) {
+                return;
+            }
+        }
+    }
+
+    /// Takes the first batch_row_count non-empty lines of the file from the buffer,
+    /// reading more blocks of the file when needed, and parses them into a table
+    table read_batch() {
+        if (column_count == 0) {
+            return table{};
+        }
+
+        std::size_t pos = 0;
+        std::int64_t row_count = 0;
+        for (;;) {
+            const char* begin = buffer.data();
+            const char* end = begin + buffer.size();
+            const char* p = begin + pos;
+            while (row_count < batch_row_count) {
+                const char* line_end = backend::find_line_end(p, end);
+                if (line_end == end) {
+                    break;
+                }
+                const char* last = line_end;
+                while (last > p && last[-1] == '\r') {
+                    --last;
+                }
+                row_count += (last > p);
+                p = line_end + 1;
+            }
+            pos = p - begin;
+            if (row_count == batch_row_count) {
+                break;
+            }
+            if (!read_block()) {
+                // The last line of the file has no line terminator
+                pos = buffer.size();
+                break;
+            }
+        }
+
+        const char* begin = buffer.data();
+        table batch =
+            (dtype == data_type::float64)
+                ? backend::parse_table<double>(begin, begin + pos, delimiter, column_count)
+                : backend::parse_table<float>(begin, begin + pos, delimiter, column_count);
+        buffer.erase(buffer.begin(), buffer.begin() + pos);
+        return batch;
+    }
+
+    void schedule() {
+        pending_batch = std::async(std::launch::async, [this]() {
+            return read_batch();
+        });
+    }
+
+    std::vector<char> buffer;
+    bool is_eof = false;
+    bool is_peeked = false;
+    table next_batch;
+    std::exception_ptr error;
+
+    /// Declared last to be destroyed first: the destructor of the future waits
+    /// for the background parsing that uses the members above
+    std::future<table> pending_batch;
+};
+
+using detail::batch_reader_impl;
+
+batch_reader::batch_reader(const data_source& ds, std::int64_t batch_row_count, data_type dtype)
+        : impl_(new batch_reader_impl{ ds, batch_row_count, dtype }) {}
+
+std::int64_t batch_reader::get_column_count() const {
+    return impl_->column_count;
+}
+
+data_type batch_reader::get_data_type() const {
+    return impl_->dtype;
+}
+
+std::int64_t batch_reader::get_batch_row_count() const {
+    return impl_->batch_row_count;
+}
+
+bool batch_reader::has_next() {
+    return impl_->has_next();
+}
+
+table batch_reader::next() {
+    return impl_->next();
+}
+
+} // namespace oneapi::dal::csv
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/csv/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::csv {
+
+namespace detail {
+class batch_reader_impl;
+} // namespace detail
+
+/// Reads a numeric CSV file by batches of rows. The next batch is parsed in the
+/// background while the caller processes the current one, so that only two
+/// batches of the file are held in memory at a time
+class ONEAPI_DAL_EXPORT batch_reader : public base {
+public:
+    /// Creates the reader of the batches with the values of the given type,
+    /// data_type::float32 or data_type::float64
+    batch_reader(const data_source& ds,
+                 std::int64_t batch_row_count,
+                 data_type dtype = data_type::float32);
+
+    /// Number of columns of the batches, defined by the first data row of the file
+    std::int64_t get_column_count() const;
+
+    /// Type of the values of the batches
+    data_type get_data_type() const;
+
+    /// Maximal number of rows in a batch, the last batch of the file may be smaller
+    std::int64_t get_batch_row_count() const;
+
+    /// Returns true if the file has rows that were not returned by next() yet,
+    /// waits for the parsing of the next batch to finish. If the parsing fails,
+    /// this and all the following calls throw the exception of the parsing
+    bool has_next();
+
+    /// Returns the next batch of rows and starts the parsing of the following one
+    table next();
+
+private:
+    dal::detail::pimpl<detail::batch_reader_impl> impl_;
+};
+
+} // namespace oneapi::dal::csv
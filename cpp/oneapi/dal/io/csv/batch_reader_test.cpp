@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(csv_batch_reader_test, can_read_file_by_batches) {
+    constexpr std::int64_t row_count = 1000;
+    constexpr std::int64_t column_count = 3;
+    constexpr std::int64_t batch_row_count = 128;
+    const std::string file_name = "csv_batch_reader_test.csv";
+    {
+        std::ofstream file(file_name, std::ios::binary);
+        file << "a,b,c\n";
+        for (std::int64_t i = 0; i < row_count; i++) {
+            file << i << "," << -i << "," << i * 0.5 << ((i % 10 == 0) ? "\r\n\n" : "\n");
+        }
+    }
+
+    csv::batch_reader reader(csv::data_source{ file_name }.set_parse_header(true),
+                             batch_row_count);
+    ASSERT_EQ(reader.get_column_count(), column_count);
+
+    std::int64_t first_row = 0;
+    while (reader.has_next()) {
+        const auto batch = reader.next();
+        const std::int64_t expected_row_count = std::min(batch_row_count, row_count - first_row);
+        ASSERT_EQ(batch.get_row_count(), expected_row_count);
+        ASSERT_EQ(batch.get_column_count(), column_count);
+
+        const auto values = row_accessor<const float>(batch).pull();
+        for (std::int64_t i = 0; i < batch.get_row_count(); i++) {
+            const float row = float(first_row + i);
+            ASSERT_FLOAT_EQ(values[i * column_count + 0], row);
+            ASSERT_FLOAT_EQ(values[i * column_count + 1], -row);
+            ASSERT_FLOAT_EQ(values[i * column_count + 2], row * 0.5f);
+        }
+        first_row += batch.get_row_count();
+    }
+    ASSERT_EQ(first_row, row_count);
+    ASSERT_THROW(reader.next(), out_of_range);
+
+    std::remove(file_name.c_str());
+}
+
+TEST(csv_batch_reader_test, throws_if_batch_row_count_is_not_positive) {
+    const std::string file_name = "csv_batch_reader_test_empty.csv";
+    { std::ofstream file(file_name); }
+
+    ASSERT_THROW(csv::batch_reader(csv::data_source{ file_name }, 0), domain_error);
+
+    csv::batch_reader reader(csv::data_source{ file_name }, 10);
+    ASSERT_FALSE(reader.has_next());
+
+    std::remove(file_name.c_str());
+}
+
+TEST(csv_batch_reader_test, can_read_batches_of_double_values) {
+    constexpr std::int64_t row_count = 300;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t batch_row_count = 64;
+    const std::string file_name = "csv_batch_reader_test_double.csv";
+    {
+        std::ofstream file(file_name, std::ios::binary);
+        file.precision(17);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            file << 1.0 + i * 1e-12 << "," << i / 3.0 << "\n";
+        }
+    }
+
+    csv::batch_reader reader(csv::data_source{ file_name }, batch_row_count, data_type::float64);
+    ASSERT_EQ(reader.get_data_type(), data_type::float64);
+
+    std::int64_t first_row = 0;
+    while (reader.has_next()) {
+        const auto batch = reader.next();
+        ASSERT_EQ(batch.get_column_count(), column_count);
+
+        // The values differ in the digits float cannot represent
+        const auto values = row_accessor<const double>(batch).pull();
+        for (std::int64_t i = 0; i < batch.get_row_count(); i++) {
+            const std::int64_t row = first_row + i;
+            ASSERT_DOUBLE_EQ(values[i * column_count + 0], 1.0 + row * 1e-12);
+            ASSERT_DOUBLE_EQ(values[i * column_count + 1], row / 3.0);
+        }
+        first_row += batch.get_row_count();
+    }
+    ASSERT_EQ(first_row, row_count);
+
+    std::remove(file_name.c_str());
+}
+
+TEST(csv_batch_reader_test, throws_if_data_type_is_not_floating_point) {
+    const std::string file_name = "csv_batch_reader_test_int.csv";
+    {
+        std::ofstream file(file_name);
+        file << "1,2\n";
+    }
+
+    ASSERT_THROW(csv::batch_reader(csv::data_source{ file_name }, 10, data_type::int32),
+                 invalid_argument);
+
+    std::remove(file_name.c_str());
+}
+
+TEST(csv_batch_reader_test, keeps_throwing_after_failed_batch) {
+    constexpr std::int64_t batch_row_count = 4;
+    const std::string file_name = "csv_batch_reader_test_bad.csv";
+    {
+        std::ofstream file(file_name);
+        for (std::int64_t i = 0; i < batch_row_count; i++) {
+            file << i << "," << i << "\n";
+        }
+        file << "1,x\n";
+    }
+
+    csv::batch_reader reader(csv::data_source{ file_name }, batch_row_count);
+    ASSERT_TRUE(reader.has_next());
+    ASSERT_EQ(reader.next().get_row_count(), batch_row_count);
+
+    // The second batch fails, the following calls report the same error
+    // instead of waiting for the finished background parsing again
+    ASSERT_THROW(reader.has_next(), invalid_argument);
+    ASSERT_THROW(reader.has_next(), invalid_argument);
+    ASSERT_THROW(reader.next(), invalid_argument);
+
+    std::remove(file_name.c_str());
+}
@@ -51,6 +51,12 @@ edge_list<std::int32_t> load_edge_list(const std::string &name) {
     return elist;
 }
 
+/// Grain sizes for the per-vertex and per-edge loops: the bodies with a couple of
+/// memory accesses are processed in large static chunks, the sorting of
+/// neighbor lists has uneven cost and is left to the adaptive partitioner
+constexpr std::size_t trivial_loop_grain_size = 4096;
+constexpr std::size_t sort_loop_grain_size = 64;
+
 template <typename Graph>
 void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
     auto layout = oneapi::dal::preview::detail::get_impl(g);
@@ -89,14 +95,24 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
         throw bad_alloc();
     }
 
-    threader_for(_unf_vertex_count, _unf_vertex_count, [&](vertex_t u) {
-        degrees_cv[u].set(0);
-    });
-
-    threader_for(edges.size(), edges.size(), [&](vertex_t u) {
-        degrees_cv[edges[u].first].inc();
-        degrees_cv[edges[u].second].inc();
-    });
+    threader_for_blocked_grained(_unf_vertex_count,
+                                 trivial_loop_grain_size,
+                                 partitioner_kind::static_partitioner,
+                                 [&](vertex_t begin, vertex_t end) {
+                                     for (vertex_t u = begin; u < end; ++u) {
+                                         degrees_cv[u].set(0);
+                                     }
+                                 });
+
+    threader_for_blocked_grained(edges.size(),
+                                 trivial_loop_grain_size,
+                                 partitioner_kind::static_partitioner,
+                                 [&](vertex_t begin, vertex_t end) {
+                                     for (vertex_t u = begin; u < end; ++u) {
+                                         degrees_cv[edges[u].first].inc();
+                                         degrees_cv[edges[u].second].inc();
+                                     }
+                                 });
 
     auto *rows_vec = new (std::nothrow)
         oneapi::dal::preview::detail::graph_container<atomic_t, allocator_atomic_t>(
@@ -123,14 +139,25 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
     auto _unf_edge_offset_arr = _unf_edge_offset_vec.data();
     auto _unf_vert_neighs_arr = _unf_vert_neighs_vec.data();
 
-    threader_for(_unf_vertex_count + 1, _unf_vertex_count + 1, [&](vertex_t n) {
-        _unf_edge_offset_arr[n] = rows_cv[n].get();
-    });
-
-    threader_for(edges.size(), edges.size(), [&](vertex_t u) {
-        _unf_vert_neighs_arr[rows_cv[edges[u].first].inc() - 1] = edges[u].second;
-        _unf_vert_neighs_arr[rows_cv[edges[u].second].inc() - 1] = edges[u].first;
-    });
+    threader_for_blocked_grained(_unf_vertex_count + 1,
+                                 trivial_loop_grain_size,
+                                 partitioner_kind::static_partitioner,
+                                 [&](vertex_t begin, vertex_t end) {
+                                     for (vertex_t n = begin; n < end; ++n) {
+                                         _unf_edge_offset_arr[n] = rows_cv[n].get();
+                                     }
+                                 });
+
+    threader_for_blocked_grained(
+        edges.size(),
+        trivial_loop_grain_size,
+        partitioner_kind::static_partitioner,
+        [&](vertex_t begin, vertex_t end) {
+            for (vertex_t u = begin; u < end; ++u) {
+                _unf_vert_neighs_arr[rows_cv[edges[u].first].inc() - 1] = edges[u].second;
+                _unf_vert_neighs_arr[rows_cv[edges[u].second].inc() - 1] = edges[u].first;
+            }
+        });
     delete rows_vec;
 
     //removing self-loops,  multiple edges from graph, and make neighbors in CSR sorted
@@ -139,14 +166,20 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
 
     layout->_degrees = std::move(vector_vertex_t(layout->_vertex_count));
 
-    threader_for(_unf_vertex_count, _unf_vertex_count, [&](vertex_t u) {
-        auto start_p = _unf_vert_neighs_vec.begin() + _unf_edge_offset_vec[u];
-        auto end_p = _unf_vert_neighs_vec.begin() + _unf_edge_offset_vec[u + 1];
-        std::sort(start_p, end_p);
-        auto neighs_u_new_end = std::unique(start_p, end_p);
-        neighs_u_new_end = std::remove(start_p, neighs_u_new_end, u);
-        layout->_degrees[u] = (vertex_t)std::distance(start_p, neighs_u_new_end);
-    });
+    threader_for_blocked_grained(
+        _unf_vertex_count,
+        sort_loop_grain_size,
+        partitioner_kind::auto_partitioner,
+        [&](vertex_t begin, vertex_t end) {
+            for (vertex_t u = begin; u < end; ++u) {
+                auto start_p = _unf_vert_neighs_vec.begin() + _unf_edge_offset_vec[u];
+                auto end_p = _unf_vert_neighs_vec.begin() + _unf_edge_offset_vec[u + 1];
+                std::sort(start_p, end_p);
+                auto neighs_u_new_end = std::unique(start_p, end_p);
+                neighs_u_new_end = std::remove(start_p, neighs_u_new_end, u);
+                layout->_degrees[u] = (vertex_t)std::distance(start_p, neighs_u_new_end);
+            }
+        });
 
     layout->_edge_offsets.clear();
     layout->_edge_offsets.reserve(layout->_vertex_count + 1);
@@ -165,13 +198,19 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
 
     auto vert_neighs = layout->_vertex_neighbors.data();
     auto edge_offs = layout->_edge_offsets.data();
-    threader_for(layout->_vertex_count, layout->_vertex_count, [&](vertex_t u) {
-        auto u_neighs = vert_neighs + edge_offs[u];
-        auto _u_neighs_unf = _unf_vert_neighs_arr + _unf_edge_offset_arr[u];
-        for (vertex_t i = 0; i < layout->_degrees[u]; i++) {
-            u_neighs[i] = _u_neighs_unf[i];
-        }
-    });
+    threader_for_blocked_grained(layout->_vertex_count,
+                                 sort_loop_grain_size,
+                                 partitioner_kind::auto_partitioner,
+                                 [&](vertex_t begin, vertex_t end) {
+                                     for (vertex_t u = begin; u < end; ++u) {
+                                         auto u_neighs = vert_neighs + edge_offs[u];
+                                         auto _u_neighs_unf =
+                                             _unf_vert_neighs_arr + _unf_edge_offset_arr[u];
+                                         for (vertex_t i = 0; i < layout->_degrees[u]; i++) {
+                                             u_neighs[i] = _u_neighs_unf[i];
+                                         }
+                                     }
+                                 });
 
     return;
 } // namespace oneapi::dal::preview::load_graph::detail
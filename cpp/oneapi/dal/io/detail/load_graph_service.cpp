@@ -33,3 +33,16 @@ ONEAPI_DAL_EXPORT void _daal_threader_for_oneapi(int n,
                                                  oneapi::dal::preview::functype func) {
     _daal_threader_for(n, threads_request, a, static_cast<daal::functype>(func));
 }
+
+ONEAPI_DAL_EXPORT void _daal_threader_for_blocked_grained_oneapi(
+    int n,
+    int grain_size,
+    int partitioner,
+    const void* a,
+    oneapi::dal::preview::functype_blocked func) {
+    _daal_threader_for_blocked_grained(n,
+                                       grain_size,
+                                       partitioner,
+                                       a,
+                                       static_cast<daal::functype2>(func));
+}
@@ -23,13 +23,25 @@
 
 namespace oneapi::dal::preview {
 typedef void (*functype)(int i, const void *a);
-}
+typedef void (*functype_blocked)(int i, int n, const void *a);
+
+/// Partitioning strategies of threader_for_blocked_grained,
+/// the values match daal::ThreaderPartitioner
+enum class partitioner_kind : int { auto_partitioner = 0, static_partitioner = 1 };
+} // namespace oneapi::dal::preview
 
 extern "C" {
 ONEAPI_DAL_EXPORT void _daal_threader_for_oneapi(int n,
                                                  int threads_request,
                                                  const void *a,
                                                  oneapi::dal::preview::functype func);
+
+ONEAPI_DAL_EXPORT void _daal_threader_for_blocked_grained_oneapi(
+    int n,
+    int grain_size,
+    int partitioner,
+    const void *a,
+    oneapi::dal::preview::functype_blocked func);
 }
 
 namespace oneapi::dal::preview::load_graph::detail {
@@ -47,5 +59,28 @@ inline ONEAPI_DAL_EXPORT void threader_for(size_t n, size_t threads_request, con
     _daal_threader_for_oneapi((int)n, (int)threads_request, a, threader_func<F>);
 }
 
+template <typename F>
+inline void threader_func_blocked(int i, int n, const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i, i + n);
+}
+
+/// Calls lambda(begin, end) for the subranges of [0, n). A subrange is split only
+/// while it is larger than grain_size, so tiny per-element bodies run in chunks
+/// instead of paying per-element task overhead
+template <typename F>
+inline void threader_for_blocked_grained(size_t n,
+                                         size_t grain_size,
+                                         partitioner_kind partitioner,
+                                         const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_grained_oneapi((int)n,
+                                              (int)grain_size,
+                                              static_cast<int>(partitioner),
+                                              a,
+                                              threader_func_blocked<F>);
+}
+
 ONEAPI_DAL_EXPORT int daal_string_to_int(const char *nptr, char **endptr);
 } // namespace oneapi::dal::preview::load_graph::detail
@@ -33,7 +33,7 @@ def daal_module(name, features=[], lib_tag="daal",
                 opencl=False, **kwargs):
     if auto:
         auto_hdrs = native.glob(["**/*.h", "**/*.i"])
-        auto_srcs = native.glob(["**/*.cpp"])
+        auto_srcs = native.glob(["**/*.cpp"], exclude=["**/*_test.cpp"])
         if opencl:
             auto_hdrs += native.glob(["**/*.cl"])
     else:
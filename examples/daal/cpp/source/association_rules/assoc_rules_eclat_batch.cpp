@@ -0,0 +1,120 @@
+/* file: assoc_rules_eclat_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of association rules mining with the Eclat method.
+!    The large item sets and the association rules are compared with the ones
+!    found by the Apriori method on the same data set
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ECLAT_BATCH"></a>
+ * \example assoc_rules_eclat_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/apriori.csv";
+
+/* Association rules parameters */
+const double minSupport    = 0.001; /* Minimum support */
+const double minConfidence = 0.7;   /* Minimum confidence */
+
+template <association_rules::Method method>
+association_rules::ResultPtr mineRules(const NumericTablePtr & data)
+{
+    association_rules::Batch<double, method> algorithm;
+    algorithm.input.set(association_rules::data, data);
+    algorithm.parameter.minSupport    = minSupport;
+    algorithm.parameter.minConfidence = minConfidence;
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+void compareTables(const NumericTablePtr & eclatTable, const NumericTablePtr & aprioriTable, const char * name);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    NumericTablePtr data = dataSource.getNumericTable();
+
+    /* Find large item sets and construct association rules with both methods */
+    association_rules::ResultPtr eclatResult   = mineRules<association_rules::eclat>(data);
+    association_rules::ResultPtr aprioriResult = mineRules<association_rules::apriori>(data);
+
+    /* Print the large item sets and the association rules found by the Eclat method */
+    printAprioriItemsets(eclatResult->get(association_rules::largeItemsets), eclatResult->get(association_rules::largeItemsetsSupport));
+    printAprioriRules(eclatResult->get(association_rules::antecedentItemsets), eclatResult->get(association_rules::consequentItemsets),
+                      eclatResult->get(association_rules::confidence));
+
+    /* The Eclat method finds the same item sets and rules in the same order as the Apriori method */
+    compareTables(eclatResult->get(association_rules::largeItemsets), aprioriResult->get(association_rules::largeItemsets), "Large item sets");
+    compareTables(eclatResult->get(association_rules::largeItemsetsSupport), aprioriResult->get(association_rules::largeItemsetsSupport),
+                  "Supports of large item sets");
+    compareTables(eclatResult->get(association_rules::antecedentItemsets), aprioriResult->get(association_rules::antecedentItemsets),
+                  "Antecedent item sets");
+    compareTables(eclatResult->get(association_rules::consequentItemsets), aprioriResult->get(association_rules::consequentItemsets),
+                  "Consequent item sets");
+    compareTables(eclatResult->get(association_rules::confidence), aprioriResult->get(association_rules::confidence), "Confidences of rules");
+
+    std::cout << "Eclat and Apriori methods found the same large item sets and association rules" << std::endl;
+
+    return 0;
+}
+
+void compareTables(const NumericTablePtr & eclatTable, const NumericTablePtr & aprioriTable, const char * name)
+{
+    const size_t nRows    = eclatTable->getNumberOfRows();
+    const size_t nColumns = eclatTable->getNumberOfColumns();
+    if (nRows != aprioriTable->getNumberOfRows() || nColumns != aprioriTable->getNumberOfColumns())
+    {
+        std::cout << name << ": sizes of the results of the Eclat and Apriori methods differ" << std::endl;
+        exit(-1);
+    }
+
+    BlockDescriptor<double> eclatBlock, aprioriBlock;
+    eclatTable->getBlockOfRows(0, nRows, readOnly, eclatBlock);
+    aprioriTable->getBlockOfRows(0, nRows, readOnly, aprioriBlock);
+    const double * eclatValues   = eclatBlock.getBlockPtr();
+    const double * aprioriValues = aprioriBlock.getBlockPtr();
+
+    for (size_t i = 0; i < nRows * nColumns; i++)
+    {
+        const double diff = eclatValues[i] - aprioriValues[i];
+        if (diff > 1e-12 || diff < -1e-12)
+        {
+            std::cout << name << ": results of the Eclat and Apriori methods differ in row " << i / nColumns << std::endl;
+            exit(-1);
+        }
+    }
+
+    eclatTable->releaseBlockOfRows(eclatBlock);
+    aprioriTable->releaseBlockOfRows(aprioriBlock);
+}
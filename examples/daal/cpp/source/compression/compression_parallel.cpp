@@ -0,0 +1,243 @@
+/* file: compression_parallel.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the compression of a serialized model by independent frames
+!    compressed and decompressed in parallel. Reports the throughput of the model
+!    save and load with the parallel streams against the sequential streams and
+!    saves and restores the model through the parallel compressed data archives
+!    with every compression method
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COMPRESSION_PARALLEL"></a>
+ * \example compression_parallel.cpp
+ */
+
+#include <cstring>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const size_t nFeatures            = 13;
+
+/* Decision forest parameters */
+const size_t nTrees = 300;
+
+/* Size of the frames compressed independently */
+const size_t frameSize = 1024 * 256;
+
+training::ResultPtr trainModel();
+double saveSequential(DataBlock & model, DataBlock & compressed);
+double saveParallel(DataBlock & model, DataBlock & compressed);
+double loadSequential(DataBlock & compressed, DataBlock & restored);
+double loadParallel(DataBlock & compressed, DataBlock & restored);
+void checkRestored(const DataBlock & model, const DataBlock & restored);
+void checkArchive(CompressionMethod method, const char * methodName, const DataBlock & model, const training::ResultPtr & result);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Serialize the trained model */
+    training::ResultPtr trainingResult = trainModel();
+    InputDataArchive dataArch;
+    trainingResult->serialize(dataArch);
+
+    const size_t modelSize = dataArch.getSizeOfArchive();
+    DataBlock model(new daal::byte[modelSize], modelSize);
+    dataArch.copyArchiveToArray(model.getPtr(), modelSize);
+
+    DataBlock compressed, parallelCompressed;
+    const double saveSeconds         = saveSequential(model, compressed);
+    const double parallelSaveSeconds = saveParallel(model, parallelCompressed);
+
+    DataBlock restored(new daal::byte[modelSize], modelSize);
+    DataBlock parallelRestored(new daal::byte[modelSize], modelSize);
+    const double loadSeconds         = loadSequential(compressed, restored);
+    const double parallelLoadSeconds = loadParallel(parallelCompressed, parallelRestored);
+
+    checkRestored(model, restored);
+    checkRestored(model, parallelRestored);
+
+    /* Save and restore the model through the data archives compressed by frames */
+    checkArchive(zlib, "zlib", model, trainingResult);
+    checkArchive(lzo, "lzo", model, trainingResult);
+    checkArchive(rle, "rle", model, trainingResult);
+    checkArchive(bzip2, "bzip2", model, trainingResult);
+
+    const double modelMBytes = double(modelSize) / (1024 * 1024);
+    std::cout << "Serialized model size, MB:            " << modelMBytes << std::endl;
+    std::cout << "Compressed size, MB:                  " << double(compressed.getSize()) / (1024 * 1024) << std::endl;
+    std::cout << "Compressed size in frames, MB:        " << double(parallelCompressed.getSize()) / (1024 * 1024) << std::endl;
+    std::cout << "Save throughput, sequential, MB/s:    " << modelMBytes / saveSeconds << std::endl;
+    std::cout << "Save throughput, parallel, MB/s:      " << modelMBytes / parallelSaveSeconds << std::endl;
+    std::cout << "Load throughput, sequential, MB/s:    " << modelMBytes / loadSeconds << std::endl;
+    std::cout << "Load throughput, parallel, MB/s:      " << modelMBytes / parallelLoadSeconds << std::endl;
+
+    delete[] model.getPtr();
+    delete[] compressed.getPtr();
+    delete[] parallelCompressed.getPtr();
+    delete[] restored.getPtr();
+    delete[] parallelRestored.getPtr();
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    NumericTablePtr trainDependentVariable(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainDependentVariable));
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    training::Batch<> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+    algorithm.parameter().nTrees = nTrees;
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+double saveSequential(DataBlock & model, DataBlock & compressed)
+{
+    const double start = getWallClockSeconds();
+
+    Compressor<zlib> compressor;
+    CompressionStream compressionStream(&compressor);
+    compressionStream.push_back(&model);
+
+    const size_t compressedSize = compressionStream.getCompressedDataSize();
+    compressed.setPtr(new daal::byte[compressedSize]);
+    compressed.setSize(compressedSize);
+    compressionStream.copyCompressedArray(compressed);
+
+    return getWallClockSeconds() - start;
+}
+
+double saveParallel(DataBlock & model, DataBlock & compressed)
+{
+    const double start = getWallClockSeconds();
+
+    /* Each frame is compressed by its own zlib compressor */
+    ParallelCompressionStream compressionStream(zlib, defaultLevel, frameSize);
+    compressionStream.push_back(&model);
+
+    const size_t compressedSize = compressionStream.getCompressedDataSize();
+    compressed.setPtr(new daal::byte[compressedSize]);
+    compressed.setSize(compressedSize);
+    compressionStream.copyCompressedArray(compressed);
+
+    return getWallClockSeconds() - start;
+}
+
+double loadSequential(DataBlock & compressed, DataBlock & restored)
+{
+    const double start = getWallClockSeconds();
+
+    Decompressor<zlib> decompressor;
+    DecompressionStream decompressionStream(&decompressor);
+    decompressionStream.push_back(&compressed);
+    decompressionStream.copyDecompressedArray(restored);
+
+    return getWallClockSeconds() - start;
+}
+
+double loadParallel(DataBlock & compressed, DataBlock & restored)
+{
+    const double start = getWallClockSeconds();
+
+    /* The frames are decompressed in parallel directly to the output array */
+    ParallelDecompressionStream decompressionStream(zlib);
+    decompressionStream.push_back(&compressed);
+    decompressionStream.copyDecompressedArray(restored);
+
+    return getWallClockSeconds() - start;
+}
+
+void checkRestored(const DataBlock & model, const DataBlock & restored)
+{
+    if (memcmp(model.getPtr(), restored.getPtr(), model.getSize()) != 0)
+    {
+        std::cout << "Restored model differs from the original one" << std::endl;
+        exit(-1);
+    }
+}
+
+void checkArchive(CompressionMethod method, const char * methodName, const DataBlock & model, const training::ResultPtr & result)
+{
+    /* Serialize the model to the archive compressed by frames */
+    ParallelCompressedDataArchive * compressedArch = new ParallelCompressedDataArchive(method, defaultLevel, frameSize);
+    InputDataArchive inDataArch(compressedArch);
+    result->serialize(inDataArch);
+
+    const size_t compressedSize = inDataArch.getSizeOfArchive();
+    DataBlock compressed(new daal::byte[compressedSize], compressedSize);
+    inDataArch.copyArchiveToArray(compressed.getPtr(), compressedSize);
+    if (compressedArch->getErrors()->size() != 0)
+    {
+        std::cout << "Compression by frames with " << methodName << " failed" << std::endl;
+        exit(-1);
+    }
+
+    /* Any part of the compressed model can be read without decompressing the preceding frames */
+    ParallelDecompressionStream decompressionStream(method);
+    decompressionStream.push_back(&compressed);
+    const size_t offset = model.getSize() / 3;
+    const size_t size   = model.getSize() - offset;
+    DataBlock range(new daal::byte[size], size);
+    if (decompressionStream.copyDecompressedRange(offset, range.getPtr(), size) != size
+        || memcmp(model.getPtr() + offset, range.getPtr(), size) != 0)
+    {
+        std::cout << "Range decompressed by frames with " << methodName << " differs from the original one" << std::endl;
+        exit(-1);
+    }
+
+    /* Restore the model from the archive and serialize it again to compare with the original one */
+    OutputDataArchive outDataArch(new ParallelDecompressedDataArchive(method, compressed.getPtr(), compressed.getSize()));
+    training::ResultPtr restoredResult(new training::Result());
+    restoredResult->deserialize(outDataArch);
+
+    InputDataArchive restoredDataArch;
+    restoredResult->serialize(restoredDataArch);
+    DataBlock restored(new daal::byte[model.getSize()], model.getSize());
+    if (restoredDataArch.getSizeOfArchive() != model.getSize())
+    {
+        std::cout << "Model restored from the archive compressed with " << methodName << " differs from the original one" << std::endl;
+        exit(-1);
+    }
+    restoredDataArch.copyArchiveToArray(restored.getPtr(), restored.getSize());
+    checkRestored(model, restored);
+
+    std::cout << "Compressed size in frames with " << methodName << ", MB: " << double(compressedSize) / (1024 * 1024) << std::endl;
+
+    delete[] compressed.getPtr();
+    delete[] range.getPtr();
+    delete[] restored.getPtr();
+}
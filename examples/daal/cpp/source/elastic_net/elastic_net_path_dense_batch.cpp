@@ -0,0 +1,157 @@
+/* file: elastic_net_path_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of elastic net in the batch processing mode.
+!
+!    The program trains the elastic net models for the decreasing sequence
+!    of L1 parameters in one call and prints the coefficients of all models.
+!    The models at several points of the path are compared with the models
+!    trained for the single L1 parameter.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ELASTIC_NET_PATH_BATCH"></a>
+ * \example elastic_net_path_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::elastic_net;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training data set */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+/* Regularization path parameters */
+const size_t nPenalties   = 20;    /* Number of L1 parameters on the path */
+const float maxPenaltyL1  = 10.0f; /* The largest L1 parameter */
+const float penaltyFactor = 0.7f;  /* Ratio of the consecutive L1 parameters */
+const float penaltyL2     = 0.1f;  /* L2 parameter of all the models */
+
+/* Points of the path checked against the training for the single L1 parameter */
+const size_t nCheckedPenalties                   = 2;
+const size_t checkedPenalties[nCheckedPenalties] = { nPenalties / 2, nPenalties - 1 };
+const float tolerance                            = 5e-3f; /* Relative tolerance of the coefficients comparison */
+
+/* Trains the elastic net model for the single L1 parameter */
+NumericTablePtr trainSinglePenalty(const NumericTablePtr & trainData, const NumericTablePtr & trainDependentVariables, float penaltyL1)
+{
+    training::Batch<> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    algorithm.parameter().penaltyL1 = NumericTablePtr(HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, penaltyL1));
+    algorithm.parameter().penaltyL2 = NumericTablePtr(HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, penaltyL2));
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(training::model)->getBeta();
+}
+
+/* Returns true if the coefficients in the row of the path are close to the ones of the model */
+bool isCloseToPath(const NumericTablePtr & betaPath, size_t row, const NumericTablePtr & beta)
+{
+    const size_t nBetas = beta->getNumberOfRows() * beta->getNumberOfColumns();
+    BlockDescriptor<> pathBlock, betaBlock;
+    betaPath->getBlockOfRows(row, 1, readOnly, pathBlock);
+    beta->getBlockOfRows(0, beta->getNumberOfRows(), readOnly, betaBlock);
+    const float * a = pathBlock.getBlockPtr();
+    const float * b = betaBlock.getBlockPtr();
+
+    bool isClose = true;
+    for (size_t i = 0; i < nBetas; ++i)
+    {
+        const float diff  = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        const float scale = b[i] > 1.0f ? b[i] : (b[i] < -1.0f ? -b[i] : 1.0f);
+        if (diff > tolerance * scale) isClose = false;
+    }
+
+    betaPath->releaseBlockOfRows(pathBlock);
+    beta->releaseBlockOfRows(betaBlock);
+    return isClose;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(HomogenNumericTable<>::create(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(MergedNumericTable::create(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create the decreasing sequence of L1 parameters, one parameter for all dependent variables */
+    NumericTablePtr penaltyL1Path(HomogenNumericTable<>::create(1, nPenalties, NumericTable::doAllocate));
+    BlockDescriptor<> block;
+    penaltyL1Path->getBlockOfRows(0, nPenalties, writeOnly, block);
+    float * penalties = block.getBlockPtr();
+    penalties[0]      = maxPenaltyL1;
+    for (size_t i = 1; i < nPenalties; ++i)
+    {
+        penalties[i] = penalties[i - 1] * penaltyFactor;
+    }
+    penaltyL1Path->releaseBlockOfRows(block);
+
+    /* Create an algorithm object to train the elastic net models along the regularization path */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    algorithm.parameter().penaltyL2     = NumericTablePtr(HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, penaltyL2));
+    algorithm.parameter().penaltyL1Path = penaltyL1Path;
+
+    /* Build the elastic net models */
+    checkStatus(algorithm.compute());
+
+    /* Retrieve the algorithm results. Each row of the path contains the coefficients of all dependent variables */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    printNumericTable(penaltyL1Path, "L1 parameters:");
+    printNumericTable(trainingResult->get(training::betaPathId), "Elastic Net coefficients along the path:");
+    printNumericTable(trainingResult->get(training::model)->getBeta(), "Elastic Net coefficients for the smallest L1 parameter:");
+
+    /* Each model on the path is the solution of the same problem as the one trained for its L1 parameter alone */
+    for (size_t i = 0; i < nCheckedPenalties; ++i)
+    {
+        const size_t row = checkedPenalties[i];
+        float penaltyL1  = maxPenaltyL1;
+        for (size_t j = 0; j < row; ++j)
+        {
+            penaltyL1 *= penaltyFactor;
+        }
+
+        NumericTablePtr beta = trainSinglePenalty(trainData, trainDependentVariables, penaltyL1);
+        if (!isCloseToPath(trainingResult->get(training::betaPathId), row, beta))
+        {
+            std::cout << "Coefficients on the path differ from the ones trained for the L1 parameter " << penaltyL1 << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/* file: em_gmm_dense_minibatch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) with the stochastic iterations and the
+!    initialization that abandons the unpromising starts.
+!    Reports the time and the logarithm of the likelihood function against
+!    the full iterations and the initialization that completes all the starts
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_DENSE_MINIBATCH"></a>
+ * \example em_gmm_dense_minibatch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float dataFPType; /* Data floating-point type */
+
+/* Input data set parameters */
+const size_t nComponents   = 4;
+const size_t nFeatures     = 8;
+const size_t nVectors      = 200000;
+const size_t nIterations   = 50;
+const size_t miniBatchSize = 8192;
+
+/* Fills the table with the observations of the well separated Gaussian clusters */
+NumericTablePtr createData()
+{
+    NumericTablePtr data = HomogenNumericTable<dataFPType>::create(nFeatures, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<dataFPType> block;
+    data->getBlockOfRows(0, nVectors, writeOnly, block);
+    dataFPType * rows = block.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        const size_t component = i % nComponents;
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            /* Sum of the uniform numbers is close to the normally distributed one */
+            dataFPType noise = 0;
+            for (size_t r = 0; r < 4; ++r)
+            {
+                state = state * 1103515245u + 12345u;
+                noise += dataFPType((state >> 8) & 0xFFFF) / dataFPType(0xFFFF) - 0.5f;
+            }
+            rows[i * nFeatures + j] = dataFPType(5 * component) * ((j + component) % 2 ? 1.0f : -1.0f) + noise;
+        }
+    }
+    data->releaseBlockOfRows(block);
+    return data;
+}
+
+em_gmm::init::ResultPtr initialize(NumericTablePtr data, size_t nWarmUpIterations, double & seconds)
+{
+    em_gmm::init::Batch<dataFPType> initAlgorithm(nComponents);
+    initAlgorithm.input.set(em_gmm::init::data, data);
+    initAlgorithm.parameter.nWarmUpIterations = nWarmUpIterations;
+
+    const double start = getWallClockSeconds();
+    initAlgorithm.compute();
+    seconds = getWallClockSeconds() - start;
+
+    return initAlgorithm.getResult();
+}
+
+em_gmm::ResultPtr train(NumericTablePtr data, em_gmm::init::ResultPtr initResult, size_t batchSize, double & seconds)
+{
+    em_gmm::Batch<dataFPType> algorithm(nComponents);
+    algorithm.input.set(em_gmm::data, data);
+    algorithm.input.set(em_gmm::inputValues, initResult);
+    algorithm.parameter.maxIterations     = nIterations;
+    algorithm.parameter.accuracyThreshold = 0.0;
+    algorithm.parameter.miniBatchSize     = batchSize;
+
+    const double start = getWallClockSeconds();
+    algorithm.compute();
+    seconds = getWallClockSeconds() - start;
+
+    return algorithm.getResult();
+}
+
+float goalFunction(em_gmm::ResultPtr result)
+{
+    BlockDescriptor<dataFPType> block;
+    NumericTablePtr table = result->get(em_gmm::goalFunction);
+    table->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    table->releaseBlockOfRows(block);
+    return value;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data = createData();
+
+    /* Initialization that completes all the starts and the one that abandons the unpromising starts after 2 iterations */
+    double initSeconds, warmUpInitSeconds;
+    em_gmm::init::ResultPtr initResult = initialize(data, 0, initSeconds);
+    initialize(data, 2, warmUpInitSeconds);
+
+    /* Full iterations and the stochastic iterations from the same start values */
+    double fullSeconds, miniBatchSeconds;
+    em_gmm::ResultPtr fullResult      = train(data, initResult, 0, fullSeconds);
+    em_gmm::ResultPtr miniBatchResult = train(data, initResult, miniBatchSize, miniBatchSeconds);
+
+    printNumericTable(miniBatchResult->get(em_gmm::weights), "Weights:");
+    printNumericTable(miniBatchResult->get(em_gmm::means), "Means:");
+
+    std::cout << "Initialization time, all starts:           " << initSeconds << std::endl;
+    std::cout << "Initialization time, abandoned starts:     " << warmUpInitSeconds << std::endl;
+    std::cout << "Full EM time:                              " << fullSeconds << std::endl;
+    std::cout << "Full EM log-likelihood:                    " << goalFunction(fullResult) << std::endl;
+    std::cout << "Stochastic EM time:                        " << miniBatchSeconds << std::endl;
+    std::cout << "Stochastic EM log-likelihood:              " << goalFunction(miniBatchResult) << std::endl;
+
+    return 0;
+}
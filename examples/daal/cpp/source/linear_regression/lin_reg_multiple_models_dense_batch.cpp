@@ -0,0 +1,240 @@
+/* file: lin_reg_multiple_models_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of linear regression in the batch processing mode.
+!
+!    The program trains the linear regression model and several ridge
+!    regression models on a training data set, builds two logistic regression
+!    models, and computes the responses of all the models for the test data in
+!    one prediction call. The responses of each model are compared with the
+!    responses of the model computed alone, the program fails if they do not
+!    agree.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LINEAR_REGRESSION_MULTIPLE_MODELS_BATCH"></a>
+ * \example lin_reg_multiple_models_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName  = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+const size_t nRidgeModels        = 3;  /* Number of ridge regression models */
+const size_t nClasses            = 3;  /* Number of classes of the multinomial logistic regression model */
+
+/* Maximal difference of the responses relative to the largest absolute value of the responses of the model computed alone */
+const float tolerance = 1.0e-5f;
+
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & dependentVariables)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and dependent variables */
+    data               = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate);
+    dependentVariables = HomogenNumericTable<>::create(nDependentVariables, 0, NumericTable::doNotAllocate);
+    NumericTablePtr mergedData(MergedNumericTable::create(data, dependentVariables));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
+
+/* Builds the logistic regression model with the coefficients beta_cj = (c + 1) * (-1)^j / (j + 1) */
+logistic_regression::ModelPtr buildLogisticModel(size_t nModelClasses, bool interceptFlag)
+{
+    const size_t nBetaRows    = nModelClasses == 2 ? 1 : nModelClasses;
+    const size_t nBetaColumns = interceptFlag ? nFeatures + 1 : nFeatures;
+
+    vector<float> beta(nBetaRows * nBetaColumns);
+    for (size_t c = 0; c < nBetaRows; c++)
+    {
+        for (size_t j = 0; j < nBetaColumns; j++)
+        {
+            beta[c * nBetaColumns + j] = float(c + 1) * (j % 2 ? -1.0f : 1.0f) / float(j + 1);
+        }
+    }
+
+    logistic_regression::ModelBuilder<> builder(nFeatures, nModelClasses);
+    builder.setBeta(beta.begin(), beta.end());
+    checkStatus(builder.getStatus());
+    return builder.getModel();
+}
+
+/* Computes the values of the linear functions of the classes of the logistic regression model, they are the responses of the model */
+NumericTablePtr computeLinearFunctions(const NumericTablePtr & data, const logistic_regression::ModelPtr & model)
+{
+    const size_t nRows         = data->getNumberOfRows();
+    const NumericTablePtr beta = model->getBeta();
+    const size_t nResponses    = beta->getNumberOfRows();
+    NumericTablePtr responses  = HomogenNumericTable<>::create(nResponses, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, betaBlock, responseBlock;
+    data->getBlockOfRows(0, nRows, readOnly, xBlock);
+    beta->getBlockOfRows(0, nResponses, readOnly, betaBlock);
+    responses->getBlockOfRows(0, nRows, writeOnly, responseBlock);
+    const float * x = xBlock.getBlockPtr();
+    const float * b = betaBlock.getBlockPtr();
+    float * r       = responseBlock.getBlockPtr();
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t c = 0; c < nResponses; c++)
+        {
+            double value = model->getInterceptFlag() ? b[c * (nFeatures + 1)] : 0.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                value += double(x[i * nFeatures + j]) * b[c * (nFeatures + 1) + j + 1];
+            }
+            r[i * nResponses + c] = float(value);
+        }
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    beta->releaseBlockOfRows(betaBlock);
+    responses->releaseBlockOfRows(responseBlock);
+    return responses;
+}
+
+/* Compares the columns of the responses of all the models that start from the given one with the responses of the model computed alone */
+bool checkResponses(const NumericTablePtr & allResponses, size_t firstColumn, const NumericTablePtr & modelResponses, const string & modelName)
+{
+    const size_t nRows         = allResponses->getNumberOfRows();
+    const size_t nAllColumns   = allResponses->getNumberOfColumns();
+    const size_t nModelColumns = modelResponses->getNumberOfColumns();
+
+    BlockDescriptor<> allBlock, modelBlock;
+    allResponses->getBlockOfRows(0, nRows, readOnly, allBlock);
+    modelResponses->getBlockOfRows(0, nRows, readOnly, modelBlock);
+    const float * all   = allBlock.getBlockPtr();
+    const float * model = modelBlock.getBlockPtr();
+
+    float diff = 0.0f, maxAbsValue = 0.0f;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nModelColumns; j++)
+        {
+            const float expected = model[i * nModelColumns + j];
+            diff                 = std::max(diff, std::fabs(all[i * nAllColumns + firstColumn + j] - expected));
+            maxAbsValue          = std::max(maxAbsValue, std::fabs(expected));
+        }
+    }
+
+    allResponses->releaseBlockOfRows(allBlock);
+    modelResponses->releaseBlockOfRows(modelBlock);
+
+    const float relativeDiff = diff / (maxAbsValue > 1.0f ? maxAbsValue : 1.0f);
+    cout << modelName << ": relative difference from the responses of the model computed alone " << relativeDiff << endl;
+    return relativeDiff <= tolerance;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainDependentVariables, testData, testGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainDependentVariables);
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Collection of the trained models and the responses of each model computed alone */
+    DataCollectionPtr models(new DataCollection());
+    vector<NumericTablePtr> modelResponses;
+    vector<string> modelNames;
+
+    /* Train the linear regression model with the normal equations method */
+    linear_regression::training::Batch<> linearAlgorithm;
+    linearAlgorithm.input.set(linear_regression::training::data, trainData);
+    linearAlgorithm.input.set(linear_regression::training::dependentVariables, trainDependentVariables);
+    checkStatus(linearAlgorithm.compute());
+    linear_regression::ModelPtr linearModel = linearAlgorithm.getResult()->get(linear_regression::training::model);
+    models->push_back(linearModel);
+
+    linear_regression::prediction::Batch<> linearPrediction;
+    linearPrediction.input.set(linear_regression::prediction::data, testData);
+    linearPrediction.input.set(linear_regression::prediction::model, linearModel);
+    checkStatus(linearPrediction.compute());
+    modelResponses.push_back(linearPrediction.getResult()->get(linear_regression::prediction::prediction));
+    modelNames.push_back("Linear regression");
+
+    /* Train the ridge regression models with the different ridge parameters */
+    float ridgeParameter = 1.0f;
+    for (size_t i = 0; i < nRidgeModels; ++i, ridgeParameter *= 10.0f)
+    {
+        ridge_regression::training::Batch<> ridgeAlgorithm;
+        ridgeAlgorithm.input.set(ridge_regression::training::data, trainData);
+        ridgeAlgorithm.input.set(ridge_regression::training::dependentVariables, trainDependentVariables);
+        ridgeAlgorithm.parameter.ridgeParameters = HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, ridgeParameter);
+        checkStatus(ridgeAlgorithm.compute());
+        ridge_regression::ModelPtr ridgeModel = ridgeAlgorithm.getResult()->get(ridge_regression::training::model);
+        models->push_back(ridgeModel);
+
+        ridge_regression::prediction::Batch<> ridgePrediction;
+        ridgePrediction.input.set(ridge_regression::prediction::data, testData);
+        ridgePrediction.input.set(ridge_regression::prediction::model, ridgeModel);
+        checkStatus(ridgePrediction.compute());
+        modelResponses.push_back(ridgePrediction.getResult()->get(ridge_regression::prediction::prediction));
+        modelNames.push_back("Ridge regression " + to_string(i));
+    }
+
+    /* Add the multinomial logistic regression model with the intercept term and the binary one without it */
+    const logistic_regression::ModelPtr logisticModels[] = { buildLogisticModel(nClasses, true), buildLogisticModel(2, false) };
+    for (size_t i = 0; i < 2; ++i)
+    {
+        models->push_back(logisticModels[i]);
+        modelResponses.push_back(computeLinearFunctions(testData, logisticModels[i]));
+        modelNames.push_back("Logistic regression " + to_string(i));
+    }
+
+    /* Compute the responses of all the models in one pass over the test data */
+    linear_regression::prediction::Batch<> algorithm;
+    algorithm.input.set(linear_regression::prediction::data, testData);
+    algorithm.input.set(linear_regression::prediction::models, models);
+    checkStatus(algorithm.compute());
+
+    /* Each row contains the responses of the models in the order of the models in the collection */
+    NumericTablePtr predictionResult = algorithm.getResult()->get(linear_regression::prediction::prediction);
+    printNumericTable(predictionResult, "Responses of all the models (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    bool passed        = true;
+    size_t firstColumn = 0;
+    for (size_t i = 0; i < modelResponses.size(); ++i)
+    {
+        passed = checkResponses(predictionResult, firstColumn, modelResponses[i], modelNames[i]) && passed;
+        firstColumn += modelResponses[i]->getNumberOfColumns();
+    }
+
+    if (!passed || firstColumn != predictionResult->getNumberOfColumns())
+    {
+        cout << "The responses of the models computed in one call differ from the responses of the models computed alone" << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,245 @@
+/* file: lin_reg_norm_eq_dense_out_of_core.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple linear regression in the out-of-core mode.
+!
+!    The program trains the model with the OutOfCore algorithm that reads the
+!    training data set from the data source in chunks of rows. The next chunk is
+!    read in the background while the normal equations model is updated with the
+!    current one, so that the reads and the computations overlap. The partial
+!    sums are accumulated in single precision over the segments of several chunks
+!    and the segments are merged on the master step with compensated summation.
+!
+!    The program fails if the coefficients differ from the ones computed in
+!    double precision, or if the compensated merge of many generated single
+!    precision partial results is not more accurate than their naive sum.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LINEAR_REGRESSION_NORM_EQ_OUT_OF_CORE"></a>
+ * \example lin_reg_norm_eq_dense_out_of_core.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::linear_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+const size_t nRowsInChunk     = 100; /* Number of rows read from the data source at once */
+const size_t nChunksInSegment = 4;   /* Number of chunks accumulated in one single precision partial result */
+
+/* Maximal difference of the coefficients relative to the largest absolute value of the coefficients computed in double precision */
+const double tolerance = 1.0e-3;
+
+/* Generated partial results merged to compare the compensated merge with the naive summation */
+const size_t nMergedSegments      = 1000; /* Number of single precision partial results */
+const size_t nRowsInMergedSegment = 16;   /* Number of rows in a partial result */
+const size_t nMergedFeatures      = 4;    /* Number of features */
+
+/* Trains the model on the data from the data source, the data source may be replaced with any other one, for example, the binary one */
+training::ResultPtr trainOutOfCore(DataSource & dataSource)
+{
+    /* The next chunk is read in the background while the model is updated with the current one,
+       the single precision partial sums of the segments are merged with compensated summation */
+    training::OutOfCore<float> algorithm(dataSource);
+    algorithm.parameter.nDependentVariables = nDependentVariables;
+    algorithm.parameter.nRowsInChunk        = nRowsInChunk;
+    algorithm.parameter.nChunksInSegment    = nChunksInSegment;
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+/* Trains the reference model on the whole data set in double precision */
+training::ResultPtr trainInMemory()
+{
+    FileDataSource<CSVFeatureManager> dataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    NumericTablePtr trainData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<double>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainDependentVariables));
+    dataSource.loadDataBlock(mergedData.get());
+
+    training::Batch<double> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+/* Returns the maximal absolute difference of the coefficients of the models relative to the largest absolute value of the coefficients
+   of the second one */
+double maxDifference(const training::ResultPtr & first, const training::ResultPtr & second)
+{
+    NumericTablePtr firstBeta  = first->get(training::model)->getBeta();
+    NumericTablePtr secondBeta = second->get(training::model)->getBeta();
+    const size_t nBetas        = firstBeta->getNumberOfColumns() * firstBeta->getNumberOfRows();
+
+    BlockDescriptor<double> firstBlock, secondBlock;
+    firstBeta->getBlockOfRows(0, firstBeta->getNumberOfRows(), readOnly, firstBlock);
+    secondBeta->getBlockOfRows(0, secondBeta->getNumberOfRows(), readOnly, secondBlock);
+    const double * a = firstBlock.getBlockPtr();
+    const double * b = secondBlock.getBlockPtr();
+
+    double diff = 0.0, maxAbsValue = 0.0;
+    for (size_t i = 0; i < nBetas; i++)
+    {
+        const double d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        diff           = d > diff ? d : diff;
+        maxAbsValue    = std::fabs(b[i]) > maxAbsValue ? std::fabs(b[i]) : maxAbsValue;
+    }
+
+    firstBeta->releaseBlockOfRows(firstBlock);
+    secondBeta->releaseBlockOfRows(secondBlock);
+    return diff / (maxAbsValue > 1.0 ? maxAbsValue : 1.0);
+}
+
+/* Returns the next pseudo-random number from [0, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+}
+
+/* Returns the X^T*X table of the model trained with normal equations */
+NumericTablePtr getXTX(const ModelPtr & model)
+{
+    return services::dynamicPointerCast<ModelNormEq, Model>(model)->getXTXTable();
+}
+
+/* Merges many generated single precision partial results on the master step, computes the maximal errors of the merged X^T*X and of the
+   naive single precision sum of the partial X^T*X tables relative to their sum computed in double precision */
+void computeMergeErrors(double & mergeError, double & naiveError)
+{
+    training::Distributed<step2Master, float> masterAlgorithm;
+    vector<NumericTablePtr> partialXTX(nMergedSegments);
+
+    unsigned int state = 777;
+    for (size_t iSegment = 0; iSegment < nMergedSegments; iSegment++)
+    {
+        NumericTablePtr data               = HomogenNumericTable<float>::create(nMergedFeatures, nRowsInMergedSegment, NumericTable::doAllocate);
+        NumericTablePtr dependentVariables = HomogenNumericTable<float>::create(1, nRowsInMergedSegment, NumericTable::doAllocate);
+
+        BlockDescriptor<float> xBlock, yBlock;
+        data->getBlockOfRows(0, nRowsInMergedSegment, writeOnly, xBlock);
+        dependentVariables->getBlockOfRows(0, nRowsInMergedSegment, writeOnly, yBlock);
+        float * x = xBlock.getBlockPtr();
+        float * y = yBlock.getBlockPtr();
+        for (size_t i = 0; i < nRowsInMergedSegment; i++)
+        {
+            y[i] = 0.0f;
+            for (size_t j = 0; j < nMergedFeatures; j++)
+            {
+                x[i * nMergedFeatures + j] = 1.0f + nextRandom(state);
+                y[i] += x[i * nMergedFeatures + j];
+            }
+        }
+        data->releaseBlockOfRows(xBlock);
+        dependentVariables->releaseBlockOfRows(yBlock);
+
+        training::Online<float> segmentAlgorithm;
+        segmentAlgorithm.input.set(training::data, data);
+        segmentAlgorithm.input.set(training::dependentVariables, dependentVariables);
+        checkStatus(segmentAlgorithm.compute());
+
+        masterAlgorithm.input.add(training::partialModels, segmentAlgorithm.getPartialResult());
+        partialXTX[iSegment] = getXTX(segmentAlgorithm.getPartialResult()->get(training::partialModel));
+    }
+    checkStatus(masterAlgorithm.compute());
+    NumericTablePtr mergedXTX = getXTX(masterAlgorithm.getPartialResult()->get(training::partialModel));
+
+    const size_t nRows   = mergedXTX->getNumberOfRows();
+    const size_t nValues = nRows * mergedXTX->getNumberOfColumns();
+    vector<double> exactSums(nValues, 0.0);
+    vector<float> naiveSums(nValues, 0.0f);
+    for (size_t iSegment = 0; iSegment < nMergedSegments; iSegment++)
+    {
+        BlockDescriptor<float> block;
+        partialXTX[iSegment]->getBlockOfRows(0, nRows, readOnly, block);
+        const float * partialSums = block.getBlockPtr();
+        for (size_t i = 0; i < nValues; i++)
+        {
+            exactSums[i] += partialSums[i];
+            naiveSums[i] += partialSums[i];
+        }
+        partialXTX[iSegment]->releaseBlockOfRows(block);
+    }
+
+    BlockDescriptor<float> mergedBlock;
+    mergedXTX->getBlockOfRows(0, nRows, readOnly, mergedBlock);
+    const float * mergedSums = mergedBlock.getBlockPtr();
+    mergeError               = 0.0;
+    naiveError               = 0.0;
+    for (size_t i = 0; i < nValues; i++)
+    {
+        /* Only the upper triangle of X^T*X may be filled */
+        if (exactSums[i] == 0.0) continue;
+        const double mergeDiff = std::fabs(mergedSums[i] - exactSums[i]) / exactSums[i];
+        const double naiveDiff = std::fabs(naiveSums[i] - exactSums[i]) / exactSums[i];
+        mergeError             = mergeDiff > mergeError ? mergeDiff : mergeError;
+        naiveError             = naiveDiff > naiveError ? naiveDiff : naiveError;
+    }
+    mergedXTX->releaseBlockOfRows(mergedBlock);
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file chunk by chunk */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    const double start                  = getWallClockSeconds();
+    training::ResultPtr outOfCoreResult = trainOutOfCore(trainDataSource);
+    const double time                   = getWallClockSeconds() - start;
+    training::ResultPtr referenceResult = trainInMemory();
+
+    printNumericTable(outOfCoreResult->get(training::model)->getBeta(), "Linear Regression coefficients:");
+    cout << "Out-of-core training time: " << time << " s" << endl;
+    const double diff = maxDifference(outOfCoreResult, referenceResult);
+    cout << "Max relative difference from the coefficients computed in double precision: " << diff << endl;
+
+    double mergeError = 0.0, naiveError = 0.0;
+    computeMergeErrors(mergeError, naiveError);
+    cout << "Max relative error of the merged sums of " << nMergedSegments << " single precision partial results: compensated " << mergeError
+         << ", naive " << naiveError << endl;
+
+    if (diff > tolerance)
+    {
+        cout << "The coefficients differ from the ones computed in double precision" << endl;
+        return -1;
+    }
+    if (mergeError >= naiveError)
+    {
+        cout << "The compensated merge is not more accurate than the naive summation" << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,338 @@
+/* file: log_reg_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multinomial logistic regression on sparse data in the batch
+!    processing mode.
+!
+!    The program generates documents as sequences of token ids, maps the tokens
+!    into a fixed number of features with feature hashing and stores the
+!    documents in CSR numeric tables. It trains the multinomial logistic
+!    regression model on the CSR data, computes the classification of the test
+!    documents and reports the time and the accuracy. For the small number of
+!    hashed features the same data is also processed in the dense format, and
+!    the probabilities of the classes predicted by the binary and the
+!    multinomial models for the test documents in the CSR and the dense formats
+!    are compared. The program fails if the probabilities do not agree.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_CSR_BATCH"></a>
+ * \example log_reg_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <algorithm>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::logistic_regression;
+
+/* Generated data set parameters */
+const size_t nClasses      = 5;      /* Number of classes */
+const size_t nTrainVectors = 20000;  /* Number of training documents */
+const size_t nTestVectors  = 5000;   /* Number of test documents */
+const size_t nTokensPerRow = 30;     /* Number of tokens in a document */
+const size_t nTokens       = 100000; /* Size of the vocabulary */
+const size_t nTopicTokens  = 500;    /* Number of the tokens specific to a class */
+
+/* Feature hashing parameters, the tokens are mapped into 2^hashBits features */
+const size_t hashBits[]       = { 10, 20 };
+const size_t nHashBitsRun     = sizeof(hashBits) / sizeof(hashBits[0]);
+const size_t maxDenseHashBits = 10; /* The dense data is built only for the small number of features */
+
+/* Solver parameters */
+const size_t nIterations       = 50;
+const double accuracyThreshold = 1.0e-6;
+const float penaltyL2          = 1.0e-4f;
+
+/* Maximal difference of the probabilities predicted for the data in the CSR and the dense formats */
+const float tolerance = 1.0e-5f;
+
+/* Documents as the token ids and the classes */
+struct Documents
+{
+    vector<size_t> tokens;
+    vector<size_t> labels;
+};
+
+/* Returns the next pseudo-random number */
+unsigned int nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+/* Generates the documents. Every second token of a document of class c is drawn from the tokens specific to c */
+void generateDocuments(size_t nVectors, unsigned int seed, Documents & documents)
+{
+    documents.tokens.resize(nVectors * nTokensPerRow);
+    documents.labels.resize(nVectors);
+
+    unsigned int state = seed;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        const size_t label    = nextRandom(state) % nClasses;
+        size_t * const tokens = &documents.tokens[i * nTokensPerRow];
+        documents.labels[i]   = label;
+        for (size_t j = 0; j < nTokensPerRow; j++)
+        {
+            const bool isTopicToken = (nextRandom(state) % 2) == 0;
+            tokens[j]               = isTopicToken ? label * nTopicTokens + nextRandom(state) % nTopicTokens : nextRandom(state) % nTokens;
+        }
+    }
+}
+
+/* Maps the token to one of 2^nHashBits features, returns the zero-based feature index */
+size_t hashToken(size_t token, size_t nHashBits)
+{
+    const unsigned int hash = (unsigned int)token * 2654435761u;
+    return hash >> (32 - nHashBits);
+}
+
+/* Builds the CSR table of the hashed features of the documents, the value of a feature is the number of its tokens */
+CSRNumericTablePtr buildHashedFeatures(const Documents & documents, size_t nHashBits)
+{
+    const size_t nVectors = documents.labels.size();
+
+    vector<size_t> hashed(nTokensPerRow);
+    vector<size_t> colIndices;
+    vector<float> values;
+    vector<size_t> rowOffsets(nVectors + 1);
+    rowOffsets[0] = 1;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        for (size_t j = 0; j < nTokensPerRow; j++)
+        {
+            hashed[j] = hashToken(documents.tokens[i * nTokensPerRow + j], nHashBits);
+        }
+        /* The column indices of a row are sorted and unique */
+        sort(hashed.begin(), hashed.end());
+        for (size_t j = 0; j < nTokensPerRow; j++)
+        {
+            if (j > 0 && hashed[j] == hashed[j - 1])
+            {
+                values.back() += 1.0f;
+                continue;
+            }
+            colIndices.push_back(hashed[j] + 1);
+            values.push_back(1.0f);
+        }
+        rowOffsets[i + 1] = colIndices.size() + 1;
+    }
+
+    const size_t nNonZeros = values.size();
+    float * tableValues    = NULL;
+    size_t * tableColumns  = NULL;
+    size_t * tableRows     = NULL;
+    CSRNumericTablePtr table(new CSRNumericTable(tableValues, tableColumns, tableRows, size_t(1) << nHashBits, nVectors));
+    table->allocateDataMemory(nNonZeros);
+    table->getArrays<float>(&tableValues, &tableColumns, &tableRows);
+    for (size_t i = 0; i < nNonZeros; i++)
+    {
+        tableValues[i]  = values[i];
+        tableColumns[i] = colIndices[i];
+    }
+    for (size_t i = 0; i < nVectors + 1; i++)
+    {
+        tableRows[i] = rowOffsets[i];
+    }
+    return table;
+}
+
+/* Converts the CSR table to the dense one */
+NumericTablePtr toDense(const CSRNumericTablePtr & sparse)
+{
+    const size_t nVectors  = sparse->getNumberOfRows();
+    const size_t nFeatures = sparse->getNumberOfColumns();
+    NumericTablePtr dense  = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate, 0.0f);
+
+    float * values      = NULL;
+    size_t * colIndices = NULL;
+    size_t * rowOffsets = NULL;
+    sparse->getArrays<float>(&values, &colIndices, &rowOffsets);
+
+    BlockDescriptor<> block;
+    dense->getBlockOfRows(0, nVectors, writeOnly, block);
+    float * x = block.getBlockPtr();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        for (size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            x[i * nFeatures + colIndices[k] - 1] = values[k];
+        }
+    }
+    dense->releaseBlockOfRows(block);
+    return dense;
+}
+
+/* Builds the labels of the model with the given number of classes, the classes of the documents are mapped to them cyclically */
+NumericTablePtr buildLabels(const Documents & documents, size_t nClassesInModel)
+{
+    const size_t nVectors  = documents.labels.size();
+    NumericTablePtr labels = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> block;
+    labels->getBlockOfRows(0, nVectors, writeOnly, block);
+    float * y = block.getBlockPtr();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        y[i] = float(documents.labels[i] % nClassesInModel);
+    }
+    labels->releaseBlockOfRows(block);
+    return labels;
+}
+
+/* Returns the share of the documents whose predicted class is the true one */
+float computeAccuracy(const NumericTablePtr & prediction, const Documents & documents)
+{
+    const size_t nVectors = documents.labels.size();
+
+    BlockDescriptor<> block;
+    prediction->getBlockOfRows(0, nVectors, readOnly, block);
+    const float * predicted = block.getBlockPtr();
+    size_t nCorrect         = 0;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        nCorrect += (size_t(predicted[i]) == documents.labels[i]);
+    }
+    prediction->releaseBlockOfRows(block);
+    return float(nCorrect) / float(nVectors);
+}
+
+/* Trains the model with the given number of classes on the training data */
+classifier::ModelPtr train(size_t nClassesInModel, const NumericTablePtr & trainData, const NumericTablePtr & trainLabels)
+{
+    const size_t nVectors = trainData->getNumberOfRows();
+
+    services::SharedPtr<optimization_solver::lbfgs::Batch<> > solver(new optimization_solver::lbfgs::Batch<>());
+    solver->parameter.nIterations             = nIterations;
+    solver->parameter.accuracyThreshold       = accuracyThreshold;
+    solver->parameter.batchSize               = nVectors;
+    solver->parameter.correctionPairBatchSize = nVectors;
+    solver->parameter.L                       = 1;
+
+    training::Batch<> trainAlgorithm(nClassesInModel);
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter().penaltyL2          = penaltyL2;
+    trainAlgorithm.parameter().optimizationSolver = solver;
+    checkStatus(trainAlgorithm.compute());
+    return trainAlgorithm.getResult()->get(classifier::training::model);
+}
+
+/* Trains the model on the training data and classifies the test data, prints the time and the accuracy */
+void run(const char * format, const NumericTablePtr & trainData, const NumericTablePtr & trainLabels, const NumericTablePtr & testData,
+         const Documents & testDocuments)
+{
+    const double trainStart    = getWallClockSeconds();
+    classifier::ModelPtr model = train(nClasses, trainData, trainLabels);
+    const double trainTime     = getWallClockSeconds() - trainStart;
+
+    prediction::Batch<> predictAlgorithm(nClasses);
+    predictAlgorithm.input.set(classifier::prediction::data, testData);
+    predictAlgorithm.input.set(classifier::prediction::model, model);
+
+    const double predictStart = getWallClockSeconds();
+    checkStatus(predictAlgorithm.compute());
+    const double predictTime = getWallClockSeconds() - predictStart;
+
+    const float accuracy = computeAccuracy(predictAlgorithm.getResult()->get(classifier::prediction::prediction), testDocuments);
+    cout << "    " << format << ": training " << trainTime << " s, prediction " << predictTime << " s, accuracy " << accuracy << endl;
+}
+
+/* Computes the probabilities of the classes for the data with the model */
+NumericTablePtr predictProbabilities(size_t nClassesInModel, const classifier::ModelPtr & model, const NumericTablePtr & data)
+{
+    prediction::Batch<> predictAlgorithm(nClassesInModel);
+    predictAlgorithm.input.set(classifier::prediction::data, data);
+    predictAlgorithm.input.set(classifier::prediction::model, model);
+    predictAlgorithm.parameter().resultsToEvaluate = prediction::computeClassesProbabilities;
+    checkStatus(predictAlgorithm.compute());
+    return predictAlgorithm.getResult()->get(classifier::prediction::probabilities);
+}
+
+/* Trains the model with the given number of classes on the CSR data and compares the probabilities predicted for the test data in the CSR
+   and the dense formats */
+bool checkPrediction(size_t nClassesInModel, const NumericTablePtr & trainData, const Documents & trainDocuments, const NumericTablePtr & testData,
+                     const NumericTablePtr & denseTestData)
+{
+    classifier::ModelPtr model          = train(nClassesInModel, trainData, buildLabels(trainDocuments, nClassesInModel));
+    NumericTablePtr sparseProbabilities = predictProbabilities(nClassesInModel, model, testData);
+    NumericTablePtr denseProbabilities  = predictProbabilities(nClassesInModel, model, denseTestData);
+
+    const size_t nVectors = denseProbabilities->getNumberOfRows();
+    const size_t nValues  = nVectors * denseProbabilities->getNumberOfColumns();
+
+    BlockDescriptor<> sparseBlock, denseBlock;
+    sparseProbabilities->getBlockOfRows(0, nVectors, readOnly, sparseBlock);
+    denseProbabilities->getBlockOfRows(0, nVectors, readOnly, denseBlock);
+    const float * a = sparseBlock.getBlockPtr();
+    const float * b = denseBlock.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nValues; i++)
+    {
+        const float d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        diff          = d > diff ? d : diff;
+    }
+
+    sparseProbabilities->releaseBlockOfRows(sparseBlock);
+    denseProbabilities->releaseBlockOfRows(denseBlock);
+
+    cout << "    Max difference of the probabilities of " << nClassesInModel << " classes predicted for the CSR and the dense data: " << diff
+         << endl;
+    return diff <= tolerance;
+}
+
+int main(int argc, char * argv[])
+{
+    Documents trainDocuments, testDocuments;
+    generateDocuments(nTrainVectors, 777, trainDocuments);
+    generateDocuments(nTestVectors, 4242, testDocuments);
+    NumericTablePtr trainLabels = buildLabels(trainDocuments, nClasses);
+
+    bool passed = true;
+    for (size_t i = 0; i < nHashBitsRun; i++)
+    {
+        CSRNumericTablePtr trainData = buildHashedFeatures(trainDocuments, hashBits[i]);
+        CSRNumericTablePtr testData  = buildHashedFeatures(testDocuments, hashBits[i]);
+        cout << "Hashed features: " << trainData->getNumberOfColumns() << ", non-zero values in the training data: "
+             << trainData->getDataSize() << endl;
+
+        run("CSR", trainData, trainLabels, testData, testDocuments);
+        if (hashBits[i] <= maxDenseHashBits)
+        {
+            NumericTablePtr denseTestData = toDense(testData);
+            run("Dense", toDense(trainData), trainLabels, denseTestData, testDocuments);
+
+            passed = checkPrediction(2, trainData, trainDocuments, testData, denseTestData) && passed;
+            passed = checkPrediction(nClasses, trainData, trainDocuments, testData, denseTestData) && passed;
+        }
+    }
+
+    if (!passed)
+    {
+        cout << "The probabilities predicted for the data in the CSR format do not agree with the ones predicted for the dense data" << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+/* file: cd_parallel_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the parallel Coordinate descent algorithm
+!
+!    The program solves the lasso problem on a generated data set with the
+!    sequential and the parallel coordinate descent and compares the time,
+!    the number of iterations and the solutions.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CD_PARALLEL_BATCH"></a>
+ * \example cd_parallel_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Generated data set parameters */
+const size_t nVectors         = 4000; /* Number of observations */
+const size_t nFeatures        = 2000; /* Number of features */
+const size_t nNonZeroFeatures = 50;   /* Number of features the dependent variable depends on */
+
+/* Solver parameters */
+const size_t nIterations             = 1000;
+const double accuracyThreshold       = 1.0e-6;
+const float penaltyL1                = 0.01f;
+const size_t parallelCoordinates[]   = { 16, 64 };
+const size_t nParallelCoordinatesRun = sizeof(parallelCoordinates) / sizeof(parallelCoordinates[0]);
+
+/* Returns the next pseudo-random number from [-1, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 23) - 1.0f;
+}
+
+/* Generates the data set where the neighbouring features are correlated */
+void generateData(NumericTablePtr & data, NumericTablePtr & dependentVariables)
+{
+    data               = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate);
+    dependentVariables = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, yBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, xBlock);
+    dependentVariables->getBlockOfRows(0, nVectors, writeOnly, yBlock);
+    float * x = xBlock.getBlockPtr();
+    float * y = yBlock.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        float * xi = x + i * nFeatures;
+        xi[0]      = nextRandom(state);
+        y[i]       = 1.0f + 0.01f * nextRandom(state);
+        for (size_t j = 1; j < nFeatures; j++)
+        {
+            xi[j] = 0.5f * xi[j - 1] + nextRandom(state);
+        }
+        for (size_t j = 0; j < nNonZeroFeatures; j++)
+        {
+            y[i] += float(j % 3 + 1) * xi[j * (nFeatures / nNonZeroFeatures)];
+        }
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    dependentVariables->releaseBlockOfRows(yBlock);
+}
+
+/* Trains the lasso model with the given number of concurrently updated coordinates, returns the time in seconds */
+double solve(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, size_t nParallelCoordinates, bool safeParallelUpdates,
+             NumericTablePtr & minimum, NumericTablePtr & nIterationsPerformed)
+{
+    services::SharedPtr<optimization_solver::mse::Batch<> > mseObjectiveFunction(new optimization_solver::mse::Batch<>(nVectors));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+    mseObjectiveFunction->parameter().penaltyL1 = HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, penaltyL1);
+
+    optimization_solver::coordinate_descent::Batch<> cdAlgorithm(mseObjectiveFunction);
+    cdAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                          HomogenNumericTable<>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0f));
+
+    cdAlgorithm.parameter().nIterations          = nIterations;
+    cdAlgorithm.parameter().accuracyThreshold    = accuracyThreshold;
+    cdAlgorithm.parameter().nParallelCoordinates = nParallelCoordinates;
+    cdAlgorithm.parameter().safeParallelUpdates  = safeParallelUpdates;
+
+    const double start = getWallClockSeconds();
+    cdAlgorithm.compute();
+    const double time = getWallClockSeconds() - start;
+
+    minimum              = cdAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    nIterationsPerformed = cdAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations);
+    return time;
+}
+
+/* Returns the maximal absolute difference of the solutions */
+float maxDifference(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    BlockDescriptor<> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nFeatures + 1, readOnly, firstBlock);
+    second->getBlockOfRows(0, nFeatures + 1, readOnly, secondBlock);
+    const float * a = firstBlock.getBlockPtr();
+    const float * b = secondBlock.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t j = 0; j < nFeatures + 1; j++)
+    {
+        const float d = a[j] > b[j] ? a[j] - b[j] : b[j] - a[j];
+        diff          = d > diff ? d : diff;
+    }
+
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return diff;
+}
+
+float getIterations(const NumericTablePtr & nIterationsPerformed)
+{
+    BlockDescriptor<> block;
+    nIterationsPerformed->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    nIterationsPerformed->releaseBlockOfRows(block);
+    return value;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data, dependentVariables;
+    generateData(data, dependentVariables);
+
+    /* Sequential coordinate descent */
+    NumericTablePtr sequentialMinimum, sequentialIterations;
+    const double sequentialTime = solve(data, dependentVariables, 1, true, sequentialMinimum, sequentialIterations);
+    cout << "Sequential coordinate descent: " << sequentialTime << " s, " << getIterations(sequentialIterations) << " iterations" << endl;
+
+    /* Parallel coordinate descent with the safe and the plain merged updates */
+    for (size_t i = 0; i < nParallelCoordinatesRun; i++)
+    {
+        for (int safe = 1; safe >= 0; safe--)
+        {
+            NumericTablePtr minimum, iterations;
+            const double time = solve(data, dependentVariables, parallelCoordinates[i], safe != 0, minimum, iterations);
+            cout << "Parallel coordinate descent, " << parallelCoordinates[i] << " coordinates per round" << (safe ? ", safe updates: " : ": ")
+                 << time << " s, " << getIterations(iterations) << " iterations, max difference from the sequential solution "
+                 << maxDifference(minimum, sequentialMinimum) << endl;
+        }
+    }
+
+    return 0;
+}
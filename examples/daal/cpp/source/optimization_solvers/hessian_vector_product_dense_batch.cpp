@@ -0,0 +1,213 @@
+/* file: hessian_vector_product_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the computation of the Hessian-vector product
+!
+!    The program computes the product of the Hessian of the logistic loss, the
+!    cross-entropy loss and the mean squared error functions and a direction
+!    with and without the intercept and the L2 regularization, and compares it
+!    with the product of the Hessian computed by the same function and the
+!    direction. The program fails if the products do not agree.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-HESSIAN_VECTOR_PRODUCT_BATCH"></a>
+ * \example hessian_vector_product_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::optimization_solver;
+using namespace daal::data_management;
+
+/* Generated data set parameters */
+const size_t nVectors  = 200; /* Number of observations */
+const size_t nFeatures = 5;   /* Number of features */
+const size_t nClasses  = 3;   /* Number of classes for the cross-entropy loss */
+
+/* Maximal difference of the products relative to the largest absolute value of the product of the Hessian and the direction */
+const float tolerance = 1.0e-4f;
+
+/* Returns the next pseudo-random number from [0, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+}
+
+/* Returns the column of the given size with the values from [-1, 1) */
+NumericTablePtr generateColumn(size_t nRows, unsigned int & state)
+{
+    NumericTablePtr column = HomogenNumericTable<>::create(1, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<> block;
+    column->getBlockOfRows(0, nRows, writeOnly, block);
+    float * values = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        values[i] = 2.0f * nextRandom(state) - 1.0f;
+    }
+    column->releaseBlockOfRows(block);
+    return column;
+}
+
+/* Generates the observations, the binary labels, the labels of nClasses classes and the continuous responses */
+void generateData(NumericTablePtr & data, NumericTablePtr & binaryLabels, NumericTablePtr & classLabels, NumericTablePtr & responses)
+{
+    data         = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate);
+    binaryLabels = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+    classLabels  = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+    responses    = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, binaryBlock, classBlock, responseBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, xBlock);
+    binaryLabels->getBlockOfRows(0, nVectors, writeOnly, binaryBlock);
+    classLabels->getBlockOfRows(0, nVectors, writeOnly, classBlock);
+    responses->getBlockOfRows(0, nVectors, writeOnly, responseBlock);
+    float * x = xBlock.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        float * xi   = x + i * nFeatures;
+        float margin = 0.0f;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            xi[j] = 2.0f * nextRandom(state) - 1.0f;
+            margin += (j % 2 ? 1.0f : -1.0f) * xi[j];
+        }
+        binaryBlock.getBlockPtr()[i]   = margin > 0.0f ? 1.0f : 0.0f;
+        classBlock.getBlockPtr()[i]    = float(i % nClasses);
+        responseBlock.getBlockPtr()[i] = margin + 0.1f * nextRandom(state);
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    binaryLabels->releaseBlockOfRows(binaryBlock);
+    classLabels->releaseBlockOfRows(classBlock);
+    responses->releaseBlockOfRows(responseBlock);
+}
+
+/* Returns the maximal absolute difference of the product of the Hessian and the direction and the Hessian-vector product
+   relative to the largest absolute value of the product of the Hessian and the direction */
+float relativeDifference(const NumericTablePtr & hessian, const NumericTablePtr & direction, const NumericTablePtr & product)
+{
+    const size_t argumentSize = direction->getNumberOfRows();
+
+    BlockDescriptor<> hessianBlock, directionBlock, productBlock;
+    hessian->getBlockOfRows(0, argumentSize, readOnly, hessianBlock);
+    direction->getBlockOfRows(0, argumentSize, readOnly, directionBlock);
+    product->getBlockOfRows(0, argumentSize, readOnly, productBlock);
+    const float * h = hessianBlock.getBlockPtr();
+    const float * v = directionBlock.getBlockPtr();
+    const float * p = productBlock.getBlockPtr();
+
+    float diff = 0.0f, maxAbsValue = 0.0f;
+    for (size_t i = 0; i < argumentSize; i++)
+    {
+        float hv = 0.0f;
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            hv += h[i * argumentSize + j] * v[j];
+        }
+        diff        = std::fabs(hv - p[i]) > diff ? std::fabs(hv - p[i]) : diff;
+        maxAbsValue = std::fabs(hv) > maxAbsValue ? std::fabs(hv) : maxAbsValue;
+    }
+
+    hessian->releaseBlockOfRows(hessianBlock);
+    direction->releaseBlockOfRows(directionBlock);
+    product->releaseBlockOfRows(productBlock);
+    return diff / (maxAbsValue > 1.0f ? maxAbsValue : 1.0f);
+}
+
+/* Computes the Hessian and the Hessian-vector product of the function in the random point and compares them */
+template <typename FunctionType>
+bool checkHessianVectorProduct(FunctionType & function, size_t argumentSize, const char * functionName, bool interceptFlag, float penaltyL2)
+{
+    unsigned int state        = 123;
+    NumericTablePtr argument  = generateColumn(argumentSize, state);
+    NumericTablePtr direction = generateColumn(argumentSize, state);
+    function.sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+
+    function.parameter().resultsToCompute = objective_function::hessian;
+    checkStatus(function.compute());
+    NumericTablePtr hessian = function.getResult()->get(objective_function::hessianIdx);
+
+    function.setResult(objective_function::ResultPtr(new objective_function::Result()));
+    function.parameter().resultsToCompute       = objective_function::hessianVectorProduct;
+    function.parameter().hessianVectorDirection = direction;
+    checkStatus(function.compute());
+    NumericTablePtr product = function.getResult()->get(objective_function::hessianVectorProductIdx);
+
+    const float diff  = relativeDifference(hessian, direction, product);
+    const bool passed = diff <= tolerance;
+    cout << functionName << ", interceptFlag = " << interceptFlag << ", penaltyL2 = " << penaltyL2 << ": relative difference " << diff
+         << (passed ? "" : " exceeds the tolerance") << endl;
+    return passed;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data, binaryLabels, classLabels, responses;
+    generateData(data, binaryLabels, classLabels, responses);
+
+    const float penaltiesL2[] = { 0.0f, 0.1f };
+
+    bool passed = true;
+    for (size_t iIntercept = 0; iIntercept < 2; iIntercept++)
+    {
+        const bool interceptFlag = (iIntercept == 0);
+        for (size_t iPenalty = 0; iPenalty < 2; iPenalty++)
+        {
+            const float penaltyL2 = penaltiesL2[iPenalty];
+
+            logistic_loss::Batch<> logLoss(nVectors);
+            logLoss.input.set(logistic_loss::data, data);
+            logLoss.input.set(logistic_loss::dependentVariables, binaryLabels);
+            logLoss.parameter().interceptFlag = interceptFlag;
+            logLoss.parameter().penaltyL2     = penaltyL2;
+            passed &= checkHessianVectorProduct(logLoss, nFeatures + 1, "Logistic loss", interceptFlag, penaltyL2);
+
+            cross_entropy_loss::Batch<> crossEntropyLoss(nClasses, nVectors);
+            crossEntropyLoss.input.set(cross_entropy_loss::data, data);
+            crossEntropyLoss.input.set(cross_entropy_loss::dependentVariables, classLabels);
+            crossEntropyLoss.parameter().interceptFlag = interceptFlag;
+            crossEntropyLoss.parameter().penaltyL2     = penaltyL2;
+            passed &= checkHessianVectorProduct(crossEntropyLoss, nClasses * (nFeatures + 1), "Cross-entropy loss", interceptFlag, penaltyL2);
+
+            mse::Batch<> meanSquaredError(nVectors);
+            meanSquaredError.input.set(mse::data, data);
+            meanSquaredError.input.set(mse::dependentVariables, responses);
+            meanSquaredError.parameter().interceptFlag = interceptFlag;
+            meanSquaredError.parameter().penaltyL2     = HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, penaltyL2);
+            passed &= checkHessianVectorProduct(meanSquaredError, nFeatures + 1, "Mean squared error", interceptFlag, penaltyL2);
+        }
+    }
+
+    if (!passed)
+    {
+        cout << "The Hessian-vector product does not agree with the product of the Hessian and the direction" << endl;
+        return -1;
+    }
+    return 0;
+}
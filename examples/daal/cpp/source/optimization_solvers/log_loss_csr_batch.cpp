@@ -0,0 +1,270 @@
+/* file: log_loss_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the computation of the logistic loss and the cross-entropy
+!    loss functions on sparse data
+!
+!    The program computes the value, the gradient, the Hessian-vector product
+!    and the Lipschitz constant of the functions on the data set in the CSR
+!    format and on its dense copy, for all the observations and for a batch of
+!    them, and compares the results. The program fails if the results do not
+!    agree.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_LOSS_CSR_BATCH"></a>
+ * \example log_loss_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::optimization_solver;
+using namespace daal::data_management;
+
+/* Generated data set parameters */
+const size_t nVectors    = 1500; /* Number of observations, several blocks of rows are processed in parallel */
+const size_t nFeatures   = 40;   /* Number of features */
+const size_t nNonZeroRow = 6;    /* Maximal number of non-zero values in a row */
+const size_t nClasses    = 3;    /* Number of classes for the cross-entropy loss */
+const size_t batchSize   = 300;  /* Number of observations in the batch */
+
+/* Function parameters */
+const bool interceptFlag = true;
+const float penaltyL2    = 0.01f;
+
+/* Maximal difference of the results relative to the largest absolute value of the results on the dense data */
+const float tolerance = 1.0e-4f;
+
+/* Returns the next pseudo-random number from [0, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+}
+
+/* Generates the sparse observations in the CSR format, their dense copy, the binary labels and the labels of nClasses classes */
+void generateData(CSRNumericTablePtr & sparseData, NumericTablePtr & denseData, NumericTablePtr & binaryLabels, NumericTablePtr & classLabels)
+{
+    denseData    = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate, 0.0f);
+    binaryLabels = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+    classLabels  = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, binaryBlock, classBlock;
+    denseData->getBlockOfRows(0, nVectors, readWrite, xBlock);
+    binaryLabels->getBlockOfRows(0, nVectors, writeOnly, binaryBlock);
+    classLabels->getBlockOfRows(0, nVectors, writeOnly, classBlock);
+    float * x = xBlock.getBlockPtr();
+
+    /* The columns of a row are drawn from the disjoint ranges, so the column indices are sorted and unique */
+    const size_t rangeSize = nFeatures / nNonZeroRow;
+    vector<float> values;
+    vector<size_t> colIndices;
+    vector<size_t> rowOffsets(nVectors + 1);
+    rowOffsets[0] = 1;
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        float margin = 0.0f;
+        for (size_t k = 0; k < nNonZeroRow; k++)
+        {
+            if (nextRandom(state) < 0.3f) continue;
+            const size_t j       = k * rangeSize + size_t(nextRandom(state) * rangeSize);
+            const float value    = 2.0f * nextRandom(state) - 1.0f;
+            x[i * nFeatures + j] = value;
+            margin += (j % 2 ? 1.0f : -1.0f) * value;
+            values.push_back(value);
+            colIndices.push_back(j + 1);
+        }
+        rowOffsets[i + 1]            = colIndices.size() + 1;
+        binaryBlock.getBlockPtr()[i] = margin > 0.0f ? 1.0f : 0.0f;
+        classBlock.getBlockPtr()[i]  = float(i % nClasses);
+    }
+
+    denseData->releaseBlockOfRows(xBlock);
+    binaryLabels->releaseBlockOfRows(binaryBlock);
+    classLabels->releaseBlockOfRows(classBlock);
+
+    const size_t nNonZeros = values.size();
+    float * tableValues    = NULL;
+    size_t * tableColumns  = NULL;
+    size_t * tableRows     = NULL;
+    sparseData             = CSRNumericTablePtr(new CSRNumericTable(tableValues, tableColumns, tableRows, nFeatures, nVectors));
+    sparseData->allocateDataMemory(nNonZeros);
+    sparseData->getArrays<float>(&tableValues, &tableColumns, &tableRows);
+    for (size_t i = 0; i < nNonZeros; i++)
+    {
+        tableValues[i]  = values[i];
+        tableColumns[i] = colIndices[i];
+    }
+    for (size_t i = 0; i < nVectors + 1; i++)
+    {
+        tableRows[i] = rowOffsets[i];
+    }
+}
+
+/* Returns the column of the given size with the values from [-1, 1) */
+NumericTablePtr generateColumn(size_t nRows, unsigned int & state)
+{
+    NumericTablePtr column = HomogenNumericTable<>::create(1, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<> block;
+    column->getBlockOfRows(0, nRows, writeOnly, block);
+    float * values = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        values[i] = 2.0f * nextRandom(state) - 1.0f;
+    }
+    column->releaseBlockOfRows(block);
+    return column;
+}
+
+/* Returns the indices of the batch of observations, the indices are not sorted and may repeat */
+NumericTablePtr generateBatchIndices()
+{
+    NumericTablePtr indices = HomogenNumericTable<int>::create(batchSize, 1, NumericTable::doAllocate);
+
+    BlockDescriptor<int> block;
+    indices->getBlockOfRows(0, 1, writeOnly, block);
+    int * values       = block.getBlockPtr();
+    unsigned int state = 4242;
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        values[i] = int(nextRandom(state) * nVectors);
+    }
+    indices->releaseBlockOfRows(block);
+    return indices;
+}
+
+/* Returns the maximal absolute difference of the tables relative to the largest absolute value of the second one */
+float relativeDifference(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    const size_t nRows = second->getNumberOfRows();
+
+    BlockDescriptor<> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nRows, readOnly, firstBlock);
+    second->getBlockOfRows(0, nRows, readOnly, secondBlock);
+    const float * a = firstBlock.getBlockPtr();
+    const float * b = secondBlock.getBlockPtr();
+
+    float diff = 0.0f, maxAbsValue = 0.0f;
+    for (size_t i = 0; i < nRows * second->getNumberOfColumns(); i++)
+    {
+        diff        = std::fabs(a[i] - b[i]) > diff ? std::fabs(a[i] - b[i]) : diff;
+        maxAbsValue = std::fabs(b[i]) > maxAbsValue ? std::fabs(b[i]) : maxAbsValue;
+    }
+
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return diff / (maxAbsValue > 1.0f ? maxAbsValue : 1.0f);
+}
+
+/* Computes the value, the gradient, the Hessian-vector product and the Lipschitz constant of the function, the Lipschitz constant is
+   computed separately as the solvers do it */
+template <typename FunctionType>
+void computeResults(FunctionType & function, const NumericTablePtr & argument, const NumericTablePtr & direction,
+                    const NumericTablePtr & batchIndices, NumericTablePtr results[4])
+{
+    function.sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+    function.parameter().interceptFlag          = interceptFlag;
+    function.parameter().penaltyL2              = penaltyL2;
+    function.parameter().batchIndices           = batchIndices;
+    function.parameter().hessianVectorDirection = direction;
+
+    function.parameter().resultsToCompute = objective_function::value | objective_function::gradient | objective_function::hessianVectorProduct;
+    checkStatus(function.compute());
+    results[0] = function.getResult()->get(objective_function::valueIdx);
+    results[1] = function.getResult()->get(objective_function::gradientIdx);
+    results[2] = function.getResult()->get(objective_function::hessianVectorProductIdx);
+
+    function.setResult(objective_function::ResultPtr(new objective_function::Result()));
+    function.parameter().resultsToCompute = objective_function::lipschitzConstant;
+    checkStatus(function.compute());
+    results[3] = function.getResult()->get(objective_function::lipschitzConstantIdx);
+}
+
+/* Compares the results of the function on the sparse and on the dense data */
+template <typename FunctionType>
+bool compareResults(FunctionType & sparseFunction, FunctionType & denseFunction, size_t argumentSize, const NumericTablePtr & batchIndices,
+                    const char * functionName)
+{
+    const char * resultNames[] = { "value", "gradient", "Hessian-vector product", "Lipschitz constant" };
+
+    unsigned int state        = 123;
+    NumericTablePtr argument  = generateColumn(argumentSize, state);
+    NumericTablePtr direction = generateColumn(argumentSize, state);
+
+    NumericTablePtr sparseResults[4], denseResults[4];
+    computeResults(sparseFunction, argument, direction, batchIndices, sparseResults);
+    computeResults(denseFunction, argument, direction, batchIndices, denseResults);
+
+    bool passed = true;
+    for (size_t i = 0; i < 4; i++)
+    {
+        const float diff = relativeDifference(sparseResults[i], denseResults[i]);
+        cout << functionName << (batchIndices ? " on the batch" : " on all observations") << ", " << resultNames[i] << ": relative difference "
+             << diff << endl;
+        passed = passed && (diff <= tolerance);
+    }
+    return passed;
+}
+
+int main(int argc, char * argv[])
+{
+    CSRNumericTablePtr sparseData;
+    NumericTablePtr denseData, binaryLabels, classLabels;
+    generateData(sparseData, denseData, binaryLabels, classLabels);
+
+    const NumericTablePtr batchIndicesRun[] = { NumericTablePtr(), generateBatchIndices() };
+
+    bool passed = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        const NumericTablePtr & batchIndices = batchIndicesRun[i];
+        const size_t numberOfTerms           = batchIndices ? batchSize : nVectors;
+
+        logistic_loss::Batch<> sparseLogLoss(numberOfTerms), denseLogLoss(numberOfTerms);
+        sparseLogLoss.input.set(logistic_loss::data, sparseData);
+        sparseLogLoss.input.set(logistic_loss::dependentVariables, binaryLabels);
+        denseLogLoss.input.set(logistic_loss::data, denseData);
+        denseLogLoss.input.set(logistic_loss::dependentVariables, binaryLabels);
+        passed = compareResults(sparseLogLoss, denseLogLoss, nFeatures + 1, batchIndices, "Logistic loss") && passed;
+
+        cross_entropy_loss::Batch<> sparseCrossEntropyLoss(nClasses, numberOfTerms), denseCrossEntropyLoss(nClasses, numberOfTerms);
+        sparseCrossEntropyLoss.input.set(cross_entropy_loss::data, sparseData);
+        sparseCrossEntropyLoss.input.set(cross_entropy_loss::dependentVariables, classLabels);
+        denseCrossEntropyLoss.input.set(cross_entropy_loss::data, denseData);
+        denseCrossEntropyLoss.input.set(cross_entropy_loss::dependentVariables, classLabels);
+        passed = compareResults(sparseCrossEntropyLoss, denseCrossEntropyLoss, nClasses * (nFeatures + 1), batchIndices, "Cross-entropy loss")
+                 && passed;
+    }
+
+    if (!passed)
+    {
+        cout << "The results on the data in the CSR format do not agree with the results on the dense data" << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+/* file: newton_cg_log_loss_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the Newton conjugate gradient algorithm
+!
+!    The program minimizes the logistic loss function on a generated data set
+!    whose features have very different scales with the Newton conjugate gradient
+!    and the LBFGS algorithms and compares the time, the number of iterations
+!    and the solutions. The program fails if the solutions do not agree.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-NEWTON_CG_LOG_LOSS_BATCH"></a>
+ * \example newton_cg_log_loss_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Generated data set parameters */
+const size_t nVectors  = 20000; /* Number of observations */
+const size_t nFeatures = 50;    /* Number of features */
+
+/* Solver parameters */
+const size_t nIterations       = 1000;
+const double accuracyThreshold = 1.0e-10;
+const float penaltyL2          = 1.0e-4f;
+
+/* Maximal difference of the solutions relative to the largest absolute value of the coefficients */
+const float tolerance = 1.0e-3f;
+
+/* Returns the next pseudo-random number from [0, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+}
+
+/* Generates the observations with the features of different scales and the labels of the logistic regression model */
+void generateData(NumericTablePtr & data, NumericTablePtr & dependentVariables)
+{
+    data               = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate);
+    dependentVariables = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, yBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, xBlock);
+    dependentVariables->getBlockOfRows(0, nVectors, writeOnly, yBlock);
+    float * x = xBlock.getBlockPtr();
+    float * y = yBlock.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        float * xi   = x + i * nFeatures;
+        float margin = 0.2f;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const float scale = 1.0f + float(j % 10) * float(j % 10);
+            xi[j]             = scale * (2.0f * nextRandom(state) - 1.0f);
+            margin += (j % 2 ? 1.0f : -1.0f) * xi[j] / scale;
+        }
+        y[i] = (nextRandom(state) * (1.0f + std::exp(-margin)) < 1.0f) ? 1.0f : 0.0f;
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    dependentVariables->releaseBlockOfRows(yBlock);
+}
+
+/* Minimizes the logistic loss function with the Newton conjugate gradient or the LBFGS algorithm, returns the time in seconds */
+double solve(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, bool useNewtonCG, NumericTablePtr & minimum,
+             NumericTablePtr & nIterationsPerformed)
+{
+    services::SharedPtr<optimization_solver::logistic_loss::Batch<> > function(new optimization_solver::logistic_loss::Batch<>(nVectors));
+    function->input.set(optimization_solver::logistic_loss::data, data);
+    function->input.set(optimization_solver::logistic_loss::dependentVariables, dependentVariables);
+    function->parameter().penaltyL2 = penaltyL2;
+
+    NumericTablePtr initialPoint = HomogenNumericTable<>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0f);
+
+    double time = 0.0;
+    if (useNewtonCG)
+    {
+        optimization_solver::newton_cg::Batch<> algorithm(function);
+        algorithm.input.set(optimization_solver::iterative_solver::inputArgument, initialPoint);
+        algorithm.parameter().nIterations       = nIterations;
+        algorithm.parameter().accuracyThreshold = accuracyThreshold;
+
+        const double start = getWallClockSeconds();
+        checkStatus(algorithm.compute());
+        time = getWallClockSeconds() - start;
+
+        minimum              = algorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+        nIterationsPerformed = algorithm.getResult()->get(optimization_solver::iterative_solver::nIterations);
+    }
+    else
+    {
+        /* All terms are used for the gradient and L = 1, so the step length is chosen by the line search */
+        optimization_solver::lbfgs::Batch<> algorithm(function);
+        algorithm.input.set(optimization_solver::iterative_solver::inputArgument, initialPoint);
+        algorithm.parameter.nIterations             = nIterations;
+        algorithm.parameter.accuracyThreshold       = accuracyThreshold;
+        algorithm.parameter.batchSize               = nVectors;
+        algorithm.parameter.correctionPairBatchSize = nVectors;
+        algorithm.parameter.L                       = 1;
+
+        const double start = getWallClockSeconds();
+        checkStatus(algorithm.compute());
+        time = getWallClockSeconds() - start;
+
+        minimum              = algorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+        nIterationsPerformed = algorithm.getResult()->get(optimization_solver::iterative_solver::nIterations);
+    }
+    return time;
+}
+
+/* Returns the maximal absolute difference of the solutions and the largest absolute value of the coefficients of the first one */
+float maxDifference(const NumericTablePtr & first, const NumericTablePtr & second, float & maxAbsValue)
+{
+    BlockDescriptor<> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nFeatures + 1, readOnly, firstBlock);
+    second->getBlockOfRows(0, nFeatures + 1, readOnly, secondBlock);
+    const float * a = firstBlock.getBlockPtr();
+    const float * b = secondBlock.getBlockPtr();
+
+    float diff  = 0.0f;
+    maxAbsValue = 0.0f;
+    for (size_t j = 0; j < nFeatures + 1; j++)
+    {
+        const float d = a[j] > b[j] ? a[j] - b[j] : b[j] - a[j];
+        diff          = d > diff ? d : diff;
+        maxAbsValue   = std::fabs(a[j]) > maxAbsValue ? std::fabs(a[j]) : maxAbsValue;
+    }
+
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return diff;
+}
+
+float getIterations(const NumericTablePtr & nIterationsPerformed)
+{
+    BlockDescriptor<> block;
+    nIterationsPerformed->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    nIterationsPerformed->releaseBlockOfRows(block);
+    return value;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data, dependentVariables;
+    generateData(data, dependentVariables);
+
+    NumericTablePtr newtonMinimum, newtonIterations;
+    const double newtonTime = solve(data, dependentVariables, true, newtonMinimum, newtonIterations);
+
+    NumericTablePtr lbfgsMinimum, lbfgsIterations;
+    const double lbfgsTime = solve(data, dependentVariables, false, lbfgsMinimum, lbfgsIterations);
+
+    printNumericTable(newtonMinimum, "Minimum found by the Newton conjugate gradient algorithm:");
+    cout << "Newton conjugate gradient: " << newtonTime << " s, " << getIterations(newtonIterations) << " iterations" << endl;
+    cout << "LBFGS: " << lbfgsTime << " s, " << getIterations(lbfgsIterations) << " iterations" << endl;
+
+    float maxAbsValue = 0.0f;
+    const float diff  = maxDifference(newtonMinimum, lbfgsMinimum, maxAbsValue);
+    cout << "Max difference of the solutions: " << diff << endl;
+
+    if (diff > tolerance * (maxAbsValue > 1.0f ? maxAbsValue : 1.0f))
+    {
+        cout << "The solutions of the Newton conjugate gradient and the LBFGS algorithms do not agree" << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,284 @@
+/* file: spmd_log_loss_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the data-parallel LBFGS and mini-batch SGD algorithms
+!
+!    The program splits a generated data set into several parts and minimizes
+!    the logistic loss function over all parts at once: every rank runs the
+!    solver in its own thread on its own part of the data, and the ranks average
+!    their local results through the shared-memory communicator.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SPMD_LOG_LOSS_BATCH"></a>
+ * \example spmd_log_loss_dense_batch.cpp
+ */
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#include "daal.h"
+#include "services/communicator.h"
+#include "service.h"
+#include <cmath>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Generated data set parameters */
+const size_t nRanks    = 4;     /* Number of ranks the data set is split into */
+const size_t nVectors  = 40000; /* Number of observations, a multiple of nRanks */
+const size_t nFeatures = 20;    /* Number of features */
+
+/* Solver parameters */
+const size_t nIterations       = 100;
+const size_t nSgdIterations    = 2000;
+const size_t sgdBatchSize      = 64;
+const double accuracyThreshold = 1.0e-10;
+const float learningRate       = 0.5f;
+
+/* Part of the data set and the result of the rank */
+struct RankTask
+{
+    NumericTablePtr data;
+    NumericTablePtr dependentVariables;
+    services::SharedPtr<daal::preview::services::Communicator> communicator;
+    bool useSgd;
+    NumericTablePtr minimum;
+};
+
+/* Returns the next pseudo-random number from [0, 1) */
+float nextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+}
+
+/* Generates the observations and the labels of the logistic regression model */
+void generateData(NumericTablePtr & data, NumericTablePtr & dependentVariables)
+{
+    data               = HomogenNumericTable<>::create(nFeatures, nVectors, NumericTable::doAllocate);
+    dependentVariables = HomogenNumericTable<>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<> xBlock, yBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, xBlock);
+    dependentVariables->getBlockOfRows(0, nVectors, writeOnly, yBlock);
+    float * x = xBlock.getBlockPtr();
+    float * y = yBlock.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        float * xi   = x + i * nFeatures;
+        float margin = 0.5f;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            xi[j] = 2.0f * nextRandom(state) - 1.0f;
+            margin += (j % 2 ? 1.0f : -1.0f) * float(j % 5) * xi[j];
+        }
+        y[i] = (nextRandom(state) * (1.0f + std::exp(-margin)) < 1.0f) ? 1.0f : 0.0f;
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    dependentVariables->releaseBlockOfRows(yBlock);
+}
+
+/* Creates the tables that refer to the rows of the given part of the data set */
+void splitData(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, size_t nParts, RankTask * tasks)
+{
+    const size_t nRowsInPart = nVectors / nParts;
+    for (size_t r = 0; r < nParts; r++)
+    {
+        BlockDescriptor<> xBlock, yBlock;
+        data->getBlockOfRows(r * nRowsInPart, nRowsInPart, readOnly, xBlock);
+        dependentVariables->getBlockOfRows(r * nRowsInPart, nRowsInPart, readOnly, yBlock);
+        tasks[r].data               = HomogenNumericTable<>::create(xBlock.getBlockPtr(), nFeatures, nRowsInPart);
+        tasks[r].dependentVariables = HomogenNumericTable<>::create(yBlock.getBlockPtr(), 1, nRowsInPart);
+        data->releaseBlockOfRows(xBlock);
+        dependentVariables->releaseBlockOfRows(yBlock);
+    }
+}
+
+/* Minimizes the logistic loss function over the data sets of all ranks */
+void solve(RankTask & task)
+{
+    const size_t nRows = task.data->getNumberOfRows();
+    services::SharedPtr<optimization_solver::logistic_loss::Batch<> > function(new optimization_solver::logistic_loss::Batch<>(nRows));
+    function->input.set(optimization_solver::logistic_loss::data, task.data);
+    function->input.set(optimization_solver::logistic_loss::dependentVariables, task.dependentVariables);
+
+    NumericTablePtr initialPoint = HomogenNumericTable<>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0f);
+
+    if (task.useSgd)
+    {
+        optimization_solver::sgd::Batch<float, optimization_solver::sgd::miniBatch> algorithm(function);
+        algorithm.input.set(optimization_solver::iterative_solver::inputArgument, initialPoint);
+        algorithm.parameter.learningRateSequence = HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, learningRate);
+        algorithm.parameter.nIterations          = nSgdIterations;
+        algorithm.parameter.batchSize            = sgdBatchSize;
+        algorithm.parameter.accuracyThreshold    = accuracyThreshold;
+        algorithm.parameter.communicator         = task.communicator;
+        algorithm.compute();
+        task.minimum = algorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    }
+    else
+    {
+        /* All terms are used for the gradient and L = 1, so the step length is chosen by the line search */
+        optimization_solver::lbfgs::Batch<> algorithm(function);
+        algorithm.input.set(optimization_solver::iterative_solver::inputArgument, initialPoint);
+        algorithm.parameter.nIterations             = nIterations;
+        algorithm.parameter.accuracyThreshold       = accuracyThreshold;
+        algorithm.parameter.batchSize               = nRows;
+        algorithm.parameter.correctionPairBatchSize = nRows;
+        algorithm.parameter.L                       = 1;
+        algorithm.parameter.communicator            = task.communicator;
+        algorithm.compute();
+        task.minimum = algorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    }
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+DWORD WINAPI runRank(LPVOID task)
+{
+    solve(*static_cast<RankTask *>(task));
+    return 0;
+}
+
+/* Runs the ranks in the separate threads and waits for all of them to finish */
+void runRanks(RankTask * tasks, size_t nParts)
+{
+    HANDLE threads[nRanks];
+    for (size_t r = 0; r < nParts; r++)
+    {
+        threads[r] = CreateThread(NULL, 0, runRank, tasks + r, 0, NULL);
+    }
+    WaitForMultipleObjects(DWORD(nParts), threads, TRUE, INFINITE);
+    for (size_t r = 0; r < nParts; r++)
+    {
+        CloseHandle(threads[r]);
+    }
+}
+#else
+void * runRank(void * task)
+{
+    solve(*static_cast<RankTask *>(task));
+    return NULL;
+}
+
+/* Runs the ranks in the separate threads and waits for all of them to finish */
+void runRanks(RankTask * tasks, size_t nParts)
+{
+    pthread_t threads[nRanks];
+    for (size_t r = 0; r < nParts; r++)
+    {
+        pthread_create(&threads[r], NULL, runRank, tasks + r);
+    }
+    for (size_t r = 0; r < nParts; r++)
+    {
+        pthread_join(threads[r], NULL);
+    }
+}
+#endif
+
+/* Returns the maximal absolute difference of the solutions */
+float maxDifference(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    BlockDescriptor<> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nFeatures + 1, readOnly, firstBlock);
+    second->getBlockOfRows(0, nFeatures + 1, readOnly, secondBlock);
+    const float * a = firstBlock.getBlockPtr();
+    const float * b = secondBlock.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t j = 0; j < nFeatures + 1; j++)
+    {
+        const float d = a[j] > b[j] ? a[j] - b[j] : b[j] - a[j];
+        diff          = d > diff ? d : diff;
+    }
+
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return diff;
+}
+
+/* Solves the problem on the whole data set and on its parts, returns the solution of rank 0 and the time in seconds */
+double run(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, size_t nParts, bool useSgd, NumericTablePtr & minimum)
+{
+    daal::services::Status s;
+    services::Collection<daal::preview::services::SharedMemoryCommunicator> communicators =
+        daal::preview::services::SharedMemoryCommunicator::createGroup(nParts, &s);
+    checkStatus(s);
+
+    RankTask tasks[nRanks];
+    splitData(data, dependentVariables, nParts, tasks);
+    for (size_t r = 0; r < nParts; r++)
+    {
+        tasks[r].communicator.reset(new daal::preview::services::SharedMemoryCommunicator(communicators[r]));
+        tasks[r].useSgd = useSgd;
+    }
+
+    const double start = getWallClockSeconds();
+    if (nParts == 1)
+    {
+        solve(tasks[0]);
+    }
+    else
+    {
+        runRanks(tasks, nParts);
+    }
+    const double time = getWallClockSeconds() - start;
+
+    /* All ranks end with the same solution */
+    for (size_t r = 1; r < nParts; r++)
+    {
+        if (maxDifference(tasks[r].minimum, tasks[0].minimum) != 0.0f)
+        {
+            cout << "Solutions of rank 0 and rank " << r << " differ" << endl;
+        }
+    }
+    minimum = tasks[0].minimum;
+    return time;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data, dependentVariables;
+    generateData(data, dependentVariables);
+
+    for (int useSgd = 0; useSgd <= 1; useSgd++)
+    {
+        const char * solverName = useSgd ? "Mini-batch SGD" : "LBFGS";
+
+        NumericTablePtr singleRankMinimum, minimum;
+        const double singleRankTime = run(data, dependentVariables, 1, useSgd != 0, singleRankMinimum);
+        const double time           = run(data, dependentVariables, nRanks, useSgd != 0, minimum);
+
+        cout << solverName << ", 1 rank: " << singleRankTime << " s" << endl;
+        cout << solverName << ", " << nRanks << " ranks: " << time << " s" << endl;
+        printNumericTable(minimum, "Minimum found by all ranks:");
+        cout << "Max difference from the single-rank solution: " << maxDifference(minimum, singleRankMinimum) << endl << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/* file: pca_transform_dense_streaming.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis transformation(PCA)
+!    applied to a stream of row batches with the projection prepared once.
+!    Reports the throughput of the prepared transformation against the
+!    transformation that rebuilds the projection at each call
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_TRANSFORM_DENSE_STREAMING"></a>
+ * \example pca_transform_dense_streaming.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nFeatures    = 64;
+const size_t nComponents  = 8;
+const size_t nSampleRows  = 20000;
+const size_t nRowsInBatch = 512;
+const size_t nBatches     = 500;
+
+/* Fills the rows of the table with correlated synthetic features */
+void fillBatch(NumericTablePtr table, size_t firstRow)
+{
+    BlockDescriptor<float> block;
+    const size_t nRows = table->getNumberOfRows();
+    table->getBlockOfRows(0, nRows, writeOnly, block);
+    float * rows = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float t = float(firstRow + i);
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            rows[i * nFeatures + j] = std::sin(0.01f * t * float(j % 7 + 1)) + 0.1f * std::cos(0.37f * t + float(j));
+        }
+    }
+    table->releaseBlockOfRows(block);
+}
+
+double transformStream(pca::transform::Batch<float> & pcaTransform, NumericTablePtr batch)
+{
+    const double start = getWallClockSeconds();
+    for (size_t iBatch = 0; iBatch < nBatches; ++iBatch)
+    {
+        fillBatch(batch, nSampleRows + iBatch * nRowsInBatch);
+        pcaTransform.input.set(pca::transform::data, batch);
+        pcaTransform.compute();
+    }
+    return double(nBatches * nRowsInBatch) / (getWallClockSeconds() - start);
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr sample = HomogenNumericTable<float>::create(nFeatures, nSampleRows, NumericTable::doAllocate);
+    fillBatch(sample, 0);
+
+    /* Fit the PCA on the sample using the correlation method */
+    pca::Batch<float, pca::correlationDense> pcaAlgorithm;
+    pcaAlgorithm.input.set(pca::data, sample);
+    pcaAlgorithm.parameter.resultsToCompute = pca::mean | pca::variance | pca::eigenvalue;
+    pcaAlgorithm.compute();
+
+    pca::ResultPtr pcaResult = pcaAlgorithm.getResult();
+
+    NumericTablePtr batch = HomogenNumericTable<float>::create(nFeatures, nRowsInBatch, NumericTable::doAllocate);
+
+    /* Transformation that builds the projection at each call */
+    pca::transform::Batch<float> pcaTransform(nComponents);
+    pcaTransform.input.set(pca::transform::eigenvectors, pcaResult->get(pca::eigenvectors));
+    pcaTransform.input.set(pca::transform::dataForTransform, pcaResult->get(pca::dataForTransform));
+
+    const double rowsPerSecond = transformStream(pcaTransform, batch);
+
+    /* Transformation that keeps the projection between the calls and writes to a preallocated result */
+    pca::transform::Batch<float> preparedTransform(nComponents);
+    preparedTransform.input.set(pca::transform::eigenvectors, pcaResult->get(pca::eigenvectors));
+    preparedTransform.input.set(pca::transform::dataForTransform, pcaResult->get(pca::dataForTransform));
+
+    pca::transform::ResultPtr preparedResult(new pca::transform::Result());
+    preparedResult->set(pca::transform::transformedData,
+                        HomogenNumericTable<float>::create(nComponents, nRowsInBatch, NumericTable::doAllocate));
+    preparedTransform.setResult(preparedResult);
+    preparedTransform.enableResetOnCompute(false);
+    preparedTransform.enableChecks(false);
+
+    const double preparedRowsPerSecond = transformStream(preparedTransform, batch);
+    preparedTransform.resetCompute();
+
+    printNumericTable(pcaTransform.getResult()->get(pca::transform::transformedData), "Transformed data:", 5);
+    printNumericTable(preparedResult->get(pca::transform::transformedData), "Transformed data with the prepared projection:", 5);
+
+    std::cout << "Rows per second, projection built at each call: " << rowsPerSecond << std::endl;
+    std::cout << "Rows per second, prepared projection:           " << preparedRowsPerSecond << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/* file: ridge_reg_norm_eq_cv_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of ridge regression in the batch processing mode.
+!
+!    The program selects the ridge parameters from the set of candidate
+!    values by the k-fold cross-validation and trains the ridge regression
+!    model with the selected parameters in one call.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-RIDGE_REGRESSION_NORM_EQ_CV_BATCH"></a>
+ * \example ridge_reg_norm_eq_cv_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::ridge_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training data set */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+/* Cross-validation parameters */
+const size_t nRidgeParameters = 7;     /* Number of candidate ridge parameters */
+const float minRidgeParameter = 0.01f; /* The smallest candidate ridge parameter */
+const size_t nFolds           = 5;     /* Number of folds */
+
+const float tolerance = 1e-3f; /* Relative tolerance of the comparison with the model trained for the selected ridge parameters */
+
+/* Checks that the coefficients of the models differ by at most tolerance relative to the largest coefficient */
+bool areClose(const NumericTablePtr & beta, const NumericTablePtr & referenceBeta)
+{
+    const size_t nRows = beta->getNumberOfRows();
+    const size_t nCols = beta->getNumberOfColumns();
+
+    BlockDescriptor<> block, referenceBlock;
+    beta->getBlockOfRows(0, nRows, readOnly, block);
+    referenceBeta->getBlockOfRows(0, nRows, readOnly, referenceBlock);
+    const float * b  = block.getBlockPtr();
+    const float * rb = referenceBlock.getBlockPtr();
+
+    float maxDiff = 0.0f, maxBeta = 0.0f;
+    for (size_t i = 0; i < nRows * nCols; ++i)
+    {
+        const float diff    = b[i] > rb[i] ? b[i] - rb[i] : rb[i] - b[i];
+        const float absBeta = rb[i] > 0.0f ? rb[i] : -rb[i];
+        maxDiff             = diff > maxDiff ? diff : maxDiff;
+        maxBeta             = absBeta > maxBeta ? absBeta : maxBeta;
+    }
+
+    beta->releaseBlockOfRows(block);
+    referenceBeta->releaseBlockOfRows(referenceBlock);
+    return maxDiff <= tolerance * (maxBeta > 1.0f ? maxBeta : 1.0f);
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(HomogenNumericTable<>::create(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(MergedNumericTable::create(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create the candidate ridge parameters, the same candidates for all dependent variables */
+    NumericTablePtr ridgeParametersGrid(HomogenNumericTable<>::create(1, nRidgeParameters, NumericTable::doAllocate));
+    BlockDescriptor<> block;
+    ridgeParametersGrid->getBlockOfRows(0, nRidgeParameters, writeOnly, block);
+    float * ridgeParameters = block.getBlockPtr();
+    ridgeParameters[0]      = minRidgeParameter;
+    for (size_t i = 1; i < nRidgeParameters; ++i)
+    {
+        ridgeParameters[i] = ridgeParameters[i - 1] * 10.0f;
+    }
+    ridgeParametersGrid->releaseBlockOfRows(block);
+
+    /* Create an algorithm object to train the ridge regression model with the normal equations method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    algorithm.parameter.ridgeParametersGrid = ridgeParametersGrid;
+    algorithm.parameter.nFolds              = nFolds;
+
+    /* Select the ridge parameters and build the ridge regression model */
+    checkStatus(algorithm.compute());
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    printNumericTable(ridgeParametersGrid, "Candidate ridge parameters:");
+    printNumericTable(trainingResult->get(training::crossValidationErrors), "Cross-validation mean squared errors:");
+    printNumericTable(trainingResult->get(training::bestRidgeParameters), "Selected ridge parameters:");
+    printNumericTable(trainingResult->get(training::model)->getBeta(), "Ridge Regression coefficients:");
+
+    /* Train the model for the selected ridge parameters alone, it must match the model built after the cross-validation */
+    training::Batch<> referenceAlgorithm;
+    referenceAlgorithm.input.set(training::data, trainData);
+    referenceAlgorithm.input.set(training::dependentVariables, trainDependentVariables);
+    referenceAlgorithm.parameter.ridgeParameters = trainingResult->get(training::bestRidgeParameters);
+    checkStatus(referenceAlgorithm.compute());
+
+    if (!areClose(trainingResult->get(training::model)->getBeta(), referenceAlgorithm.getResult()->get(training::model)->getBeta()))
+    {
+        cout << "The model differs from the one trained for the selected ridge parameters" << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+/* file: serialization_mapped.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the model load from a file mapped to memory.
+!    The arrays of the model are stored in the archive at the page-aligned
+!    positions, so the restored model refers to the mapped file instead of
+!    copying the data. Reports the load time of the model read to memory
+!    against the load time of the model mapped to memory
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SERIALIZATION_MAPPED"></a>
+ * \example serialization_mapped.cpp
+ */
+
+#include <fstream>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13;
+
+/* Files with the serialized model */
+const string modelFileName        = "df_reg_model.bin";
+const string alignedModelFileName = "df_reg_model_aligned.bin";
+
+/* Decision forest parameters */
+const size_t nTrees = 300;
+
+/* Alignment of the arrays in the archive, a multiple of the page size */
+const size_t arrayAlignment = 4096;
+
+training::ResultPtr trainModel();
+void saveModel(training::ResultPtr & trainingResult, InputDataArchive & dataArch, const string & fileName);
+training::ResultPtr loadModel(double & seconds);
+training::ResultPtr loadMappedModel(double & seconds);
+NumericTablePtr predict(const training::ResultPtr & trainingResult);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+
+    /* Save the model in the default format and with the arrays aligned to the page size */
+    InputDataArchive dataArch;
+    saveModel(trainingResult, dataArch, modelFileName);
+    AlignedInputDataArchive alignedDataArch(arrayAlignment);
+    if (alignedDataArch.getErrors()->size() != 0)
+    {
+        std::cout << alignedDataArch.getErrors()->getDescription() << std::endl;
+        return -1;
+    }
+    saveModel(trainingResult, alignedDataArch, alignedModelFileName);
+
+    double loadSeconds = 0.0, mappedLoadSeconds = 0.0;
+    training::ResultPtr restoredResult = loadModel(loadSeconds);
+    training::ResultPtr mappedResult   = loadMappedModel(mappedLoadSeconds);
+
+    printNumericTable(predict(restoredResult), "Prediction of the model read to memory (first 10 rows):", 10);
+    printNumericTable(predict(mappedResult), "Prediction of the model mapped to memory (first 10 rows):", 10);
+
+    std::cout << "Model load time, read to memory, ms:   " << loadSeconds * 1000.0 << std::endl;
+    std::cout << "Model load time, mapped to memory, ms: " << mappedLoadSeconds * 1000.0 << std::endl;
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    training::Batch<> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+    algorithm.parameter().nTrees = nTrees;
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+void saveModel(training::ResultPtr & trainingResult, InputDataArchive & dataArch, const string & fileName)
+{
+    trainingResult->serialize(dataArch);
+
+    const size_t length = dataArch.getSizeOfArchive();
+    daal::byte * buffer = new daal::byte[length];
+    dataArch.copyArchiveToArray(buffer, length);
+
+    std::ofstream file(fileName.c_str(), std::ios::binary);
+    if (!file.is_open())
+    {
+        fileOpenError(fileName.c_str());
+    }
+    file.write((const char *)buffer, length);
+    delete[] buffer;
+}
+
+training::ResultPtr loadModel(double & seconds)
+{
+    const double start = getWallClockSeconds();
+
+    /* The whole file is read to memory and the arrays of the model are copied from it */
+    daal::byte * buffer = NULL;
+    const size_t length = readTextFile(modelFileName, &buffer);
+    OutputDataArchive dataArch(buffer, length);
+    training::ResultPtr restoredResult(new training::Result());
+    restoredResult->deserialize(dataArch);
+    delete[] buffer;
+
+    seconds = getWallClockSeconds() - start;
+    return restoredResult;
+}
+
+training::ResultPtr loadMappedModel(double & seconds)
+{
+    const double start = getWallClockSeconds();
+
+    /* The file is mapped to memory, the arrays of the model refer to the mapping and are loaded on the first access */
+    AlignedOutputDataArchive dataArch(alignedModelFileName.c_str());
+    training::ResultPtr restoredResult(new training::Result());
+    restoredResult->deserialize(dataArch);
+
+    seconds = getWallClockSeconds() - start;
+    return restoredResult;
+}
+
+NumericTablePtr predict(const training::ResultPtr & trainingResult)
+{
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    prediction::Batch<> algorithm;
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    dataSource.loadDataBlock(mergedData.get());
+}
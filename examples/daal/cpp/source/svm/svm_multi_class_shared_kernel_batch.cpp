@@ -0,0 +1,195 @@
+/* file: svm_multi_class_shared_kernel_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multi-class support vector machine (SVM) classification with
+!    the kernel function values shared by the two-class classifiers.
+!    Reports the training time and the number of the kernel function
+!    computations with and without the shared cache and checks that both
+!    models give the same predictions
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVM_MULTI_CLASS_SHARED_KERNEL_BATCH"></a>
+ * \example svm_multi_class_shared_kernel_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nClasses        = 20;
+const size_t nFeatures       = 16;
+const size_t nVectorsInClass = 300;
+const size_t nVectors        = nClasses * nVectorsInClass;
+const size_t sharedCacheSize = 16000000;
+
+/* Fills the tables with the observations of the Gaussian clusters, one cluster per class */
+void createData(NumericTablePtr & data, NumericTablePtr & labels)
+{
+    data   = HomogenNumericTable<float>::create(nFeatures, nVectors, NumericTable::doAllocate);
+    labels = HomogenNumericTable<float>::create(1, nVectors, NumericTable::doAllocate);
+
+    BlockDescriptor<float> dataBlock, labelsBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, dataBlock);
+    labels->getBlockOfRows(0, nVectors, writeOnly, labelsBlock);
+    float * x = dataBlock.getBlockPtr();
+    float * y = labelsBlock.getBlockPtr();
+
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        const size_t label = i % nClasses;
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            /* Sum of the uniform numbers is close to the normally distributed one */
+            float noise = 0;
+            for (size_t r = 0; r < 4; ++r)
+            {
+                state = state * 1103515245u + 12345u;
+                noise += float((state >> 8) & 0xFFFF) / float(0xFFFF) - 0.5f;
+            }
+            x[i * nFeatures + j] = float((label >> (j % 5)) & 1) * 2.0f + float((label + j) % 3) + noise;
+        }
+        y[i] = float(label);
+    }
+    data->releaseBlockOfRows(dataBlock);
+    labels->releaseBlockOfRows(labelsBlock);
+}
+
+/* Numbers of the kernel function computations in each mode */
+struct KernelCounters
+{
+    services::Atomic<int> nMatrixMatrix; /* Blocks of the kernel matrix */
+    services::Atomic<int> nMatrixVector; /* Rows of the kernel matrix */
+    services::Atomic<int> nVectorVector; /* Single values of the kernel matrix */
+};
+
+/* Radial basis kernel function that counts its computations, the copies made by the algorithms share the counters */
+class CountingKernel : public kernel_function::rbf::Batch<>
+{
+public:
+    CountingKernel(KernelCounters * counters) : _counters(counters) {}
+    CountingKernel(const CountingKernel & other) : kernel_function::rbf::Batch<>(other), _counters(other._counters) {}
+
+    /* Called by the library before each computation of the kernel function */
+    services::Status checkComputeParams() DAAL_C11_OVERRIDE
+    {
+        switch (parameter.computationMode)
+        {
+        case kernel_function::matrixMatrix: _counters->nMatrixMatrix.inc(); break;
+        case kernel_function::matrixVector: _counters->nMatrixVector.inc(); break;
+        case kernel_function::vectorVector: _counters->nVectorVector.inc(); break;
+        }
+        return kernel_function::rbf::Batch<>::checkComputeParams();
+    }
+
+protected:
+    CountingKernel * cloneImpl() const DAAL_C11_OVERRIDE { return new CountingKernel(*this); }
+
+private:
+    KernelCounters * _counters;
+};
+
+multi_class_classifier::ModelPtr trainModel(NumericTablePtr data, NumericTablePtr labels, size_t cacheSize, KernelCounters & counters,
+                                            double & seconds)
+{
+    services::SharedPtr<svm::training::Batch<> > training(new svm::training::Batch<>());
+    training->parameter.kernel = kernel_function::KernelIfacePtr(new CountingKernel(&counters));
+
+    multi_class_classifier::training::Batch<> algorithm(nClasses);
+    algorithm.parameter.training        = training;
+    algorithm.parameter.sharedCacheSize = cacheSize;
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+
+    const double start = getWallClockSeconds();
+    checkStatus(algorithm.compute());
+    seconds = getWallClockSeconds() - start;
+
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+NumericTablePtr testModel(multi_class_classifier::ModelPtr model, NumericTablePtr data)
+{
+    services::SharedPtr<svm::prediction::Batch<> > prediction(new svm::prediction::Batch<>());
+    prediction->parameter.kernel = kernel_function::KernelIfacePtr(new kernel_function::rbf::Batch<>());
+
+    multi_class_classifier::prediction::Batch<> algorithm(nClasses);
+    algorithm.parameter.prediction = prediction;
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, model);
+    checkStatus(algorithm.compute());
+
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+size_t countEqual(NumericTablePtr a, NumericTablePtr b)
+{
+    BlockDescriptor<float> aBlock, bBlock;
+    a->getBlockOfRows(0, nVectors, readOnly, aBlock);
+    b->getBlockOfRows(0, nVectors, readOnly, bBlock);
+    size_t nEqual = 0;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        if (aBlock.getBlockPtr()[i] == bBlock.getBlockPtr()[i]) ++nEqual;
+    }
+    a->releaseBlockOfRows(aBlock);
+    b->releaseBlockOfRows(bBlock);
+    return nEqual;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data, labels;
+    createData(data, labels);
+
+    double copySeconds, sharedSeconds;
+    KernelCounters copyCounters, sharedCounters;
+    multi_class_classifier::ModelPtr copyModel   = trainModel(data, labels, 0, copyCounters, copySeconds);
+    multi_class_classifier::ModelPtr sharedModel = trainModel(data, labels, sharedCacheSize, sharedCounters, sharedSeconds);
+
+    NumericTablePtr copyPrediction   = testModel(copyModel, data);
+    NumericTablePtr sharedPrediction = testModel(sharedModel, data);
+
+    std::cout << "Training time, data copies:              " << copySeconds << std::endl;
+    std::cout << "Training time, shared cache:             " << sharedSeconds << std::endl;
+    std::cout << "Kernel blocks, data copies:              " << copyCounters.nMatrixMatrix.get() << std::endl;
+    std::cout << "Kernel blocks, shared cache:             " << sharedCounters.nMatrixMatrix.get() << std::endl;
+    std::cout << "Kernel rows, data copies:                " << copyCounters.nMatrixVector.get() << std::endl;
+    std::cout << "Kernel rows, shared cache:               " << sharedCounters.nMatrixVector.get() << std::endl;
+    std::cout << "Kernel values, data copies:              " << copyCounters.nVectorVector.get() << std::endl;
+    std::cout << "Kernel values, shared cache:             " << sharedCounters.nVectorVector.get() << std::endl;
+    std::cout << "Correct predictions, shared cache:       " << countEqual(sharedPrediction, labels) << " of " << nVectors << std::endl;
+
+    /* The two-class classifiers solve the same problems in both modes */
+    const size_t nEqual = countEqual(copyPrediction, sharedPrediction);
+    if (nEqual != nVectors)
+    {
+        std::cout << "Predictions of the models trained with and without the shared cache differ: " << nVectors - nEqual << " of " << nVectors
+                  << std::endl;
+        exit(-1);
+    }
+
+    return 0;
+}
@@ -35,6 +35,13 @@
 #include <vector>
 #include <queue>
 
+/* The examples are also built in the C++03 mode where <chrono> is not available */
+#if __cplusplus >= 201103L || defined(_MSC_VER)
+    #include <chrono>
+#else
+    #include <sys/time.h>
+#endif
+
 #include "error_handling.h"
 
 /* Link sequential verison for Intel DAAL for dynamic version on Windows */
@@ -716,6 +723,18 @@ void checkArguments(int argc, char * argv[], int count, ...)
     delete[] filelist;
 }
 
+/* Returns the wall clock time in seconds, used to measure the throughput in the examples */
+double getWallClockSeconds()
+{
+#if __cplusplus >= 201103L || defined(_MSC_VER)
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    timeval tv;
+    gettimeofday(&tv, NULL);
+    return double(tv.tv_sec) + double(tv.tv_usec) * 1e-6;
+#endif
+}
+
 void copyBytes(daal::byte * dst, daal::byte * src, size_t size)
 {
     for (size_t i = 0; i < size; i++)
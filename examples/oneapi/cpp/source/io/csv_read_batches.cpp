@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <iostream>
+
+#include "daal.h"
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "example_util/utils.hpp"
+
+using namespace oneapi;
+namespace daal_dm = daal::data_management;
+namespace daal_lom = daal::algorithms::low_order_moments;
+
+int main(int argc, char const *argv[]) {
+    const std::string data_file_name = get_data_path("kmeans_dense_train_data.csv");
+    constexpr std::int64_t batch_row_count = 1000;
+
+    /// The next batch is parsed in the background while the moments
+    /// of the current batch are computed
+    dal::csv::batch_reader reader(dal::csv::data_source{ data_file_name }, batch_row_count);
+
+    daal_lom::Online<float> moments;
+    while (reader.has_next()) {
+        const auto batch = reader.next();
+        auto rows = dal::row_accessor<const float>(batch).pull();
+
+        const auto daal_batch = daal_dm::HomogenNumericTable<float>::create(
+            const_cast<float *>(rows.get_data()),
+            batch.get_column_count(),
+            batch.get_row_count());
+
+        moments.input.set(daal_lom::data, daal_batch);
+        moments.compute();
+    }
+    moments.finalizeCompute();
+
+    const auto result = moments.getResult();
+    daal_dm::BlockDescriptor<float> block;
+    result->get(daal_lom::mean)->getBlockOfRows(0, 1, daal_dm::readOnly, block);
+
+    std::cout << "Means of " << reader.get_column_count() << " columns:" << std::endl;
+    for (std::int64_t i = 0; i < reader.get_column_count(); i++) {
+        std::cout << block.getBlockPtr()[i] << " ";
+    }
+    std::cout << std::endl;
+    result->get(daal_lom::mean)->releaseBlockOfRows(block);
+
+    return 0;
+}
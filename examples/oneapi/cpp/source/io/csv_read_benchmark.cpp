@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "daal.h"
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "example_util/utils.hpp"
+
+using namespace oneapi;
+namespace daal_dm = daal::data_management;
+
+/// Compares the throughput of dal::read on a CSV file with the throughput
+/// of DAAL FileDataSource<CSVFeatureManager> on the same file.
+/// Usage: csv_read_benchmark [row_count] [column_count]
+int main(int argc, char const *argv[]) {
+    const std::int64_t row_count = (argc > 1) ? std::stoll(argv[1]) : 200000;
+    const std::int64_t column_count = (argc > 2) ? std::stoll(argv[2]) : 16;
+    const std::string file_name = "csv_read_benchmark.csv";
+
+    {
+        std::ofstream file(file_name);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                file << std::sin(0.001 * double(i) * double(j + 1)) * 100.0
+                     << (j + 1 < column_count ? "," : "\n");
+            }
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const auto data = dal::read<dal::table>(dal::csv::data_source{ file_name });
+    const std::chrono::duration<double> dal_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    daal_dm::FileDataSource<daal_dm::CSVFeatureManager> data_source(
+        file_name,
+        daal_dm::DataSource::doAllocateNumericTable,
+        daal_dm::DataSource::doDictionaryFromContext);
+    data_source.loadDataBlock();
+    const std::chrono::duration<double> daal_time = std::chrono::steady_clock::now() - start;
+
+    const auto daal_table = data_source.getNumericTable();
+    daal_dm::BlockDescriptor<float> block;
+    daal_table->getBlockOfRows(0, daal_table->getNumberOfRows(), daal_dm::readOnly, block);
+    const float *daal_values = block.getBlockPtr();
+    const auto dal_values = dal::row_accessor<const float>(data).pull();
+
+    double max_diff = 0.0;
+    for (std::int64_t i = 0; i < dal_values.get_count(); i++) {
+        max_diff = std::max(max_diff, std::abs(double(dal_values[i]) - double(daal_values[i])));
+    }
+    daal_table->releaseBlockOfRows(block);
+    std::remove(file_name.c_str());
+
+    std::cout << "Rows x columns: " << data.get_row_count() << " x " << data.get_column_count()
+              << std::endl;
+    std::cout << "DAAL CSV data source, s: " << daal_time.count() << std::endl;
+    std::cout << "dal::read,            s: " << dal_time.count() << std::endl;
+    std::cout << "Speedup: " << daal_time.count() / dal_time.count() << std::endl;
+    std::cout << "Max difference of the values: " << max_diff << std::endl;
+
+    return 0;
+}
@@ -33,7 +33,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_ridge_1regression_TrainPar
                                                                                                            jlong parAddr, jlong cRidgeParameters)
 {
     SerializationIfacePtr * const ntShPtr                          = (SerializationIfacePtr *)cRidgeParameters;
-    ((ridge_regression::TrainParameter *)parAddr)->ridgeParameters = staticPointerCast<NumericTable, SerializationIface>(*ntShPtr);
+    ((ridge_regression::interface1::TrainParameter *)parAddr)->ridgeParameters = staticPointerCast<NumericTable, SerializationIface>(*ntShPtr);
 }
 
 /*
@@ -45,6 +45,6 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_ridge_1regression_TrainPa
                                                                                                             jlong parAddr)
 {
     NumericTablePtr * const ntShPtr = new NumericTablePtr();
-    *ntShPtr                        = ((ridge_regression::TrainParameter *)parAddr)->ridgeParameters;
+    *ntShPtr                        = ((ridge_regression::interface1::TrainParameter *)parAddr)->ridgeParameters;
     return (jlong)ntShPtr;
 }